@@ -24,6 +24,8 @@ public:
     // Layer handlers
     // ----------------------------------------
     void OnUpdate(pixc::Timestep ts) override;
+    void OnSimulate(pixc::Timestep ts, pixc::FramePacket& packet) override;
+    void OnRender(const pixc::FramePacket& packet) override;
     
 private:
     // Initialization
@@ -113,3 +113,29 @@ void DepthSample::OnUpdate(pixc::Timestep ts)
     auto material = pixc::Renderer::GetMaterialLibrary().Get("LinearDepth");
     m_Scene.GetViewport()->RenderToFrameBuffer(nullptr, material);
 }
+
+/**
+ * @brief Capture the scene (main thread).
+ *
+ * @param ts Times passed since the last update.
+ * @param packet Packet of the frame.
+ */
+void DepthSample::OnSimulate(pixc::Timestep ts, pixc::FramePacket& packet)
+{
+    m_Scene.Capture(packet.Scenes[&m_Scene]);
+}
+
+/**
+ * @brief Draw the scene captured by the simulation (render thread).
+ *
+ * @param packet Packet of the frame.
+ */
+void DepthSample::OnRender(const pixc::FramePacket& packet)
+{
+    pixc::Renderer::ResetStats();
+    
+    m_Scene.Draw(packet.Scenes.at(&m_Scene));
+    
+    auto material = pixc::Renderer::GetMaterialLibrary().Get("LinearDepth");
+    m_Scene.GetViewport()->RenderToFrameBuffer(nullptr, material);
+}
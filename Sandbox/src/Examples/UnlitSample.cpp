@@ -87,3 +87,30 @@ void UnlitSample::OnUpdate(pixc::Timestep ts)
     // Update the camera state (e.g., input handling, matrices) using the timestep
     m_Scene.GetCamera()->OnUpdate(ts);
 }
+
+/**
+ * @brief Simulate the rendering layer and capture the scene (main thread).
+ *
+ * @param ts Times passed since the last update.
+ * @param packet Packet of the frame.
+ */
+void UnlitSample::OnSimulate(pixc::Timestep ts, pixc::FramePacket& packet)
+{
+    // Update the camera state (e.g., input handling, matrices) using the timestep
+    m_Scene.GetCamera()->OnUpdate(ts);
+    
+    // Capture the scene as seen from the updated camera
+    m_Scene.Capture(packet.Scenes[&m_Scene]);
+}
+
+/**
+ * @brief Draw the scene captured by the simulation (render thread).
+ *
+ * @param packet Packet of the frame.
+ */
+void UnlitSample::OnRender(const pixc::FramePacket& packet)
+{
+    pixc::Renderer::ResetStats();
+    
+    m_Scene.Draw(packet.Scenes.at(&m_Scene));
+}
@@ -0,0 +1,113 @@
+#include <pixc.h>
+
+#include <stb_image.h>
+
+///< Size of the rendered image (pixels).
+static constexpr uint32_t s_Size = 64;
+///< Largest difference accepted per channel (8-bit values).
+static constexpr int s_Tolerance = 2;
+
+/**
+ * @brief Render an unlit plane with the software rasterizer into the screen buffer of a scene.
+ *
+ * The plane spans half of the view of an orthographic camera, so it covers the pixels in the
+ * middle of the image, over the clear color.
+ *
+ * @param output The file the rendered image is saved to.
+ */
+static void RenderUnlitPlane(const std::filesystem::path& output)
+{
+    pixc::Renderer::GetMaterialLibrary().Create<pixc::UnlitMaterial>("Unlit");
+
+    pixc::Scene scene(s_Size, s_Size);
+    auto camera = std::make_shared<pixc::OrthographicCamera>(s_Size, s_Size);
+    camera->SetPosition(glm::vec3(0.0f, 0.0f, 5.0f));
+    scene.SetCamera(camera);
+
+    auto plane = pixc::utils::geometry::ModelPlane<pixc::GeoVertexData<glm::vec4, glm::vec2>>();
+    scene.GetModels().Add("Plane", plane);
+
+    pixc::RenderPassSpecification spec;
+    spec.Target.FrameBuffer = scene.GetFrameBuffers().Get("ScreenBuffer");
+    spec.Target.ClearColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    spec.Target.ClearTargets = pixc::RenderTargetMask::Color | pixc::RenderTargetMask::Depth;
+    spec.Render.Camera = camera;
+    spec.Render.Models = {
+        { "Plane", "Unlit", nullptr,
+            [](const std::shared_ptr<pixc::Material>& material)
+            {
+                if (auto unlit = std::dynamic_pointer_cast<pixc::UnlitMaterial>(material))
+                    unlit->SetColor(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+            }
+        }
+    };
+    scene.GetRenderPasses().Add("Scene", spec);
+
+    scene.Draw();
+    scene.GetFrameBuffers().Get("ScreenBuffer")->SaveAttachment(0, output);
+}
+
+/**
+ * @brief Compare a rendered image with a reference image.
+ *
+ * @param image The rendered image file.
+ * @param reference The reference image file.
+ *
+ * @return `true` if both images have the same size and all their channels are within the tolerance.
+ */
+static bool CompareImages(const std::filesystem::path& image, const std::filesystem::path& reference)
+{
+    int width, height, channels, referenceWidth, referenceHeight;
+    stbi_uc* pixels = stbi_load(image.string().c_str(), &width, &height, &channels, 4);
+    stbi_uc* expected = stbi_load(reference.string().c_str(), &referenceWidth, &referenceHeight,
+                                  &channels, 4);
+
+    bool match = pixels && expected && width == referenceWidth && height == referenceHeight;
+    if (!match)
+        PIXEL_CORE_ERROR("Could not compare {0} with {1}", image.string(), reference.string());
+
+    uint32_t mismatches = 0;
+    for (int i = 0; match && i < width * height * 4; i++)
+        mismatches += std::abs(pixels[i] - expected[i]) > s_Tolerance ? 1 : 0;
+    if (mismatches > 0)
+    {
+        PIXEL_CORE_ERROR("{0} channel(s) differ from the reference image", mismatches);
+        match = false;
+    }
+
+    stbi_image_free(pixels);
+    stbi_image_free(expected);
+    return match;
+}
+
+/**
+ * @brief Entry point of the software rasterizer test.
+ *
+ * Renders a scene with the software rasterizer (hidden window, no graphics context) and compares
+ * the result with its reference image.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments: the reference image and the file the rendered image is saved to.
+ *
+ * @return 0 if the rendered image matches the reference.
+ */
+int main(int argc, char** argv)
+{
+    pixc::Log::Init();
+
+    if (argc < 3)
+    {
+        PIXEL_CORE_ERROR("Usage: SoftwareRenderTest <reference> <output>");
+        return 1;
+    }
+    std::filesystem::path reference = argv[1], output = argv[2];
+
+    {
+        pixc::Window window("SoftwareRenderTest", s_Size, s_Size, false);
+        pixc::Renderer::Init();
+        RenderUnlitPlane(output);
+        pixc::Renderer::Shutdown();
+    }
+
+    return CompareImages(output, reference) ? 0 : 1;
+}
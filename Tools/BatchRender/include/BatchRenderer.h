@@ -0,0 +1,97 @@
+#pragma once
+
+#include <pixc.h>
+
+#include <optional>
+
+/**
+ * @brief Represents a camera pose to be rendered.
+ */
+struct CameraPose
+{
+    glm::vec3 Position = glm::vec3(0.0f);       ///< Camera position.
+    glm::vec3 Rotation = glm::vec3(0.0f);       ///< Camera rotation (pitch, yaw, roll) in degrees.
+    std::optional<float> FieldOfView;           ///< Vertical field of view in degrees (optional).
+};
+
+/**
+ * @brief Describes a batch of views to be rendered.
+ */
+struct BatchSpecification
+{
+    ///< Scene file (binary scene description).
+    std::filesystem::path ScenePath;
+    ///< Camera poses file (one pose per line).
+    std::filesystem::path PosesPath;
+    ///< Directory where the images are written.
+    std::filesystem::path OutputDirectory = "output";
+    ///< Image format (file extension: png, jpg or hdr).
+    std::string Format = "png";
+
+    ///< Size of the rendered images.
+    uint32_t Width = 1024;
+    uint32_t Height = 1024;
+
+    ///< Framebuffer (and color attachment) saved for each view.
+    std::string Target = "ScreenBuffer";
+    uint32_t Attachment = 0;
+
+    ///< Number of worker processes sharing the views.
+    uint32_t ShardCount = 1;
+    ///< Shard rendered by this process (all the shards are launched if not defined).
+    std::optional<uint32_t> ShardIndex;
+};
+
+/**
+ * @brief Renders a scene from a list of camera poses into images, without displaying a window.
+ *
+ * The `BatchRenderer` class loads a scene description, renders it once per camera pose into a
+ * hidden window, and writes the images through the asynchronous capture pipeline. The views can
+ * be shared among several worker processes (shards), each of them with its own rendering context.
+ *
+ * The camera poses file contains one pose per line: `x y z pitch yaw roll [fov]`. Empty lines and
+ * lines starting with `#` are ignored.
+ *
+ * Copying or moving `BatchRenderer` objects is disabled to ensure single ownership.
+ */
+class BatchRenderer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Create a batch renderer.
+    /// @param spec The batch specification.
+    BatchRenderer(const BatchSpecification& spec) : m_Spec(spec) {}
+    /// @brief Delete the batch renderer.
+    ~BatchRenderer() = default;
+
+    // Run
+    // ----------------------------------------
+    int Run(const std::filesystem::path& executable);
+
+    // Arguments
+    // ----------------------------------------
+    static std::optional<BatchSpecification> ParseArguments(int argc, char** argv);
+    static void PrintUsage();
+
+private:
+    // Poses
+    // ----------------------------------------
+    static std::vector<CameraPose> LoadPoses(const std::filesystem::path& filePath);
+
+    // Render
+    // ----------------------------------------
+    int LaunchShards(const std::filesystem::path& executable, size_t viewCount);
+    int RenderShard(const std::vector<CameraPose>& poses);
+
+    // Batch renderer variables
+    // ----------------------------------------
+private:
+    ///< Batch specification.
+    BatchSpecification m_Spec;
+
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(BatchRenderer);
+};
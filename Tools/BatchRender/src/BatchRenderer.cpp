@@ -0,0 +1,361 @@
+#include "BatchRenderer.h"
+
+#include <future>
+#include <iomanip>
+
+/**
+ * @brief Quote an argument of a command line.
+ *
+ * @param argument The argument.
+ *
+ * @return The quoted argument.
+ */
+static std::string Quote(const std::string& argument)
+{
+    return "\"" + argument + "\"";
+}
+
+/**
+ * @brief Parse the integer value of an option.
+ *
+ * @param value The value.
+ * @param result The integer parsed.
+ *
+ * @return `true` if the value is a valid non-negative integer.
+ */
+static bool ParseInteger(const std::string& value, uint32_t& result)
+{
+    if (value.empty() || !std::isdigit(static_cast<unsigned char>(value[0])))
+        return false;
+
+    try
+    {
+        size_t end = 0;
+        unsigned long parsed = std::stoul(value, &end);
+        if (end != value.size() || parsed > std::numeric_limits<uint32_t>::max())
+            return false;
+        result = static_cast<uint32_t>(parsed);
+        return true;
+    }
+    catch (const std::invalid_argument&)
+    {
+        return false;
+    }
+    catch (const std::out_of_range&)
+    {
+        return false;
+    }
+}
+
+/**
+ * @brief Get the name of the image of a view.
+ *
+ * @param index The index of the view.
+ * @param format The image format (extension).
+ *
+ * @return The image file name.
+ */
+static std::string GetImageName(size_t index, const std::string& format)
+{
+    std::ostringstream name;
+    name << "view_" << std::setw(6) << std::setfill('0') << index << "." << format;
+    return name.str();
+}
+
+/**
+ * @brief Initializes the renderer, and shuts it down (with all its services) when leaving the
+ * scope, on every return path and before the rendering context (window) is destroyed.
+ */
+struct RendererScope
+{
+    RendererScope() { pixc::Renderer::Init(); }
+    ~RendererScope() { pixc::Renderer::Shutdown(); }
+};
+
+/**
+ * @brief Render the batch of views.
+ *
+ * @param executable Path to this executable (used to launch the worker processes).
+ *
+ * @return The exit code (0 if all the views have been rendered).
+ */
+int BatchRenderer::Run(const std::filesystem::path& executable)
+{
+    auto poses = LoadPoses(m_Spec.PosesPath);
+    if (poses.empty())
+    {
+        PIXEL_CORE_ERROR("No camera pose defined in {0}", m_Spec.PosesPath.string());
+        return 1;
+    }
+
+    // Share the views among several processes, or render them here
+    if (m_Spec.ShardCount > 1 && !m_Spec.ShardIndex.has_value())
+        return LaunchShards(executable, poses.size());
+    return RenderShard(poses);
+}
+
+/**
+ * @brief Launch the worker processes (one per shard) and wait for them to complete.
+ *
+ * @param executable Path to this executable.
+ * @param viewCount The total number of views.
+ *
+ * @return The exit code (0 if all the processes succeeded).
+ */
+int BatchRenderer::LaunchShards(const std::filesystem::path& executable, size_t viewCount)
+{
+    pixc::Timer timer;
+
+    std::vector<std::future<int>> processes;
+    for (uint32_t shard = 0; shard < m_Spec.ShardCount; shard++)
+    {
+        std::string command = Quote(executable.string()) +
+            " --scene " + Quote(m_Spec.ScenePath.string()) +
+            " --poses " + Quote(m_Spec.PosesPath.string()) +
+            " --output " + Quote(m_Spec.OutputDirectory.string()) +
+            " --format " + m_Spec.Format +
+            " --size " + std::to_string(m_Spec.Width) + "x" + std::to_string(m_Spec.Height) +
+            " --target " + Quote(m_Spec.Target) +
+            " --attachment " + std::to_string(m_Spec.Attachment) +
+            " --shards " + std::to_string(m_Spec.ShardCount) +
+            " --shard " + std::to_string(shard);
+        #ifdef _WIN32
+        // The command interpreter removes the outer quotes
+        command = Quote(command);
+        #endif
+
+        processes.push_back(std::async(std::launch::async, [command]()
+        {
+            return std::system(command.c_str());
+        }));
+    }
+
+    int failed = 0;
+    for (auto& process : processes)
+        failed += process.get() != 0 ? 1 : 0;
+
+    float elapsed = timer.Elapsed();
+    PIXEL_CORE_INFO("Rendered {0} views with {1} processes in {2:.2f} s ({3:.1f} images/s)",
+                    viewCount, m_Spec.ShardCount, elapsed, viewCount / std::max(elapsed, 1e-6f));
+    if (failed)
+        PIXEL_CORE_ERROR("{0} worker process(es) failed", failed);
+
+    return failed ? 1 : 0;
+}
+
+/**
+ * @brief Render the views of the shard of this process.
+ *
+ * @param poses The camera poses of all the views.
+ *
+ * @return The exit code (0 if all the views have been rendered).
+ */
+int BatchRenderer::RenderShard(const std::vector<CameraPose>& poses)
+{
+    uint32_t shardIndex = m_Spec.ShardIndex.value_or(0);
+    uint32_t shardCount = m_Spec.ShardIndex.has_value() ? m_Spec.ShardCount : 1;
+
+    // Create the rendering context (hidden window, a display is still required)
+    auto window = std::make_unique<pixc::Window>("BatchRender", m_Spec.Width, m_Spec.Height, false);
+    window->SetVerticalSync(false);
+    RendererScope renderer;
+
+    // Load the scene
+    pixc::Scene scene(m_Spec.Width, m_Spec.Height);
+    pixc::SceneSerializer serializer(scene);
+    if (!serializer.Deserialize(m_Spec.ScenePath))
+        return 1;
+    // The images and models referenced by the scene are loaded in the background
+    scene.WaitForLoads();
+
+    auto& frameBuffers = scene.GetFrameBuffers();
+    if (!frameBuffers.Exists(m_Spec.Target))
+    {
+        PIXEL_CORE_ERROR("Framebuffer '{0}' not defined in the scene", m_Spec.Target);
+        return 1;
+    }
+    auto frameBuffer = frameBuffers.Get(m_Spec.Target);
+    if (m_Spec.Attachment >= frameBuffer->GetColorAttachments().size())
+    {
+        PIXEL_CORE_ERROR("Framebuffer '{0}' has no color attachment {1}", m_Spec.Target, m_Spec.Attachment);
+        return 1;
+    }
+
+    std::filesystem::create_directories(m_Spec.OutputDirectory);
+
+    // Render the views (the images are read back and written in the background)
+    auto camera = scene.GetCamera();
+    auto perspective = std::dynamic_pointer_cast<pixc::PerspectiveCamera>(camera);
+
+    pixc::Timer timer;
+    size_t count = 0;
+    for (size_t i = shardIndex; i < poses.size(); i += shardCount)
+    {
+        const auto& pose = poses[i];
+        camera->SetPosition(pose.Position);
+        camera->SetRotation(pose.Rotation);
+        if (perspective && pose.FieldOfView.has_value())
+            perspective->SetFieldOfView(pose.FieldOfView.value());
+
+        scene.Draw();
+        frameBuffer->SaveAttachmentAsync(m_Spec.Attachment,
+                                         m_Spec.OutputDirectory / GetImageName(i, m_Spec.Format));
+        pixc::FrameCapture::Update();
+        count++;
+    }
+
+    // Wait for all the images to be written
+    pixc::FrameCapture::Flush();
+    auto stats = pixc::FrameCapture::GetStats();
+
+    float elapsed = timer.Elapsed();
+    PIXEL_CORE_INFO("Shard {0}/{1}: rendered {2} views in {3:.2f} s ({4:.1f} images/s)",
+                    shardIndex + 1, shardCount, count, elapsed, count / std::max(elapsed, 1e-6f));
+
+    return stats.FailedCount > 0 ? 1 : 0;
+}
+
+/**
+ * @brief Load the camera poses from a file.
+ *
+ * @param filePath The camera poses file path.
+ *
+ * @return The camera poses.
+ */
+std::vector<CameraPose> BatchRenderer::LoadPoses(const std::filesystem::path& filePath)
+{
+    std::vector<CameraPose> poses;
+
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_ERROR("Failed to load: {0}", filePath.string());
+        return poses;
+    }
+
+    std::string line;
+    uint32_t lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream stream(line);
+        CameraPose pose;
+        stream >> pose.Position.x >> pose.Position.y >> pose.Position.z
+               >> pose.Rotation.x >> pose.Rotation.y >> pose.Rotation.z;
+        if (stream.fail())
+        {
+            PIXEL_CORE_WARN("Invalid camera pose (line {0}) ignored", lineNumber);
+            continue;
+        }
+
+        float fov;
+        if (stream >> fov)
+            pose.FieldOfView = fov;
+        poses.push_back(pose);
+    }
+    return poses;
+}
+
+/**
+ * @brief Parse the command line arguments.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ *
+ * @return The batch specification, or nothing if the arguments are not valid.
+ */
+std::optional<BatchSpecification> BatchRenderer::ParseArguments(int argc, char** argv)
+{
+    BatchSpecification spec;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if (argument == "--help" || argument == "-h")
+            return std::nullopt;
+
+        // All the other options need a value
+        if (i + 1 >= argc)
+        {
+            PIXEL_CORE_ERROR("Missing value for the option {0}", argument);
+            return std::nullopt;
+        }
+        std::string value = argv[++i];
+
+        if (argument == "--scene")
+            spec.ScenePath = value;
+        else if (argument == "--poses")
+            spec.PosesPath = value;
+        else if (argument == "--output")
+            spec.OutputDirectory = value;
+        else if (argument == "--format")
+            spec.Format = value;
+        else if (argument == "--size")
+        {
+            if (std::sscanf(value.c_str(), "%ux%u", &spec.Width, &spec.Height) != 2)
+            {
+                PIXEL_CORE_ERROR("Invalid size: {0} (expected WIDTHxHEIGHT)", value);
+                return std::nullopt;
+            }
+        }
+        else if (argument == "--target")
+            spec.Target = value;
+        else if (argument == "--attachment" || argument == "--shards" || argument == "--shard")
+        {
+            uint32_t number = 0;
+            if (!ParseInteger(value, number))
+            {
+                PIXEL_CORE_ERROR("Invalid value for the option {0}: {1}", argument, value);
+                return std::nullopt;
+            }
+
+            if (argument == "--attachment")
+                spec.Attachment = number;
+            else if (argument == "--shards")
+                spec.ShardCount = std::max(1u, number);
+            else
+                spec.ShardIndex = number;
+        }
+        else
+        {
+            PIXEL_CORE_ERROR("Unknown option: {0}", argument);
+            return std::nullopt;
+        }
+    }
+
+    if (spec.ScenePath.empty() || spec.PosesPath.empty())
+    {
+        PIXEL_CORE_ERROR("A scene and a camera poses file must be defined");
+        return std::nullopt;
+    }
+    if (spec.ShardIndex.has_value() && spec.ShardIndex.value() >= spec.ShardCount)
+    {
+        PIXEL_CORE_ERROR("Shard index out of range");
+        return std::nullopt;
+    }
+    return spec;
+}
+
+/**
+ * @brief Print the usage of the command line tool.
+ */
+void BatchRenderer::PrintUsage()
+{
+    std::cout <<
+        "Usage: BatchRender --scene <file> --poses <file> [options]\n"
+        "\n"
+        "Renders a scene (saved with pixc::SceneSerializer) from a list of camera poses.\n"
+        "Each line of the poses file defines a view: x y z pitch yaw roll [fov]\n"
+        "\n"
+        "Options:\n"
+        "  --output <dir>        Output directory (default: output)\n"
+        "  --format <ext>        Image format: png, jpg or hdr (default: png)\n"
+        "  --size <W>x<H>        Image size (default: 1024x1024)\n"
+        "  --target <name>       Framebuffer saved (default: ScreenBuffer)\n"
+        "  --attachment <index>  Color attachment saved (default: 0)\n"
+        "  --shards <count>      Number of worker processes (default: 1)\n"
+        "  --shard <index>       Render a single shard in this process\n";
+}
@@ -0,0 +1,28 @@
+#include "BatchRenderer.h"
+
+/**
+ * @brief Entry point of the batch rendering tool.
+ *
+ * The `main` function initializes the logging system, parses the command line arguments and
+ * renders the batch of views described by them.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ *
+ * @return An integer indicating the exit status of the tool.
+ */
+int main(int argc, char** argv)
+{
+    // Initialize the logging system
+    pixc::Log::Init();
+
+    auto spec = BatchRenderer::ParseArguments(argc, argv);
+    if (!spec.has_value())
+    {
+        BatchRenderer::PrintUsage();
+        return 1;
+    }
+
+    BatchRenderer renderer(spec.value());
+    return renderer.Run(argv[0]);
+}
@@ -22,6 +22,14 @@ class WindowCloseEvent;
  * be pushed and popped to manage the rendering process. The class encapsulates a window and
  * manages the application's main loop.
  *
+ * The frames can be drawn on a separate render thread (see `EnableRenderThread()`). The main
+ * thread then polls the events and simulates the layers (`Layer::OnSimulate()`), while the render
+ * thread draws the previous frame (`Layer::OnRender()`), creates the assets loaded, evaluates the
+ * animations and presents the frames. The window resize events are handled on the render thread
+ * (they resize the graphics resources), and the layers must hand the other changes of graphics
+ * resources over with `RenderThread::Enqueue()`. The layers not implementing the hooks are fully
+ * updated on the render thread. The multi-viewport mode of the GUI is not supported.
+ *
  * Copying or moving `Application` objects is disabled to ensure single ownership and prevent
  * unintended duplication.
  */
@@ -39,6 +47,10 @@ public:
     // ----------------------------------------
     void Run();
     
+    /// @brief Draw the frames on a separate render thread (must be set before running).
+    /// @param enabled Enable or not the render thread.
+    void EnableRenderThread(bool enabled) { m_RenderThread = enabled; }
+    
     // Events handler(s)
     // ----------------------------------------
     void OnEvent(Event& e);
@@ -58,8 +70,15 @@ public:
     Window& GetWindow() { return *m_Window; }
     
 private:
+    // Run
+    // ----------------------------------------
+    void RunWithRenderThread();
+    void RenderFrame(const FramePacket& packet);
+    void Shutdown();
+    
     // Events handler(s)
     // ----------------------------------------
+    void DispatchEvent(Event& e);
     bool OnWindowResize(WindowResizeEvent &e);
     bool OnWindowClose(WindowCloseEvent &e);
     
@@ -70,6 +89,8 @@ private:
     std::unique_ptr<Window> m_Window;
     ///< Application status.
     bool m_Running = true;
+    ///< Frames drawn on a separate render thread.
+    bool m_RenderThread = false;
     
     ///< Layers to be rendered.
     LayerStack m_LayerStack;
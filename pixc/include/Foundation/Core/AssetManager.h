@@ -0,0 +1,330 @@
+#pragma once
+
+#include "Foundation/Renderer/Shader/Shader.h"
+#include "Foundation/Renderer/Texture/Texture2D.h"
+#include "Foundation/Renderer/Material/Material.h"
+#include "Foundation/Renderer/Drawable/Model/AssimpModel.h"
+
+#include <atomic>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Types of assets handled by the asset manager.
+ */
+enum class AssetType : uint8_t
+{
+    None = 0,           ///< No asset.
+    Texture,            ///< 2D texture loaded from an image file.
+    EnvironmentMap,     ///< Equirectangular (HDR) environment map.
+    Model,              ///< Model loaded from a file (Assimp).
+    Shader,             ///< Shader program.
+    Material,           ///< Material (depends on a shader and textures).
+    Count,              ///< Number of asset types.
+};
+
+/**
+ * @brief Priority of a load request (higher priorities are loaded first).
+ */
+enum class AssetPriority : uint8_t
+{
+    Low = 0,
+    Normal = 1,
+    High = 2,
+};
+
+/**
+ * @brief Loading state of an asset.
+ */
+enum class AssetState : uint8_t
+{
+    Queued = 0,         ///< Waiting for a worker thread.
+    Loading,            ///< Being decoded, or waiting for its creation (or its dependencies).
+    Ready,              ///< Loaded and ready to be used.
+    Failed,             ///< Could not be loaded.
+};
+
+/**
+ * @brief Represents an asset tracked by the asset manager.
+ *
+ * @note Apart from its state, the record is only modified by the thread updating the manager (the
+ * rendering thread); the map of records is guarded, so requests can be made from any thread.
+ */
+struct AssetRecord
+{
+    AssetType Type = AssetType::None;                   ///< Type of asset.
+    std::filesystem::path Path;                         ///< Source file (or shader path).
+    std::string Name;                                   ///< Name of the asset (materials).
+    bool Flip = true;                                   ///< Flip the image vertically (textures).
+    PrimitiveType Primitive = PrimitiveType::Triangle;  ///< Primitive used for rendering (models).
+    AssetPriority Priority = AssetPriority::Normal;     ///< Priority of the current load request.
+
+    std::atomic<AssetState> State = AssetState::Queued; ///< Loading state.
+    std::atomic<uint64_t> Ticket = 0;                   ///< Identifier of the current load request.
+
+    std::shared_ptr<void> Asset;                        ///< Asset (null until ready).
+    uint32_t Version = 0;                               ///< Number of times the asset has been (re)loaded.
+    size_t MemorySize = 0;                              ///< Estimated memory used by the asset (bytes).
+    uint64_t LastUsedFrame = 0;                         ///< Last frame the asset was accessed.
+    std::filesystem::file_time_type WriteTime;          ///< Modification time of the loaded source file.
+    bool Reloading = false;                             ///< A reload has been requested.
+
+    ///< Assets required to create this asset (kept alive while this asset is).
+    std::vector<std::shared_ptr<AssetRecord>> Dependencies;
+    ///< Function creating the asset from its dependencies (materials).
+    std::function<std::shared_ptr<void>()> Build;
+    ///< Functions executed each time the asset becomes ready (including reloads).
+    std::vector<std::function<void()>> Callbacks;
+};
+
+// Forward declarations
+template<typename T>
+class AssetHandle;
+
+/**
+ * @brief Loads, tracks and evicts the assets of the application.
+ *
+ * The `AssetManager` class fronts the loading of textures, environment maps, models, shaders and
+ * materials. Load requests are asynchronous: files are decoded on worker threads (highest priority
+ * first), and the corresponding GPU resources are created on the main thread in `Update()`, within
+ * a time budget per frame. Requests return handles that resolve once the asset is ready. Shaders are
+ * not decoded by the workers: they are compiled synchronously when created.
+ *
+ * Materials depend on a shader and textures; they are created once all their dependencies are
+ * ready, and rebuilt when one of them is reloaded.
+ *
+ * An asset is in use while a handle to it exists or while its resource is referenced anywhere
+ * else (libraries, materials, ...). When the estimated memory of a type of asset exceeds its
+ * budget, the least recently used assets that are not in use are evicted.
+ *
+ * If hot reloading is enabled, the source files of the loaded assets are checked periodically and
+ * modified assets are loaded again; the handles resolve to the new version once it is ready.
+ *
+ * @note The manager must be used from the main (rendering) thread only.
+ */
+class AssetManager
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(uint32_t workerCount = 0);
+    static void Shutdown();
+
+    // Update
+    // ----------------------------------------
+    static void Update();
+
+    // Load requests
+    // ----------------------------------------
+    static AssetHandle<Texture2D> LoadTexture(const std::filesystem::path& filePath, bool flip = true,
+                                              AssetPriority priority = AssetPriority::Normal);
+    static AssetHandle<Texture2D> LoadEnvironmentMap(const std::filesystem::path& filePath,
+                                                     AssetPriority priority = AssetPriority::Normal);
+    static AssetHandle<AssimpModel> LoadModel(const std::filesystem::path& filePath,
+                                              const PrimitiveType& primitive = PrimitiveType::Triangle,
+                                              AssetPriority priority = AssetPriority::Normal);
+    static AssetHandle<Shader> LoadShader(const std::filesystem::path& filePath,
+                                          AssetPriority priority = AssetPriority::Normal);
+
+    template<typename Type>
+    static AssetHandle<Type> LoadMaterial(const std::string& name,
+                                          const std::filesystem::path& shaderPath,
+                                          const std::vector<std::filesystem::path>& texturePaths = {},
+                                          const std::function<void(const std::shared_ptr<Type>&,
+                                                const std::vector<std::shared_ptr<Texture2D>>&)>& setup = {},
+                                          AssetPriority priority = AssetPriority::Normal);
+
+    static void Wait(const std::shared_ptr<AssetRecord>& record);
+
+    // Memory
+    // ----------------------------------------
+    static void SetMemoryBudget(AssetType type, size_t bytes);
+    static size_t GetMemoryUsage(AssetType type);
+
+    // Setter(s)
+    // ----------------------------------------
+    static void SetUploadBudget(float milliseconds);
+    static void EnableHotReload(bool enabled, float interval = 1.0f);
+
+    // Getter(s)
+    // ----------------------------------------
+    static uint64_t GetFrame();
+
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the asset manager.
+     */
+    struct Statistics
+    {
+        ///< Number of requests waiting for a worker thread (load queue depth).
+        uint32_t QueueDepth = 0;
+        ///< Number of requests being decoded by the worker threads.
+        uint32_t LoadingCount = 0;
+        ///< Number of assets waiting for their creation (decoded, or waiting for dependencies).
+        uint32_t PendingCount = 0;
+        ///< Number of assets loaded.
+        uint32_t ResidentCount = 0;
+        ///< Estimated memory used by the loaded assets (bytes).
+        size_t MemoryUsage = 0;
+
+        ///< Number of assets loaded, reloaded, evicted and failed (since the last reset).
+        uint32_t Loaded = 0;
+        uint32_t Reloaded = 0;
+        uint32_t Evicted = 0;
+        uint32_t Failed = 0;
+
+        ///< Throughput measured over the last second.
+        float AssetsPerSecond = 0.0f;
+        float BytesPerSecond = 0.0f;
+    };
+
+    static void ResetStats();
+    static Statistics GetStats();
+
+private:
+    // Requests
+    // ----------------------------------------
+    static std::shared_ptr<AssetRecord> Request(AssetType type, const std::filesystem::path& filePath,
+                                                AssetPriority priority, bool flip = true,
+                                                PrimitiveType primitive = PrimitiveType::Triangle);
+    static std::shared_ptr<AssetRecord> RequestMaterial(const std::string& name,
+                                                        const std::vector<std::shared_ptr<AssetRecord>>& dependencies,
+                                                        const std::function<std::shared_ptr<void>()>& build);
+};
+
+/**
+ * @brief Handle to an asset loaded by the asset manager.
+ *
+ * The handle keeps the asset in use. It resolves to the asset once it is ready, and to its latest
+ * version after a reload.
+ *
+ * @tparam T The type of asset.
+ */
+template<typename T>
+class AssetHandle
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Create an empty handle.
+    AssetHandle() = default;
+    /// @brief Create a handle to an asset.
+    /// @param record The asset record.
+    AssetHandle(const std::shared_ptr<AssetRecord>& record) : m_Record(record) {}
+
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check whether the handle refers to an asset.
+    /// @return `true` if the handle is valid.
+    bool IsValid() const { return m_Record != nullptr; }
+    /// @brief Check whether the asset is ready to be used.
+    /// @return `true` if the asset is ready.
+    bool IsReady() const { return m_Record && m_Record->Asset; }
+    /// @brief Get the loading state of the asset.
+    /// @return The loading state.
+    AssetState GetState() const { return m_Record ? m_Record->State.load() : AssetState::Failed; }
+    /// @brief Get the version of the asset (incremented each time it is reloaded).
+    /// @return The version.
+    uint32_t GetVersion() const { return m_Record ? m_Record->Version : 0; }
+    /// @brief Get the asset.
+    /// @return The asset, or null if it is not ready.
+    std::shared_ptr<T> Get() const
+    {
+        if (!IsReady())
+            return nullptr;
+
+        m_Record->LastUsedFrame = AssetManager::GetFrame();
+        return std::static_pointer_cast<T>(m_Record->Asset);
+    }
+    /// @brief Get the record of the asset.
+    /// @return The asset record.
+    const std::shared_ptr<AssetRecord>& GetRecord() const { return m_Record; }
+
+    // Resolution
+    // ----------------------------------------
+    /// @brief Define a function to be executed each time the asset becomes ready (including
+    /// reloads). The function is executed right away if the asset is already ready.
+    /// @param callback The function receiving the asset.
+    void OnReady(const std::function<void(const std::shared_ptr<T>&)>& callback) const
+    {
+        if (!m_Record)
+            return;
+
+        std::weak_ptr<AssetRecord> weak = m_Record;
+        m_Record->Callbacks.push_back([weak, callback]()
+        {
+            if (auto record = weak.lock())
+                callback(std::static_pointer_cast<T>(record->Asset));
+        });
+
+        if (IsReady())
+            callback(Get());
+    }
+    /// @brief Block until the asset is ready (or has failed), processing the loads meanwhile.
+    /// @return The asset, or null if it could not be loaded.
+    std::shared_ptr<T> Wait() const
+    {
+        if (m_Record)
+            AssetManager::Wait(m_Record);
+        return Get();
+    }
+
+    // Handle variables
+    // ----------------------------------------
+private:
+    ///< Record of the asset.
+    std::shared_ptr<AssetRecord> m_Record;
+};
+
+/**
+ * @brief Request the loading of a material.
+ *
+ * The material is created (with its shader path) once its shader and textures are ready, and
+ * rebuilt each time one of them is reloaded.
+ *
+ * @tparam Type The type of material.
+ * @param name The name of the material.
+ * @param shaderPath The path to the shader used by the material.
+ * @param texturePaths The textures used by the material.
+ * @param setup Function defining the properties of the material from its textures.
+ * @param priority The priority of the request.
+ *
+ * @return A handle to the material.
+ */
+template<typename Type>
+AssetHandle<Type> AssetManager::LoadMaterial(const std::string& name,
+                                             const std::filesystem::path& shaderPath,
+                                             const std::vector<std::filesystem::path>& texturePaths,
+                                             const std::function<void(const std::shared_ptr<Type>&,
+                                                   const std::vector<std::shared_ptr<Texture2D>>&)>& setup,
+                                             AssetPriority priority)
+{
+    // Request the dependencies of the material
+    std::vector<std::shared_ptr<AssetRecord>> dependencies;
+    dependencies.push_back(Request(AssetType::Shader, shaderPath, priority));
+    for (const auto& path : texturePaths)
+        dependencies.push_back(Request(AssetType::Texture, path, priority));
+
+    // Create the material from the current version of its dependencies
+    std::vector<std::shared_ptr<AssetRecord>> textures(dependencies.begin() + 1, dependencies.end());
+    auto build = [shaderPath, textures, setup]() -> std::shared_ptr<void>
+    {
+        auto material = std::make_shared<Type>(shaderPath);
+
+        std::vector<std::shared_ptr<Texture2D>> maps;
+        for (const auto& texture : textures)
+            maps.push_back(std::static_pointer_cast<Texture2D>(texture->Asset));
+        if (setup)
+            setup(material, maps);
+        return material;
+    };
+
+    return AssetHandle<Type>(RequestMaterial(name, dependencies, build));
+}
+
+} // namespace pixc
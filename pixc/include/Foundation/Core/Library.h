@@ -139,6 +139,25 @@ public:
         return m_Objects.find(name) != m_Objects.end();
     }
     
+    // Remove
+    // ----------------------------------------
+    /// @brief Removes an object from the library.
+    /// @param name The name of the object to remove.
+    /// @return The removed object (default value if it was not found).
+    ObjectType Remove(const std::string& name)
+    {
+        auto it = m_Objects.find(name);
+        if (it == m_Objects.end())
+        {
+            PIXEL_CORE_WARN("{0} not found!", GetTypeName());
+            return ObjectType();
+        }
+        
+        ObjectType object = std::move(it->second);
+        m_Objects.erase(it);
+        return object;
+    }
+    
     /// @brief Checks if the library is empty.
     /// @return `true` if the library contains no elements, `false` otherwise.
     bool IsEmpty() const { return m_Objects.empty(); }
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Foundation/Scene/FramePacket.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Draws the frames on a separate thread, which owns the graphics context.
+ *
+ * The main thread simulates a frame and captures everything needed to draw it into a
+ * `FramePacket`, while the render thread draws the previous one. There are two packets: the main
+ * thread writes into one while the render thread reads the other, and they are swapped when the
+ * frame is submitted. The main thread waits if it gets a full frame ahead of the render thread.
+ *
+ * All the work on the graphics API happens on the render thread. The work that cannot be
+ * captured into the packet (e.g., creating or resizing the resources, changing the lights or the
+ * materials) is handed over with `Enqueue()`: the commands are executed on the render thread
+ * before it draws the next packet, while the main thread waits for them. They can then safely
+ * access both the graphics context and the state of the simulation.
+ *
+ * Typical usage (see `Application::EnableRenderThread()`):
+ * @code
+ * RenderThread::Init([](const FramePacket& packet) { ... draw the packet ... });
+ * while (running)
+ * {
+ *     FramePacket& packet = RenderThread::BeginFrame();
+ *     ... simulate and capture the frame into the packet ...
+ *     RenderThread::Submit();
+ * }
+ * RenderThread::Shutdown();
+ * @endcode
+ */
+class RenderThread
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(const std::function<void(const FramePacket&)>& render);
+    static void Shutdown();
+    
+    // Frames
+    // ----------------------------------------
+    static FramePacket& BeginFrame();
+    static void Submit();
+    
+    // Commands
+    // ----------------------------------------
+    static void Enqueue(const std::function<void()>& command);
+    
+    // Getter(s)
+    // ----------------------------------------
+    static bool IsRunning();
+    static bool IsRenderThread();
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the timings of the render thread (averaged over the frames since the last reset).
+     */
+    struct Statistics
+    {
+        ///< Number of frames drawn.
+        uint64_t Frames = 0;
+        ///< Time between two frames submitted (ms).
+        float FrameTime = 0.0f;
+        ///< Time spent simulating and capturing a frame on the main thread (ms).
+        float SimulationTime = 0.0f;
+        ///< Time spent drawing a frame on the render thread (ms).
+        float RenderTime = 0.0f;
+        ///< Time the main thread waited for a free packet or for the commands (ms).
+        float SimulationWait = 0.0f;
+        ///< Time the render thread waited for a packet (ms).
+        float RenderWait = 0.0f;
+        ///< Number of commands executed.
+        uint32_t Commands = 0;
+    };
+    
+    static void ResetStats();
+    static Statistics GetStats();
+
+private:
+    static void Loop();
+};
+
+} // namespace pixc
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <filesystem>
+#include <mutex>
 
 /**
  * @namespace pixc
@@ -17,6 +18,10 @@ namespace pixc {
  * per-level or per-user assets.
  *
  * It uses `std::filesystem::path` for path operations to ensure portability and correctness.
+ *
+ * An optional cache directory holds the data generated from the resources (mesh blobs, font
+ * atlases), so that it is not generated again on the next loads. Nothing is written next to the
+ * resources: the caches are disabled until a cache directory is defined.
  */
 class ResourcesManager {
     
@@ -30,6 +35,13 @@ public:
     /// @brief Sets a specific resources path to override the general one.
     /// @param path The override path to a specific resources directory.
     static void SetSpecificPath(const std::filesystem::path& path) { s_SpecificPath = path; }
+    /// @brief Sets the directory where the data generated from the resources is cached.
+    /// @param path The cache directory (empty to disable the caches, the default).
+    static void SetCachePath(const std::filesystem::path& path)
+    {
+        std::lock_guard<std::mutex> lock(s_CacheMutex);
+        s_CachePath = path;
+    }
 
     // Getter(s)
     // ----------------------------------------
@@ -47,6 +59,13 @@ public:
     {
         return s_SpecificPath / relativePath;
     }
+    /// @brief Retrieves the directory where the data generated from the resources is cached.
+    /// @return The cache directory, or an empty path if the caches are disabled.
+    static std::filesystem::path GetCachePath()
+    {
+        std::lock_guard<std::mutex> lock(s_CacheMutex);
+        return s_CachePath;
+    }
 
     // Resource manager variables
     // ----------------------------------------
@@ -55,6 +74,9 @@ private:
     inline static std::filesystem::path s_GeneralPath = "";
     ///< A specific override path for resources.
     inline static std::filesystem::path s_SpecificPath = "";
+    ///< The directory of the generated data (caches disabled if empty, read by worker threads).
+    inline static std::filesystem::path s_CachePath = "";
+    inline static std::mutex s_CacheMutex;
 };
 
 } // namespace pixc
@@ -26,6 +26,8 @@ struct WindowData
     uint32_t Width, Height;
     ///< Vertical synchronization with the monitor.
     bool VerticalSync;
+    ///< Window shown on screen (hidden for offscreen rendering, a display is still required).
+    bool Visible;
     
     ///< Callback function to handle events.
     std::function<void(Event&)> EventCallback;
@@ -36,9 +38,11 @@ struct WindowData
     /// @param title Window name.
     /// @param width Size (width) of the window.
     /// @param height Size (height) of the window.
+    /// @param verticalSync Synchronize with the monitor.
+    /// @param visible Show the window on screen.
     WindowData(const std::string& title, const uint32_t width,
-               const uint32_t height, bool verticalSync = true)
-    : Title(title), Width(width), Height(height), VerticalSync(verticalSync)
+               const uint32_t height, bool verticalSync = true, bool visible = true)
+    : Title(title), Width(width), Height(height), VerticalSync(verticalSync), Visible(visible)
     {}
     /// @brief delete the data of the window.
     ~WindowData() = default;
@@ -58,12 +62,15 @@ class Window
 public:
     // Constructor(s)/Destructor
     // ----------------------------------------
-    Window(const std::string& title, const uint32_t width, const uint32_t height);
+    Window(const std::string& title, const uint32_t width, const uint32_t height,
+           bool visible = true);
     ~Window();
     
     // Handler(s)
     // ----------------------------------------
     void OnUpdate() const;
+    void PollEvents() const;
+    void SwapBuffers() const;
     void OnResize(const uint32_t width, const uint32_t height) const;
     
     // Getter(s)
@@ -80,6 +87,9 @@ public:
     /// @brief Check if there is a vertical synchronization with the monitor.
     /// @return `true` if the window is synchronized.
     bool IsVerticalSync() const { return m_Data.VerticalSync; }
+    /// @brief Check if the window is shown on screen.
+    /// @return `true` if the window is visible.
+    bool IsVisible() const { return m_Data.Visible; }
     /// @brief Get the GLFW window.
     /// @return The native window.
     void* GetNativeWindow() const { return m_Window; }
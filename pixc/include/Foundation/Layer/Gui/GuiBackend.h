@@ -2,6 +2,8 @@
 
 #include "Foundation/Core/ClassUtils.h"
 
+struct ImDrawData;
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -39,7 +41,7 @@ public:
     // Rendering
     // ----------------------------------------
     virtual void BeginFrame() = 0;
-    virtual void EndFrame() = 0;
+    virtual void EndFrame(ImDrawData* drawData) = 0;
     
 protected:
     // Constructor
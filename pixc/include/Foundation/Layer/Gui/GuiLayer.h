@@ -6,6 +6,7 @@
 #include "Foundation/Layer/Gui/GuiBackend.h"
 
 struct ImGuiContext;
+struct ImDrawData;
 
 /**
  * @namespace pixc
@@ -22,6 +23,10 @@ namespace pixc {
  *
  * Copying or moving `GuiLayer` objects is disabled to ensure single ownership and prevent
  * unintended layer duplication.
+ *
+ * When the frames are drawn on the render thread, the interface is built on the main thread (with
+ * the inputs), and a copy of its draw data is drawn on the render thread. The platform windows
+ * (multi-viewport) are then disabled.
  */
 class GuiLayer : public Layer
 {
@@ -37,6 +42,8 @@ public:
     void OnAttach() override;
     void OnDetach() override;
     void OnUpdate(Timestep ts) override;
+    void OnSimulate(Timestep ts, FramePacket& packet) override;
+    void OnRender(const FramePacket& packet) override;
     void OnEvent(Event& e) override;
     
     // Layer rendering
@@ -55,6 +62,11 @@ protected:
     // ----------------------------------------
     void GUIStats(Timestep ts);
     
+    // Draw data
+    // ----------------------------------------
+    static void CopyDrawData(ImDrawData*& copy);
+    static void ReleaseDrawData(ImDrawData*& copy);
+    
     // Getter(s)
     // ----------------------------------------
     bool IsActive();
@@ -75,6 +87,9 @@ private:
     ///< Dispatch the event to this layers only.
     bool m_BlockEvents = true;
     
+    ///< Copies of the draw data built on the main thread (one per frame packet).
+    std::array<ImDrawData*, 2> m_DrawData = { nullptr, nullptr };
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
@@ -6,6 +6,8 @@
 
 #include "Foundation/Event/Event.h"
 
+#include "Foundation/Scene/FramePacket.h"
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -44,6 +46,15 @@ class Layer
     /// @brief Render this layer.  The method is called every frame
     /// @param deltaTime Time elapsed since the last frame, in seconds.
     virtual void OnUpdate(Timestep ts) {}
+    /// @brief Simulate this layer and capture what has to be drawn (main thread, when the frames
+    /// are drawn on the render thread).
+    /// @param ts Time elapsed since the last frame, in seconds.
+    /// @param packet Packet of the frame.
+    virtual void OnSimulate(Timestep ts, FramePacket& packet) {}
+    /// @brief Draw a frame captured by `OnSimulate()` (render thread). By default, the whole
+    /// layer is updated on the render thread (the layers polling the inputs must override both).
+    /// @param packet Packet of the frame.
+    virtual void OnRender(const FramePacket& packet) { OnUpdate(packet.DeltaTime); }
     /// @brief Handle an event that possibly occurred inside the layer.
     /// @param e Event.
     virtual void OnEvent(Event& e) {}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents the keyframes animating a joint of a skeleton.
+ *
+ * Each component (translation, rotation, scale) has its own keys, sorted by time.
+ */
+struct AnimationChannel
+{
+    uint32_t Joint = 0;                     ///< Index of the animated joint.
+    
+    std::vector<float> TranslationTimes;    ///< Time (in seconds) of the translation keys.
+    std::vector<glm::vec3> Translations;    ///< Translation keys.
+    std::vector<float> RotationTimes;       ///< Time (in seconds) of the rotation keys.
+    std::vector<glm::quat> Rotations;       ///< Rotation keys.
+    std::vector<float> ScaleTimes;          ///< Time (in seconds) of the scale keys.
+    std::vector<glm::vec3> Scales;          ///< Scale keys.
+};
+
+/**
+ * @brief Represents an animation of a skeleton (e.g., walk, run, idle).
+ *
+ * The joints without a channel keep their bind pose during the animation.
+ */
+struct AnimationClip
+{
+    std::string Name;                       ///< Name of the animation.
+    float Duration = 0.0f;                  ///< Duration of the animation (in seconds).
+    std::vector<AnimationChannel> Channels; ///< Keyframes of the animated joints.
+};
+
+} // namespace pixc
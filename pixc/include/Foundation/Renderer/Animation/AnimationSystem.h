@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Foundation/Renderer/Animation/Animator.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Updates the animated characters of the application and uploads their bone matrices.
+ *
+ * The `AnimationSystem` class evaluates the registered animators once per frame, spreading them
+ * in batches over worker threads (the calling thread takes part too). The bone matrices of all
+ * the characters are gathered in a single uniform buffer, uploaded at once after the evaluation;
+ * each character then binds its own range of the buffer (`BoneBlock`) before being drawn.
+ *
+ * @note The system must be used from the main (rendering) thread only.
+ */
+class AnimationSystem
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(uint32_t workerCount = 0);
+    static void Shutdown();
+    
+    // Animators
+    // ----------------------------------------
+    static void Register(const std::shared_ptr<Animator>& animator);
+    static void Unregister(const std::shared_ptr<Animator>& animator);
+    
+    // Update
+    // ----------------------------------------
+    static void Update(float deltaTime);
+    
+    // Usage
+    // ----------------------------------------
+    static bool BindBoneMatrices(const Animator& animator);
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the animation system.
+     */
+    struct Statistics
+    {
+        ///< Number of animators registered.
+        uint32_t AnimatorCount = 0;
+        ///< Number of joints evaluated per update.
+        uint32_t JointCount = 0;
+        ///< Number of threads evaluating the animators (including the main thread).
+        uint32_t ThreadCount = 0;
+        ///< Time spent evaluating the animators in the last update (milliseconds).
+        float EvaluationTime = 0.0f;
+        ///< Size of the bone matrices uploaded in the last update (bytes).
+        size_t UploadSize = 0;
+    };
+    
+    static Statistics GetStats();
+};
+
+} // namespace pixc
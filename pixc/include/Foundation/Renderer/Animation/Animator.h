@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+#include "Foundation/Renderer/Animation/Skeleton.h"
+#include "Foundation/Renderer/Animation/AnimationClip.h"
+#include "Foundation/Renderer/Animation/Pose.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Plays the animations of a skinned character.
+ *
+ * The `Animator` class evaluates the keyframes of the animation being played into a pose, blends
+ * it with the previous animation during a transition, and computes the bone matrices used to skin
+ * the character on the GPU. Several characters can share the same skeleton and animations, each
+ * of them with its own animator.
+ *
+ * The animators registered in the `AnimationSystem` are updated in parallel once per frame.
+ * Updating an animator only touches its own data, so different animators can be updated from
+ * different threads.
+ *
+ * Copying or moving `Animator` objects is disabled to ensure single ownership.
+ */
+class Animator
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    Animator(const std::shared_ptr<Skeleton>& skeleton);
+    /// @brief Delete the animator.
+    ~Animator() = default;
+    
+    // Playback
+    // ----------------------------------------
+    void Play(const std::shared_ptr<AnimationClip>& clip, float fadeDuration = 0.0f, bool loop = true);
+    void Stop();
+    
+    void Update(float deltaTime);
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Change the playback speed.
+    /// @param speed The speed factor (1 for the original speed).
+    void SetSpeed(float speed) { m_Speed = speed; }
+    /// @brief Pause or resume the playback.
+    /// @param paused `true` to pause the animation.
+    void SetPaused(bool paused) { m_Paused = paused; }
+    /// @brief Change the current time of the animation being played.
+    /// @param time The time (in seconds).
+    void SetTime(float time) { m_Current.Time = time; m_Current.Cursors.assign(m_Current.Cursors.size(), 0); }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the skeleton animated.
+    /// @return The skeleton.
+    const std::shared_ptr<Skeleton>& GetSkeleton() const { return m_Skeleton; }
+    /// @brief Get the animation being played.
+    /// @return The animation, or null if none.
+    const std::shared_ptr<AnimationClip>& GetClip() const { return m_Current.Clip; }
+    /// @brief Get the current time of the animation being played.
+    /// @return The time (in seconds).
+    float GetTime() const { return m_Current.Time; }
+    /// @brief Check if an animation is being played.
+    /// @return `true` if an animation is being played.
+    bool IsPlaying() const { return m_Current.Clip && !m_Paused; }
+    /// @brief Get the current (local) pose of the skeleton.
+    /// @return The pose.
+    const Pose& GetPose() const { return m_Pose; }
+    /// @brief Get the bone matrices (mesh space of the bind pose to the animated model space).
+    /// @return The bone matrices (one per joint of the skeleton).
+    const std::vector<glm::mat4>& GetBoneMatrices() const { return m_BoneMatrices; }
+
+private:
+    /**
+     * @brief Represents an animation being played.
+     */
+    struct Layer
+    {
+        std::shared_ptr<AnimationClip> Clip;    ///< Animation.
+        float Time = 0.0f;                      ///< Current time (in seconds).
+        bool Loop = true;                       ///< Restart the animation when it ends.
+        std::vector<uint32_t> Cursors;          ///< Last key used (three per channel).
+    };
+    
+    // Evaluation
+    // ----------------------------------------
+    static void Advance(Layer& layer, float deltaTime);
+    void Sample(Layer& layer, Pose& pose) const;
+    void ComputeBoneMatrices();
+    
+    // Animator variables
+    // ----------------------------------------
+private:
+    ///< Skeleton animated.
+    std::shared_ptr<Skeleton> m_Skeleton;
+    
+    ///< Animation being played, and the previous one (during a transition).
+    Layer m_Current;
+    Layer m_Previous;
+    ///< Transition between the previous and the current animation.
+    float m_FadeDuration = 0.0f;
+    float m_FadeTime = 0.0f;
+    
+    ///< Playback state.
+    float m_Speed = 1.0f;
+    bool m_Paused = false;
+    
+    ///< Local pose of the skeleton (and the pose of the previous animation).
+    Pose m_Pose;
+    Pose m_PreviousPose;
+    ///< Global transformation of the joints (scratch data).
+    std::vector<glm::mat4> m_Globals;
+    ///< Bone matrices (skinning palette).
+    std::vector<glm::mat4> m_BoneMatrices;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(Animator);
+};
+
+} // namespace pixc
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Foundation/Renderer/Animation/Skeleton.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents the local transformation of the joints of a skeleton (structure of arrays).
+ *
+ * Each component of the transformations is stored in its own contiguous array, so the operations
+ * applied to all the joints (blending, bind pose reset) are simple loops over floats that the
+ * compiler can vectorize.
+ */
+struct Pose
+{
+    ///< Translation of the joints.
+    std::vector<float> TX, TY, TZ;
+    ///< Rotation (quaternion) of the joints.
+    std::vector<float> RX, RY, RZ, RW;
+    ///< Scale of the joints.
+    std::vector<float> SX, SY, SZ;
+    
+    /// @brief Change the number of joints of the pose.
+    /// @param count The number of joints.
+    void Resize(uint32_t count)
+    {
+        for (auto* component : { &TX, &TY, &TZ, &RX, &RY, &RZ, &RW, &SX, &SY, &SZ })
+            component->resize(count);
+    }
+    /// @brief Get the number of joints of the pose.
+    /// @return The number of joints.
+    uint32_t GetJointCount() const { return static_cast<uint32_t>(TX.size()); }
+    
+    /// @brief Set the local transformation of a joint.
+    /// @param joint The index of the joint.
+    /// @param t The translation.
+    /// @param r The rotation.
+    /// @param s The scale.
+    void Set(uint32_t joint, const glm::vec3& t, const glm::quat& r, const glm::vec3& s)
+    {
+        TX[joint] = t.x; TY[joint] = t.y; TZ[joint] = t.z;
+        RX[joint] = r.x; RY[joint] = r.y; RZ[joint] = r.z; RW[joint] = r.w;
+        SX[joint] = s.x; SY[joint] = s.y; SZ[joint] = s.z;
+    }
+    /// @brief Reset the pose to the bind pose of a skeleton.
+    /// @param skeleton The skeleton.
+    void SetBindPose(const Skeleton& skeleton)
+    {
+        Resize(skeleton.GetJointCount());
+        for (uint32_t i = 0; i < skeleton.GetJointCount(); i++)
+        {
+            const auto& joint = skeleton.Joints[i];
+            Set(i, joint.Translation, joint.Rotation, joint.Scale);
+        }
+    }
+    /// @brief Get the local transformation matrix of a joint.
+    /// @param joint The index of the joint.
+    /// @return The transformation matrix (translation * rotation * scale).
+    glm::mat4 GetMatrix(uint32_t joint) const
+    {
+        glm::mat4 matrix = glm::mat4_cast(glm::quat(RW[joint], RX[joint], RY[joint], RZ[joint]));
+        matrix[0] *= SX[joint];
+        matrix[1] *= SY[joint];
+        matrix[2] *= SZ[joint];
+        matrix[3] = glm::vec4(TX[joint], TY[joint], TZ[joint], 1.0f);
+        return matrix;
+    }
+    
+    /// @brief Blend a pose into this one (linear blend, normalized for the rotations).
+    /// @param other The pose to be blended (same number of joints).
+    /// @param weight The weight of the other pose (0 keeps this pose).
+    void Blend(const Pose& other, float weight)
+    {
+        const uint32_t count = std::min(GetJointCount(), other.GetJointCount());
+        
+        auto lerp = [count, weight](std::vector<float>& a, const std::vector<float>& b)
+        {
+            for (uint32_t i = 0; i < count; i++)
+                a[i] += (b[i] - a[i]) * weight;
+        };
+        lerp(TX, other.TX); lerp(TY, other.TY); lerp(TZ, other.TZ);
+        lerp(SX, other.SX); lerp(SY, other.SY); lerp(SZ, other.SZ);
+        
+        // Rotations: blend along the shortest path, then normalize
+        for (uint32_t i = 0; i < count; i++)
+        {
+            float dot = RX[i] * other.RX[i] + RY[i] * other.RY[i] +
+                        RZ[i] * other.RZ[i] + RW[i] * other.RW[i];
+            float w = dot < 0.0f ? -weight : weight;
+            float x = RX[i] * (1.0f - weight) + other.RX[i] * w;
+            float y = RY[i] * (1.0f - weight) + other.RY[i] * w;
+            float z = RZ[i] * (1.0f - weight) + other.RZ[i] * w;
+            float q = RW[i] * (1.0f - weight) + other.RW[i] * w;
+            float inverseLength = 1.0f / std::sqrt(x * x + y * y + z * z + q * q);
+            RX[i] = x * inverseLength;
+            RY[i] = y * inverseLength;
+            RZ[i] = z * inverseLength;
+            RW[i] = q * inverseLength;
+        }
+    }
+};
+
+} // namespace pixc
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/// @brief Maximum number of joints of a skeleton (size of the bone matrix palette in the shaders).
+constexpr uint32_t MaxSkeletonJoints = 128;
+
+/// @brief Maximum number of bones influencing a vertex.
+constexpr uint32_t MaxBoneInfluences = 4;
+
+/**
+ * @brief Represents a joint of a skeleton.
+ *
+ * A joint is either a bone (it influences vertices) or an intermediate node of the hierarchy
+ * whose transformation affects the bones below it.
+ */
+struct Joint
+{
+    std::string Name;                                       ///< Name of the node.
+    int32_t Parent = -1;                                    ///< Index of the parent joint (-1 for the root).
+    glm::mat4 Offset = glm::mat4(1.0f);                     ///< Inverse bind matrix (mesh to joint space).
+    
+    glm::vec3 Translation = glm::vec3(0.0f);                ///< Local translation in the bind pose.
+    glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f); ///< Local rotation in the bind pose.
+    glm::vec3 Scale = glm::vec3(1.0f);                      ///< Local scale in the bind pose.
+};
+
+/**
+ * @brief Represents the joint hierarchy that deforms a skinned model.
+ *
+ * The joints are stored with the parents before their children, so the global transformation of
+ * the joints can be computed in a single pass over the array.
+ */
+struct Skeleton
+{
+    ///< Joints of the skeleton (parents first).
+    std::vector<Joint> Joints;
+    ///< Inverse of the transformation of the root node of the model.
+    glm::mat4 GlobalInverse = glm::mat4(1.0f);
+    
+    /// @brief Get the number of joints of the skeleton.
+    /// @return The number of joints.
+    uint32_t GetJointCount() const { return static_cast<uint32_t>(Joints.size()); }
+    /// @brief Find a joint by its name.
+    /// @param name The name of the joint.
+    /// @return The index of the joint, or -1 if the skeleton has no joint with this name.
+    int32_t FindJoint(const std::string& name) const
+    {
+        for (size_t i = 0; i < Joints.size(); i++)
+        {
+            if (Joints[i].Name == name)
+                return static_cast<int32_t>(i);
+        }
+        return -1;
+    }
+};
+
+/**
+ * @brief Represents the bones influencing a vertex of a skinned mesh (second vertex stream).
+ *
+ * The joint indices are stored as floats so the stream uses the same attribute path as the other
+ * vertex data; they are exact up to 2^24.
+ */
+struct SkinVertexData
+{
+    glm::vec4 joints = glm::vec4(0.0f);     ///< Indices of the influencing joints.
+    glm::vec4 weights = glm::vec4(0.0f);    ///< Weights of the influencing joints (sum of one).
+};
+
+} // namespace pixc
@@ -7,6 +7,8 @@
 #include "Foundation/Renderer/Texture/Texture.h"
 #include "Foundation/Renderer/Texture/TextureUtils.h"
 
+#include <glm/glm.hpp>
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -61,6 +63,75 @@ struct AttachmentSpecification
     }
 };
 
+class FrameBuffer;
+
+/**
+ * @brief What happens to the content of an attachment when a render pass begins.
+ */
+enum class LoadAction : uint8_t
+{
+    Load = 0,       ///< The previous content is kept.
+    Clear,          ///< The attachment is cleared with the clear value of the pass.
+    DontCare,       ///< The previous content is undefined (every pixel is written by the pass).
+};
+
+/**
+ * @brief What happens to the content of an attachment when a render pass ends.
+ */
+enum class StoreAction : uint8_t
+{
+    Store = 0,      ///< The content is kept (e.g., sampled by a later pass).
+    Discard,        ///< The content is not needed anymore (e.g., intermediate depth buffer).
+    Resolve,        ///< The content is resolved into the resolve target, then discarded.
+};
+
+/**
+ * @brief Load and store actions of a framebuffer attachment.
+ */
+struct AttachmentActions
+{
+    LoadAction Load = LoadAction::Load;         ///< Action when the render pass begins.
+    StoreAction Store = StoreAction::Store;     ///< Action when the render pass ends.
+};
+
+/**
+ * @brief Defines the load and store actions of the attachments of a render pass.
+ *
+ * The actions let the rendering API skip the work on the attachments that are not needed: the
+ * attachments are cleared one by one with their own value, the contents that are overwritten or
+ * never read again are not loaded or written back to memory (tiled GPUs), and the multisampled
+ * attachments are resolved as part of the pass.
+ */
+struct RenderPassActions
+{
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the actions of a color attachment.
+    /// @param index The color attachment index.
+    /// @return The actions defined for the attachment, or the common ones.
+    const AttachmentActions& GetColorActions(const uint32_t index) const
+    {
+        return index < ColorAttachments.size() ? ColorAttachments[index] : Color;
+    }
+    
+    // Render pass actions variables
+    // ----------------------------------------
+    ///< Actions of the color attachments (unless defined for the attachment).
+    AttachmentActions Color;
+    ///< Actions of each color attachment (overrides the common ones).
+    std::vector<AttachmentActions> ColorAttachments;
+    ///< Actions of the depth (and stencil) attachment.
+    AttachmentActions Depth;
+    
+    ///< Clear values of the attachments.
+    glm::vec4 ClearColor = glm::vec4(0.0f);
+    float ClearDepth = 1.0f;
+    int32_t ClearStencil = 0;
+    
+    ///< Framebuffer receiving the attachments with a `StoreAction::Resolve`.
+    std::shared_ptr<FrameBuffer> ResolveTarget;
+};
+
 /**
  * @brief Defines the specifications for a framebuffer.
  *
@@ -97,6 +168,9 @@ struct FrameBufferSpecification
     uint32_t Samples = 1;
     ///< A flag indicating whether mipmaps should be created for the texture.
     bool MipMaps = false;
+    ///< Store the multisampled attachments in render buffers when supported (they are only
+    ///< rendered into and resolved, never sampled).
+    bool RenderBuffers = false;
     
     ///< The properties for framebuffer texture attachments.
     AttachmentSpecification AttachmentsSpec;
@@ -229,6 +303,19 @@ class FrameBuffer
     /// @return The depth attachment (texture reference).
     const std::shared_ptr<Texture>& GetDepthAttachment() const { return m_DepthAttachment; }
     
+    /// @brief Get the number of color attachments (also the ones stored in render buffers).
+    /// @return The number of color attachments.
+    uint32_t GetColorAttachmentCount() const { return static_cast<uint32_t>(m_ColorAttachmentsSpec.size()); }
+    /// @brief Check if the framebuffer has a depth attachment (also if stored in a render buffer).
+    /// @return `true` if a depth attachment is defined.
+    bool HasDepthAttachment() const { return m_DepthAttachmentSpec.Format != TextureFormat::None; }
+    /// @brief Check if the attachments are stored in render buffers (they cannot be sampled).
+    /// @return `true` if the attachments are render buffers.
+    virtual bool UsesRenderBuffers() const { return false; }
+    /// @brief Get the memory used by the attachments of the framebuffer.
+    /// @return The size of the attachments (bytes).
+    size_t GetMemorySize() const { return m_MemorySize; }
+    
     /// @brief Get the active rendering targets for this framebuffer.
     /// @return The state of the color, depth and stencil targets state.
     RenderTargetMask GetEnabledTargets() const { return m_EnabledTargets; }
@@ -237,6 +324,15 @@ class FrameBuffer
     FrameBufferDrawTarget& GetDrawTargetOverride() { return m_DrawTargetOverride; }
     
     virtual std::vector<char> GetAttachmentData(const uint32_t index) = 0;
+    /// @brief Read the pixel data of a color attachment without waiting for the rendering.
+    /// @param index The color attachment index.
+    /// @param callback Function receiving the pixel data once it is available.
+    /// @note The default implementation reads the data synchronously.
+    virtual void GetAttachmentDataAsync(const uint32_t index,
+                                        const std::function<void(std::vector<char>)>& callback)
+    {
+        callback(GetAttachmentData(index));
+    }
     
     // Usage
     // ----------------------------------------
@@ -279,11 +375,25 @@ class FrameBuffer
     // ----------------------------------------
     virtual void ClearAttachment(const uint32_t index, const int value) = 0;
     
+    // Load/store actions
+    // ----------------------------------------
+    virtual void ApplyLoadActions(const RenderPassActions& actions);
+    /// @brief Release the attachments whose content is not needed after the render pass
+    /// (not supported by default, the content is kept).
+    /// @param actions The actions of the render pass.
+    virtual void ApplyStoreActions(const RenderPassActions& actions) {}
+    
     // Blit
     // ----------------------------------------
     static void Blit(const std::shared_ptr<FrameBuffer>& src,
                      const std::shared_ptr<FrameBuffer>& dst,
                      const BlitSpecification& spec = BlitSpecification());
+    static bool BlitToScreen(const std::shared_ptr<FrameBuffer>& src,
+                             const uint32_t width, const uint32_t height,
+                             const BlitSpecification& spec = BlitSpecification());
+    static void Resolve(const std::shared_ptr<FrameBuffer>& src,
+                        const std::shared_ptr<FrameBuffer>& dst,
+                        const std::vector<uint32_t>& colors, const bool depth);
     
     // Reset
     // ----------------------------------------
@@ -294,6 +404,31 @@ class FrameBuffer
     // Save
     // ----------------------------------------
     void SaveAttachment(const uint32_t index, const std::filesystem::path& path);
+    void SaveAttachmentAsync(const uint32_t index, const std::filesystem::path& path);
+    
+    static void ProcessReadbacks(bool wait = false);
+    static void ReleaseReadbacks();
+    static uint32_t GetPendingReadbacks();
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the memory and resolve cost of the framebuffers with the same sample count.
+     */
+    struct SampleStatistics
+    {
+        ///< Number of framebuffers.
+        uint32_t FrameBufferCount = 0;
+        ///< Memory used by their attachments (bytes).
+        size_t Memory = 0;
+        ///< Number of attachments resolved since the last reset.
+        uint32_t ResolveCount = 0;
+        ///< Multisampled data read by the resolves since the last reset (bytes).
+        size_t ResolvedMemory = 0;
+    };
+    
+    static void ResetResolveStats();
+    static std::map<uint32_t, SampleStatistics> GetSampleStats();
     
     protected:
     // Constructor(s)/Destructor
@@ -304,6 +439,7 @@ class FrameBuffer
     // ----------------------------------------
     virtual void Invalidate() = 0;
     void DefineAttachments();
+    size_t ComputeMemorySize() const;
     
     // Destructor
     // ----------------------------------------
@@ -330,6 +466,10 @@ class FrameBuffer
     ///< Optional override for the specific draw target (attachment, cube face, mip level).
     FrameBufferDrawTarget m_DrawTargetOverride;
     
+    ///< Memory used by the attachments (and the sample count it is reported for).
+    size_t m_MemorySize = 0;
+    uint32_t m_MemorySamples = 1;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
     public:
@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents an image read back from a framebuffer, waiting to be written into a file.
+ */
+struct CapturedImage
+{
+    std::filesystem::path Path;     ///< Output file path (format defined by the extension).
+    uint32_t Width = 0;             ///< Image width (pixels).
+    uint32_t Height = 0;            ///< Image height (pixels).
+    int Channels = 0;               ///< Number of channels per pixel.
+    int Stride = 0;                 ///< Size of a row (bytes).
+    std::vector<char> Pixels;       ///< Pixel data (bottom row first).
+};
+
+/**
+ * @brief Writes the images captured from framebuffers into files.
+ *
+ * The `FrameCapture` class encodes and writes the captured images on worker threads, so saving
+ * the rendered frames does not stall the rendering. Together with the asynchronous readbacks of
+ * the framebuffers (`FrameBuffer::SaveAttachmentAsync()`), it forms the capture pipeline:
+ * the pixels are copied on the GPU, read back once the copy is complete (`Update()`), and
+ * written in the background.
+ *
+ * @note The number of images waiting to be written is bounded: submitting an image blocks while
+ * the queue is full.
+ */
+class FrameCapture
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(uint32_t workerCount = 0);
+    static void Shutdown();
+
+    // Capture
+    // ----------------------------------------
+    static void Update();
+    static void Flush();
+
+    static void Submit(CapturedImage&& image);
+    static bool Write(const CapturedImage& image);
+
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the capture pipeline.
+     */
+    struct Statistics
+    {
+        ///< Number of images waiting to be written.
+        uint32_t PendingCount = 0;
+        ///< Number of images written (since the last reset).
+        uint32_t WrittenCount = 0;
+        ///< Number of images that could not be written (since the last reset).
+        uint32_t FailedCount = 0;
+    };
+
+    static void ResetStats();
+    static Statistics GetStats();
+};
+
+} // namespace pixc
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Enumeration of shader binding points for storage blocks.
+ */
+enum class StorageBinding : uint32_t
+{
+    Input           = 0,    ///< Data read by a compute pass (e.g., partial results to be reduced).
+    Output          = 1,    ///< Data written by a compute pass.
+};
+
+/**
+ * @brief Represents a buffer of data (std430 layout) that can be read and written by the shaders.
+ *
+ * The `StorageBuffer` class provides an abstract interface for managing storage buffers, which
+ * hold the input and output data of the compute passes. The results written by the GPU can be
+ * read back asynchronously: `BeginReadback()` marks the point of the command stream to wait for,
+ * and the data is only retrieved once `IsReadbackReady()` reports that the GPU is done, so the
+ * CPU never stalls on the commands still in flight.
+ *
+ * This class defines the common interface for storage buffers across different rendering APIs.
+ * Concrete implementations for specific APIs inherit from this class and handle the actual
+ * buffer creation and management logic.
+ *
+ * Copying or moving `StorageBuffer` objects is disabled to ensure single ownership and prevent
+ * unintended buffer duplication.
+ */
+class StorageBuffer
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    static std::shared_ptr<StorageBuffer> Create(const uint32_t size);
+    // Destructor
+    // ----------------------------------------
+    /// @brief Delete the storage buffer.
+    virtual ~StorageBuffer() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Pure virtual function for attaching the buffer to a binding point.
+    /// @param binding The binding point.
+    virtual void Bind(const uint32_t binding) const = 0;
+    
+    // Readback
+    // ----------------------------------------
+    /// @brief Pure virtual function for requesting the data written by the commands issued so far.
+    virtual void BeginReadback() = 0;
+    /// @brief Pure virtual function for checking if the requested data can be read without waiting.
+    /// @return `true` if the GPU finished writing the data.
+    virtual bool IsReadbackReady() = 0;
+    /// @brief Check if a readback has been requested and not retrieved yet.
+    /// @return `true` if a readback is pending.
+    bool IsReadbackPending() const { return m_ReadbackPending; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Pure virtual function for updating the data of the buffer.
+    /// @param data The new data.
+    /// @param size The size (in bytes) of the data.
+    /// @param offset The offset (in bytes) where the data is written.
+    virtual void SetData(const void *data, const uint32_t size, const uint32_t offset = 0) = 0;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Pure virtual function for copying the data of the buffer into the CPU memory.
+    /// @param data The destination of the data.
+    /// @param size The size (in bytes) of the data.
+    /// @param offset The offset (in bytes) where the data is read.
+    virtual void GetData(void *data, const uint32_t size, const uint32_t offset = 0) = 0;
+    /// @brief Get the size of the buffer.
+    /// @return The size (in bytes).
+    uint32_t GetSize() const { return m_Size; }
+    
+protected:
+    // Base constructor
+    // ----------------------------------------
+    /// @brief Generate a storage buffer.
+    /// @param size The size (in bytes) of the buffer.
+    StorageBuffer(const uint32_t size) : m_Size(size) {}
+    
+    // Storage buffer variables
+    // ----------------------------------------
+protected:
+    ///< Size of the buffer (in bytes).
+    uint32_t m_Size = 0;
+    ///< Readback requested and not retrieved yet.
+    bool m_ReadbackPending = false;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(StorageBuffer);
+};
+
+} // namespace pixc
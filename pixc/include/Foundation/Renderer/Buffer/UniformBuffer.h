@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Enumeration of shader binding points for uniform blocks.
+ */
+enum class UniformBinding : uint32_t
+{
+    Material        = 0,    ///< Parameter block of the material (`MaterialBlock`)
+    Bones           = 1,    ///< Bone matrices of a skinned model (`BoneBlock`)
+};
+
+/**
+ * @brief Represents a buffer storing a block of uniforms (std140 layout) on the GPU.
+ *
+ * The `UniformBuffer` class provides an abstract interface for managing uniform buffers, which
+ * store a group of shader parameters that can be updated at once and attached to a shader
+ * binding point without setting each uniform individually.
+ *
+ * This class defines the common interface for uniform buffers across different rendering APIs.
+ * Concrete implementations for specific APIs inherit from this class and handle the actual
+ * buffer creation and management logic.
+ *
+ * Copying or moving `UniformBuffer` objects is disabled to ensure single ownership and prevent
+ * unintended buffer duplication.
+ */
+class UniformBuffer
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    static std::shared_ptr<UniformBuffer> Create(const uint32_t size);
+    // Destructor
+    // ----------------------------------------
+    /// @brief Delete the uniform buffer.
+    virtual ~UniformBuffer() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Pure virtual function for attaching a range of the buffer to a binding point.
+    /// @param binding The binding point.
+    /// @param offset The offset (in bytes) of the range.
+    /// @param size The size (in bytes) of the range.
+    virtual void BindRange(const uint32_t binding, const uint32_t offset,
+                           const uint32_t size) const = 0;
+    /// @brief Attach the whole buffer to a binding point.
+    /// @param binding The binding point.
+    void Bind(const uint32_t binding) const { BindRange(binding, 0, m_Size); }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Pure virtual function for updating the data of the buffer.
+    /// @param data The new data.
+    /// @param size The size (in bytes) of the data.
+    /// @param offset The offset (in bytes) where the data is written.
+    virtual void SetData(const void *data, const uint32_t size, const uint32_t offset = 0) = 0;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the size of the buffer.
+    /// @return The size (in bytes).
+    uint32_t GetSize() const { return m_Size; }
+    
+protected:
+    // Base constructor
+    // ----------------------------------------
+    /// @brief Generate a uniform buffer.
+    /// @param size The size (in bytes) of the buffer.
+    UniformBuffer(const uint32_t size) : m_Size(size) {}
+    
+    // Uniform buffer variables
+    // ----------------------------------------
+protected:
+    ///< Size of the buffer (in bytes).
+    uint32_t m_Size = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(UniformBuffer);
+};
+
+} // namespace pixc
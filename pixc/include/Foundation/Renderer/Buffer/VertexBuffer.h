@@ -31,6 +31,7 @@ public:
     // ----------------------------------------
     static std::shared_ptr<VertexBuffer> Create(const void *vertices, const uint32_t size,
                                                 const uint32_t count);
+    static std::shared_ptr<VertexBuffer> Create(const uint32_t size);
     // Destructor
     // ----------------------------------------
     /// @brief Delete the vertex buffer.
@@ -43,11 +44,21 @@ public:
     /// @brief Pure virtual function for unbinding the vertex buffer.
     virtual void Unbind() const = 0;
     
+    /// @brief Pure virtual function for updating the content of a dynamic vertex buffer.
+    /// @param vertices The new vertex data.
+    /// @param size Size of the vertex data in bytes (must fit in the allocated buffer).
+    /// @param count Number of vertices.
+    virtual void SetData(const void *vertices, const uint32_t size,
+                         const uint32_t count) = 0;
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the number of vertices.
     /// @return The amount of vertices defined.
     uint32_t GetCount() const { return m_Count; }
+    /// @brief Get the size of the allocated buffer.
+    /// @return The size in bytes.
+    uint32_t GetSize() const { return m_Size; }
     /// @brief Retrieve the current layout of the buffer, specifying the arrangement and format
     /// of vertex attributes within the buffer.
     /// @return The layout of the buffer.
@@ -64,11 +75,17 @@ protected:
     // Base constructor
     // ----------------------------------------
     /// @brief Generate a vertex buffer.
-    VertexBuffer(const uint32_t count) : m_Count(count) {};
+    /// @param size Size of the buffer in bytes.
+    /// @param count Number of vertices.
+    VertexBuffer(const uint32_t size, const uint32_t count)
+        : m_Size(size), m_Count(count)
+    {}
     
     // Vertex buffer variables
     // ----------------------------------------
 protected:
+    ///< Size of the allocated buffer (in bytes).
+    uint32_t m_Size = 0;
     ///< Number of vertices (element count).
     uint32_t m_Count = 0;
     ///< Layout for the vertex attributes.
@@ -47,6 +47,9 @@ public:
     /// @brief Get the camera field of view.
     /// @return Field of view angle (degrees).
     float GetFieldOfView() const { return m_FieldOfView; }
+    /// @brief Check if the far plane of the camera is at infinity.
+    /// @return `true` if the far plane is ignored by the projection.
+    bool IsFarPlaneInfinite() const { return m_InfiniteFarPlane; }
     
     // Setter(s)
     // ----------------------------------------
@@ -78,6 +81,13 @@ public:
         m_FieldOfView = fov;
         UpdateProjectionMatrix();
     }
+    /// @brief Move the far plane of the camera to infinity (best used with the reversed depth).
+    /// @param infinite Pass true to ignore the far plane in the projection.
+    void SetInfiniteFarPlane(const bool infinite)
+    {
+        m_InfiniteFarPlane = infinite;
+        UpdateProjectionMatrix();
+    }
     
 protected:
     // Transformation matrices
@@ -101,6 +111,8 @@ protected:
 protected:
     ///< Camera field of view (angle in degrees).
     float m_FieldOfView;
+    ///< Infinite far plane flag.
+    bool m_InfiniteFarPlane = false;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
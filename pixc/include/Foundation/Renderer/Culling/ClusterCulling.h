@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Foundation/Renderer/RendererTypes.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/// @brief Maximum number of triangles of a mesh cluster.
+constexpr uint32_t MeshClusterTriangles = 124;
+
+/**
+ * @brief Represents a small group of neighbouring triangles of a mesh (meshlet).
+ *
+ * The triangles of a cluster are contiguous in the index buffer of the mesh, so the clusters that
+ * can be seen are drawn as ranges of indices.
+ */
+struct MeshCluster
+{
+    uint32_t IndexOffset = 0;                   ///< First index of the cluster.
+    uint32_t IndexCount = 0;                    ///< Number of indices of the cluster.
+    
+    glm::vec3 Center = glm::vec3(0.0f);         ///< Center of the bounding sphere (model space).
+    float Radius = 0.0f;                        ///< Radius of the bounding sphere.
+    
+    glm::vec3 ConeAxis = glm::vec3(0.0f);       ///< Average direction of the triangle normals.
+    float ConeCutoff = 1.0f;                    ///< Spread of the normals (1 if never back-facing).
+};
+
+/**
+ * @brief Tests applied to the clusters of the meshes drawn in a render pass.
+ */
+enum class ClusterCullingMode : uint8_t
+{
+    None = 0,               ///< The meshes are drawn entirely.
+    Frustum,                ///< The clusters outside the view frustum are skipped.
+    FrustumAndBackface,     ///< Also skip the clusters facing away (passes culling back faces only).
+};
+
+/**
+ * @brief Skips the parts of the large meshes that cannot be seen.
+ *
+ * The meshes are split at import into clusters of neighbouring triangles (`BuildClusters()`),
+ * each with a bounding sphere and a cone bounding the normals of its triangles. Before a split mesh
+ * is drawn, its clusters are tested against the view frustum (and optionally their normal cone
+ * against the view position), and only the ranges of indices of the remaining clusters are drawn
+ * with a single multi-draw command.
+ *
+ * The meshes with many clusters are tested in batches over worker threads (the calling thread
+ * takes part too).
+ *
+ * @note The system must be used from the main (rendering) thread only.
+ */
+class ClusterCulling
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(uint32_t workerCount = 0);
+    static void Shutdown();
+    
+    // Clusters
+    // ----------------------------------------
+    static std::vector<MeshCluster> BuildClusters(const std::vector<glm::vec3>& positions,
+                                                  std::vector<uint32_t>& indices);
+    
+    // Culling
+    // ----------------------------------------
+    static void SetMode(ClusterCullingMode mode);
+    static ClusterCullingMode GetMode();
+    
+    static bool Cull(const std::vector<MeshCluster>& clusters, const glm::mat4& transform,
+                     std::vector<IndexRange>& ranges);
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the cluster culling.
+     */
+    struct Statistics
+    {
+        ///< Number of clusters tested.
+        uint32_t ClusterCount = 0;
+        ///< Number of clusters outside the view frustum.
+        uint32_t FrustumCulled = 0;
+        ///< Number of clusters facing away from the view.
+        uint32_t BackfaceCulled = 0;
+        ///< Number of ranges of indices drawn.
+        uint32_t DrawnRanges = 0;
+        ///< Number of threads testing the clusters (including the main thread).
+        uint32_t ThreadCount = 0;
+    };
+    
+    static void ResetStats();
+    static Statistics GetStats();
+};
+
+} // namespace pixc
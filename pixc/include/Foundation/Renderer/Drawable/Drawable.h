@@ -82,6 +82,13 @@ public:
         // Define the vertex attributes
         SetVertexAttributes(vertexBuffer);
     }
+    /// @brief Attach an already created vertex buffer (e.g. a dynamic one) to the drawable object.
+    /// @param vertexBuffer The vertex buffer, with its layout already defined.
+    void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer)
+    {
+        m_VertexBuffers.push_back(vertexBuffer);
+        SetVertexAttributes(vertexBuffer);
+    }
     /// @brief Define the index buffer for the drawable object.
     /// @param indices Set of indices.
     void SetIndexData(const std::vector<uint32_t> &indices)
@@ -94,6 +101,9 @@ public:
         // Copy the index data in the buffer
         m_IndexBuffer = IndexBuffer::Create(indices.data(), size);
     }
+    /// @brief Share an already created index buffer with the drawable object.
+    /// @param indexBuffer The index buffer.
+    void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) { m_IndexBuffer = indexBuffer; }
     /// @brief Sets the shader used for shading the drawable object.
     /// @param shader The shader program.
     virtual void SetShader(const std::shared_ptr<Shader>& shader) { m_Shader = shader; }
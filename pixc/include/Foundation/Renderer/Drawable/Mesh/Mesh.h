@@ -7,6 +7,7 @@
 #include "Foundation/Renderer/Material/Material.h"
 
 #include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/Culling/ClusterCulling.h"
 
 #include <glm/glm.hpp>
 
@@ -55,6 +56,20 @@ public:
         DefineVertices(vertices, layout);
         DefineIndices(indices);
     }
+    /// @brief Add a stream of per-vertex data in its own vertex buffer (e.g., skinning weights).
+    /// @note The attributes follow the ones of the previous buffers, and no CPU copy is kept.
+    /// @tparam StreamData The type of the per-vertex data.
+    /// @param data The per-vertex data (one element per vertex of the mesh).
+    /// @param layout The layout of the data in the buffer.
+    template<typename StreamData>
+    void AddVertexStream(const std::vector<StreamData> &data, const BufferLayout &layout)
+    {
+        m_Drawable->AddVertexData(data, layout);
+    }
+    void DefinePositionStream(const std::vector<glm::vec3> &positions);
+    /// @brief Define the clusters of the mesh, so only the visible ones are drawn.
+    /// @param clusters The clusters (ranges of the index buffer with their bounds).
+    void SetClusters(const std::vector<MeshCluster> &clusters) { m_Clusters = clusters; }
     
     // Setter(s)
     // ----------------------------------------
@@ -64,8 +79,16 @@ public:
     {
         m_Material = material;
         m_Drawable->SetShader(material->GetShader());
+        if (m_PositionDrawable)
+            m_PositionDrawable->SetShader(material->GetShader());
     }
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the material of the mesh.
+    /// @return The material, or null if none.
+    const std::shared_ptr<Material>& GetMaterial() const { return m_Material; }
+    
     // Render
     // ----------------------------------------
     void DrawMesh(const glm::mat4& transform = glm::mat4(1.0f),
@@ -81,9 +104,16 @@ private:
     
     ///< Rendering drawable data/state.
     std::shared_ptr<Drawable> m_Drawable;
+    ///< Positions alone, tightly packed (optional, used by the position only shaders).
+    std::shared_ptr<Drawable> m_PositionDrawable;
     
     ///< Mesh material
     std::shared_ptr<Material> m_Material;
+    
+    ///< Clusters of triangles (empty if the mesh is drawn entirely).
+    std::vector<MeshCluster> m_Clusters;
+    ///< Ranges of indices of the visible clusters (scratch data).
+    std::vector<IndexRange> m_VisibleRanges;
 };
 
 /**
@@ -139,6 +169,31 @@ void Mesh<VertexData>::DefineIndices(const std::vector<uint32_t> &indices)
     m_Indices = indices;
     // Define the index buffer in the drawable object
     m_Drawable->SetIndexData(indices);
+    if (m_PositionDrawable)
+        m_PositionDrawable->SetIndexBuffer(m_Drawable->GetIndexBuffer());
+}
+
+/**
+ * @brief Define a second copy of the vertex positions, alone in their own buffer.
+ *
+ * The shaders consuming only the positions (e.g., depth and shadow passes) then fetch 12 bytes per
+ * vertex instead of the full interleaved vertex data. The index buffer is shared.
+ *
+ * @param positions The positions of the vertices of the mesh (same order as the vertex data).
+ */
+template<typename VertexData>
+void Mesh<VertexData>::DefinePositionStream(const std::vector<glm::vec3> &positions)
+{
+    static const BufferLayout layout = {
+        { "a_Position", { DataType::Vec3 } }
+    };
+    
+    m_PositionDrawable = Drawable::Create();
+    m_PositionDrawable->AddVertexData(positions, layout);
+    if (m_Drawable->GetIndexBuffer())
+        m_PositionDrawable->SetIndexBuffer(m_Drawable->GetIndexBuffer());
+    if (m_Material)
+        m_PositionDrawable->SetShader(m_Material->GetShader());
 }
 
 /**
@@ -158,10 +213,26 @@ void Mesh<VertexData>::DrawMesh(const glm::mat4 &transform,
         return;
     }
     
-    if (m_Material)
-        Renderer::Draw(m_Drawable, m_Material, transform, primitive);
-    else
+    if (!m_Material)
+    {
         Renderer::Draw(m_Drawable, primitive);
+        return;
+    }
+    
+    // Fetch the positions alone if the shader does not need the other attributes
+    const auto& drawable = m_PositionDrawable && m_Material->GetShader()->IsPositionOnly() ?
+                           m_PositionDrawable : m_Drawable;
+    
+    // Draw only the visible clusters of the large meshes
+    if (primitive == PrimitiveType::Triangle && !m_Clusters.empty() &&
+        ClusterCulling::Cull(m_Clusters, transform, m_VisibleRanges))
+    {
+        if (!m_VisibleRanges.empty())
+            Renderer::DrawRanges(drawable, m_Material, m_VisibleRanges, transform, primitive);
+        return;
+    }
+    
+    Renderer::Draw(drawable, m_Material, transform, primitive);
 }
 
 } // namespace pixc
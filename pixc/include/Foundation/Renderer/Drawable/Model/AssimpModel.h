@@ -3,11 +3,14 @@
 #include "Foundation/Renderer/Drawable/Mesh/Mesh.h"
 #include "Foundation/Renderer/Drawable/Model/Model.h"
 
+#include "Foundation/Renderer/Animation/Animator.h"
+
 #include <glm/glm.hpp>
 
 struct aiNode;
 struct aiScene;
 struct aiMesh;
+struct aiAnimation;
 
 /**
  * @namespace pixc
@@ -25,12 +28,48 @@ struct AssimpVertexData
     glm::vec3 normal;           ///< Normal vector.
 };
 
+/**
+ * @brief Represents the geometry of a mesh read from a model file (CPU side).
+ */
+struct AssimpMeshData
+{
+    std::vector<AssimpVertexData> Vertices;     ///< Vertex data.
+    std::vector<uint32_t> Indices;              ///< Index data.
+    std::vector<SkinVertexData> Skin;           ///< Bones influencing each vertex (empty if not skinned).
+    std::vector<MeshCluster> Clusters;          ///< Clusters of triangles (empty if drawn entirely).
+};
+
+/**
+ * @brief Represents the data of a model read from a file (CPU side).
+ */
+struct AssimpModelData
+{
+    std::vector<AssimpMeshData> Meshes;                     ///< Geometry of the meshes.
+    std::shared_ptr<Skeleton> Rig;                          ///< Skeleton (null if the model is not skinned).
+    std::vector<std::shared_ptr<AnimationClip>> Animations; ///< Animations of the skeleton.
+};
+
 /**
  * @brief Represents a model loaded using the ASSIMP library.
  *
  * The `AssimpModel` class extends the base `Model` class and provides functionality for loading
  *  and processing models. It inherits the ability to load and render meshes from the base class and
  * adds specific processing using ASSIMP, such as parsing nodes and meshes from an ASSIMP scene.
+ *
+ * The processed geometry can be cached in binary mesh blobs, so subsequent loads skip the ASSIMP
+ * import entirely. The cache is disabled until a directory is defined (`SetCacheDirectory()`, the
+ * cache directory of the resources shared with the font atlases).
+ * `ReadModelData()` only touches CPU data and can be called from worker threads; the GPU resources
+ * are created when the model is constructed.
+ *
+ * Skinned models also import their skeleton, the bone weights of their vertices (as a second vertex
+ * stream) and their animations. They are deformed on the GPU by the skinned shader variants (e.g.,
+ * `PhongColorSkinned`), using the bone matrices of an `Animator`. Several characters can share the
+ * same model, each of them drawn with its own animator (`DrawAnimated()`).
+ *
+ * In the scene passes using the `Depth` material (shadow maps), the animated models are drawn with
+ * its skinned variant (`DepthSkinned`). Any other material without a skinned shader draws them in
+ * their bind pose.
  */
 class AssimpModel : public LoadedModel<AssimpVertexData>
 {
@@ -46,6 +85,28 @@ public:
     {
         LoadModel(filePath);
     }
+    /// @brief Define an assimp model from the data already read from a file source.
+    /// @param filePath The path to the model file.
+    /// @param data The data of the model (see `ReadModelData()`).
+    /// @param primitive The primitive type of the model.
+    AssimpModel(const std::filesystem::path& filePath, const AssimpModelData& data,
+                const PrimitiveType &primitive = PrimitiveType::Triangle)
+    : LoadedModel<AssimpVertexData>(filePath, primitive)
+    {
+        DefineModel(data);
+    }
+    /// @brief Define an assimp model sharing the meshes (GPU resources), skeleton and animations
+    /// of another one, with its own transformation and materials.
+    /// @param source The model whose geometry is shared.
+    /// @param primitive The primitive type of the model.
+    AssimpModel(const AssimpModel& source, const PrimitiveType &primitive)
+    : LoadedModel<AssimpVertexData>(source.m_FilePath, primitive),
+      m_Skeleton(source.m_Skeleton), m_Animations(source.m_Animations)
+    {
+        this->m_Meshes = source.m_Meshes;
+        this->m_BBox = source.m_BBox;
+        this->UpdateModelMatrix();
+    }
     
     /// @brief Delete the model.
     virtual ~AssimpModel() override = default;
@@ -54,11 +115,70 @@ public:
     // ----------------------------------------
     virtual void LoadModel(const std::filesystem::path& filePath) override;
     
+    static AssimpModelData ReadModelData(const std::filesystem::path& filePath);
+    
+    // Render
+    // ----------------------------------------
+    void DrawModelWithTransform(const glm::mat4 &transform = glm::mat4(1.0f)) override;
+    void DrawAnimated(const Animator& animator, const glm::mat4 &transform);
+    
+    // Animation
+    // ----------------------------------------
+    std::shared_ptr<Animator> CreateAnimator() const;
+    std::shared_ptr<AnimationClip> GetAnimation(const std::string& name) const;
+    
+    /// @brief Define the animator used to draw the model (`DrawModel()`).
+    /// @param animator The animator (null to draw the model in its bind pose).
+    void SetAnimator(const std::shared_ptr<Animator>& animator) { m_Animator = animator; }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if the model is deformed by a skeleton.
+    /// @return `true` if the model is skinned.
+    bool IsSkinned() const { return m_Skeleton != nullptr; }
+    /// @brief Get the skeleton of the model.
+    /// @return The skeleton, or null if the model is not skinned.
+    const std::shared_ptr<Skeleton>& GetSkeleton() const { return m_Skeleton; }
+    /// @brief Get the animations of the model.
+    /// @return The animations.
+    const std::vector<std::shared_ptr<AnimationClip>>& GetAnimations() const { return m_Animations; }
+    /// @brief Get the animator used to draw the model.
+    /// @return The animator, or null if none.
+    const std::shared_ptr<Animator>& GetAnimator() const { return m_Animator; }
+    
+    // Mesh cache
+    // ----------------------------------------
+    static void SetCacheDirectory(const std::filesystem::path& directory);
+    static std::filesystem::path GetCachePath(const std::filesystem::path& filePath);
+
 private:
     // Mesh processing
     // ----------------------------------------
-    void ProcessNode(aiNode *node, const aiScene *scene);
-    Mesh<AssimpVertexData> ProcessMesh(aiMesh *mesh);
+    static void ProcessNode(aiNode *node, const aiScene *scene, AssimpModelData& data);
+    static AssimpMeshData ProcessMesh(aiMesh *mesh, const Skeleton* skeleton);
+    
+    // Animation processing
+    // ----------------------------------------
+    static std::shared_ptr<Skeleton> ProcessSkeleton(const aiScene *scene);
+    static std::shared_ptr<AnimationClip> ProcessAnimation(aiAnimation *animation,
+                                                           const Skeleton& skeleton);
+    
+    void DefineModel(const AssimpModelData& data);
+    
+    // Mesh cache
+    // ----------------------------------------
+    static bool LoadMeshBlob(const std::filesystem::path& filePath, AssimpModelData& data);
+    static void SaveMeshBlob(const std::filesystem::path& filePath, const AssimpModelData& data);
+    
+    // Assimp model variables
+    // ----------------------------------------
+private:
+    ///< Skeleton deforming the meshes (null if the model is not skinned).
+    std::shared_ptr<Skeleton> m_Skeleton;
+    ///< Animations of the skeleton.
+    std::vector<std::shared_ptr<AnimationClip>> m_Animations;
+    ///< Animator used to draw the model.
+    std::shared_ptr<Animator> m_Animator;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
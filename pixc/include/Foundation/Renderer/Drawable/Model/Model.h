@@ -65,6 +65,18 @@ public:
     /// @brief Get the model orientation (yaw, pitch, roll).
     /// @return The model rotation angles.
     const glm::vec3& GetRotation() const { return m_Rotation; }
+    /// @brief Get the scaling factor of the model in the x, y, and z axis.
+    /// @return The model scaling factor.
+    const glm::vec3& GetScale() const { return m_Scale; }
+    /// @brief Get the up axis of the model.
+    /// @return The up axis direction.
+    const glm::vec3& GetUpAxis() const { return m_UpAxis; }
+    /// @brief Get the primitive type that defines the model.
+    /// @return The primitive type.
+    PrimitiveType GetPrimitive() const { return m_Primitive; }
+    /// @brief Get the bounding box of the model (in model space).
+    /// @return The bounding box.
+    virtual const BBox& GetBBox() const = 0;
     
     /// @brief Get the model matrix (transformation from model space to world space).
     /// @return The view matrix.
@@ -104,7 +116,7 @@ public:
         m_UpAxis = glm::normalize(upAxis);
         UpdateModelMatrix();
     }
-    
+
 protected:
     // Constructor(s)
     // ----------------------------------------
@@ -224,6 +236,9 @@ public:
     /// @brief Get the number of meshes representing the model.
     /// @return The number of meshes.
     int GetMeshNumber() const { return (int)m_Meshes.size(); }
+    /// @brief Get the bounding box of the model (in model space).
+    /// @return The bounding box.
+    const BBox& GetBBox() const override { return m_BBox; }
     
     // Setter(s)
     // ----------------------------------------
@@ -242,7 +257,7 @@ public:
         if (index >= 0 && index < m_Meshes.size())
             m_Meshes[index].SetMaterial(material);
     }
-    
+
 protected:
     // Bounding box definition
     // ----------------------------------------
@@ -301,7 +316,7 @@ public:
     /// @brief Get the directory where the model file is located.
     /// @return The directory of the model.
     std::string GetDirectory() { return m_FilePath.parent_path().string(); }
-    
+
 protected:
     /// @brief Define a model from a file source.
     /// @param filePath The path to the model file.
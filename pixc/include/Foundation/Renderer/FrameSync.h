@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Bounds the number of frames the GPU can lag behind the CPU.
+ *
+ * A fence is inserted at the end of each frame. Before recording a new frame, the CPU waits for
+ * the fence of the frame issued `N` frames earlier, where `N` is the number of frames in flight:
+ * - with one frame in flight, the CPU waits for the GPU every frame (lowest latency);
+ * - with more frames in flight, the CPU records ahead of the GPU (highest throughput).
+ *
+ * The dynamic resources written by the CPU every frame (e.g., the bone matrices) are duplicated
+ * into `MaxFramesInFlight` slots, one per frame in flight (see `GetSlot()`): the slot written is
+ * never read by a frame still executing on the GPU.
+ *
+ * @note Only the APIs without an internal synchronization of their frames use the fences
+ *       (OpenGL), the frames are never waited for otherwise.
+ */
+class FrameSync
+{
+public:
+    ///< Maximum number of frames in flight (number of slots of the dynamic resources).
+    static constexpr uint32_t MaxFramesInFlight = 3;
+    
+    // Initialization
+    // ----------------------------------------
+    static void Shutdown();
+    
+    // Frames
+    // ----------------------------------------
+    static void BeginFrame();
+    static void EndFrame();
+    
+    static bool IsFrameComplete(uint64_t frame);
+    static void WaitForFrame(uint64_t frame);
+    
+    // Getter(s)
+    // ----------------------------------------
+    static uint64_t GetFrame();
+    static uint32_t GetSlot();
+    static uint32_t GetFramesInFlight();
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetFramesInFlight(uint32_t count);
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the synchronization of the frames (measured over
+     * the last second).
+     */
+    struct Statistics
+    {
+        ///< Number of frames issued and not yet complete on the GPU.
+        uint32_t FramesInFlight = 0;
+        ///< Average time the CPU waited for the GPU before a frame (ms).
+        float WaitTime = 0.0f;
+        ///< Average time between the end of a frame on the CPU and its completion on the GPU (ms).
+        float Latency = 0.0f;
+        ///< Frames completed by the GPU per second.
+        float FramesPerSecond = 0.0f;
+    };
+    
+    static void ResetStats();
+    static Statistics GetStats();
+
+private:
+    static void CollectCompleted();
+};
+
+} // namespace pixc
@@ -29,6 +29,13 @@ public:
     virtual void Init() = 0;
     static std::unique_ptr<GraphicsContext> Create(void* window);
     
+    // Usage
+    // ----------------------------------------
+    /// @brief Make the context current on the calling thread (APIs bound to a thread only).
+    virtual void MakeCurrent() {}
+    /// @brief Release the context from the calling thread (APIs bound to a thread only).
+    virtual void ReleaseCurrent() {}
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the graphics context instance.
@@ -8,6 +8,8 @@
 
 #include "Foundation/Renderer/RendererCommand.h"
 
+#include <atomic>
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -21,10 +23,18 @@ namespace pixc {
  * It provides methods to set and retrieve the light's position, environment map, and additional properties
  * such as the shadow camera and 3D model representation.
  *
+ * The environment map is baked into a cube map over several frames (see `Update()`): a fixed
+ * number of steps is processed per frame, while the previous environment stays in use. The new
+ * environment replaces it at once when all the steps are done. The baking state belongs to the
+ * thread drawing the frames, changes from the main thread are handed over to it.
+ *
+ * @note The steps are counted rather than timed: the commands of a step are only queued on the
+ * CPU, so the time measured there says little about the work left to the GPU.
+ *
  * Copying or moving `EnvironmentLight` objects is disabled to ensure single ownership and prevent
  * unintended duplication of light resources.
  */
-class EnvironmentLight : public Light
+class EnvironmentLight : public Light, public std::enable_shared_from_this<EnvironmentLight>
 {
 public:
     // Constructor(s)/Destructor
@@ -42,6 +52,11 @@ public:
     
     virtual void SetEnvironmentMap(const std::shared_ptr<Texture>& texture);
     
+    /// @brief Set the number of baking steps processed per frame.
+    /// @param steps The number of steps (zero to bake all the steps not waiting for the GPU in a
+    ///              single frame).
+    void SetBakeStepsPerFrame(uint32_t steps) { m_BakeStepsPerFrame = steps; }
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the ambient light strength.
@@ -49,17 +64,39 @@ public:
     float GetAmbientStrength() const { return m_AmbientStrength; }
     
     /// @brief Get the environment map.
-    /// @return The texture describing the environment.
-    const std::shared_ptr<Texture>& GetEnvironmentMap() { return m_EnvironmentMap; }
+    /// @return The texture describing the environment (the one being baked, if any).
+    const std::shared_ptr<Texture>& GetEnvironmentMap()
+    {
+        return m_Bake.Source ? m_Bake.Source : m_EnvironmentMap;
+    }
+    
+    /// @brief Get the number of baking steps processed per frame.
+    /// @return The number of steps.
+    uint32_t GetBakeStepsPerFrame() const { return m_BakeStepsPerFrame; }
+    /// @brief Check if an environment map is being baked (can be called from any thread).
+    /// @return `true` if the baking is not done yet.
+    bool IsBaking() const { return m_BakeProgress < 1.0f; }
+    /// @brief Get the progress of the baking of the environment (can be called from any thread).
+    /// @return The fraction of the steps done (1 if no environment is being baked).
+    float GetBakeProgress() const { return m_BakeProgress; }
     
     //const std::shared_ptr<Texture>& GetIrradianceMap();
     //const std::shared_ptr<Texture>& GetPreFilterMap();
     
+    // Update
+    // ----------------------------------------
+    void Update() override;
+    
     // Render
     // ----------------------------------------
     /// @brief Renders the 3D model that represents the light source.
     void DrawLight() override;
     
+    /// @brief Check if the light represents the background of the scene.
+    /// @return `true` if an environment map is defined.
+    bool HasBackground() const override { return m_EnvironmentMap != nullptr; }
+    void DrawBackground() override;
+    
 protected:
     // Initialization
     // ----------------------------------------
@@ -73,9 +110,12 @@ protected:
     void DefineLightProperties(const std::shared_ptr<Shader>& shader,
                                LightProperty properties) override;
     
-    // Update
+    // Baking
     // ----------------------------------------
-    virtual void UpdateEnvironment();
+    virtual void BeginBake(const std::shared_ptr<Texture>& texture);
+    virtual uint32_t GetBakeStepCount() const;
+    virtual bool BakeStep(const uint32_t step);
+    virtual void FinishBake();
     
     // Environment variables
     // ----------------------------------------
@@ -90,6 +130,26 @@ protected:
     /// Environment orientation (pitch, yaw, and roll angles).
     glm::vec3 m_Rotation = glm::vec3(0.0f, -90.0f, 0.0f);
     
+    /**
+     * Represents the state of the environment map being baked.
+     */
+    struct BakeState
+    {
+        ///< Environment map being baked (null if none).
+        std::shared_ptr<Texture> Source;
+        ///< Cube map being rendered (replaces the environment cube map when done).
+        std::shared_ptr<FrameBuffer> Target;
+        ///< Next step to be processed.
+        uint32_t Step = 0;
+    };
+    
+    ///< State of the baking (modified on the thread drawing the frames).
+    BakeState m_Bake;
+    ///< Number of baking steps per frame (all of them if zero).
+    uint32_t m_BakeStepsPerFrame = 1;
+    ///< Fraction of the baking steps done.
+    std::atomic<float> m_BakeProgress = 1.0f;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
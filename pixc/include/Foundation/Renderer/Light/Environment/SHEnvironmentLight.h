@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Foundation/Renderer/Light/Environment/EnvironmentLight.h"
+#include "Foundation/Renderer/Buffer/StorageBuffer.h"
 #include <glm/glm.hpp>
 
 /**
@@ -60,6 +61,16 @@ private:
     SHMatrix m_Anisotropic;                 ///< SH coefficients for anisotropic irradiance (direction-dependent).
 };
 
+/**
+ * @brief Represents an environment light whose irradiance is described with spherical harmonics.
+ *
+ * The SH coefficients are computed on the GPU each time the environment map changes, as the last
+ * steps of its baking. When the compute passes are supported, the texels of the environment cube
+ * map are projected by work group into partial sums, reduced into a storage buffer and read back
+ * asynchronously. Otherwise, the coefficients are computed by a fragment pass into a small
+ * framebuffer, also read back asynchronously. The previous coefficients are kept until the GPU is
+ * done, and replaced along with the environment cube map.
+ */
 class SHEnvironmentLight : public EnvironmentLight
 {
 public:
@@ -70,26 +81,66 @@ public:
     /// @brief Destructor for the environment light.
     ~SHEnvironmentLight() override = default;
     
+    /**
+     * Represents the luminance statistics of the environment map.
+     */
+    struct LuminanceStatistics
+    {
+        ///< Average luminance over the sphere of directions.
+        float Average = 0.0f;
+        ///< Maximum luminance of a texel (the average when computed by the fragment pass).
+        float Max = 0.0f;
+    };
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the luminance statistics of the environment map (e.g., for the auto-exposure).
+    /// @return The luminance statistics computed with the current coefficients.
+    const LuminanceStatistics& GetLuminance() const { return m_Luminance; }
+    
 private:
     // Initialization
     // ----------------------------------------
     void SetupFrameBuffers(const uint32_t size) override;
     void SetupResources() override;
+    void SetupComputeResources();
     
     // Properties
     // ----------------------------------------
     void DefineLightProperties(const std::shared_ptr<Shader>& shader,
                                LightProperty properties) override;
     
-    // Update
+    // Baking
     // ----------------------------------------
-    void UpdateEnvironment() override;
+    void BeginBake(const std::shared_ptr<Texture>& texture) override;
+    uint32_t GetBakeStepCount() const override;
+    bool BakeStep(const uint32_t step) override;
+    void FinishBake() override;
+    
+    void ProjectEnvironment(const std::shared_ptr<FrameBuffer>& environment);
+    void RenderCoefficients(const std::shared_ptr<FrameBuffer>& environment);
+    bool RetrieveCoefficients();
     
     // Environment variables
     // ----------------------------------------
 private:
     ///< Spherical harmonics coefficients.
     SHCoefficients m_Coefficients;
+    ///< Luminance statistics of the environment map.
+    LuminanceStatistics m_Luminance;
+    
+    ///< Coefficients and luminance statistics of the environment being baked.
+    SHCoefficients m_BakedCoefficients;
+    LuminanceStatistics m_BakedLuminance;
+    ///< Whether the projection of the environment being baked has been submitted.
+    bool m_Projected = false;
+    ///< Pixels of the coefficients read back (fragment path only, empty until received).
+    std::shared_ptr<std::vector<char>> m_Readback;
+    
+    ///< Partial sums of the projection work groups (compute path only).
+    std::shared_ptr<StorageBuffer> m_Partials;
+    ///< Reduced coefficients and luminance statistics (compute path only).
+    std::shared_ptr<StorageBuffer> m_Result;
 };
 
 } // namespace pixc
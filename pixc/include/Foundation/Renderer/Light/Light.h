@@ -2,6 +2,7 @@
 
 #include "Foundation/Core/Resources.h"
 
+#include "Foundation/Renderer/RendererAPI.h"
 #include "Foundation/Renderer/Shader/Shader.h"
 #include "Foundation/Renderer/Material/Material.h"
 #include "Foundation/Renderer/Buffer/FrameBuffer.h"
@@ -18,6 +19,19 @@
  */
 namespace pixc {
 
+/**
+ * @brief State of a light used to draw a frame (captured with the frame, see `Light::Capture()`).
+ */
+struct LightState
+{
+    glm::mat4 ModelMatrix = glm::mat4(1.0f);        ///< Transformation of the light model.
+    glm::vec4 Vector = glm::vec4(0.0f);             ///< Position (.w = 1) or direction (.w = 0).
+    glm::vec3 Color = glm::vec3(1.0f);              ///< Light color.
+    float DiffuseStrength = 0.0f;                   ///< Diffuse strength.
+    float SpecularStrength = 0.0f;                  ///< Specular strength.
+    glm::mat4 ShadowTransform = glm::mat4(1.0f);    ///< Projection-view matrix of the shadow camera.
+};
+
 /**
  * @brief Abstract base class for all light sources in the engine.
  *
@@ -41,14 +55,44 @@ public:
     /// @return The light 3D model.
     const std::shared_ptr<BaseModel>& GetModel() { return m_Model; }
     
+    // Frame state
+    // ----------------------------------------
+    /// @brief Capture the current state of the light, to draw a frame later on.
+    /// @return The state of the light.
+    virtual LightState Capture() const
+    {
+        LightState state;
+        if (m_Model)
+            state.ModelMatrix = m_Model->GetModelMatrix();
+        return state;
+    }
+    /// @brief Draw the light with a captured state until the next one is applied.
+    /// @param state The state captured with the frame being drawn.
+    void Apply(const LightState& state)
+    {
+        m_State = state;
+        m_Applied = true;
+    }
+    
+    // Update
+    // ----------------------------------------
+    /// @brief Update the resources of the light before a frame is drawn (nothing by default).
+    virtual void Update() {}
+    
     // Render
     // ----------------------------------------
     /// @brief Renders the 3D model that represents the light source.
     virtual void DrawLight()
     {
         if (m_Model)
-            m_Model->DrawModel();
+            m_Model->DrawModelWithTransform(GetDrawState().ModelMatrix);
     }
+    /// @brief Check if the light represents the background of the scene (no background by default).
+    /// @return `true` if the light is drawn as the background (see `DrawBackground()`).
+    virtual bool HasBackground() const { return false; }
+    /// @brief Renders the background represented by the light, behind the models already drawn
+    /// (no background by default).
+    virtual void DrawBackground() {}
     
     /// @brief Define light properties into the uniforms of the shader program.
     /// @param shader The shader program.
@@ -71,6 +115,10 @@ protected:
     /// @brief Define a base light.
     Light() = default;
     
+    /// @brief Get the state used to draw the light (the state applied, or the current one).
+    /// @return The state of the light.
+    LightState GetDrawState() const { return m_Applied ? m_State : Capture(); }
+    
     // Light variables
     // ----------------------------------------
 protected:
@@ -79,6 +127,10 @@ protected:
     ///< Light model (visible in the scene if defined).
     std::shared_ptr<BaseModel> m_Model;
     
+    ///< State captured with the frame being drawn (see `Apply()`).
+    LightState m_State;
+    bool m_Applied = false;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
@@ -144,6 +196,33 @@ public:
     /// @brief Get the framebuffer with the rendered shadow map.
     /// @return The shadow map framebuffer.
     const std::shared_ptr<FrameBuffer>& GetShadowFrameBuffer() const { return m_Shadow.FrameBuffer; }
+    /// @brief Get the sampler used to read the shadow maps (the depth outside the map is the far plane).
+    /// @return The shadow map sampler (shared by all the lights).
+    static std::shared_ptr<Sampler> GetShadowSampler()
+    {
+        SamplerSpecification spec;
+        spec.Filter = { TextureFilter::Nearest, TextureFilter::Nearest, TextureFilter::None };
+        spec.Wrap = TextureWrap::ClampToBorder;
+        spec.BorderColor = glm::vec4(RendererAPI::GetFarDepth());
+        spec.MipMaps = false;
+        return Sampler::Get(spec);
+    }
+    
+    // Frame state
+    // ----------------------------------------
+    /// @brief Capture the current state of the light, to draw a frame later on.
+    /// @return The state of the light.
+    LightState Capture() const override
+    {
+        LightState state = Light::Capture();
+        state.Vector = m_Vector;
+        state.Color = m_Color;
+        state.DiffuseStrength = m_DiffuseStrength;
+        state.SpecularStrength = m_SpecularStrength;
+        if (m_Shadow.Camera)
+            state.ShadowTransform = m_Shadow.Camera->GetProjectionMatrix() * m_Shadow.Camera->GetViewMatrix();
+        return state;
+    }
     
     // Properties
     // ----------------------------------------
@@ -153,21 +232,22 @@ public:
     void DefineLightProperties(const std::shared_ptr<Shader>& shader,
                                LightProperty properties) override
     {
+        LightState state = GetDrawState();
 
         // Define general light properties if specified by the flags
         if (HasProperty(properties, LightProperty::GeneralProperties))
-            DefineGeneralProperties(shader);
+            DefineGeneralProperties(shader, state);
     
         // Define strength properties for the light
-        DefineStrenghtProperties(shader, properties);
+        DefineStrenghtProperties(shader, state, properties);
         
         // Define transformation properties if specified by the flags
         if (HasProperty(properties, LightProperty::ShadowProperties))
         {
-            DefineTranformProperties(shader);
+            DefineTranformProperties(shader, state);
             uint32_t slot = static_cast<uint32_t>(TextureIndex::ShadowMap0) + GetID();
             shader->SetTexture("u_Environment.Lights[" + std::to_string(GetID()) + "].ShadowMap",
-                               GetShadowMap(), slot);
+                               GetShadowMap(), slot, GetShadowSampler());
         }
     }
     
@@ -176,8 +256,9 @@ public:
     /// @brief Initialize the shadow map framebuffer.
     /// @param width The width of the shadow map in pixels.
     /// @param height The height of the shadow map in pixels.
-    /// @param format The depth texture format.
-    void InitShadowFrameBuffer(int width, int height, TextureFormat format = TextureFormat::DEPTH24)
+    /// @param format The depth texture format (32-bit float by default if the depth is reversed).
+    void InitShadowFrameBuffer(int width, int height,
+                               TextureFormat format = RendererAPI::GetDepthFormat(TextureFormat::DEPTH24))
     {
         m_Shadow.Camera->SetViewportSize(width, height);
         
@@ -211,28 +292,30 @@ protected:
     // ----------------------------------------
     /// @brief Define the general properties (from the light) into the uniforms of the shader program.
     /// @param shader Shader program to be used.
-    void DefineGeneralProperties(const std::shared_ptr<Shader> &shader)
+    /// @param state State of the light being drawn.
+    void DefineGeneralProperties(const std::shared_ptr<Shader> &shader, const LightState& state)
     {
-        shader->SetVec3("u_Environment.Lights[" + std::to_string(m_ID) + "].Color", m_Color);
-        shader->SetVec4("u_Environment.Lights[" + std::to_string(m_ID) + "].Vector", m_Vector);
+        shader->SetVec3("u_Environment.Lights[" + std::to_string(m_ID) + "].Color", state.Color);
+        shader->SetVec4("u_Environment.Lights[" + std::to_string(m_ID) + "].Vector", state.Vector);
     }
     /// @brief Define the strength properties (from the light) into the uniforms of the shader program.
     /// @param shader Shader program to be used.
-    void DefineStrenghtProperties(const std::shared_ptr<Shader> &shader,
+    /// @param state State of the light being drawn.
+    void DefineStrenghtProperties(const std::shared_ptr<Shader> &shader, const LightState& state,
                                   LightProperty properties)
     {
         if (HasProperty(properties, LightProperty::DiffuseLighting))
-            shader->SetFloat("u_Environment.Lights[" + std::to_string(m_ID) + "].Ld", m_DiffuseStrength);
+            shader->SetFloat("u_Environment.Lights[" + std::to_string(m_ID) + "].Ld", state.DiffuseStrength);
         if (HasProperty(properties, LightProperty::SpecularLighting))
-            shader->SetFloat("u_Environment.Lights[" + std::to_string(m_ID) + "].Ls", m_SpecularStrength);
+            shader->SetFloat("u_Environment.Lights[" + std::to_string(m_ID) + "].Ls", state.SpecularStrength);
     }
     /// @brief Define the transformation properties (from the light) into the uniforms of the shader program.
     /// @param shader Shader program to be used.
-    void DefineTranformProperties(const std::shared_ptr<Shader> &shader)
+    /// @param state State of the light being drawn.
+    void DefineTranformProperties(const std::shared_ptr<Shader> &shader, const LightState& state)
     {
         shader->SetMat4("u_Environment.Lights[" + std::to_string(m_ID) + "].Transform",
-                        m_Shadow.Camera->GetProjectionMatrix() *
-                        m_Shadow.Camera->GetViewMatrix());
+                        state.ShadowTransform);
     }
     
 protected:
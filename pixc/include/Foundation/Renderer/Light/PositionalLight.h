@@ -79,7 +79,7 @@ public:
     void DrawLight() override
     {
         auto material = GetOrCreateLightMaterial();
-        material->SetColor(glm::vec4(m_Color, 1.0f));
+        material->SetColor(glm::vec4(GetDrawState().Color, 1.0f));
         Light::DrawLight();
     }
     
@@ -60,6 +60,18 @@ public:
         m_FarPlane = farPlane;
     }
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check whether the depth is linearized.
+    /// @return True if the depth is linearized.
+    bool IsLinearizeDepth() const { return m_LinearizeDepth; }
+    /// @brief Get the near plane used for depth linearization.
+    /// @return The near clipping plane.
+    float GetNearPlane() const { return m_NearPlane; }
+    /// @brief Get the far plane used for depth linearization.
+    /// @return The far clipping plane.
+    float GetFarPlane() const { return m_FarPlane; }
+    
 private:
     // Properties
     // ----------------------------------------
@@ -65,6 +65,17 @@ public:
         for (auto& pair : lights)
             DefineLightProperties(pair.second);
     }
+    /// @brief Define the light properties linked to the material.
+    /// @param lights The lights of the scene (as captured for the frame).
+    /// @param casters The number of light casters among the lights.
+    void DefineLightProperties(const std::vector<std::shared_ptr<Light>>& lights, int casters)
+    {
+        m_Shader->Bind();
+        m_Shader->SetInt("u_Environment.LightCount", casters);
+        
+        for (const auto& light : lights)
+            DefineLightProperties(light);
+    }
     
 protected:
     /// @brief Define the light properties linked to the material.
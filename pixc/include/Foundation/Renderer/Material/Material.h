@@ -3,9 +3,12 @@
 #include "Foundation/Core/Library.h"
 
 #include "Foundation/Renderer/Material/Properties/MaterialProperty.h"
+#include "Foundation/Renderer/Material/Properties/ParameterBlock.h"
 #include "Foundation/Renderer/Shader/Shader.h"
 #include "Foundation/Renderer/Texture/Texture.h"
 
+#include <atomic>
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -20,6 +23,10 @@ namespace pixc {
  * material-specific properties. Derived classes are responsible for implementing the
  * `SetMaterialProperties()` method to define the material's specific properties.
  *
+ * Each material is identified by a pipeline ID (shared by all the materials using the same
+ * shader) and an instance ID (unique to the material), which can be used to sort and batch
+ * the draws.
+ *
  * Copying or moving `Material` objects is disabled to ensure single ownership and prevent
  * unintended duplication of material resources.
  */
@@ -36,7 +43,7 @@ public:
         std::string name = filePath.stem().string();
         auto shader = s_ShaderLibrary.Exists(name) ?
             s_ShaderLibrary.Get(name) : s_ShaderLibrary.Load(name, filePath);
-        m_Shader = shader;
+        SetShader(shader);
     }
     /// @brief Destructor for the material.
     virtual ~Material() = default;
@@ -61,6 +68,30 @@ public:
     /// @return shader program.
     std::shared_ptr<Shader> GetShader() { return m_Shader; }
     
+    /// @brief Get the identifier of the pipeline (shader) used by the material.
+    /// @return The pipeline ID (shared by all the materials using the same shader).
+    uint32_t GetPipelineID() const { return m_PipelineID; }
+    /// @brief Get the identifier of the material.
+    /// @return The instance ID (unique to each material).
+    uint32_t GetInstanceID() const { return m_InstanceID; }
+    
+    /// @brief Get the material this one has been instanced from.
+    /// @return The parent material, or `nullptr` if the material is not an instance.
+    virtual std::shared_ptr<Material> GetParent() const { return nullptr; }
+    /// @brief Get the material defining the shader and the default properties.
+    /// @return The root parent of a material instance, or the material itself.
+    Material& GetDefinition()
+    {
+        Material* material = this;
+        while (auto parent = material->GetParent())
+            material = parent.get();
+        return *material;
+    }
+    
+    /// @brief Get the block storing the material properties on the GPU.
+    /// @return The parameter block, or `nullptr` if the properties are set individually.
+    virtual ParameterBlock* GetParameterBlock() { return nullptr; }
+    
     /// @brief Returns the active flags for the material.
     /// @return Shading flags.
     MaterialProperty GetMaterialProperties() { return m_Properties; }
@@ -71,13 +102,37 @@ public:
     {
         return (m_Properties & flag) != MaterialProperty::None;
     }
-    
+
+    /// @brief Get the library containing the shaders shared by all materials.
+    /// @return The shader library.
+    static ShaderLibrary& GetShaderLibrary() { return s_ShaderLibrary; }
+
     // Properties
     // ----------------------------------------
     /// @brief Set the material properties.
     virtual void SetMaterialProperties()
     {}
     
+protected:
+    // Constructor(s)
+    // ----------------------------------------
+    /// @brief Generate a material using an already loaded shader.
+    /// @param shader The shader used by the material.
+    Material(const std::shared_ptr<Shader>& shader)
+    {
+        SetShader(shader);
+    }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Define the shader of the material (and its pipeline ID).
+    /// @param shader The shader program.
+    void SetShader(const std::shared_ptr<Shader>& shader)
+    {
+        m_Shader = shader;
+        m_PipelineID = shader ? shader->GetID() : 0;
+    }
+    
     // Material variables
     // ----------------------------------------
 protected:
@@ -87,8 +142,16 @@ protected:
     ///< Properties of the material used for shading.
     MaterialProperty m_Properties = MaterialProperty::None;
     
+    ///< Identifier of the pipeline (shader).
+    uint32_t m_PipelineID = 0;
+    ///< Identifier of the material.
+    uint32_t m_InstanceID = ++s_InstanceCount;
+    
     ///< Library containing all shader that have been loaded.
     static inline ShaderLibrary s_ShaderLibrary;
+    ///< Number of materials created (materials can be created on the worker threads of the
+    ///< asset manager).
+    static inline std::atomic<uint32_t> s_InstanceCount = 0;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
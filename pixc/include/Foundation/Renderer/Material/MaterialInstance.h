@@ -0,0 +1,253 @@
+#pragma once
+
+#include "Foundation/Renderer/Material/Material.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief A material sharing the shader and the default properties of a parent material.
+ *
+ * The `MaterialInstance` class only stores the properties it overrides, packed in a single block
+ * of data. When bound, the parent material is bound first (shader and default properties), then
+ * the overridden properties are applied. If the parent stores its properties in a parameter
+ * block, the instance builds its own block from the parent one and only uploads it when one of
+ * the properties (of the instance or the parent) has been modified.
+ *
+ * Instances share the pipeline ID of their parent, so draws can be sorted and batched by shader.
+ * They can be added to a `MaterialLibrary` with `Create<MaterialInstance>(name, parent)`.
+ *
+ * Copying or moving `MaterialInstance` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class MaterialInstance : public Material
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an instance of a material.
+    /// @param parent The material defining the shader and the default properties.
+    MaterialInstance(const std::shared_ptr<Material>& parent)
+        : Material(parent->GetShader()), m_Parent(parent)
+    {
+        m_Properties = parent->GetMaterialProperties();
+    }
+    /// @brief Destructor for the material instance.
+    ~MaterialInstance() override = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the parent material and apply the overridden properties.
+    void Bind() override
+    {
+        m_Parent->Bind();
+        SetMaterialProperties();
+    }
+    /// @brief Unbind the parent material.
+    void Unbind() override
+    {
+        m_Parent->Unbind();
+    }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Override a property of the parent material.
+    /// @tparam T The type of the property (e.g., float, glm::vec3, etc.).
+    /// @param name The uniform name of the property (e.g., "u_Material.Kd").
+    /// @param value The value of the property.
+    template<typename T>
+    void Set(const std::string& name, const T& value)
+    {
+        auto it = std::find_if(m_Overrides.begin(), m_Overrides.end(),
+                               [&name](const Override& o) { return o.Name == name; });
+        if (it == m_Overrides.end())
+        {
+            Override property;
+            property.Name = name;
+            property.Type = utils::data::GetDataType<T>();
+            property.Offset = static_cast<uint32_t>(m_Data.size());
+            m_Data.resize(m_Data.size() + sizeof(T));
+            it = m_Overrides.insert(m_Overrides.end(), property);
+        }
+        
+        PIXEL_CORE_ASSERT(it->Type == utils::data::GetDataType<T>(),
+                          "Property '" + name + "' type mismatch!");
+        memcpy(&m_Data[it->Offset], &value, sizeof(T));
+        m_ParameterBlock.MarkDirty();
+    }
+    /// @brief Override a texture of the parent material.
+    /// @param name The uniform name of the texture (e.g., "u_Material.TextureMap").
+    /// @param texture The texture.
+    /// @param slot The texture slot.
+    void SetTexture(const std::string& name, const std::shared_ptr<Texture>& texture, uint32_t slot)
+    {
+        for (auto& property : m_Textures)
+        {
+            if (property.Name == name)
+            {
+                property.Texture = texture;
+                property.Slot = slot;
+                return;
+            }
+        }
+        m_Textures.push_back({ name, texture, slot });
+    }
+    /// @brief Remove all the overridden properties (the parent ones are used again).
+    void Reset()
+    {
+        m_Overrides.clear();
+        m_Textures.clear();
+        m_Data.clear();
+        m_ParameterBlock.MarkDirty();
+    }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the material this one has been instanced from.
+    /// @return The parent material.
+    std::shared_ptr<Material> GetParent() const override { return m_Parent; }
+    /// @brief Get the block storing the material properties on the GPU.
+    /// @return The parameter block.
+    ParameterBlock* GetParameterBlock() override { return &m_ParameterBlock; }
+    /// @brief Check if a property of the parent material is overridden.
+    /// @param name The uniform name of the property.
+    /// @return `true` if the instance defines its own value.
+    bool IsOverridden(const std::string& name) const
+    {
+        return std::any_of(m_Overrides.begin(), m_Overrides.end(),
+                           [&name](const Override& o) { return o.Name == name; }) ||
+               std::any_of(m_Textures.begin(), m_Textures.end(),
+                           [&name](const TextureOverride& o) { return o.Name == name; });
+    }
+
+protected:
+    // Properties
+    // ----------------------------------------
+    /// @brief Apply the overridden properties (after the parent ones).
+    void SetMaterialProperties() override
+    {
+        for (const auto& property : m_Textures)
+            m_Shader->SetTexture(property.Name, property.Texture, property.Slot);
+        
+        if (m_Overrides.empty())
+            return;
+        
+        // Build the parameter block from the parent one (when it changes)
+        ParameterBlock* parentBlock = m_Parent->GetParameterBlock();
+        if (parentBlock && !parentBlock->GetData().empty())
+        {
+            if (m_ParentVersion != parentBlock->GetVersion())
+            {
+                m_ParentVersion = parentBlock->GetVersion();
+                m_ParameterBlock.MarkDirty();
+            }
+            
+            std::vector<char> data;
+            if (m_ParameterBlock.IsDirty())
+            {
+                data = parentBlock->GetData();
+                for (const auto& property : m_Overrides)
+                {
+                    auto member = parentBlock->GetMember(property.Name);
+                    if (member && member->Type == property.Type)
+                        memcpy(&data[member->Offset], &m_Data[property.Offset],
+                               utils::data::GetDataSize(property.Type));
+                }
+            }
+            
+            const auto& block = data.empty() ? m_ParameterBlock.GetData() : data;
+            if (m_ParameterBlock.Bind(m_Shader, block.data(), static_cast<uint32_t>(block.size())))
+            {
+                // Only set the properties that are not part of the block
+                for (const auto& property : m_Overrides)
+                {
+                    if (!parentBlock->GetMember(property.Name))
+                        SetUniform(property);
+                }
+                return;
+            }
+        }
+        
+        // Set the properties individually otherwise
+        for (const auto& property : m_Overrides)
+            SetUniform(property);
+    }
+
+private:
+    /**
+     * @brief Describes a property overridden by the instance.
+     */
+    struct Override
+    {
+        std::string Name;                       ///< Uniform name.
+        DataType Type = DataType::None;         ///< Type of the property.
+        uint32_t Offset = 0;                    ///< Offset (in bytes) of the value in the packed data.
+    };
+    
+    /**
+     * @brief Describes a texture overridden by the instance.
+     */
+    struct TextureOverride
+    {
+        std::string Name;                       ///< Uniform name.
+        std::shared_ptr<Texture> Texture;       ///< Texture.
+        uint32_t Slot = 0;                      ///< Texture slot.
+    };
+    
+    /// @brief Set an overridden property into its uniform.
+    /// @param property The overridden property.
+    void SetUniform(const Override& property)
+    {
+        const char* value = &m_Data[property.Offset];
+        switch (property.Type)
+        {
+            case DataType::Uint:
+                m_Shader->SetUint(property.Name, *reinterpret_cast<const uint32_t*>(value)); break;
+            case DataType::Int:
+                m_Shader->SetInt(property.Name, *reinterpret_cast<const int*>(value)); break;
+            case DataType::Float:
+                m_Shader->SetFloat(property.Name, *reinterpret_cast<const float*>(value)); break;
+            case DataType::Vec2:
+                m_Shader->SetVec2(property.Name, *reinterpret_cast<const glm::vec2*>(value)); break;
+            case DataType::Vec3:
+                m_Shader->SetVec3(property.Name, *reinterpret_cast<const glm::vec3*>(value)); break;
+            case DataType::Vec4:
+                m_Shader->SetVec4(property.Name, *reinterpret_cast<const glm::vec4*>(value)); break;
+            case DataType::Mat2:
+                m_Shader->SetMat2(property.Name, *reinterpret_cast<const glm::mat2*>(value)); break;
+            case DataType::Mat3:
+                m_Shader->SetMat3(property.Name, *reinterpret_cast<const glm::mat3*>(value)); break;
+            case DataType::Mat4:
+                m_Shader->SetMat4(property.Name, *reinterpret_cast<const glm::mat4*>(value)); break;
+            case DataType::None:
+                break;
+        }
+    }
+    
+    // Material instance variables
+    // ----------------------------------------
+private:
+    ///< Material defining the shader and the default properties.
+    std::shared_ptr<Material> m_Parent;
+    
+    ///< Properties overridden (values packed in the data block).
+    std::vector<Override> m_Overrides;
+    std::vector<char> m_Data;
+    ///< Textures overridden.
+    std::vector<TextureOverride> m_Textures;
+    
+    ///< Parameter block of the instance (parent block with the overridden values).
+    ParameterBlock m_ParameterBlock;
+    ///< Version of the parent block used to build the instance block.
+    uint32_t m_ParentVersion = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(MaterialInstance);
+};
+
+} // namespace pixc
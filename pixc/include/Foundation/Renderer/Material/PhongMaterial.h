@@ -3,6 +3,7 @@
 #include "Foundation/Core/Resources.h"
 
 #include "Foundation/Renderer/Material/LitMaterial.h"
+#include "Foundation/Renderer/Material/Properties/ParameterBlock.h"
 
 /**
  * @namespace pixc
@@ -15,6 +16,9 @@ namespace pixc {
  *
  * The `Phong` class provides a base class for defining material properties used in Phong
  * shading. It is intended to be inherited by specific material classes to add Phong support.
+ *
+ * The properties are stored in a parameter block (uniform buffer) that is only updated when
+ * one of them is modified.
  */
 class Phong
 {
@@ -28,7 +32,11 @@ public:
     // ----------------------------------------
     /// @brief Set the shininess (exponent value).
     /// @param shininess The shininess value.
-    void SetShininess(float shininess) { m_Shininess = shininess; }
+    void SetShininess(float shininess)
+    {
+        m_Shininess = shininess;
+        m_ParameterBlock.MarkDirty();
+    }
     
     // Getter(s)
     // ----------------------------------------
@@ -47,6 +55,7 @@ protected:
     // ----------------------------------------
     /// @brief Set the material properties into the uniforms of the shader program.
     /// @param shader The shader program to set the properties for.
+    /// @note Only used when the shader does not define the parameter block.
     void SetProperties(const std::shared_ptr<Shader>& shader)
     {
         shader->SetFloat("u_Material.Shininess", m_Shininess);
@@ -57,6 +66,9 @@ protected:
 protected:
     ///< Material shininess.
     float m_Shininess = 32.0f;
+    
+    ///< Material properties stored on the GPU.
+    ParameterBlock m_ParameterBlock;
 };
 
 /**
@@ -79,8 +91,6 @@ public:
     // ----------------------------------------
     /// @brief Set the albedo color.
     /// @param color Albedo color in RGBA.
-    /// @brief Set the albedo color.
-    /// @param color Albedo color in RGBA.
     virtual void SetColor (const glm::vec4& color)
     {
         // Set the color as the ambient and diffuse coefficients
@@ -89,17 +99,18 @@ public:
         
         // Set the alpha value
         m_Alpha = color.a;
+        m_ParameterBlock.MarkDirty();
     }
     
     /// @brief Set the ambient coefficient for the material.
     /// @param k The ambient coefficient representing the RGB color components.
-    void SetAmbientColor(const glm::vec3 &k) { m_Ka = k; }
+    void SetAmbientColor(const glm::vec3 &k) { m_Ka = k; m_ParameterBlock.MarkDirty(); }
     /// @brief Set the diffuse coefficient for the material.
     /// @param k The diffuse coefficient representing the RGB color components.
-    void SetDiffuseColor(const glm::vec3 &k) { m_Kd = k; }
+    void SetDiffuseColor(const glm::vec3 &k) { m_Kd = k; m_ParameterBlock.MarkDirty(); }
     /// @brief Set the specular coefficient for the material.
     /// @param k The specular coefficient representing the RGB color components.
-    void SetSpecularColor(const glm::vec3 &k) { m_Ks = k; }
+    void SetSpecularColor(const glm::vec3 &k) { m_Ks = k; m_ParameterBlock.MarkDirty(); }
     
     // Getter(s)
     // ----------------------------------------
@@ -121,7 +132,15 @@ protected:
     // Constructor(s)
     // ----------------------------------------
     /// @brief Generate a phong color.
-    PhongColor() = default;
+    PhongColor()
+    {
+        // Describe the parameter block (used by the material instances)
+        m_ParameterBlock.DefineMember("u_Material.Ka", DataType::Vec3, offsetof(Parameters, Ka));
+        m_ParameterBlock.DefineMember("u_Material.Kd", DataType::Vec3, offsetof(Parameters, Kd));
+        m_ParameterBlock.DefineMember("u_Material.Ks", DataType::Vec3, offsetof(Parameters, Ks));
+        m_ParameterBlock.DefineMember("u_Material.Shininess", DataType::Float, offsetof(Parameters, Shininess));
+        m_ParameterBlock.DefineMember("u_Material.Alpha", DataType::Float, offsetof(Parameters, Alpha));
+    }
     
 protected:
     // Properties
@@ -130,6 +149,17 @@ protected:
     /// @param shader The shader program to set the properties for.
     void SetProperties(const std::shared_ptr<Shader>& shader)
     {
+        // Bind the parameter block (uploaded only if a property has been modified)
+        Parameters parameters;
+        parameters.Ka = m_Ka;
+        parameters.Kd = m_Kd;
+        parameters.Ks = m_Ks;
+        parameters.Shininess = m_Shininess;
+        parameters.Alpha = m_Alpha;
+        if (m_ParameterBlock.Bind(shader, parameters))
+            return;
+        
+        // Set the properties individually otherwise
         shader->SetVec3("u_Material.Ka", m_Ka);
         shader->SetVec3("u_Material.Kd", m_Kd);
         shader->SetVec3("u_Material.Ks", m_Ks);
@@ -142,6 +172,19 @@ protected:
     // Phong color variables
     // ----------------------------------------
 protected:
+    /// @brief Layout of the parameter block (`PhongColorMaterial.glsl`, std140).
+    struct Parameters
+    {
+        glm::vec3 Ka;           ///< Ambient coefficient.
+        float _pad0 = 0.0f;
+        glm::vec3 Kd;           ///< Diffuse coefficient.
+        float _pad1 = 0.0f;
+        glm::vec3 Ks;           ///< Specular coefficient.
+        float Shininess;        ///< Shininess.
+        float Alpha;            ///< Alpha.
+        float _pad2[3] = {};
+    };
+    
     ///< Ambient coefficient.
     glm::vec3 m_Ka = glm::vec3(1.0f);
     ///< Diffuse coefficient.
@@ -197,7 +240,12 @@ protected:
     // Constructor(s)
     // ----------------------------------------
     /// @brief Generate a phong texture.
-    PhongTexture() = default;
+    PhongTexture()
+    {
+        // Describe the parameter block (used by the material instances)
+        m_ParameterBlock.DefineMember("u_Material.Shininess", DataType::Float, offsetof(Parameters, Shininess));
+        m_ParameterBlock.DefineMember("u_Material.Alpha", DataType::Float, offsetof(Parameters, Alpha));
+    }
     
 protected:
     // Properties
@@ -206,17 +254,33 @@ protected:
     /// @param shader The shader program to set the properties for.
     void SetProperties(const std::shared_ptr<Shader>& shader)
     {
-        shader->SetTexture("u_Material.DiffuseMap", m_DiffuseTexture,
+        // Bind the parameter block (uploaded only if a property has been modified)
+        Parameters parameters;
+        parameters.Shininess = m_Shininess;
+        bool block = m_ParameterBlock.Bind(shader, parameters);
+        
+        // Samplers cannot be stored in the block (same names in all the backends)
+        shader->SetTexture("u_MaterialMaps.DiffuseMap", m_DiffuseTexture,
                            static_cast<uint32_t>(TextureIndex::DiffuseMap));
-        shader->SetTexture("u_Material.SpecularMap", m_SpecularTexture,
+        shader->SetTexture("u_MaterialMaps.SpecularMap", m_SpecularTexture,
                            static_cast<uint32_t>(TextureIndex::SpecularMap));
         
-        Phong::SetProperties(shader);
+        // Set the properties individually otherwise
+        if (!block)
+            Phong::SetProperties(shader);
     }
     
-    // Phong color variables
+    // Phong texture variables
     // ----------------------------------------
 protected:
+    /// @brief Layout of the parameter block (`PhongTextureMaterial.glsl`, std140).
+    struct Parameters
+    {
+        float Shininess;        ///< Shininess.
+        float Alpha = 1.0f;     ///< Alpha.
+        float _pad0[2] = {};
+    };
+    
     ///< Diffuse map.
     std::shared_ptr<Texture> m_DiffuseTexture;
     ///< Specular map.
@@ -251,6 +315,12 @@ public:
     /// @brief Destructor for the phong color material.
     ~PhongColorMaterial() override = default;
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the block storing the material properties on the GPU.
+    /// @return The parameter block.
+    ParameterBlock* GetParameterBlock() override { return &m_ParameterBlock; }
+    
 protected:
     // Properties
     // ----------------------------------------
@@ -295,6 +365,12 @@ public:
     /// @brief Destructor for the phong texture material.
     ~PhongTextureMaterial() override = default;
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the block storing the material properties on the GPU.
+    /// @return The parameter block.
+    ParameterBlock* GetParameterBlock() override { return &m_ParameterBlock; }
+    
 protected:
     // Properties
     // ----------------------------------------
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+#include "Foundation/Renderer/Shader/Shader.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Describes a member of a parameter block.
+ */
+struct ParameterMember
+{
+    DataType Type = DataType::None;     ///< Type of the member.
+    uint32_t Offset = 0;                ///< Offset (in bytes) of the member in the block.
+};
+
+/**
+ * @brief Stores the parameters of a material in a uniform buffer (std140 layout).
+ *
+ * The `ParameterBlock` class keeps a copy of the material parameters on the GPU. The buffer is
+ * only written when the parameters have been marked as modified, and binding the material then
+ * attaches the buffer to the material binding point instead of setting each uniform.
+ *
+ * The members of the block can be described (by their uniform name) so that material instances
+ * can build their own block from the one of their parent.
+ *
+ * Copying or moving `ParameterBlock` objects is disabled to ensure single ownership of the buffer.
+ */
+class ParameterBlock
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a parameter block.
+    ParameterBlock() = default;
+    /// @brief Delete the parameter block.
+    ~ParameterBlock() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Update the block (if modified) and attach it to the material binding point.
+    /// @tparam T The parameters structure (matching the std140 layout of the shader block).
+    /// @param shader The shader program using the parameters.
+    /// @param parameters The current material parameters.
+    /// @return `true` if the block has been bound, `false` if the shader (or rendering API) does
+    ///         not define the block and the uniforms must be set individually.
+    template<typename T>
+    bool Bind(const std::shared_ptr<Shader>& shader, const T& parameters)
+    {
+        static_assert(sizeof(T) % 16 == 0, "Parameter blocks must be padded to 16 bytes (std140)!");
+        return Bind(shader, &parameters, sizeof(T));
+    }
+    /// @brief Update the block (if modified) and attach it to the material binding point.
+    /// @param shader The shader program using the parameters.
+    /// @param data The current material parameters (only read if the block has been modified).
+    /// @param size The size (in bytes) of the parameters.
+    /// @return `true` if the block has been bound.
+    bool Bind(const std::shared_ptr<Shader>& shader, const void *data, uint32_t size)
+    {
+        const uint32_t binding = static_cast<uint32_t>(UniformBinding::Material);
+        if (!shader->SetUniformBlock("MaterialBlock", binding))
+            return false;
+        
+        if (!m_Buffer || m_Buffer->GetSize() != size)
+        {
+            m_Buffer = UniformBuffer::Create(size);
+            if (!m_Buffer)
+                return false;
+            m_Dirty = true;
+        }
+        
+        if (m_Dirty)
+        {
+            m_Buffer->SetData(data, size);
+            m_Data.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+            m_Version++;
+            m_Dirty = false;
+        }
+        
+        m_Buffer->BindRange(binding, 0, size);
+        return true;
+    }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Mark the parameters as modified (the buffer is updated on the next bind).
+    void MarkDirty() { m_Dirty = true; }
+    /// @brief Describe a member of the block.
+    /// @param name The uniform name of the member (e.g., "u_Material.Kd").
+    /// @param type The type of the member.
+    /// @param offset The offset (in bytes) of the member in the block.
+    void DefineMember(const std::string& name, DataType type, uint32_t offset)
+    {
+        m_Members[name] = { type, offset };
+    }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if the parameters need to be uploaded.
+    /// @return `true` if the parameters have been modified since the last upload.
+    bool IsDirty() const { return m_Dirty; }
+    /// @brief Get the description of a member of the block.
+    /// @param name The uniform name of the member.
+    /// @return The member, or `nullptr` if it is not part of the block.
+    const ParameterMember* GetMember(const std::string& name) const
+    {
+        auto it = m_Members.find(name);
+        return it != m_Members.end() ? &it->second : nullptr;
+    }
+    /// @brief Get the parameters last uploaded.
+    /// @return The packed parameters (empty if the block has never been bound).
+    const std::vector<char>& GetData() const { return m_Data; }
+    /// @brief Get the number of times the block has been uploaded.
+    /// @return The version of the parameters.
+    uint32_t GetVersion() const { return m_Version; }
+    
+    // Parameter block variables
+    // ----------------------------------------
+private:
+    ///< Uniform buffer storing the parameters.
+    std::shared_ptr<UniformBuffer> m_Buffer;
+    ///< Indicates if the parameters have been modified.
+    bool m_Dirty = true;
+    
+    ///< Copy of the parameters last uploaded.
+    std::vector<char> m_Data;
+    ///< Number of uploads.
+    uint32_t m_Version = 0;
+    ///< Members of the block (by uniform name).
+    std::unordered_map<std::string, ParameterMember> m_Members;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(ParameterBlock);
+};
+
+} // namespace pixc
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Foundation/Renderer/Texture/Sampler.h"
+
 /**
  * @namespace pixc
  * @brief Main namespace of the Pixel Core rendering engine.
@@ -30,12 +32,21 @@ public:
     {
         m_Texture = texture;
     }
+    /// @brief Set the sampling state used to read the texture map.
+    /// @param spec The sampler specifications (shared with all the textures using the same state).
+    void SetSampler(const SamplerSpecification& spec)
+    {
+        m_Sampler = Sampler::Get(spec);
+    }
     
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the texture map used for the geometry.
     /// @return The texture map.
     std::shared_ptr<Texture> GetTextureMap() const { return m_Texture; }
+    /// @brief Get the sampler used to read the texture map.
+    /// @return The sampler (`nullptr` if the sampling state of the texture is used).
+    std::shared_ptr<Sampler> GetSampler() const { return m_Sampler; }
     
 protected:
     // Constructor(s)
@@ -52,7 +63,7 @@ protected:
     void SetProperties(const std::shared_ptr<Shader>& shader,
                        const std::string& name, uint32_t slot)
     {
-        shader->SetTexture(name, m_Texture, slot);
+        shader->SetTexture(name, m_Texture, slot, m_Sampler);
     }
     
     // Flat texture variables
@@ -60,6 +71,8 @@ protected:
 protected:
     ///< Texture map.
     std::shared_ptr<Texture> m_Texture;
+    ///< Sampler used to read the texture map.
+    std::shared_ptr<Sampler> m_Sampler;
 };
 
 } // namespace pixc
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Foundation/Core/Resources.h"
+
+#include "Foundation/Renderer/Material/TextureMaterial.h"
+#include "Foundation/Renderer/PostProcess/AutoExposure.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief A material class displaying a high dynamic range image.
+ *
+ * The `ToneMapMaterial` class is a subclass of `TextureMaterial` that applies the exposure and
+ * the tone mapping operator of an auto-exposure stage to the texture map, when its shader
+ * defines the `u_Exposure` uniforms.
+ *
+ * Copying or moving `ToneMapMaterial` objects is disabled to ensure single ownership
+ * and prevent unintended duplication of material resources.
+ */
+class ToneMapMaterial : public TextureMaterial
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a tone mapping material object with the specified shader file path.
+    /// @param filePath The file path to the shader used by the material.
+    ToneMapMaterial(const std::filesystem::path& filePath =
+                    ResourcesManager::GeneralPath("pixc/shaders/post/ToneMap"))
+    : TextureMaterial(filePath)
+    {}
+    /// @brief Destructor for the tone mapping material.
+    ~ToneMapMaterial() override = default;
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the auto-exposure stage defining the exposure of the image.
+    /// @param exposure The auto-exposure stage.
+    void SetExposure(const std::shared_ptr<AutoExposure>& exposure) { m_Exposure = exposure; }
+    
+private:
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        TextureMaterial::SetMaterialProperties();
+        if (m_Exposure && m_Shader->IsUniform("u_Exposure.Value"))
+            m_Exposure->SetProperties(m_Shader);
+    }
+    
+    // Tone mapping material variables
+    // ----------------------------------------
+private:
+    ///< Auto-exposure stage defining the exposure of the image.
+    std::shared_ptr<AutoExposure> m_Exposure;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(ToneMapMaterial);
+};
+
+} // namespace pixc
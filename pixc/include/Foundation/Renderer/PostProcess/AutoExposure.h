@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+#include "Foundation/Renderer/Buffer/StorageBuffer.h"
+#include "Foundation/Renderer/Shader/Shader.h"
+#include "Foundation/Renderer/Texture/Texture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Operators mapping the high dynamic range colors into the displayable range.
+ */
+enum class ToneMapping : int32_t
+{
+    None = 0,               ///< The colors are only scaled by the exposure (and clamped).
+    Reinhard = 1,           ///< Extended Reinhard operator (luminance based, with a white point).
+    ACES = 2,               ///< Filmic curve fitted to the ACES reference transform.
+    Uncharted2 = 3,         ///< Filmic curve of Uncharted 2 (with a white point).
+};
+
+/**
+ * @brief Represents the exposure and tone mapping applied when the image is displayed.
+ */
+struct ExposureSettings
+{
+    ///< Adapt the exposure to the luminance of the rendered frames.
+    bool AutoExposure = false;
+    ///< Exposure compensation (in stops), the only exposure control without auto-exposure.
+    float Compensation = 0.0f;
+    
+    ///< Range of luminance measured (log2), the values outside are clamped.
+    float MinLogLuminance = -8.0f;
+    float MaxLogLuminance = 4.0f;
+    ///< Fractions of the darkest and brightest pixels ignored by the measure.
+    float LowPercent = 0.5f;
+    float HighPercent = 0.95f;
+    ///< Luminance the average luminance is mapped to (middle gray).
+    float KeyValue = 0.18f;
+    ///< Adaptation speed towards a brighter or a darker scene (per second).
+    float SpeedUp = 3.0f;
+    float SpeedDown = 1.0f;
+    
+    ///< Tone mapping operator.
+    ToneMapping Operator = ToneMapping::None;
+    ///< Smallest luminance mapped to white (Reinhard and Uncharted 2 operators).
+    float WhitePoint = 4.0f;
+};
+
+/**
+ * @brief Measures the luminance of the rendered frames and adapts the exposure over time.
+ *
+ * Each frame, a compute pass builds a histogram of the log-luminance of a downsampled version of
+ * the frame into a storage buffer. The histograms are read back asynchronously (a frame or more
+ * later, as soon as the GPU is done), so the CPU never waits: the average luminance is computed
+ * from the histogram, ignoring the darkest and brightest pixels, and the exposure smoothly adapts
+ * to it. The exposure and the tone mapping operator are then applied by the shader displaying
+ * the frame (`u_Exposure` uniforms).
+ *
+ * Without compute support (e.g., macOS, Metal), the exposure is only defined by the compensation.
+ *
+ * Copying or moving `AutoExposure` objects is disabled to ensure single ownership.
+ */
+class AutoExposure
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    AutoExposure(const ExposureSettings& settings = ExposureSettings());
+    /// @brief Delete the auto-exposure stage.
+    ~AutoExposure() = default;
+    
+    // Update
+    // ----------------------------------------
+    void Update(const std::shared_ptr<Texture>& frame);
+    
+    // Properties
+    // ----------------------------------------
+    void SetProperties(const std::shared_ptr<Shader>& shader) const;
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Change the exposure settings.
+    /// @param settings The exposure settings.
+    void SetSettings(const ExposureSettings& settings) { m_Settings = settings; }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the exposure settings.
+    /// @return The exposure settings.
+    ExposureSettings& GetSettings() { return m_Settings; }
+    /// @brief Get the exposure applied to the frames.
+    /// @return The exposure (scale factor of the colors).
+    float GetExposure() const { return m_Exposure; }
+    /// @brief Get the average luminance the exposure is currently adapted to.
+    /// @return The adapted luminance.
+    float GetAdaptedLuminance() const { return m_AdaptedLuminance; }
+    /// @brief Check if the exposure can adapt to the frames (compute passes supported).
+    /// @return `true` if the luminance of the frames can be measured.
+    bool IsSupported() const { return m_Histograms[0] != nullptr; }
+    
+private:
+    // Measure
+    // ----------------------------------------
+    void BuildHistogram(const std::shared_ptr<Texture>& frame);
+    void RetrieveHistograms();
+    float ComputeAverageLuminance(const std::vector<uint32_t>& bins) const;
+    
+    // Auto-exposure variables
+    // ----------------------------------------
+private:
+    ///< Exposure settings.
+    ExposureSettings m_Settings;
+    
+    ///< Histograms being built or read back (used in turns).
+    std::array<std::shared_ptr<StorageBuffer>, 2> m_Histograms;
+    ///< Index of the next histogram to be built.
+    uint32_t m_NextHistogram = 0;
+    
+    ///< Average luminance of the last frame measured, and the luminance adapted to.
+    float m_TargetLuminance = 0.18f;
+    float m_AdaptedLuminance = 0.18f;
+    ///< Exposure applied to the frames.
+    float m_Exposure = 1.0f;
+    ///< Time of the last update (seconds since the epoch of the steady clock).
+    double m_LastUpdate = -1.0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(AutoExposure);
+};
+
+} // namespace pixc
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents a fence inserted into the command stream of the GPU.
+ *
+ * The fence is signaled once the GPU has executed all the commands issued before it was created.
+ * The CPU can then poll it, or wait for it, before reusing the resources read by these commands.
+ *
+ * Copying or moving `Fence` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class Fence
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    static std::shared_ptr<Fence> Create();
+    // Destructor
+    // ----------------------------------------
+    /// @brief Delete the fence.
+    virtual ~Fence() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Pure virtual function for checking if the fence has been signaled (never waits).
+    /// @return `true` if the commands issued before the fence are complete.
+    virtual bool IsSignaled() const = 0;
+    /// @brief Pure virtual function for waiting until the fence is signaled.
+    /// @param timeout Maximum time to wait (in nanoseconds).
+    /// @return `true` if the fence has been signaled.
+    virtual bool Wait(uint64_t timeout = UINT64_MAX) const = 0;
+
+protected:
+    // Constructor(s)
+    // ----------------------------------------
+    /// @brief Create a fence.
+    Fence() = default;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(Fence);
+};
+
+} // namespace pixc
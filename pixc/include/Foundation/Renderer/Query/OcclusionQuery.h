@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents a query checking whether any sample of the draw calls issued while it is
+ * active passes the depth test.
+ *
+ * The `OcclusionQuery` class is used to cull objects hidden behind other ones: a cheap proxy of
+ * the object (e.g., its bounding box) is drawn under the query, without writing into the
+ * framebuffer. The result can then be either:
+ * - used on the GPU to discard the draw calls of the object (conditional rendering), so the CPU
+ *   never waits for it;
+ * - read back on the CPU once it is available (usually a frame later), to skip the object.
+ *
+ * Copying or moving `OcclusionQuery` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class OcclusionQuery
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    static std::shared_ptr<OcclusionQuery> Create();
+    // Destructor
+    // ----------------------------------------
+    /// @brief Delete the occlusion query.
+    virtual ~OcclusionQuery() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Pure virtual function for starting the query (the draw calls issued until `End()`
+    /// are tested).
+    virtual void Begin() = 0;
+    /// @brief Pure virtual function for ending the query.
+    virtual void End() = 0;
+    
+    /// @brief Pure virtual function for discarding the following draw calls (until
+    /// `EndConditionalRender()`) if no sample of the query passed.
+    /// @param wait Let the GPU wait for the result of the query; the draw calls are executed if
+    ///             the result is not available otherwise.
+    virtual void BeginConditionalRender(bool wait = true) const = 0;
+    /// @brief Pure virtual function for ending the conditional rendering.
+    virtual void EndConditionalRender() const = 0;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Pure virtual function for checking if the result of the query can be read without
+    /// stalling.
+    /// @return `true` if the result is available.
+    virtual bool IsResultAvailable() const = 0;
+    /// @brief Pure virtual function for reading the result of the query (waits for it if needed).
+    /// @return `true` if any sample passed the depth test.
+    virtual bool GetResult() const = 0;
+    /// @brief Check if the query has been issued (and its result not read yet).
+    /// @return `true` if the query is pending.
+    bool IsPending() const { return m_Pending; }
+
+protected:
+    // Constructor(s)
+    // ----------------------------------------
+    /// @brief Create an occlusion query.
+    OcclusionQuery() = default;
+    
+    // Occlusion query variables
+    // ----------------------------------------
+protected:
+    ///< The query has been issued and its result not read yet.
+    mutable bool m_Pending = false;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OcclusionQuery);
+};
+
+} // namespace pixc
@@ -30,6 +30,7 @@ public:
     // Initialization
     // ----------------------------------------
     static void Init();
+    static void Shutdown();
     
     // Scene parametrization
     // ----------------------------------------
@@ -44,11 +45,25 @@ public:
     // ----------------------------------------
     static void Draw(const std::shared_ptr<Drawable>& drawable,
                      const PrimitiveType &primitive = PrimitiveType::Triangle);
+    static void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                            const uint32_t indexCount,
+                            const PrimitiveType &primitive = PrimitiveType::Triangle);
     
     static void Draw(const std::shared_ptr<Drawable>& drawable,
                      const std::shared_ptr<Material>& material,
                      const glm::mat4 &transform = glm::mat4(1.0f),
                      const PrimitiveType &primitive = PrimitiveType::Triangle);
+    static void DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                           const std::shared_ptr<Material>& material,
+                           const std::vector<IndexRange>& ranges,
+                           const glm::mat4 &transform = glm::mat4(1.0f),
+                           const PrimitiveType &primitive = PrimitiveType::Triangle);
+    
+    static void DrawFullscreen(const std::shared_ptr<Material>& material);
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetFade(float fade);
     
     // Getters(s)
     // ----------------------------------------
@@ -56,6 +71,16 @@ public:
     
     static MaterialLibrary& GetMaterialLibrary() { return s_MaterialLibrary; }
     
+    /// @brief Get the view matrix of the scene being rendered.
+    /// @return The view matrix.
+    static const glm::mat4& GetViewMatrix() { return s_SceneData->ViewMatrix; }
+    /// @brief Get the projection matrix of the scene being rendered.
+    /// @return The projection matrix.
+    static const glm::mat4& GetProjectionMatrix() { return s_SceneData->ProjectionMatrix; }
+    /// @brief Get the view position of the scene being rendered.
+    /// @return The view position (world space).
+    static const glm::vec3& GetViewPosition() { return s_SceneData->ViewPosition; }
+    
     // Statistics
     // ----------------------------------------
     /**
@@ -71,7 +96,7 @@ public:
     
     static void ResetStats();
     static RenderingStatistics GetStats();
-
+    
     
     // Renderer Structures
     // ----------------------------------------
@@ -88,8 +113,15 @@ private:
         glm::mat4 ViewMatrix = glm::mat4(1.0f);
         ///< Projection matrix.
         glm::mat4 ProjectionMatrix = glm::mat4(1.0f);
+        
+        ///< Opacity of the models being drawn (dithered fade, 1 when fully drawn).
+        float Fade = 1.0f;
     };
     
+    // Material
+    // ----------------------------------------
+    static void BindMaterial(const std::shared_ptr<Material>& material, const glm::mat4& transform);
+    
     // Renderer variables
     // ----------------------------------------
 private:
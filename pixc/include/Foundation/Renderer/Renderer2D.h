@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Foundation/Renderer/RendererTypes.h"
+
+#include "Foundation/Renderer/Camera/Camera.h"
+#include "Foundation/Renderer/Texture/Texture.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Defines the order in which the quads of a 2D batch are submitted to the GPU.
+ */
+enum class QuadSortMode
+{
+    None = 0,           ///< Keep the submission order.
+    BackToFront = 1,    ///< Farthest quads first (required for blended sprites).
+    FrontToBack = 2,    ///< Closest quads first (reduces overdraw for opaque sprites).
+    Texture = 3,        ///< Group quads by texture to reduce the number of flushes.
+};
+
+/**
+ * @brief Describes a single quad (sprite) to be rendered by the 2D batch renderer.
+ */
+struct QuadSpecification
+{
+    glm::vec3 Position = glm::vec3(0.0f);                   ///< Center of the quad (world space).
+    glm::vec2 Size = glm::vec2(1.0f);                       ///< Size of the quad (width, height).
+    float Rotation = 0.0f;                                  ///< Rotation around the z-axis (degrees).
+
+    glm::vec4 Tint = glm::vec4(1.0f);                       ///< Color multiplied with the texture sample.
+
+    ///< Texture coordinates sub-rectangle (min.x, min.y, max.x, max.y), e.g. for sprite sheets.
+    glm::vec4 TextureRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    ///< Texture of the quad (white texture if not defined).
+    std::shared_ptr<Texture> TextureMap;
+};
+
+/**
+ * @brief Renders large amounts of 2D quads (sprites, overlays, HUD elements) in a few draw calls.
+ *
+ * The `Renderer2D` class accumulates the quads submitted between `BeginScene()` and `EndScene()`.
+ * When the scene ends, the quads are (optionally) sorted, expanded into a streaming vertex buffer
+ * and flushed in batches. A batch is submitted only when it runs out of quads or when a new texture
+ * does not fit in the available texture slots, so quads sharing a small set of textures are rendered
+ * with a single draw call.
+ *
+ * @note The textures used by the quads must remain alive until `EndScene()` is called.
+ */
+class Renderer2D
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init();
+    static void Shutdown();
+
+    // Scene parametrization
+    // ----------------------------------------
+    static void BeginScene(const std::shared_ptr<Camera>& camera = nullptr,
+                           const QuadSortMode sort = QuadSortMode::None);
+    static void BeginScene(const glm::mat4& view, const glm::mat4& projection,
+                           const QuadSortMode sort = QuadSortMode::None);
+
+    static void EndScene();
+
+    // Render
+    // ----------------------------------------
+    static void DrawQuad(const QuadSpecification& quad);
+
+    static void DrawQuad(const glm::vec3& position, const glm::vec2& size,
+                         const glm::vec4& color);
+    static void DrawQuad(const glm::vec3& position, const glm::vec2& size,
+                         const std::shared_ptr<Texture>& texture,
+                         const glm::vec4& tint = glm::vec4(1.0f));
+
+    static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size,
+                                const float rotation, const glm::vec4& color);
+    static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size,
+                                const float rotation, const std::shared_ptr<Texture>& texture,
+                                const glm::vec4& tint = glm::vec4(1.0f));
+
+    static void DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture,
+                         const glm::vec4& textureRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f),
+                         const glm::vec4& tint = glm::vec4(1.0f));
+
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the 2D rendering.
+     */
+    struct Statistics
+    {
+        ///< Number of quads submitted.
+        uint32_t QuadCount = 0;
+        ///< Number of batches flushed (draw calls).
+        uint32_t DrawCalls = 0;
+    };
+
+    static void ResetStats();
+    static Statistics GetStats();
+
+private:
+    // Render
+    // ----------------------------------------
+    static void Flush();
+};
+
+} // namespace pixc
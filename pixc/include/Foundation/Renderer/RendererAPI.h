@@ -30,12 +30,16 @@ public:
     {
         None = 0,
         OpenGL = 1,
-        
+
 #ifdef __APPLE__
         Metal = 2,
 #endif
+        
+#ifdef PIXC_SOFTWARE_RENDERER
+        Software = 3,
+#endif
     };
-    
+
 public:
     // Destructor
     // ----------------------------------------
@@ -54,6 +58,26 @@ public:
     /// @return The active rendering API.
     static API GetAPI() { return s_API; }
     
+    /// @brief Check if the depth is reversed (near plane at 1, far plane at 0).
+    /// @return `true` if the reversed depth is enabled.
+    static bool IsDepthReversed() { return s_ReversedDepth; }
+    /// @brief Get the depth of the far plane, used to clear the depth buffers.
+    /// @return The depth of the far plane (0 if the depth is reversed, 1 otherwise).
+    static float GetFarDepth() { return s_ReversedDepth ? 0.0f : 1.0f; }
+    /// @brief Get the depth of the near plane (clip space depth in [0, 1], as output by the
+    /// projections).
+    /// @return The depth of the near plane (1 if the depth is reversed, 0 otherwise).
+    static float GetNearDepth() { return s_ReversedDepth ? 1.0f : 0.0f; }
+    static DepthFunction GetDepthFunction(const DepthFunction function);
+    static glm::mat4 GetDepthProjection(const glm::mat4& projection);
+    /// @brief Get the format of the depth attachments to be used with the current depth convention.
+    /// @param format The format of the depth attachment (for the standard depth).
+    /// @return The format to be used (32-bit float if the depth is reversed).
+    static TextureFormat GetDepthFormat(const TextureFormat format)
+    {
+        return s_ReversedDepth ? TextureFormat::DEPTH32F : format;
+    }
+    
     // Setter(s)
     // ----------------------------------------
     virtual void SetClearColor(const glm::vec4& color) = 0;
@@ -74,10 +98,26 @@ public:
     
     virtual void SetFaceCulling(const FaceCulling mode) = 0;
     virtual void SetCubeMapSeamless(const bool enabled) = 0;
+    virtual void EnableBlending(const bool enabled) = 0;
+    
+    /// @brief Enable or disable the writing into the color attachments (not supported by default).
+    /// @param enabled Pass true to write the color of the fragments, false to discard it.
+    virtual void EnableColorWriting(const bool enabled) {}
+    /// @brief Enable or disable the writing into the depth buffer (not supported by default).
+    /// @param enabled Pass true to write the depth of the fragments, false to keep the buffer.
+    virtual void EnableDepthWriting(const bool enabled) {}
+    
+    // Depth
+    // ----------------------------------------
+    /// @brief Check if the reversed depth is supported (not supported by default).
+    /// @return `true` if the clip space depth can be mapped to [0, 1] and reversed.
+    virtual bool IsReversedDepthSupported() const { return false; }
+    void SetReversedDepth(const bool enabled);
     
     // Render
     // ----------------------------------------
     virtual void BeginRenderPass(const std::shared_ptr<FrameBuffer>& framebuffer);
+    void ApplyLoadActions(const RenderPassActions& actions);
     virtual void EndRenderPass();
     
     void Clear();
@@ -85,23 +125,64 @@ public:
     
     virtual void Draw(const std::shared_ptr<Drawable>& drawable,
                       const PrimitiveType &primitive = PrimitiveType::Triangle) = 0;
+    virtual void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                             const uint32_t indexCount,
+                             const PrimitiveType &primitive = PrimitiveType::Triangle) = 0;
+    /// @brief Render several ranges of indices of a drawable object (draws all the indices by default).
+    /// @param drawable The drawable object containing the data for rendering.
+    /// @param ranges The ranges of indices to be rendered.
+    /// @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+    virtual void DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                            const std::vector<IndexRange>& ranges,
+                            const PrimitiveType &primitive = PrimitiveType::Triangle)
+    {
+        Draw(drawable, primitive);
+    }
+    /// @brief Render a single triangle covering the screen, without vertex data (not supported by
+    /// default, the shaders of the other APIs read the vertices of a plane instead).
+    virtual void DrawFullscreen() {}
     
+    // Compute
+    // ----------------------------------------
+    /// @brief Check if the compute passes are supported (not supported by default).
+    /// @return `true` if compute shaders and storage buffers can be used.
+    virtual bool IsComputeSupported() const { return false; }
+    /// @brief Run the compute shader currently bound (not supported by default).
+    /// @param x The number of work groups in the x dimension.
+    /// @param y The number of work groups in the y dimension.
+    /// @param z The number of work groups in the z dimension.
+    virtual void DispatchCompute(const uint32_t x, const uint32_t y, const uint32_t z) {}
+
 protected:
     // Constructor(s)
     // ----------------------------------------
     /// @brief Protected default constructor to prevent direct instantiation.
     RendererAPI() = default;
     
+    // Depth
+    // ----------------------------------------
+    /// @brief Configure the depth range of the API for the reversed depth (nothing by default).
+    /// @param enabled Pass true to reverse the depth, false to restore the standard depth.
+    virtual void ApplyReversedDepth(const bool enabled) {}
+    
+    // Render
+    // ----------------------------------------
+    void ResolveAttachments(const RenderPassActions& actions);
+    
     // Renderer API variables
     // ----------------------------------------
 protected:
     ///< The currently bound framebuffer. If null, rendering goes to the screen (default framebuffer).
     std::shared_ptr<FrameBuffer> m_ActiveFrameBuffer = nullptr;
-    
-    
+    ///< Load and store actions of the current render pass (if defined).
+    std::optional<RenderPassActions> m_ActiveActions;
+
+
 private:
     ///< The currently active rendering API.
     static API s_API;
+    ///< Reversed depth flag.
+    static bool s_ReversedDepth;
 };
 
 } // namespace pixc
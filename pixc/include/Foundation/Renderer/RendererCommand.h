@@ -36,6 +36,8 @@ public:
     // Render
     // ----------------------------------------
     static void BeginRenderPass(const std::shared_ptr<FrameBuffer>& framebuffer = nullptr);
+    static void BeginRenderPass(const std::shared_ptr<FrameBuffer>& framebuffer,
+                                const RenderPassActions& actions);
     static void EndRenderPass();
     
     static void Clear();
@@ -43,6 +45,18 @@ public:
     
     static void Draw(const std::shared_ptr<Drawable>& drawable,
                      const PrimitiveType &primitive = PrimitiveType::Triangle);
+    static void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                            const uint32_t indexCount,
+                            const PrimitiveType &primitive = PrimitiveType::Triangle);
+    static void DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                           const std::vector<IndexRange>& ranges,
+                           const PrimitiveType &primitive = PrimitiveType::Triangle);
+    static void DrawFullscreen();
+    
+    // Compute
+    // ----------------------------------------
+    static bool IsComputeSupported();
+    static void DispatchCompute(const uint32_t x, const uint32_t y = 1, const uint32_t z = 1);
     
     // Setter(s)
     // ----------------------------------------
@@ -50,15 +64,28 @@ public:
     static void SetDepthFunction(const DepthFunction function);
     static void ConfigureDepthTesting(const bool enabled = true,
                                       const DepthFunction function = DepthFunction::Less);
+    static void SetReversedDepth(const bool enabled = true);
     
     static void SetFaceCulling(const FaceCulling mode);
     static void SetCubeMapSeamless(const bool enabled);
+    static void EnableBlending(const bool enabled = true);
+    
+    static void EnableColorWriting(const bool enabled = true);
+    static void EnableDepthWriting(const bool enabled = true);
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check whether alpha blending is enabled (as last defined with `EnableBlending()`).
+    /// @return `true` if alpha blending is enabled.
+    static bool IsBlendingEnabled() { return s_Blending; }
     
     // Renderer variables
     // ----------------------------------------
 private:
     ///< Rendering API.
     static std::unique_ptr<RendererAPI> s_API;
+    ///< Alpha blending state (disabled by default).
+    inline static bool s_Blending = false;
 };
 
 } // namespace pixc
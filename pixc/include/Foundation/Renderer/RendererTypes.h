@@ -36,4 +36,13 @@ enum class DepthFunction
     None, Always, Never, Less, Equal, LEqual, Greater, NotEqual, GEqual,
 };
 
+/**
+ * @brief Represents a range of indices of an index buffer.
+ */
+struct IndexRange
+{
+    uint32_t Offset = 0;    ///< First index of the range.
+    uint32_t Count = 0;     ///< Number of indices of the range.
+};
+
 } // namespace pixc
@@ -6,6 +6,7 @@
 #include "Foundation/Renderer/Shader/Uniform.h"
 
 #include "Foundation/Renderer/Texture/Texture.h"
+#include "Foundation/Renderer/Texture/Sampler.h"
 
 #include <glm/glm.hpp>
 
@@ -47,6 +48,25 @@ public:
     /// @brief Get the name that identifies the shader.
     /// @return The shader's name.
     const std::string& GetName() const { return m_Name; }
+    /// @brief Get the identifier of the shader (used as the pipeline ID of the materials).
+    /// @return The shader ID (unique to each shader, never reused).
+    uint32_t GetID() const { return m_ID; }
+    /// @brief Get the path of the shader source file.
+    /// @return The shader file path.
+    const std::filesystem::path& GetPath() const { return m_FilePath; }
+    
+    bool IsUniform(const std::string& name) const;
+    /// @brief Check if the shader only consumes the vertex positions (e.g., depth only shaders).
+    /// @return `true` if `a_Position` is the only vertex attribute of the shader.
+    bool IsPositionOnly() const
+    {
+        const auto& order = m_Attributes.GetBufferOrder();
+        return order.size() == 1 && order.front() == "a_Position";
+    }
+    /// @brief Check if the shader reads no vertex data (e.g., fullscreen passes generating their
+    /// vertices from the vertex index).
+    /// @return `true` if the shader has no vertex attribute.
+    bool IsVertexless() const { return m_Attributes.GetBufferOrder().empty(); }
     
     // Setter(s)
     // ----------------------------------------
@@ -65,7 +85,15 @@ public:
     
     virtual void SetTexture(const std::string &name,
                             const std::shared_ptr<Texture>& texture,
-                            int slot) = 0;
+                            int slot,
+                            const std::shared_ptr<Sampler>& sampler = nullptr) = 0;
+    
+    /// @brief Attach a uniform block of the shader to a binding point.
+    /// @param name The name of the uniform block.
+    /// @param binding The binding point (where the uniform buffer is attached).
+    /// @return `true` if the shader defines the uniform block, `false` if its uniforms must
+    ///         be set individually.
+    virtual bool SetUniformBlock(const std::string& name, uint32_t binding) { return false; }
     
     // Parsing
     // ----------------------------------------
@@ -83,8 +111,8 @@ protected:
     
     // Getter(s)
     // ----------------------------------------
-    bool IsUniform(const std::string& name) const;
     static std::filesystem::path GetFullFilePath(const std::filesystem::path& filePath);
+    static std::string GetDefinitions();
     
     // Setter(s)
     // ----------------------------------------
@@ -144,6 +172,8 @@ protected:
     std::string m_Name;
     ///< File path of shader source program.
     std::filesystem::path m_FilePath;
+    ///< Identifier of the shader.
+    uint32_t m_ID = ++s_ShaderCount;
     
     ///< Vertex attributes supported by the shader.
     BufferLayout m_Attributes;
@@ -152,6 +182,9 @@ protected:
     
     UniformLibrary m_Uniforms;
     
+    ///< Number of shaders created.
+    static inline uint32_t s_ShaderCount = 0;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
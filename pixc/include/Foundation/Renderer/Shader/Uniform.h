@@ -17,7 +17,7 @@ namespace pixc {
  */
 enum class ShaderType
 {
-    NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2
+    NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2, COMPUTE = 3
 };
 
 /**
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+#include "Foundation/Core/Library.h"
+
+#include "Foundation/Renderer/Texture/Texture2D.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Defines how the signed-distance-field atlas of a font is generated.
+ */
+struct FontSpecification
+{
+    uint32_t GlyphSize = 48;            ///< Size of an em (in pixels) in the atlas.
+    uint32_t Padding = 6;               ///< Distance field spread around each glyph (in pixels).
+    uint32_t AtlasSize = 1024;          ///< Size (width and height) of each atlas page.
+
+    uint32_t FirstCodepoint = 32;       ///< First character included in the atlas.
+    uint32_t LastCodepoint = 255;       ///< Last character included in the atlas.
+
+    // Operator(s)
+    // ----------------------------------------
+    /// @brief Equality operator for comparing two font specifications.
+    /// @param other Another font specification to compare against.
+    /// @return True if both specifications match.
+    bool operator==(const FontSpecification& other) const
+    {
+        return GlyphSize == other.GlyphSize && Padding == other.Padding &&
+               AtlasSize == other.AtlasSize && FirstCodepoint == other.FirstCodepoint &&
+               LastCodepoint == other.LastCodepoint;
+    }
+};
+
+/**
+ * @brief Represents the information of a single glyph inside the atlas.
+ *
+ * All the plane values are expressed in em units (a font size of 1), relative to the pen
+ * position on the baseline.
+ */
+struct Glyph
+{
+    uint32_t Page = 0;                          ///< Atlas page containing the glyph.
+    glm::vec4 TextureRect = glm::vec4(0.0f);    ///< Texture coordinates (left, bottom, right, top).
+    glm::vec4 PlaneRect = glm::vec4(0.0f);      ///< Quad bounds (min.x, min.y, max.x, max.y).
+    float Advance = 0.0f;                       ///< Horizontal advance to the next glyph.
+};
+
+/**
+ * @brief Represents a TrueType font rendered through a signed-distance-field glyph atlas.
+ *
+ * The `Font` class rasterizes the glyphs of a TTF file into one or more single-channel
+ * distance field pages. Generating the atlas is expensive, so it can be cached to disk in the
+ * cache directory of the resources (see `ResourcesManager::SetCachePath()`, disabled by default);
+ * subsequent loads read the cached atlas directly.
+ * Distance fields can be scaled to any size with sharp edges, so one atlas serves both
+ * small screen-space labels and large world-space text.
+ *
+ * Copying or moving `Font` objects is disabled to ensure single ownership of the atlas.
+ */
+class Font
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    Font(const std::filesystem::path& filePath,
+         const FontSpecification& spec = FontSpecification());
+    ~Font();
+
+    // Getter(s)
+    // ----------------------------------------
+    const Glyph& GetGlyph(uint32_t codepoint) const;
+    float GetKerning(uint32_t first, uint32_t second) const;
+
+    /// @brief Get the atlas specification of the font.
+    /// @return The font specification.
+    const FontSpecification& GetSpecification() const { return m_Spec; }
+    /// @brief Get the atlas pages of the font.
+    /// @return The atlas textures.
+    const std::vector<std::shared_ptr<Texture2D>>& GetPages() const { return m_Pages; }
+
+    /// @brief Get the distance between two baselines (in em units).
+    /// @return The line height.
+    float GetLineHeight() const { return m_LineHeight; }
+    /// @brief Get the distance from the baseline to the top of the font (in em units).
+    /// @return The ascender.
+    float GetAscender() const { return m_Ascender; }
+    /// @brief Get the distance from the baseline to the bottom of the font (in em units).
+    /// @return The descender (negative value).
+    float GetDescender() const { return m_Descender; }
+
+    /// @brief Get the file path of the font.
+    /// @return The font file path.
+    const std::filesystem::path& GetPath() const { return m_FilePath; }
+
+    static std::filesystem::path GetCachePath(const std::filesystem::path& filePath,
+                                              const FontSpecification& spec);
+
+private:
+    // Atlas
+    // ----------------------------------------
+    void GenerateAtlas(std::vector<std::vector<uint8_t>>& pages);
+    bool LoadAtlas(const std::filesystem::path& cachePath,
+                   std::vector<std::vector<uint8_t>>& pages);
+    void SaveAtlas(const std::filesystem::path& cachePath,
+                   const std::vector<std::vector<uint8_t>>& pages) const;
+    void CreatePages(const std::vector<std::vector<uint8_t>>& pages);
+
+    // Font variables
+    // ----------------------------------------
+private:
+    ///< File path of the font.
+    std::filesystem::path m_FilePath;
+    ///< Atlas specification.
+    FontSpecification m_Spec;
+
+    ///< Raw TTF data (kept for kerning queries).
+    std::vector<unsigned char> m_Data;
+    ///< TrueType font information (opaque `stbtt_fontinfo`).
+    struct FontInfo;
+    std::unique_ptr<FontInfo> m_Info;
+    ///< Scale converting font units into em units.
+    float m_Scale = 0.0f;
+
+    ///< Glyphs defined in the atlas.
+    std::unordered_map<uint32_t, Glyph> m_Glyphs;
+    ///< Atlas pages.
+    std::vector<std::shared_ptr<Texture2D>> m_Pages;
+
+    ///< Vertical metrics (em units).
+    float m_LineHeight = 1.0f;
+    float m_Ascender = 1.0f;
+    float m_Descender = 0.0f;
+
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(Font);
+};
+
+/**
+ * @brief A library for managing the fonts used in rendering.
+ */
+class FontLibrary : public Library<std::shared_ptr<Font>>
+{
+public:
+    // Constructor
+    // ----------------------------------------
+    /// @brief Create a new font library.
+    FontLibrary() : Library("Font") {}
+
+    // Load
+    // ----------------------------------------
+    /// @brief Load a font and add it to the library.
+    /// @param name The name to associate with the font.
+    /// @param filePath The TTF file path.
+    /// @param spec The atlas specification.
+    /// @return The loaded font.
+    std::shared_ptr<Font> Load(const std::string& name, const std::filesystem::path& filePath,
+                               const FontSpecification& spec = FontSpecification())
+    {
+        auto font = std::make_shared<Font>(filePath, spec);
+        Add(name, font);
+        return font;
+    }
+};
+
+} // namespace pixc
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Foundation/Renderer/Camera/Camera.h"
+#include "Foundation/Renderer/Text/Font.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Defines the horizontal alignment of the lines of a string.
+ */
+enum class TextAlignment
+{
+    Left = 0,       ///< Lines start at the origin.
+    Center = 1,     ///< Lines are centered around the origin.
+    Right = 2,      ///< Lines end at the origin.
+};
+
+/**
+ * @brief Describes how a string is laid out and rendered.
+ */
+struct TextSpecification
+{
+    ///< Size of an em: world units for world-space text, pixels for screen-space text.
+    float Size = 1.0f;
+    ///< Color of the text.
+    glm::vec4 Color = glm::vec4(1.0f);
+    ///< Horizontal alignment of the lines.
+    TextAlignment Alignment = TextAlignment::Left;
+    ///< Multiplier applied to the line height of the font.
+    float LineSpacing = 1.0f;
+};
+
+/**
+ * @brief Renders text using the signed-distance-field atlas of a font.
+ *
+ * The `TextRenderer` class lays out the strings submitted between `BeginScene()` and `EndScene()`
+ * into glyph quads. The quads are grouped by atlas page and written into a streaming vertex buffer,
+ * so all the text of a scene (world-space text and screen-space labels alike) is rendered with one
+ * draw call per atlas page.
+ *
+ * World-space text is transformed and depth-tested as any other geometry. Screen-space labels are
+ * anchored to a world position: they keep a constant size in pixels, face the screen and are
+ * depth-tested at the depth of their anchor.
+ *
+ * @note The fonts used must remain alive until `EndScene()` is called.
+ */
+class TextRenderer
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init();
+    static void Shutdown();
+
+    // Scene parametrization
+    // ----------------------------------------
+    static void BeginScene(const std::shared_ptr<Camera>& camera);
+    static void BeginScene(const glm::mat4& view, const glm::mat4& projection,
+                           const glm::vec2& viewportSize);
+
+    static void EndScene();
+
+    // Render
+    // ----------------------------------------
+    static void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+                           const glm::mat4& transform,
+                           const TextSpecification& spec = TextSpecification());
+    static void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+                           const glm::vec3& position,
+                           const TextSpecification& spec = TextSpecification());
+
+    static void DrawLabel(const std::string& text, const std::shared_ptr<Font>& font,
+                          const glm::vec3& anchor, const glm::vec2& offset = glm::vec2(0.0f),
+                          const TextSpecification& spec = TextSpecification());
+    static void DrawScreenString(const std::string& text, const std::shared_ptr<Font>& font,
+                                 const glm::vec2& position,
+                                 const TextSpecification& spec = TextSpecification());
+
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the text rendering.
+     */
+    struct Statistics
+    {
+        ///< Number of glyphs submitted.
+        uint32_t GlyphCount = 0;
+        ///< Number of batches flushed (draw calls).
+        uint32_t DrawCalls = 0;
+    };
+
+    static void ResetStats();
+    static Statistics GetStats();
+};
+
+} // namespace pixc
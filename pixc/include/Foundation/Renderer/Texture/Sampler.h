@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Foundation/Core/ClassUtils.h"
+#include "Foundation/Renderer/Texture/Texture.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * Specifications (sampling state) of a sampler.
+ *
+ * The `SamplerSpecification` defines how a texture is read in a shader: the filtering modes,
+ * the wrap mode, the border color (used with `TextureWrap::ClampToBorder`), whether the mipmaps
+ * are sampled, and whether depth textures are compared against a reference value.
+ */
+struct SamplerSpecification
+{
+    // Constructor(s)
+    // ----------------------------------------
+    /// @brief Define a sampler with the default sampling state.
+    SamplerSpecification() = default;
+    /// @brief Define a sampler with the sampling state of a texture.
+    /// @param spec The texture specifications.
+    SamplerSpecification(const TextureSpecification& spec)
+        : Filter(spec.Filter), Wrap(spec.Wrap), MipMaps(spec.MipMaps)
+    {
+        if (utils::textures::IsDepthFormat(spec.Format))
+            BorderColor = glm::vec4(1.0f);
+    }
+    
+    // Sampler specification variables
+    // ----------------------------------------
+    ///< The filtering modes (minification, magnification and mipmapping).
+    TextureFilterModes Filter = { TextureFilter::Linear, TextureFilter::Linear, TextureFilter::Linear };
+    ///< The wrap mode, applied to all the texture coordinates.
+    TextureWrap Wrap = TextureWrap::Repeat;
+    ///< The border color (used when the texture coordinates are clamped to the border).
+    glm::vec4 BorderColor = glm::vec4(0.0f);
+    
+    ///< A flag indicating whether the mipmaps of the texture are sampled.
+    bool MipMaps = true;
+    ///< A flag indicating whether depth values are compared to a reference (shadow samplers).
+    bool CompareDepth = false;
+    
+    // Operator(s)
+    // ----------------------------------------
+    /// @brief Equality operator for comparing two sampler specifications.
+    /// @param other Another sampler specification to compare against.
+    /// @return True if both specifications match.
+    inline bool operator==(const SamplerSpecification& other) const
+    {
+        return Filter.Min == other.Filter.Min &&
+               Filter.Mag == other.Filter.Mag &&
+               Filter.Mip == other.Filter.Mip &&
+               Wrap == other.Wrap &&
+               BorderColor == other.BorderColor &&
+               MipMaps == other.MipMaps &&
+               CompareDepth == other.CompareDepth;
+    }
+};
+
+/**
+ * @brief Represents the sampling state used to read textures in a shader.
+ *
+ * The `Sampler` class decouples the sampling state (filtering, wrapping, border color, depth
+ * comparison) from the textures: a sampler is bound to a texture unit and overrides the sampling
+ * state of the texture bound to the same unit. The same texture can therefore be read with
+ * different sampling modes without being duplicated.
+ *
+ * Samplers are shared: `Sampler::Get()` returns the sampler cached for a specification, so each
+ * unique sampling state only exists once.
+ *
+ * Copying or moving `Sampler` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class Sampler
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    static std::shared_ptr<Sampler> Get(const SamplerSpecification& spec);
+    // Destructor
+    // ----------------------------------------
+    /// @brief Delete the sampler.
+    virtual ~Sampler() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the sampler to a specific texture unit.
+    /// @param slot The texture unit slot.
+    virtual void BindToTextureUnit(uint32_t slot) const = 0;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the sampling state of the sampler.
+    /// @return The sampler specification.
+    const SamplerSpecification& GetSpecification() const { return m_Spec; }
+    
+    // Cache
+    // ----------------------------------------
+    static uint32_t GetCacheSize();
+    static void ClearCache();
+    
+protected:
+    // Constructor(s)
+    // ----------------------------------------
+    /// @brief Create a sampler with a specific sampling state.
+    /// @param spec The sampler specifications.
+    Sampler(const SamplerSpecification& spec) : m_Spec(spec) {}
+    
+    // Release
+    // ----------------------------------------
+    /// @brief Release the resources of the sampler on the graphics API (nothing by default). The
+    /// sampler stays valid, but the sampling state of the textures is used instead.
+    virtual void Release() {}
+    
+    // Sampler variables
+    // ----------------------------------------
+protected:
+    ///< Sampler specifications.
+    SamplerSpecification m_Spec;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(Sampler);
+};
+
+} // namespace pixc
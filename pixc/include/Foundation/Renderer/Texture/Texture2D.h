@@ -25,6 +25,21 @@ inline bool TextureLoader(std::shared_ptr<Texture2D> &texture,
 } // namespace draw
 } // namespace utils
 
+/**
+ * @brief Image decoded from a file, ready to be uploaded into a 2D texture.
+ *
+ * Decoding does not require the rendering context, so images can be decoded on worker threads
+ * and uploaded later using `Texture2D::CreateFromImage()`.
+ */
+struct TextureImage
+{
+    int Width = 0;                      ///< Image width (pixels).
+    int Height = 0;                     ///< Image height (pixels).
+    int Channels = 0;                   ///< Number of channels.
+    bool HDR = false;                   ///< Floating point data (HDR file).
+    std::shared_ptr<void> Pixels;       ///< Pixel data (null if the image could not be decoded).
+};
+
 /**
  * @brief Represents a two-dimensional texture.
  *
@@ -57,6 +72,20 @@ public:
                                                      const TextureSpecification& spec,
                                                      bool flip = true);
     
+    static std::shared_ptr<Texture2D> CreateFromImage(const TextureImage& image,
+                                                      const std::filesystem::path& filePath,
+                                                      bool flip = true);
+    
+    // Loading
+    // ----------------------------------------
+    static TextureImage DecodeImage(const std::filesystem::path& filePath, bool flip = true);
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check whether the texture has been loaded flipped vertically.
+    /// @return `true` if the texture is flipped.
+    bool IsFlipped() const { return m_Flip; }
+    
     // Friend class definition(s)
     // ----------------------------------------
     friend bool utils::draw::TextureLoader(std::shared_ptr<Texture2D> &texture,
@@ -40,7 +40,7 @@ inline CubeMap BuildCubeMap(RendererAPI::API api, float near = 0.1f,
                             const glm::vec3& eye = glm::vec3(0.0f))
 {
     // Construct the perspective projection matrix
-    glm::mat4 proj = glm::perspective(glm::radians(fov), 1.0f, near, far);
+    glm::mat4 proj = RendererAPI::GetDepthProjection(glm::perspective(glm::radians(fov), 1.0f, near, far));
 
     // Define view matrices for each face of the cubemap
     const glm::mat4 POSITIVE_X = glm::lookAt(eye, eye + glm::vec3( 1, 0, 0), glm::vec3(0,-1, 0));
@@ -72,6 +72,61 @@ inline void RotateCubeMap(CubeMap& cube, const glm::mat4& rotationMatrix)
         view = view * rotationMatrix;
 }
 
+/**
+ * Render a single face of a cube map using the specified material and framebuffer.
+ *
+ * The frame is not presented: the face is submitted with the rest of the frame being drawn (e.g.,
+ * when the cube map is rendered over several frames).
+ *
+ * @param cube The CubeMap containing the projection and view matrices for all six faces.
+ * @param face The index of the face to render.
+ * @param model The model to render for the face of the cubemap.
+ * @param material The material to use when rendering the model.
+ * @param framebuffer The framebuffer where the cubemap face will be rendered.
+ * @param viewportWidth Optional width of the viewport. If zero, the framebuffer default size is used.
+ * @param viewportHeight Optional height of the viewport. If zero, the framebuffer default size is used.
+ * @param level The mip level of the framebuffer to render into.
+ * @param genMipMaps Flag indicating whether to generate mipmaps for the resulting cubemap.
+ */
+inline void RenderCubeMapFace(const CubeMap& cube, const uint32_t face,
+                              const std::shared_ptr<BaseModel>& model,
+                              const std::shared_ptr<Material>& material,
+                              const std::shared_ptr<FrameBuffer>& framebuffer,
+                              const uint32_t& viewportWidth = 0,
+                              const uint32_t& viewportHeight = 0,
+                              const uint32_t& level = 0,
+                              const bool& genMipMaps = true)
+{
+    // Update the size of the model
+    model->SetScale(glm::vec3(2.0f));
+    // Set the material for rendering
+    model->SetMaterial(material);
+    
+    // Bind the framebuffer for drawing to the cube map face and mip level
+    framebuffer->BindForDrawAttachmentCube(0, face, level);
+    
+    // Set the viewport dimensions if provided
+    if (viewportWidth > 0 && viewportHeight > 0)
+        RendererCommand::SetViewport(0, 0, viewportWidth, viewportHeight);
+    
+    // Clear the active buffers in the framebuffer
+    RendererCommand::BeginRenderPass(framebuffer);
+    RendererCommand::SetClearColor(glm::vec4(0.0f));
+    RendererCommand::Clear();
+    
+    // Begin rendering scene with the specified view and projection matrices
+    Renderer::BeginScene(cube.views[face], cube.projection);
+    // Draw the model using the specified material
+    model->DrawModel();
+    // End the rendering scene
+    Renderer::EndScene();
+    
+    RendererCommand::EndRenderPass();
+    
+    // Unbind the framebuffer and optionally generate mipmaps
+    framebuffer->Unbind(genMipMaps);
+}
+
 /**
  * Render a cube map from multiple perspectives using the specified material and framebuffer.
  *
@@ -92,37 +147,11 @@ inline void RenderCubeMap(const CubeMap& cube, const std::shared_ptr<BaseModel>&
                           const uint32_t& level = 0,
                           const bool& genMipMaps = true)
 {
-    // Update the size of the model
-    model->SetScale(glm::vec3(2.0f));
-    // Set the material for rendering
-    model->SetMaterial(material);
-    
     // Loop through each face of the cube map
     for (uint32_t i = 0; i < cube.views.size(); ++i)
     {
-        // Bind the framebuffer for drawing to the current cube map face and mip level
-        framebuffer->BindForDrawAttachmentCube(0, i, level);
-        
-        // Set the viewport dimensions if provided
-        if (viewportWidth > 0 && viewportHeight > 0)
-            RendererCommand::SetViewport(0, 0, viewportWidth, viewportHeight);
-        
-        // Clear the active buffers in the framebuffer
-        RendererCommand::BeginRenderPass(framebuffer);
-        RendererCommand::SetClearColor(glm::vec4(0.0f));
-        RendererCommand::Clear();
-        
-        // Begin rendering scene with the specified view and projection matrices
-        Renderer::BeginScene(cube.views[i], cube.projection);
-        // Draw the model using the specified material
-        model->DrawModel();
-        // End the rendering scene
-        Renderer::EndScene();
-        
-        RendererCommand::EndRenderPass();
-        
-        // Unbind the framebuffer and optionally generate mipmaps
-        framebuffer->Unbind(genMipMaps);
+        RenderCubeMapFace(cube, i, model, material, framebuffer,
+                          viewportWidth, viewportHeight, level, genMipMaps);
         
         // Render the face of the cubemap
         GraphicsContext::Get().SwapBuffers();
@@ -1,5 +1,13 @@
 #pragma once
 
+#ifdef PIXC_SOFTWARE_RENDERER
+    #define CREATE_SOFTWARE_OBJECT(PointerType, ObjectType, ...)\
+            case RendererAPI::API::Software:\
+                return PointerType<Software##ObjectType>(__VA_ARGS__);
+#else
+    #define CREATE_SOFTWARE_OBJECT(PointerType, ObjectType, ...)
+#endif
+
 #ifdef __APPLE__
     #define CREATE_RENDERER_OBJECT(PointerType, ObjectType, ...)\
         switch (Renderer::GetAPI())\
@@ -11,6 +19,7 @@
                 return PointerType<OpenGL##ObjectType>(__VA_ARGS__);\
             case RendererAPI::API::Metal:\
                 return PointerType<Metal##ObjectType>(__VA_ARGS__);\
+            CREATE_SOFTWARE_OBJECT(PointerType, ObjectType, __VA_ARGS__)\
         }\
         PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");\
         return nullptr;
@@ -23,6 +32,7 @@
                 return nullptr;\
             case RendererAPI::API::OpenGL:\
                 return PointerType<OpenGL##ObjectType>(__VA_ARGS__);\
+            CREATE_SOFTWARE_OBJECT(PointerType, ObjectType, __VA_ARGS__)\
         }\
         PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");\
         return nullptr;
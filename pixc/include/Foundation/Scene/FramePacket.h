@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Foundation/Core/Timestep.h"
+
+#include "Foundation/Scene/RenderPass.h"
+
+#include "Foundation/Renderer/Light/Light.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+class Scene;
+
+/**
+ * @brief State of a camera when the frame was captured.
+ */
+struct CameraState
+{
+    glm::mat4 View = glm::mat4(1.0f);           ///< View matrix.
+    glm::mat4 Projection = glm::mat4(1.0f);     ///< Projection matrix.
+    glm::vec3 Position = glm::vec3(0.0f);       ///< Position of the camera.
+    float NearPlane = 0.0f;                     ///< Distance to the near plane.
+};
+
+/**
+ * @brief A render pass of a scene as captured for a frame.
+ *
+ * The specification is a copy of the one of the scene, except for its models: only the
+ * renderables left by the contribution culling are kept (with their opacity, model and material).
+ */
+struct PassPacket
+{
+    std::string Name;                           ///< Name of the render pass.
+    RenderPassSpecification Specification;      ///< Specification (visible renderables only).
+    std::vector<float> Fades;                   ///< Opacity of each renderable (1 if fully drawn).
+    std::vector<std::shared_ptr<BaseModel>> Models;     ///< Model of each renderable.
+    std::vector<std::shared_ptr<Material>> Materials;   ///< Material of each renderable (or null).
+    uint32_t CulledModels = 0;                  ///< Number of models culled by the contribution culling.
+};
+
+/**
+ * @brief A scene as captured for a frame (see `Scene::Capture()`).
+ */
+struct ScenePacket
+{
+    ///< State of the cameras used by the render passes.
+    std::unordered_map<const Camera*, CameraState> Cameras;
+    ///< Transformation of the models drawn.
+    std::unordered_map<const BaseModel*, glm::mat4> Transforms;
+    ///< Lights of the scene, with their state (same order).
+    std::vector<std::shared_ptr<Light>> Lights;
+    std::vector<LightState> LightStates;
+    ///< Number of light casters among the lights.
+    int LightCasters = 0;
+    ///< Render passes, in rendering order.
+    std::vector<PassPacket> Passes;
+    ///< Models removed from the scene since the previous capture (see `Scene::RemoveModel()`).
+    std::vector<const BaseModel*> RemovedModels;
+    
+    /// @brief Remove the captured data (the memory is kept for the next capture).
+    void Reset()
+    {
+        Cameras.clear();
+        Transforms.clear();
+        Lights.clear();
+        LightStates.clear();
+        LightCasters = 0;
+        Passes.clear();
+        RemovedModels.clear();
+    }
+};
+
+/**
+ * @brief Everything the render thread needs to draw a frame.
+ *
+ * The packet is filled by the main thread while simulating the frame, then only read by the render
+ * thread while it draws it (see `RenderThread`). It holds copies of the state that keeps changing
+ * during the simulation: the cameras, the lights, the transformations of the models, and the
+ * renderables left after the culling (with their models and materials).
+ */
+struct FramePacket
+{
+    Timestep DeltaTime;                         ///< Time elapsed since the previous frame.
+    uint64_t Frame = 0;                         ///< Index of the frame.
+    
+    ///< Scenes captured (per scene).
+    std::unordered_map<const Scene*, ScenePacket> Scenes;
+    
+    /// @brief Remove the captured data (the memory is kept for the next capture).
+    void Reset()
+    {
+        for (auto& [scene, packet] : Scenes)
+            packet.Reset();
+    }
+};
+
+} // namespace pixc
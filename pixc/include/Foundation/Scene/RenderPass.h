@@ -2,6 +2,7 @@
 
 #include "Foundation/Renderer/Camera/Camera.h"
 #include "Foundation/Renderer/Buffer/FrameBuffer.h"
+#include "Foundation/Renderer/Culling/ClusterCulling.h"
 
 #include <glm/glm.hpp>
 
@@ -13,15 +14,44 @@ namespace pixc {
 
 /**
  * @brief Target output of the render pass (framebuffer, viewport, and clear behavior).
+ *
+ * When load and store actions are defined, they replace the clear settings: the attachments are
+ * cleared, kept, discarded or resolved one by one as defined by the actions.
  */
 struct TargetSettings
 {
     std::shared_ptr<FrameBuffer> FrameBuffer;           ///< Target framebuffer (null = default).
     std::optional<glm::vec2> ViewportSize;              ///< Viewport override (uses framebuffer or scene's viewport if not set).
-
+    
     bool ClearEnabled = true;                           ///< Whether the framebuffer should be cleared.
     glm::vec4 ClearColor = glm::vec4(0.0f);             ///< Clear color (used only if ClearEnabled).
     std::optional<RenderTargetMask> ClearTargets;       ///< Buffers to clear (color, depth, stencil).
+    
+    std::optional<RenderPassActions> Actions;           ///< Load/store actions of the attachments.
+};
+
+/**
+ * @brief Occlusion culling applied to the models of a render pass.
+ */
+enum class OcclusionCulling : uint8_t
+{
+    None = 0,       ///< All the models are drawn.
+    Conditional,    ///< The GPU skips the models whose bounding box is hidden (no CPU stall).
+    Readback,       ///< The CPU skips the models found hidden by a previous query.
+};
+
+/**
+ * @brief Thresholds used to skip the models that barely contribute to a render pass.
+ *
+ * The distances and screen sizes are measured from the scene camera (the viewer), also for the
+ * passes rendered from another point of view (e.g., shadow maps), so a shadow pass can use its
+ * own, more aggressive, thresholds.
+ */
+struct CullingSettings
+{
+    float MaxDistance = 0.0f;       ///< Maximum distance to the bounds of the model (0 = unlimited).
+    float MinScreenSize = 0.0f;     ///< Minimum projected size of the bounds (fraction of the viewport height).
+    float FadeRange = 0.0f;         ///< Fraction of the thresholds over which the model fades out (dithered).
 };
 
 /**
@@ -31,12 +61,17 @@ struct Renderable
 {
     std::string ModelName;                      ///< Name of the model in the scene's model library.
     std::string MaterialName;                   ///< Name of the material to use for this model.
-
-    ///< Lambda to configure model before rendering it.
+    
+    ///< Lambda to configure model before rendering it (called when the scene is captured, on the
+    ///< main thread, see `Scene::Capture()`).
     std::function<void(std::shared_ptr<BaseModel>&)> ModelSetupFunction;
     
-    ///< Lambda to configure material properties before rendering this model.
+    ///< Lambda to configure material properties before rendering this model (called when the
+    ///< model is drawn).
     std::function<void(const std::shared_ptr<Material>&)> MaterialSetupFunction;
+    
+    bool Occluder = false;                      ///< Whether the model is drawn first to hide others (never tested).
+    std::optional<CullingSettings> Culling;     ///< Culling thresholds overriding the ones of the pass.
 };
 
 /**
@@ -47,6 +82,13 @@ struct RenderSettings
     std::shared_ptr<Camera> Camera;             ///< Camera used for rendering (falls back to scene camera if null).
     std::vector<Renderable> Models;             ///< Models to render in this pass.
     bool RenderLights = false;                  ///< Whether to render lights in this pass.
+    bool RenderBackground = false;              ///< Whether to render the background (environment) after the models.
+    bool SortByPipeline = false;                ///< Whether to group the models by shader, then material.
+    
+    OcclusionCulling Occlusion = OcclusionCulling::None;    ///< Occlusion culling of the models (not occluders).
+    uint32_t OcclusionInterval = 4;             ///< Frames between two tests of a model found visible.
+    
+    ClusterCullingMode Clusters = ClusterCullingMode::Frustum;  ///< Culling of the clusters of the large meshes.
 };
 
 /**
@@ -66,6 +108,7 @@ struct RenderPassSpecification
     bool Active = true;                         ///< Whether this render pass is active.
     TargetSettings Target;                      ///< Framebuffer, viewport, clear.
     RenderSettings Render;                      ///< Models, camera, lights.
+    CullingSettings Culling;                    ///< Distance and screen size culling.
     PassHooks Hooks;                            ///< Custom code hooks.
 };
 
@@ -103,6 +146,12 @@ struct RenderPassSpecification
          m_Order.push_back(name);
      }
      
+     // Getter(s)
+     // ----------------------------------------
+     /// @brief Get the names of the render passes in rendering order.
+     /// @return The rendering order.
+     const std::vector<std::string>& GetOrder() const { return m_Order; }
+     
      // Library variables
      // ----------------------------------------
      private:
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Foundation/Core/AssetManager.h"
+
 #include "Foundation/Renderer/Camera/Camera.h"
 #include "Foundation/Renderer/Light/Light.h"
 #include "Foundation/Renderer/Drawable/Model/Model.h"
+#include "Foundation/Renderer/Query/OcclusionQuery.h"
 
 #include "Foundation/Scene/Viewport.h"
 #include "Foundation/Scene/RenderPass.h"
+#include "Foundation/Scene/FramePacket.h"
 
 /**
  * @namespace pixc
@@ -20,7 +24,8 @@ public:
     // ----------------------------------------
     /// @brief Create a new scene.
     Scene(uint32_t width, uint32_t height,
-          const std::filesystem::path& viewportShader = "");
+          const std::filesystem::path& viewportShader = "",
+          const TextureFormat viewportFormat = TextureFormat::RGBA8);
     /// @brief Delete the specified scene.
     ~Scene() = default;
     
@@ -65,20 +70,100 @@ public:
         m_Camera = camera;
     }
     
+    // Remove
+    // ----------------------------------------
+    void RemoveModel(const std::string& name);
+    
+    // Loading
+    // ----------------------------------------
+    void WhenLoaded(const std::vector<std::shared_ptr<AssetRecord>>& assets,
+                    const std::function<void(Scene&)>& function);
+    void UpdateLoads();
+    void WaitForLoads();
+    
+    /// @brief Check whether assets requested for the scene are still being loaded.
+    /// @return `true` if functions are waiting for their assets (see `WhenLoaded()`).
+    bool IsLoading() const { return !m_PendingLoads.empty(); }
+    
     // Render
     // ----------------------------------------
     void Draw();
     
+    void Capture(ScenePacket& packet);
+    void Draw(const ScenePacket& packet);
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the statistics of a render pass (last frame drawn).
+     */
+    struct PassStatistics
+    {
+        ///< Number of models drawn.
+        uint32_t DrawnModels = 0;
+        ///< Number of models culled by their distance or screen size.
+        uint32_t CulledModels = 0;
+        ///< Number of models drawn fading out (dithered).
+        uint32_t FadingModels = 0;
+    };
+    
+    /**
+     * Represents the information related to the statistics of the scene (last frame drawn).
+     */
+    struct Statistics
+    {
+        ///< Number of models drawn (including the ones drawn under a conditional render).
+        uint32_t DrawnModels = 0;
+        ///< Number of occlusion queries issued.
+        uint32_t OcclusionTests = 0;
+        ///< Number of models skipped because a previous query found them hidden.
+        uint32_t OcclusionCulled = 0;
+        ///< Number of models drawn under a conditional render (discarded by the GPU if hidden).
+        uint32_t ConditionalDraws = 0;
+        ///< Number of models culled by their distance or screen size.
+        uint32_t ContributionCulled = 0;
+        ///< Statistics of each render pass drawn.
+        std::unordered_map<std::string, PassStatistics> Passes;
+    };
+    
+    /// @brief Get the statistics of the last frame drawn.
+    /// @return The scene statistics.
+    const Statistics& GetStats() const { return m_Stats; }
+
 private:
-    void Draw(const RenderPassSpecification& pass);
+    void Draw(const PassPacket& pass, const ScenePacket& packet);
+    
+    void UpdateLights(const ScenePacket& packet);
+    void DrawLights(const ScenePacket& packet, const bool background = false);
+    void DrawBackground(const ScenePacket& packet);
+    void DrawModels(const PassPacket& pass, const ScenePacket& packet);
+    void DrawRenderable(const PassPacket& pass, size_t index, const ScenePacket& packet);
     
-    void DrawLights();
-    void DrawModels(const std::vector<Renderable>& models);
+    // Contribution culling
+    // ----------------------------------------
+    float ComputeContribution(const BaseModel& model, const CullingSettings& culling) const;
+    
+    // Occlusion culling
+    // ----------------------------------------
+    /**
+     * Represents the occlusion state of a model drawn in a render pass.
+     */
+    struct OcclusionState
+    {
+        std::shared_ptr<OcclusionQuery> Query;  ///< Query testing the bounding box of the model.
+        bool Visible = true;                    ///< Result of the last query read.
+        uint64_t NextTest = 0;                  ///< Frame of the next test while visible.
+    };
+    
+    bool PrepareOcclusion();
+    bool CrossesNearPlane(const BaseModel& model, const CameraState& camera,
+                          const ScenePacket& packet) const;
+    void DrawOcclusionProxy(const std::shared_ptr<BaseModel>& model, const ScenePacket& packet);
     
     // Setters
     // ----------------------------------------
     void ApplyTargetSettings(const TargetSettings& target);
-    void DefineShadowProperties(const std::shared_ptr<Material>& material);
+    void DefineShadowProperties(const std::shared_ptr<Material>& material, const ScenePacket& packet);
     
     // Scene variables
     // ----------------------------------------
@@ -99,6 +184,34 @@ private:
     
     ///< Render passes for the rendering of the scene.
     RenderPassLibrary m_RenderPasses;
+    
+    ///< Occlusion state of the models tested (per render pass and model).
+    std::unordered_map<std::string, std::unordered_map<const BaseModel*, OcclusionState>> m_Occlusion;
+    ///< Models removed since the last capture (their occlusion state is released when drawn).
+    std::vector<const BaseModel*> m_RemovedModels;
+    ///< Unit cube drawn to test the bounding boxes (null if the queries are not supported).
+    std::shared_ptr<BaseModel> m_OcclusionProxy;
+    ///< Whether the occlusion proxy has been created (or found unsupported).
+    bool m_OcclusionReady = false;
+    
+    /**
+     * Represents a function waiting for assets to be loaded (see `WhenLoaded()`).
+     */
+    struct PendingLoad
+    {
+        std::vector<std::shared_ptr<AssetRecord>> Assets;   ///< Assets required.
+        std::function<void(Scene&)> Function;               ///< Function executed once they are loaded.
+    };
+    ///< Functions waiting for their assets.
+    std::vector<PendingLoad> m_PendingLoads;
+    
+    ///< Packet captured and drawn by `Draw()` (kept to reuse its memory).
+    ScenePacket m_Packet;
+    
+    ///< Number of frames drawn.
+    uint64_t m_Frame = 0;
+    ///< Statistics of the last frame drawn.
+    Statistics m_Stats;
 };
 
 } // namespace pixc
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Foundation/Scene/Scene.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Saves and loads scenes using a compact binary format.
+ *
+ * The `SceneSerializer` class writes the resources of a scene (framebuffers, materials and their
+ * properties, models and their transforms, lights and render pass descriptions) into a single
+ * binary file. Models loaded from files are stored by reference to their source files (read from
+ * their cached mesh blobs when the mesh cache is enabled), and textures by reference to their
+ * source images.
+ *
+ * Loading reads the file in a single pass. The referenced images and models are requested to the
+ * `AssetManager` as soon as their references are read, and loaded in the background while the
+ * rest of the file is parsed; the resources are then created in bulk, in dependency order. The
+ * loading does not block: the textures and models are defined in the scene once they are ready
+ * (see `Scene::WhenLoaded()` and `Scene::WaitForLoads()`).
+ *
+ * @note Code defined in the scene (render pass hooks, model and material setup functions) and
+ * procedurally generated geometry cannot be serialized; they must be defined again after loading.
+ *
+ * Copying or moving `SceneSerializer` objects is disabled to ensure single ownership.
+ */
+class SceneSerializer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Create a serializer for a scene.
+    /// @param scene The scene to be saved or loaded.
+    SceneSerializer(Scene& scene) : m_Scene(scene) {}
+    /// @brief Delete the serializer.
+    ~SceneSerializer() = default;
+
+    // Serialization
+    // ----------------------------------------
+    bool Serialize(const std::filesystem::path& filePath);
+    bool Deserialize(const std::filesystem::path& filePath);
+
+    // Serializer variables
+    // ----------------------------------------
+private:
+    ///< Scene to be saved or loaded.
+    Scene& m_Scene;
+
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SceneSerializer);
+};
+
+} // namespace pixc
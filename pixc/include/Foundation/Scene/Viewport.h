@@ -6,6 +6,9 @@
 #include "Foundation/Renderer/Drawable/Model/ModelUtils.h"
 
 #include "Foundation/Renderer/Material/UnlitMaterial.h"
+#include "Foundation/Renderer/Material/ToneMapMaterial.h"
+
+#include "Foundation/Renderer/PostProcess/AutoExposure.h"
 
 #include "Foundation/Renderer/RendererCommand.h"
 
@@ -23,6 +26,13 @@ namespace pixc {
  * It supports both supersampling and subsampling through a scale factor, allowing the framebuffer
  * to be rendered at higher or lower resolutions than the display size while keeping the geometry consistent.
  *
+ * Without a viewport shader, the screen buffer is copied to the screen with a direct blit; the
+ * viewport material is only drawn when the rendering API cannot blit into the screen.
+ *
+ * When an exposure is defined (`SetExposure()`), the image is displayed through a tone mapping
+ * material, with an exposure that can adapt to the luminance of the frames. The screen buffer
+ * should then use a high dynamic range format (e.g., `TextureFormat::RGBA16F`).
+ *
  * Copying or moving `Viewport` objects is disabled to ensure proper management of the
  * underlying framebuffer and shared geometry.
  */
@@ -35,14 +45,16 @@ public:
     /// @param width The width of the viewport.
     /// @param height The height of the viewport.
     /// @param shaderPath Optional shader path for the viewport material.
-    Viewport(uint32_t width, uint32_t height, const std::filesystem::path& shaderPath = "")
+    /// @param format The format of the color attachment of the screen buffer.
+    Viewport(uint32_t width, uint32_t height, const std::filesystem::path& shaderPath = "",
+             const TextureFormat format = TextureFormat::RGBA8)
     {
         // Create the output framebuffer (screen buffer)
         FrameBufferSpecification viewportSpec;
         viewportSpec.SetFrameBufferSize(width, height);
         viewportSpec.AttachmentsSpec = {
-            { TextureType::TEXTURE2D, TextureFormat::RGBA8 },
-            { TextureType::TEXTURE2D, TextureFormat::DEPTH16 }
+            { TextureType::TEXTURE2D, format },
+            { TextureType::TEXTURE2D, RendererAPI::GetDepthFormat(TextureFormat::DEPTH16) }
         };
         m_ScreenBuffer = FrameBuffer::Create(viewportSpec);
         
@@ -68,6 +80,7 @@ public:
             return std::dynamic_pointer_cast<TextureMaterial>(materialLibrary.Get(name));
         };
         m_Material = createOrGetMaterial(name, shaderPath);
+        m_Blit = shaderPath.empty();
     }
     /// @brief Delete the viewport.
     ~Viewport() = default;
@@ -85,6 +98,10 @@ public:
     /// @return Viewport framebuffer.
     const std::shared_ptr<FrameBuffer>& GetScreenBuffer() const { return m_ScreenBuffer; }
     
+    /// @brief Get the auto-exposure stage applied when displaying the image.
+    /// @return The auto-exposure stage, or null if no exposure is defined.
+    const std::shared_ptr<AutoExposure>& GetExposure() const { return m_Exposure; }
+    
     // Setter(s)
     // ----------------------------------------
     /// @brief Resize the size of the viewport.
@@ -109,22 +126,75 @@ public:
     /// @return Viewport framebuffer.
     void SetScreenBuffer(const std::shared_ptr<FrameBuffer>& fb) { m_ScreenBuffer = fb; }
     
+    /// @brief Define the exposure and tone mapping applied when displaying the image (replaces
+    /// the viewport material in `RenderToScreen()`).
+    /// @param settings The exposure settings.
+    void SetExposure(const ExposureSettings& settings)
+    {
+        if (m_Exposure)
+        {
+            m_Exposure->SetSettings(settings);
+            return;
+        }
+        
+        // The tone mapping shader is only defined in GLSL
+        if (Renderer::GetAPI() != RendererAPI::API::OpenGL)
+        {
+            PIXEL_CORE_WARN("Tone mapping is not supported by the rendering API!");
+            return;
+        }
+        
+        m_Exposure = std::make_shared<AutoExposure>(settings);
+        
+        auto& materialLibrary = Renderer::GetMaterialLibrary();
+        if (!materialLibrary.Exists("ViewportToneMap"))
+            materialLibrary.Create<ToneMapMaterial>("ViewportToneMap");
+        m_ToneMapMaterial = std::dynamic_pointer_cast<ToneMapMaterial>(materialLibrary.Get("ViewportToneMap"));
+    }
+    
     // Render
     // ----------------------------------------
     /// @brief Display the rendered image into the screen.
     /// @param material Viewport material.
     void RenderToScreen() const
     {
-        m_Material->SetTextureMap(m_ScreenBuffer->GetColorAttachment(0));
-        Render(nullptr, m_Material);
+        const auto& frame = m_ScreenBuffer->GetColorAttachment(0);
+        
+        // Measure the frame and apply the exposure while displaying it
+        if (m_Exposure)
+        {
+            m_Exposure->Update(frame);
+            m_ToneMapMaterial->SetExposure(m_Exposure);
+            m_ToneMapMaterial->SetTextureMap(frame);
+            Render(nullptr, m_ToneMapMaterial, false);
+            return;
+        }
+        
+        // Copy the image directly when no shading is applied to it
+        if (m_Blit)
+        {
+            BlitSpecification spec;
+            spec.SetFilter(m_Scale == 1.0f ? TextureFilter::Nearest : TextureFilter::Linear);
+            
+            RendererCommand::BeginRenderPass(nullptr);
+            bool copied = FrameBuffer::BlitToScreen(m_ScreenBuffer, GetWidth(), GetHeight(), spec);
+            RendererCommand::EndRenderPass();
+            
+            if (copied)
+                return;
+        }
+        
+        m_Material->SetTextureMap(frame);
+        Render(nullptr, m_Material, false);
     }
-    /// @brief Render the viewport geometry into a framebuffer.
+    /// @brief Render a fullscreen pass into a framebuffer.
     /// @param framebuffer The output of the rendered image.
     /// @param material The shading material used for rendering.
+    /// @param clear Clear the framebuffer before rendering (not needed when every pixel is written).
     void RenderToFrameBuffer(const std::shared_ptr<FrameBuffer>& framebuffer,
-                             const std::shared_ptr<Material>& material) const
+                             const std::shared_ptr<Material>& material, bool clear = true) const
     {
-        Render(framebuffer, material);
+        Render(framebuffer, material, clear);
     }
     
     // Friend class definition(s)
@@ -132,22 +202,23 @@ public:
     friend class Scene;
     
 private:
-    /// @brief Render the viewport geometry into a framebuffer.
+    /// @brief Render a fullscreen pass into a framebuffer.
     /// @param framebuffer The output of the rendered image.
     /// @param material The shading material used for rendering.
+    /// @param clear Clear the framebuffer before rendering.
     void Render(const std::shared_ptr<FrameBuffer>& framebuffer,
-                const std::shared_ptr<Material>& material) const
+                const std::shared_ptr<Material>& material, bool clear) const
     {
         RendererCommand::BeginRenderPass(framebuffer);
         if (!framebuffer)
             RendererCommand::SetViewport(0, 0, GetWidth(), GetHeight());
-        RendererCommand::SetClearColor(glm::vec4(0.0f));
-        RendererCommand::Clear();
+        if (clear)
+        {
+            RendererCommand::SetClearColor(glm::vec4(0.0f));
+            RendererCommand::Clear();
+        }
 
-        Renderer::BeginScene();
-        s_Geometry->SetMaterial(material);
-        s_Geometry->DrawModel();
-        Renderer::EndScene();
+        Renderer::DrawFullscreen(material);
 
         RendererCommand::EndRenderPass();
     }
@@ -162,6 +233,12 @@ private:
     std::shared_ptr<FrameBuffer> m_ScreenBuffer;
     ///< Material to be used to display the framebuffer.
     std::shared_ptr<TextureMaterial> m_Material;
+    ///< Copy the framebuffer to the screen instead of drawing it (no viewport shader).
+    bool m_Blit = false;
+    
+    ///< Auto-exposure stage and material applying it (if an exposure is defined).
+    std::shared_ptr<AutoExposure> m_Exposure;
+    std::shared_ptr<ToneMapMaterial> m_ToneMapMaterial;
     
     ///< Scale factor for the viewport plane (for subsampling or resizing)
     float m_Scale = 1.0f;
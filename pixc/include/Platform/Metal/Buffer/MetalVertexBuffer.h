@@ -24,6 +24,7 @@ public:
     // ----------------------------------------
     MetalVertexBuffer(const void *vertices, const uint32_t size,
                       const uint32_t count);
+    MetalVertexBuffer(const uint32_t size);
     ///@brief Delete the vertex buffer.
     ~MetalVertexBuffer() override = default;
     
@@ -36,6 +37,9 @@ public:
     /// @note Not necessary for Metal API.
     void Unbind() const override {};
     
+    void SetData(const void *vertices, const uint32_t size,
+                 const uint32_t count) override;
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Returns the instance of this as a Metal Buffer.
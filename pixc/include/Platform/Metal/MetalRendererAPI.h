@@ -45,6 +45,10 @@ public:
     /// @param enabled Set to `true` to enable seamless cubemap sampling, or `false` to disable it.
     /// @note No-op in Metal: seamless cubemap sampling is automatic
     void SetCubeMapSeamless(const bool enabled) override {}
+    /// @brief Enable or disable alpha blending.
+    /// @param enabled Set to `true` to enable alpha blending, or `false` to disable it.
+    /// @note No-op in Metal: blending is defined in the render pipeline state.
+    void EnableBlending(const bool enabled) override {}
     
     // Render
     // ----------------------------------------
@@ -55,6 +59,9 @@ public:
     
     void Draw(const std::shared_ptr<Drawable>& drawable,
               const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                     const uint32_t indexCount,
+                     const PrimitiveType &primitive = PrimitiveType::Triangle) override;
     
 private:
     // Initialization
@@ -56,7 +56,8 @@ public:
     
     void SetTexture(const std::string &name,
                     const std::shared_ptr<Texture>& texture,
-                    int slot) override;
+                    int slot,
+                    const std::shared_ptr<Sampler>& sampler = nullptr) override;
     
 private:
     // Getter(s)
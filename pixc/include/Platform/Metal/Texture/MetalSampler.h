@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Sampler.h"
+
+#include "Platform/Metal/MetalContext.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `Sampler` for the Metal rendering API.
+ *
+ * The `MetalSampler` creates a sampler state object. Metal binds the sampler states along with the
+ * textures (see `MetalShader::SetTexture()`), instead of the sampler of the texture itself.
+ *
+ * Copying or moving `MetalSampler` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class MetalSampler : public Sampler
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    MetalSampler(const SamplerSpecification& spec);
+    ~MetalSampler() override;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the sampler to a specific texture unit (bound with the texture instead).
+    /// @param slot The texture unit slot.
+    void BindToTextureUnit(uint32_t slot) const override {}
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the Metal sampler state.
+    /// @return The sampler state as a void pointer (null once released).
+    void* MTLGetSampler() const { return m_Sampler; }
+    
+protected:
+    void Release() override;
+    
+    // Sampler variables
+    // ----------------------------------------
+private:
+    ///< Sampler state (id<MTLSamplerState>).
+    void* m_Sampler = nullptr;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(MetalSampler);
+};
+
+} // namespace pixc
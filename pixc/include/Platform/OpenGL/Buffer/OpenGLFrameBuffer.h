@@ -28,6 +28,18 @@ class OpenGLFrameBuffer : public FrameBuffer
     // Getter(s)
     // ----------------------------------------
     std::vector<char> GetAttachmentData(const uint32_t index) override;
+    /// @brief Check if the attachments are stored in render buffers (multisampled framebuffer
+    /// whose attachments are never sampled).
+    /// @return `true` if the attachments are render buffers.
+    bool UsesRenderBuffers() const override { return m_Spec.RenderBuffers && m_Spec.Samples > 1; }
+    void GetAttachmentDataAsync(const uint32_t index,
+                                const std::function<void(std::vector<char>)>& callback) override;
+    
+    // Readback
+    // ----------------------------------------
+    static void ProcessReadbacks(bool wait);
+    static void ReleaseReadbacks();
+    static uint32_t GetPendingReadbacks();
     
     // Usage
     // ----------------------------------------
@@ -42,11 +54,22 @@ class OpenGLFrameBuffer : public FrameBuffer
     // ----------------------------------------
     void ClearAttachment(const uint32_t index, const int value) override;
     
+    // Load/store actions
+    // ----------------------------------------
+    void ApplyLoadActions(const RenderPassActions& actions) override;
+    void ApplyStoreActions(const RenderPassActions& actions) override;
+    
     // Blit
     // ----------------------------------------
     static void Blit(const std::shared_ptr<OpenGLFrameBuffer>& src,
                      const std::shared_ptr<OpenGLFrameBuffer>& dst,
                      const BlitSpecification& spec);
+    static void BlitToScreen(const std::shared_ptr<OpenGLFrameBuffer>& src,
+                             const uint32_t width, const uint32_t height,
+                             const BlitSpecification& spec);
+    static void Resolve(const std::shared_ptr<OpenGLFrameBuffer>& src,
+                        const std::shared_ptr<OpenGLFrameBuffer>& dst,
+                        const std::vector<uint32_t>& colors, const bool depth);
     
     private:
     // Destructor
@@ -56,12 +79,16 @@ class OpenGLFrameBuffer : public FrameBuffer
     // Reset
     // ----------------------------------------
     void Invalidate() override;
+    void DefineRenderBuffers();
     
     // Framebuffer variables
     // ----------------------------------------
     private:
     ///< ID of the framebuffer.
     uint32_t m_ID = 0;
+    ///< Render buffers storing the attachments (if not stored in textures).
+    std::vector<uint32_t> m_ColorRenderBuffers;
+    uint32_t m_DepthRenderBuffer = 0;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/StorageBuffer.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `StorageBuffer` for the OpenGL rendering API.
+ *
+ * The `OpenGLStorageBuffer` handles the creation, update, and binding of shader storage buffers
+ * specifically for OpenGL (4.3 or later). The readbacks are synchronized with a fence object
+ * inserted in the command stream.
+ *
+ * Copying or moving `OpenGLStorageBuffer` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class OpenGLStorageBuffer : public StorageBuffer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    OpenGLStorageBuffer(const uint32_t size);
+    virtual ~OpenGLStorageBuffer();
+    
+    // Usage
+    // ----------------------------------------
+    void Bind(const uint32_t binding) const override;
+    
+    // Readback
+    // ----------------------------------------
+    void BeginReadback() override;
+    bool IsReadbackReady() override;
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetData(const void *data, const uint32_t size, const uint32_t offset = 0) override;
+    
+    // Getter(s)
+    // ----------------------------------------
+    void GetData(void *data, const uint32_t size, const uint32_t offset = 0) override;
+    
+private:
+    // Synchronization
+    // ----------------------------------------
+    void ReleaseFence();
+    
+    // Storage buffer variables
+    // ----------------------------------------
+private:
+    ///< ID of the storage buffer.
+    uint32_t m_ID = 0;
+    ///< Fence signaled when the GPU is done with the commands of the readback (`GLsync`).
+    void* m_Fence = nullptr;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OpenGLStorageBuffer);
+};
+
+} // namespace pixc
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `UniformBuffer` for the OpenGL rendering API.
+ *
+ * The `OpenGLUniformBuffer` handles the creation, update, and binding of uniform buffers
+ * specifically for OpenGL. It uses OpenGL functions to interact with the GPU.
+ *
+ * Copying or moving `OpenGLUniformBuffer` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class OpenGLUniformBuffer : public UniformBuffer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    OpenGLUniformBuffer(const uint32_t size);
+    virtual ~OpenGLUniformBuffer();
+    
+    // Usage
+    // ----------------------------------------
+    void BindRange(const uint32_t binding, const uint32_t offset,
+                   const uint32_t size) const override;
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetData(const void *data, const uint32_t size, const uint32_t offset = 0) override;
+    
+    // Uniform buffer variables
+    // ----------------------------------------
+private:
+    ///< ID of the uniform buffer.
+    uint32_t m_ID = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OpenGLUniformBuffer);
+};
+
+} // namespace pixc
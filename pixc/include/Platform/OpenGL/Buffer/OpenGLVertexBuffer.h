@@ -24,6 +24,7 @@ public:
     // ----------------------------------------
     OpenGLVertexBuffer(const void *vertices, const uint32_t size,
                        const uint32_t count);
+    OpenGLVertexBuffer(const uint32_t size);
     virtual ~OpenGLVertexBuffer();
     
     // Usage
@@ -31,6 +32,9 @@ public:
     void Bind() const override;
     void Unbind() const override;
     
+    void SetData(const void *vertices, const uint32_t size,
+                 const uint32_t count) override;
+    
     // Vertex buffer variables
     // ----------------------------------------
 private:
@@ -34,7 +34,7 @@ public:
     // Rendering
     // ----------------------------------------
     virtual void BeginFrame() override;
-    virtual void EndFrame() override;
+    virtual void EndFrame(ImDrawData* drawData) override;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -27,6 +27,11 @@ public:
     // ----------------------------------------
     void Init() override;
     
+    // Usage
+    // ----------------------------------------
+    void MakeCurrent() override;
+    void ReleaseCurrent() override;
+    
     // Setter(s)
     // ----------------------------------------
     static void SetWindowHints();
@@ -44,6 +44,14 @@ public:
     
     void SetFaceCulling(const FaceCulling mode) override;
     void SetCubeMapSeamless(const bool enabled) override;
+    void EnableBlending(const bool enabled) override;
+    
+    void EnableColorWriting(const bool enabled) override;
+    void EnableDepthWriting(const bool enabled) override;
+    
+    // Depth
+    // ----------------------------------------
+    bool IsReversedDepthSupported() const override;
     
     // Render
     // ----------------------------------------
@@ -53,12 +61,36 @@ public:
     
     void Draw(const std::shared_ptr<Drawable>& drawable,
               const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                     const uint32_t indexCount,
+                     const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                    const std::vector<IndexRange>& ranges,
+                    const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawFullscreen() override;
+    
+    // Compute
+    // ----------------------------------------
+    bool IsComputeSupported() const override;
+    void DispatchCompute(const uint32_t x, const uint32_t y, const uint32_t z) override;
+    
+protected:
+    // Depth
+    // ----------------------------------------
+    void ApplyReversedDepth(const bool enabled) override;
     
     // OpenGL API variables
     // ----------------------------------------
 private:
     ///< Rendering flag.
     static bool s_IsRendering;
+    
+    ///< Counts and offsets of the ranges of indices drawn at once (scratch data).
+    std::vector<int32_t> m_RangeCounts;
+    std::vector<const void*> m_RangeOffsets;
+    
+    ///< Vertex array without attributes (required by the core profile to draw without vertex data).
+    uint32_t m_EmptyVertexArray = 0;
 };
 
 } // namespace pixc
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Foundation/Renderer/Query/Fence.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of a fence for OpenGL (`glFenceSync`).
+ *
+ * Copying or moving `OpenGLFence` objects is disabled to ensure single ownership and
+ * prevent unintended resource duplication.
+ */
+class OpenGLFence : public Fence
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    OpenGLFence();
+    ~OpenGLFence() override;
+    
+    // Usage
+    // ----------------------------------------
+    bool IsSignaled() const override;
+    bool Wait(uint64_t timeout = UINT64_MAX) const override;
+    
+    // OpenGL fence variables
+    // ----------------------------------------
+private:
+    ///< Sync object (`GLsync`).
+    void* m_Sync = nullptr;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OpenGLFence);
+};
+
+} // namespace pixc
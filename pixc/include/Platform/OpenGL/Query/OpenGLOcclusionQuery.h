@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Foundation/Renderer/Query/OcclusionQuery.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of an occlusion query for OpenGL (`GL_ANY_SAMPLES_PASSED`).
+ *
+ * Copying or moving `OpenGLOcclusionQuery` objects is disabled to ensure single ownership and
+ * prevent unintended resource duplication.
+ */
+class OpenGLOcclusionQuery : public OcclusionQuery
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    OpenGLOcclusionQuery();
+    ~OpenGLOcclusionQuery() override;
+    
+    // Usage
+    // ----------------------------------------
+    void Begin() override;
+    void End() override;
+    
+    void BeginConditionalRender(bool wait = true) const override;
+    void EndConditionalRender() const override;
+    
+    // Getter(s)
+    // ----------------------------------------
+    bool IsResultAvailable() const override;
+    bool GetResult() const override;
+    
+    // OpenGL occlusion query variables
+    // ----------------------------------------
+private:
+    ///< Query identifier.
+    uint32_t m_ID = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OpenGLOcclusionQuery);
+};
+
+} // namespace pixc
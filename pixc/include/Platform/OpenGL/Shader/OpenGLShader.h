@@ -48,7 +48,10 @@ public:
     
     void SetTexture(const std::string &name,
                     const std::shared_ptr<Texture>& texture,
-                    int slot) override;
+                    int slot,
+                    const std::shared_ptr<Sampler>& sampler = nullptr) override;
+    
+    bool SetUniformBlock(const std::string& name, uint32_t binding) override;
     
 private:
     /**
@@ -64,15 +67,19 @@ private:
         std::string FragmentSource;
         ///< Geometry shader source code
         std::string GeometrySource;
+        ///< Compute shader source code (compute programs have no other stage)
+        std::string ComputeSource;
         
         // Constructor(s)/Destructor
         // ----------------------------------------
         /// @brief Define the shader program source.
         /// @param vs Vertex shader source.
         /// @param fs Fragment shader source.
+        /// @param gs Geometry shader source.
+        /// @param cs Compute shader source.
         OpenGLShaderSource(const std::string& vs, const std::string& fs,
-            const std::string& gs = "")
-            : VertexSource(vs), FragmentSource(fs), GeometrySource(gs)
+            const std::string& gs = "", const std::string& cs = "")
+            : VertexSource(vs), FragmentSource(fs), GeometrySource(gs), ComputeSource(cs)
         {}
         /// @brief Delete the shader program source.
         ~OpenGLShaderSource() = default;
@@ -85,6 +92,7 @@ private:
     uint32_t CreateShader(const std::string& vertexShader,
                           const std::string& fragmentShader,
                           const std::string& gemetryShader = "");
+    uint32_t CreateComputeShader(const std::string& computeShader);
     
     // Attributes(s) & Uniform(s)
     // ----------------------------------------
@@ -99,6 +107,9 @@ private:
     ///< ID of the shader program.
     uint32_t m_ID = 0;
     
+    ///< Uniform blocks defined in the shader (block index and attached binding point).
+    std::unordered_map<std::string, std::pair<uint32_t, int32_t>> m_UniformBlocks;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
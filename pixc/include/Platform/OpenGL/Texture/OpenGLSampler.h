@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Sampler.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `Sampler` for the OpenGL rendering API.
+ *
+ * The `OpenGLSampler` handles the creation and binding of sampler objects specifically for
+ * OpenGL. It keeps track of the samplers bound to each texture unit to avoid redundant calls.
+ *
+ * Copying or moving `OpenGLSampler` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class OpenGLSampler : public Sampler
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    OpenGLSampler(const SamplerSpecification& spec);
+    ~OpenGLSampler() override;
+    
+    // Usage
+    // ----------------------------------------
+    void BindToTextureUnit(uint32_t slot) const override;
+    static void UnbindTextureUnit(uint32_t slot);
+    
+protected:
+    void Release() override;
+    
+    // Sampler variables
+    // ----------------------------------------
+private:
+    ///< ID of the sampler.
+    uint32_t m_ID = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(OpenGLSampler);
+};
+
+} // namespace pixc
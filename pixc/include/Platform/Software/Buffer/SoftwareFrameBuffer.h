@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/FrameBuffer.h"
+
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents the textures written by the software rasterizer during a draw call.
+ */
+struct SoftwareRenderTarget
+{
+    ///< Color textures and the layer drawn into each of them.
+    std::vector<std::pair<SoftwareTexture*, uint32_t>> Colors;
+    ///< Depth texture (if any).
+    SoftwareTexture* Depth = nullptr;
+    ///< Size of the target (in pixels).
+    uint32_t Width = 0, Height = 0;
+};
+
+/**
+ * @brief Provides an implementation of the `FrameBuffer` interface for the software rendering API.
+ *
+ * The attachments are software textures, written directly by the rasterizer. The default
+ * framebuffer (the screen) is a software framebuffer too, since the software rendering API does
+ * not present its images.
+ *
+ * Copying or moving `SoftwareFrameBuffer` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class SoftwareFrameBuffer : public FrameBuffer
+{
+    public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareFrameBuffer(const FrameBufferSpecification& spec);
+    ~SoftwareFrameBuffer() override;
+    
+    // Getter(s)
+    // ----------------------------------------
+    std::vector<char> GetAttachmentData(const uint32_t index) override;
+    SoftwareRenderTarget GetRenderTarget() const;
+    
+    static std::shared_ptr<SoftwareFrameBuffer> GetScreen();
+    
+    // Reset
+    // ----------------------------------------
+    static void ResizeScreen(const uint32_t width, const uint32_t height);
+    
+    // Draw
+    // ----------------------------------------
+    void ClearAttachment(const uint32_t index, const int value) override;
+    
+    // Load/store actions
+    // ----------------------------------------
+    void ApplyLoadActions(const RenderPassActions& actions) override;
+    
+    // Blit
+    // ----------------------------------------
+    static void Blit(const std::shared_ptr<SoftwareFrameBuffer>& src,
+                     const std::shared_ptr<SoftwareFrameBuffer>& dst,
+                     const BlitSpecification& spec);
+    static void BlitToScreen(const std::shared_ptr<SoftwareFrameBuffer>& src,
+                             const uint32_t width, const uint32_t height,
+                             const BlitSpecification& spec);
+    
+    private:
+    // Reset
+    // ----------------------------------------
+    void Invalidate() override;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+    public:
+    DISABLE_COPY_AND_MOVE(SoftwareFrameBuffer);
+};
+
+} // namespace pixc
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/IndexBuffer.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `IndexBuffer` for the software rendering API.
+ *
+ * The `SoftwareIndexBuffer` keeps a copy of the indices in memory, which the rasterizer reads
+ * when assembling the primitives.
+ *
+ * Copying or moving `SoftwareIndexBuffer` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class SoftwareIndexBuffer : public IndexBuffer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an index buffer and copy the input indices into it.
+    /// @param indices Index information for the vertices.
+    /// @param count Number of indices.
+    SoftwareIndexBuffer(const uint32_t *indices, const uint32_t count)
+        : IndexBuffer(count), m_Indices(indices, indices + count)
+    {}
+    /// @brief Delete the index buffer.
+    virtual ~SoftwareIndexBuffer() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the index buffer (the indices are read directly by the rasterizer).
+    void Bind() const override {}
+    /// @brief Unbind the index buffer.
+    void Unbind() const override {}
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the indices of the buffer.
+    /// @return The indices.
+    const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+    
+    // Index buffer variables
+    // ----------------------------------------
+private:
+    ///< Indices of the buffer.
+    std::vector<uint32_t> m_Indices;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareIndexBuffer);
+};
+
+} // namespace pixc
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Foundation/Renderer/Buffer/VertexBuffer.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `VertexBuffer` for the software rendering API.
+ *
+ * The `SoftwareVertexBuffer` keeps a copy of the vertex data in memory, which the rasterizer
+ * reads through the layout of the buffer.
+ *
+ * Copying or moving `SoftwareVertexBuffer` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class SoftwareVertexBuffer : public VertexBuffer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareVertexBuffer(const void *vertices, const uint32_t size,
+                         const uint32_t count);
+    SoftwareVertexBuffer(const uint32_t size);
+    /// @brief Delete the vertex buffer.
+    virtual ~SoftwareVertexBuffer() = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the vertex buffer (the data is read directly by the rasterizer).
+    void Bind() const override {}
+    /// @brief Unbind the vertex buffer.
+    void Unbind() const override {}
+    
+    void SetData(const void *vertices, const uint32_t size,
+                 const uint32_t count) override;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the vertex data.
+    /// @return The vertex data (bytes).
+    const char* GetData() const { return m_Data.data(); }
+    
+    // Vertex buffer variables
+    // ----------------------------------------
+private:
+    ///< Vertex data.
+    std::vector<char> m_Data;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareVertexBuffer);
+};
+
+} // namespace pixc
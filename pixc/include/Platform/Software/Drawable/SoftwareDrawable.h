@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Foundation/Renderer/Drawable/Drawable.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents a drawable object specifically for the software rasterizer.
+ *
+ * The vertex attributes are read from the vertex buffers through their layout when the drawable
+ * is rasterized, so there is no vertex array to be defined.
+ *
+ * Copying or moving `SoftwareDrawable` objects is disabled to ensure single ownership
+ * and prevent unintended buffer duplication.
+ */
+class SoftwareDrawable : public Drawable
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Constructs a drawable object.
+    SoftwareDrawable() : Drawable() {}
+    /// @brief Destroys the drawable object.
+    ~SoftwareDrawable() override = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Binds the drawable by binding its shader.
+    void Bind() const override { m_Shader->Bind(); }
+    /// @brief Un-binds the drawable by un-binding its shader.
+    void Unbind() const override { m_Shader->Unbind(); }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the shader used for shading the drawable object.
+    /// @return The shader program.
+    const std::shared_ptr<Shader>& GetShader() const { return m_Shader; }
+
+private:
+
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Add a vertex buffer (its data is read through its layout when rasterized).
+    /// @param vbo The vertex buffer.
+    void SetVertexAttributes(const std::shared_ptr<VertexBuffer>& vbo) override {}
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareDrawable);
+};
+
+} // namespace pixc
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Foundation/Layer/Gui/GuiBackend.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief ImGui backend implementation for the software rendering API.
+ *
+ * The `SoftwareGuiBackend` class keeps ImGui running with the GLFW backend (inputs and frames),
+ * but its draw data is not rasterized: the software rendering API does not present its images.
+ */
+class SoftwareGuiBackend : public GuiBackend
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Default constructor.
+    SoftwareGuiBackend() = default;
+    /// @brief Default destructor.
+    virtual ~SoftwareGuiBackend() = default;
+    
+    virtual void Init() override;
+    /// @brief Shuts down the ImGui software backend.
+    virtual void Shutdown() override {}
+    
+    // Rendering
+    // ----------------------------------------
+    /// @brief Begins a new ImGui frame using the software backend.
+    virtual void BeginFrame() override {}
+    /// @brief Ends the ImGui frame (its draw data is discarded).
+    /// @param drawData The draw data of the frame.
+    virtual void EndFrame(ImDrawData* drawData) override {}
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareGuiBackend);
+};
+
+} // namespace pixc
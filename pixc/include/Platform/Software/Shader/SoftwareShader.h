@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Foundation/Renderer/Shader/Shader.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+class SoftwareTexture;
+
+/**
+ * @brief Enumeration of the shading models executed by the software rasterizer.
+ */
+enum class SoftwareShadingModel
+{
+    None = 0,       ///< No kernel available, the draw calls are skipped.
+    Unlit,          ///< Material color modulated by a texture (`Unlit`).
+    Phong,          ///< Blinn-Phong shading with the lights of the environment (`PhongColor`).
+    PhongTexture,   ///< Blinn-Phong shading with diffuse and specular maps (`PhongTexture`).
+    Depth,          ///< Depth only, without color output (`DepthOnly`).
+    LinearDepth,    ///< Visualization of a depth map (`LinearDepth`).
+};
+
+/**
+ * @brief Concrete implementation of the `Shader` class for the software rendering API.
+ *
+ * The software rasterizer does not execute GLSL: each shader selects a built-in shading kernel
+ * (written in C++) from its name. The GLSL source of the shader is still read, to define the
+ * same vertex attributes and uniforms as with OpenGL, so the materials set their uniforms as
+ * usual and the kernels read them back.
+ *
+ * Copying or moving `SoftwareShader` objects is disabled to ensure single ownership and prevent
+ * unintended shader duplication.
+ */
+class SoftwareShader : public Shader
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareShader(const std::string& name, const std::filesystem::path& filePath);
+    SoftwareShader(const std::filesystem::path& filePath);
+    /// @brief Delete the shader.
+    ~SoftwareShader() override = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Activate the shader (the kernel is selected when drawing).
+    void Bind() const override {}
+    /// @brief Deactivate the shader.
+    void Unbind() const override {}
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the shading model executed for this shader.
+    /// @return The shading model.
+    SoftwareShadingModel GetShadingModel() const { return m_ShadingModel; }
+    
+    /// @brief Get the value of a uniform.
+    /// @tparam T The type of the uniform value.
+    /// @param name The name of the uniform (e.g., "u_Material.Color").
+    /// @param fallback The value returned if the uniform is not defined or has not been set.
+    /// @return The value of the uniform.
+    template <typename T>
+    T GetUniform(const std::string& name, const T& fallback)
+    {
+        auto [group, member] = utils::SplitString(name);
+        if (!m_Uniforms.Exists(group, member))
+            return fallback;
+        
+        const auto& uniform = m_Uniforms.Get(group, member);
+        if (!uniform.Data || uniform.Type != utils::data::GetDataType<T>())
+            return fallback;
+        return *reinterpret_cast<const T*>(uniform.Data);
+    }
+    const SoftwareTexture* GetTexture(const std::string& name);
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetBool(const std::string &name, bool value) override;
+    void SetUint(const std::string &name, unsigned int value) override;
+    void SetInt(const std::string &name, int value) override;
+    void SetFloat(const std::string &name, float value) override;
+    
+    void SetVec2(const std::string& name, const glm::vec2& value) override;
+    void SetVec3(const std::string& name, const glm::vec3& value) override;
+    void SetVec4(const std::string& name, const glm::vec4& value) override;
+    
+    void SetMat2(const std::string& name, const glm::mat2& value) override;
+    void SetMat3(const std::string& name, const glm::mat3& value) override;
+    void SetMat4(const std::string& name, const glm::mat4& value) override;
+    
+    void SetTexture(const std::string &name,
+                    const std::shared_ptr<Texture>& texture,
+                    int slot,
+                    const std::shared_ptr<Sampler>& sampler = nullptr) override;
+
+private:
+    // Attributes(s) & Uniform(s)
+    // ----------------------------------------
+    void ExtractShaderResources() override;
+    void ExtractStageResources(const std::string& source, bool vertexStage);
+    // Parsing
+    // ----------------------------------------
+    void ParseShader(const std::filesystem::path& filepath);
+    
+    // Shader variables
+    // ----------------------------------------
+private:
+    ///< Shading kernel executed for the shader.
+    SoftwareShadingModel m_ShadingModel = SoftwareShadingModel::None;
+    
+    ///< Vertex and fragment sources (GLSL), only read to define the attributes and uniforms.
+    std::string m_VertexSource, m_FragmentSource;
+    ///< Textures bound to each texture unit.
+    std::unordered_map<int, std::shared_ptr<Texture>> m_TextureUnits;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareShader);
+};
+
+} // namespace pixc
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Foundation/Renderer/GraphicsContext.h"
+
+struct GLFWwindow;
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ *  @brief Manages the (headless) context of the software rendering API.
+ *
+ *  The software rasterizer renders into memory, so the window is created without a graphics
+ *  context and the rendered images are not presented (they are read from the framebuffers).
+ */
+class SoftwareContext : public GraphicsContext
+{
+public:
+    // Constructor(s)
+    // ----------------------------------------
+    SoftwareContext(GLFWwindow* windowHandle);
+    
+    // Initialization
+    // ----------------------------------------
+    void Init() override;
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetWindowHints();
+    /// @brief Define the vertical synchronization (the images are not presented).
+    /// @param enabled Enable or not the vertical synchronization.
+    void SetVerticalSync(bool enabled) override {}
+    
+    void UpdateBufferSize(const uint32_t width,
+                          const uint32_t height) override;
+    
+    // Buffers
+    // ----------------------------------------
+    /// @brief Swaps the front and back buffers (the images are not presented).
+    void SwapBuffers() override {}
+    
+    // Software context variables
+    // ----------------------------------------
+private:
+    ///< Native window (GLFW).
+    GLFWwindow* m_WindowHandle;
+};
+
+} // namespace pixc
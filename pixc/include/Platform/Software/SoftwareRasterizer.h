@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Foundation/Renderer/RendererTypes.h"
+
+#include "Platform/Software/Buffer/SoftwareFrameBuffer.h"
+#include "Platform/Software/Shader/SoftwareShader.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Represents the pipeline state used by the software rasterizer.
+ */
+struct SoftwareRasterState
+{
+    ///< Viewport (x, y, width and height, in pixels).
+    glm::ivec4 Viewport = glm::ivec4(0);
+    
+    ///< Depth test state.
+    bool DepthTesting = false;
+    DepthFunction DepthFunc = DepthFunction::Less;
+    ///< Reversed depth (near plane at 1, far plane at 0).
+    bool ReversedDepth = false;
+    
+    ///< Writing of the fragments into the color and depth targets.
+    bool ColorWriting = true;
+    bool DepthWriting = true;
+    ///< Alpha blending (source alpha, one minus source alpha).
+    bool Blending = false;
+};
+
+/**
+ * @brief Represents a vertex transformed by the software rasterizer.
+ */
+struct SoftwareVertex
+{
+    glm::vec4 Position = glm::vec4(0.0f);       ///< Position in clip space.
+    glm::vec3 WorldPosition = glm::vec3(0.0f);  ///< Position in world space.
+    glm::vec3 Normal = glm::vec3(0.0f);         ///< Normal in world space.
+    glm::vec2 TextureCoord = glm::vec2(0.0f);   ///< Texture coordinates.
+};
+
+/**
+ * @brief Represents a light read by the shading kernels (same as the `Light` GLSL structure).
+ */
+struct SoftwareLight
+{
+    glm::vec4 Vector = glm::vec4(0.0f);         ///< Position (w = 1) or direction (w = 0).
+    glm::vec3 Color = glm::vec3(0.0f);          ///< Color of the light.
+    float Ld = 0.0f;                            ///< Diffuse intensity.
+    float Ls = 0.0f;                            ///< Specular intensity.
+};
+
+/**
+ * @brief Represents the uniforms read by the shading kernels during a draw call.
+ *
+ * The uniforms are read from the shader once per draw call, so the worker threads never access
+ * the shader while rasterizing.
+ */
+struct SoftwareMaterial
+{
+    ///< Maximum number of lights (`MAX_NUMBER_LIGHTS` in the shaders).
+    static constexpr uint32_t MaxLights = 4;
+    
+    ///< Shading kernel to be executed.
+    SoftwareShadingModel Model = SoftwareShadingModel::None;
+    
+    ///< Color (unlit) or reflection coefficients (phong) of the material.
+    glm::vec4 Color = glm::vec4(1.0f);
+    glm::vec3 Ka = glm::vec3(0.0f), Kd = glm::vec3(0.0f), Ks = glm::vec3(0.0f);
+    float Shininess = 1.0f;
+    float Alpha = 1.0f;
+    ///< Texture map (unlit), diffuse map (phong) or depth map (linear depth), and specular map.
+    const SoftwareTexture* TextureMap = nullptr;
+    const SoftwareTexture* SpecularMap = nullptr;
+    
+    ///< Linearization of the depth map (linear depth).
+    bool Linearize = false;
+    float NearPlane = 0.1f, FarPlane = 100.0f;
+    
+    ///< Position of the viewer and lights of the environment.
+    glm::vec3 ViewPosition = glm::vec3(0.0f);
+    float La = 0.0f;
+    uint32_t LightCount = 0;
+    SoftwareLight Lights[MaxLights];
+    
+    ///< Opacity of the model (dithered fade).
+    float Fade = 1.0f;
+};
+
+/**
+ * @brief Rasterizes triangles into software textures with a tile-based, multithreaded pipeline.
+ *
+ * The triangles of a draw call are set up and binned into screen tiles on the calling thread.
+ * The tiles are then rasterized in parallel by worker threads (the calling thread takes part
+ * too): each tile is processed by a single thread, in submission order, so the depth test and
+ * the blending need no synchronization. The edge functions are evaluated four pixels at a time,
+ * in loops that the compiler can vectorize.
+ *
+ * @note The rasterizer must be used from the main (rendering) thread only.
+ */
+class SoftwareRasterizer
+{
+public:
+    ///< Size of the screen tiles (in pixels).
+    static constexpr uint32_t TileSize = 64;
+    
+    // Initialization
+    // ----------------------------------------
+    static void Init(uint32_t workerCount = 0);
+    static void Shutdown();
+    
+    // Render
+    // ----------------------------------------
+    static void DrawTriangles(const SoftwareRenderTarget& target, const SoftwareRasterState& state,
+                              const SoftwareMaterial& material,
+                              const std::vector<SoftwareVertex>& vertices,
+                              const std::vector<uint32_t>& indices);
+    
+    // Statistics
+    // ----------------------------------------
+    /**
+     * Represents the information related to the statistics of the software rasterizer.
+     */
+    struct Statistics
+    {
+        ///< Number of draw calls rasterized.
+        uint32_t DrawCount = 0;
+        ///< Number of triangles rasterized (after clipping).
+        uint32_t TriangleCount = 0;
+        ///< Number of tiles rasterized (a tile is counted once per draw call).
+        uint32_t TileCount = 0;
+        ///< Number of threads rasterizing the tiles (including the main thread).
+        uint32_t ThreadCount = 0;
+        ///< Time spent rasterizing the draw calls (milliseconds).
+        float RasterTime = 0.0f;
+    };
+    
+    static Statistics GetStats();
+    static void ResetStats();
+};
+
+} // namespace pixc
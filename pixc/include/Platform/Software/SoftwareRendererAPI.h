@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Foundation/Renderer/RendererAPI.h"
+
+#include "Platform/Software/SoftwareRasterizer.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * Concrete implementation of the RendererAPI interface for the software rasterizer.
+ *
+ * The `SoftwareRendererAPI` class keeps the pipeline state set through the renderer commands,
+ * transforms the vertices of the drawables on the CPU and hands the triangles to the
+ * `SoftwareRasterizer`.
+ */
+class SoftwareRendererAPI : public RendererAPI
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Create a software renderer API.
+    SoftwareRendererAPI() = default;
+    /// @brief Delete the software renderer API (and stop the rasterizer threads).
+    virtual ~SoftwareRendererAPI() { SoftwareRasterizer::Shutdown(); }
+    
+    // Initialization
+    // ----------------------------------------
+    void Init() override;
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetClearColor(const glm::vec4& color) override;
+    
+    void SetViewport(const uint32_t x, const uint32_t y,
+                     const uint32_t width, const uint32_t height) override;
+    
+    void EnableDepthTesting(const bool enabled) override;
+    void SetDepthFunction(const DepthFunction function) override;
+    
+    /// @brief Set the face culling mode (the rasterizer draws both faces of the triangles).
+    /// @param mode The face culling mode to be set.
+    void SetFaceCulling(const FaceCulling mode) override {}
+    /// @brief Enable or disable seamless cubemap sampling (the faces are sampled separately).
+    /// @param enabled Set to `true` to enable seamless cubemap sampling.
+    void SetCubeMapSeamless(const bool enabled) override {}
+    void EnableBlending(const bool enabled) override;
+    
+    void EnableColorWriting(const bool enabled) override;
+    void EnableDepthWriting(const bool enabled) override;
+    
+    // Depth
+    // ----------------------------------------
+    /// @brief Check if the reversed depth is supported (the clip space depth is always in [0, 1]).
+    /// @return `true` if the reversed depth can be used.
+    bool IsReversedDepthSupported() const override { return true; }
+    
+    // Render
+    // ----------------------------------------
+    void Clear(const RenderTargetMask targets) override;
+    
+    void Draw(const std::shared_ptr<Drawable>& drawable,
+              const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                     const uint32_t indexCount,
+                     const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+    void DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                    const std::vector<IndexRange>& ranges,
+                    const PrimitiveType &primitive = PrimitiveType::Triangle) override;
+
+protected:
+    // Depth
+    // ----------------------------------------
+    /// @brief Clip the triangles against the near plane of the reversed depth, or of the standard one.
+    /// @param enabled Pass true to reverse the depth, false to restore the standard depth.
+    void ApplyReversedDepth(const bool enabled) override { m_State.ReversedDepth = enabled; }
+
+private:
+    // Render
+    // ----------------------------------------
+    SoftwareRenderTarget GetRenderTarget() const;
+    void DrawIndices(const std::shared_ptr<Drawable>& drawable,
+                     const std::vector<uint32_t>& indices,
+                     const PrimitiveType &primitive);
+    
+    // Software API variables
+    // ----------------------------------------
+private:
+    ///< Pipeline state.
+    SoftwareRasterState m_State;
+    ///< Color used to clear the color targets.
+    glm::vec4 m_ClearColor = glm::vec4(0.0f);
+    
+    ///< Vertices and indices of the draw call (scratch data).
+    std::vector<SoftwareVertex> m_Vertices;
+    std::vector<uint32_t> m_Indices, m_Triangles;
+};
+
+} // namespace pixc
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Sampler.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of `Sampler` for the software rendering API.
+ *
+ * The `SoftwareSampler` only holds the sampling state: the shading kernels of the software
+ * rasterizer always read the textures with their own sampling state (see `SoftwareShader`), so
+ * there is nothing to bind.
+ *
+ * Copying or moving `SoftwareSampler` objects is disabled to ensure single ownership and prevent
+ * unintended resource duplication.
+ */
+class SoftwareSampler : public Sampler
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Create a sampler with a specific sampling state.
+    /// @param spec The sampler specifications.
+    SoftwareSampler(const SamplerSpecification& spec) : Sampler(spec) {}
+    /// @brief Delete the sampler.
+    ~SoftwareSampler() override = default;
+    
+    // Usage
+    // ----------------------------------------
+    /// @brief Bind the sampler to a specific texture unit (nothing to bind).
+    /// @param slot The texture unit slot.
+    void BindToTextureUnit(uint32_t slot) const override {}
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareSampler);
+};
+
+} // namespace pixc
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Texture.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Stores the texels of a texture in memory for the software rasterizer.
+ *
+ * The `SoftwareTexture` class is the counterpart of `OpenGLTexture` for the software rendering
+ * API. The texels of every format are converted into floating point RGBA values when uploaded,
+ * so the shading kernels sample all the textures the same way; they are converted back into the
+ * texture format when read. The depth formats store the depth in the red channel.
+ *
+ * A texture is made of layers of the same size: the faces of a cube texture or the slices of a 3D
+ * texture (a single layer for the other types).
+ *
+ * @note Only the base level is stored (the mipmaps are not generated), and the multisampled
+ * textures keep a single sample per pixel (the rasterizer does not multisample).
+ */
+class SoftwareTexture
+{
+public:
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the width of the texture layers.
+    /// @return The width (in texels).
+    uint32_t GetWidth() const { return m_Width; }
+    /// @brief Get the height of the texture layers.
+    /// @return The height (in texels).
+    uint32_t GetHeight() const { return m_Height; }
+    /// @brief Get the number of layers of the texture (faces or slices).
+    /// @return The number of layers.
+    uint32_t GetLayerCount() const { return m_LayerCount; }
+    /// @brief Get the texels of a layer of the texture (row by row, from the bottom row).
+    /// @param layer The layer index.
+    /// @return The first texel of the layer.
+    glm::vec4* GetTexels(uint32_t layer = 0)
+    {
+        return m_Texels.data() + (size_t)layer * m_Width * m_Height;
+    }
+    /// @brief Get the texels of a layer of the texture (row by row, from the bottom row).
+    /// @param layer The layer index.
+    /// @return The first texel of the layer.
+    const glm::vec4* GetTexels(uint32_t layer = 0) const
+    {
+        return m_Texels.data() + (size_t)layer * m_Width * m_Height;
+    }
+    
+    // Sampling
+    // ----------------------------------------
+    glm::vec4 Fetch(int32_t x, int32_t y, uint32_t layer = 0) const;
+    glm::vec4 Sample(const glm::vec2& coordinates, uint32_t layer = 0) const;
+    glm::vec4 SampleCube(const glm::vec3& direction) const;
+    
+    // Read/Write
+    // ----------------------------------------
+    void Fill(const glm::vec4& value, uint32_t layer = 0);
+    void Copy(const SoftwareTexture& src, uint32_t srcLayer = 0, uint32_t dstLayer = 0);
+    std::vector<char> Read(uint32_t layer = 0) const;
+    
+    // Disable the creation of this resource
+    // ----------------------------------------
+protected:
+    /// @brief Create a software texture (without texels).
+    SoftwareTexture() = default;
+    
+    // Texture Creator
+    // ----------------------------------------
+    void SWCreate(const TextureSpecification& spec, uint32_t layerCount);
+    void SWUpload(const void *data, uint32_t layer);
+    // Texture Destructor
+    // ----------------------------------------
+    void SWRelease();
+    
+    // Texture variables
+    // ----------------------------------------
+protected:
+    ///< Size of the layers (in texels) and number of layers.
+    uint32_t m_Width = 0, m_Height = 0;
+    uint32_t m_LayerCount = 0;
+    ///< Format of the texture and sampling state.
+    TextureFormat m_Format = TextureFormat::None;
+    TextureFilter m_Filter = TextureFilter::Nearest;
+    TextureWrap m_Wrap = TextureWrap::ClampToEdge;
+    
+    ///< Texels of all the layers.
+    std::vector<glm::vec4> m_Texels;
+};
+
+// Destructor
+// ----------------------------------------
+#define DEFINE_SOFTWARE_TEXTURE_DESTRUCTOR(TextureType)\
+    /** @brief Destructor to release the texels of the texture. */\
+    ~Software##TextureType() override { ReleaseTexture(); }
+
+// Usage
+// ----------------------------------------
+#define DEFINE_SOFTWARE_TEXTURE_BINDING_METHODS()\
+    /** @brief Bind the texture (the kernels read the textures set in the shader). */\
+    void Bind() const override {}\
+    /** @brief Binds the texture to a specific texture unit (see `SoftwareShader`). */\
+    /** @param slot The index of the texture unit to bind to. */\
+    void BindToTextureUnit(uint32_t slot) const override {}\
+    /** @brief Unbind the texture. */\
+    void Unbind() const override {}
+
+// Creation & Release
+// ----------------------------------------
+#define DEFINE_SOFTWARE_TEXTURE_RESOURCE_METHODS()\
+    /** @brief Releases the texels of the texture. */\
+    void ReleaseTexture() override\
+    {\
+        SWRelease();\
+    }\
+    /** @brief Creates the texels of the texture. */\
+    void CreateTexture(const void* data) override;
+
+} // namespace pixc
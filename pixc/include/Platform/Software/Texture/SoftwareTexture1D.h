@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Texture1D.h"
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of a one-dimensional texture for the software rasterizer.
+ *
+ * The `SoftwareTexture1D` class specializes the `Texture1D` class to store its texels in memory
+ * (see `SoftwareTexture`), where the shading kernels of the software rendering API read them.
+ *
+ * @note Copying and moving `SoftwareTexture1D` objects is disabled to prevent
+ * unintended resource ownership issues.
+ */
+class SoftwareTexture1D : public Texture1D, public SoftwareTexture
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareTexture1D();
+    SoftwareTexture1D(const TextureSpecification& spec);
+    
+    SoftwareTexture1D(const void *data);
+    SoftwareTexture1D(const void *data, const TextureSpecification& spec);
+    
+    DEFINE_SOFTWARE_TEXTURE_DESTRUCTOR(Texture1D)
+    
+    // Usage
+    // ----------------------------------------
+    DEFINE_SOFTWARE_TEXTURE_BINDING_METHODS()
+
+protected:
+    DEFINE_SOFTWARE_TEXTURE_RESOURCE_METHODS()
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareTexture1D);
+};
+
+} // namespace pixc
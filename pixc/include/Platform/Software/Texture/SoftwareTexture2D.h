@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Texture2D.h"
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of a two-dimensional texture for the software rasterizer.
+ *
+ * The `SoftwareTexture2D` class specializes the `Texture2D` class to store its texels in memory
+ * (see `SoftwareTexture`), where the shading kernels of the software rendering API read them.
+ *
+ * The multisampled textures keep a single sample per pixel.
+ *
+ * @note Copying and moving `SoftwareTexture2D` objects is disabled to prevent
+ * unintended resource ownership issues.
+ */
+class SoftwareTexture2D : public Texture2D, public SoftwareTexture
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareTexture2D(uint8_t samples);
+    SoftwareTexture2D(const TextureSpecification& spec, uint8_t samples);
+    
+    SoftwareTexture2D(const void *data, uint8_t samples);
+    SoftwareTexture2D(const void *data, const TextureSpecification& spec,
+                      uint8_t samples);
+    
+    SoftwareTexture2D(const std::filesystem::path& filePath, bool flip);
+    SoftwareTexture2D(const std::filesystem::path& filePath,
+                      const TextureSpecification& spec, bool flip);
+    
+    DEFINE_SOFTWARE_TEXTURE_DESTRUCTOR(Texture2D)
+    
+    // Usage
+    // ----------------------------------------
+    DEFINE_SOFTWARE_TEXTURE_BINDING_METHODS()
+
+private:
+    DEFINE_SOFTWARE_TEXTURE_RESOURCE_METHODS()
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareTexture2D);
+};
+
+} // namespace pixc
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/Texture3D.h"
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of a three-dimensional texture for the software rasterizer.
+ *
+ * The `SoftwareTexture3D` class specializes the `Texture3D` class to store its texels in memory
+ * (see `SoftwareTexture`), where the shading kernels of the software rendering API read them.
+ *
+ * Each slice of the texture is stored as a layer.
+ *
+ * @note Copying and moving `SoftwareTexture3D` objects is disabled to prevent
+ * unintended resource ownership issues.
+ */
+class SoftwareTexture3D : public Texture3D, public SoftwareTexture
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareTexture3D();
+    SoftwareTexture3D(const TextureSpecification& spec);
+    
+    SoftwareTexture3D(const void *data);
+    SoftwareTexture3D(const void *data, const TextureSpecification& spec);
+    
+    DEFINE_SOFTWARE_TEXTURE_DESTRUCTOR(Texture3D)
+    
+    // Usage
+    // ----------------------------------------
+    DEFINE_SOFTWARE_TEXTURE_BINDING_METHODS()
+
+protected:
+    DEFINE_SOFTWARE_TEXTURE_RESOURCE_METHODS()
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareTexture3D);
+};
+
+} // namespace pixc
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Foundation/Renderer/Texture/TextureCube.h"
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Concrete implementation of a cubemap texture for the software rasterizer.
+ *
+ * The `SoftwareTextureCube` class specializes the `TextureCube` class to store its texels in memory
+ * (see `SoftwareTexture`), where the shading kernels of the software rendering API read them.
+ *
+ * Each face of the cube is stored as a layer (+X, -X, +Y, -Y, +Z, -Z).
+ *
+ * @note Copying and moving `SoftwareTextureCube` objects is disabled to prevent
+ * unintended resource ownership issues.
+ */
+class SoftwareTextureCube : public TextureCube, public SoftwareTexture
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    SoftwareTextureCube();
+    SoftwareTextureCube(const TextureSpecification& spec);
+    
+    SoftwareTextureCube(const void *data);
+    SoftwareTextureCube(const std::vector<const void *>& data);
+    SoftwareTextureCube(const void *data, const TextureSpecification& spec);
+    SoftwareTextureCube(const std::vector<const void *>& data,
+                        const TextureSpecification& spec);
+    
+    SoftwareTextureCube(const std::filesystem::path& directory,
+                        const std::vector<std::string>& files, bool flip);
+    SoftwareTextureCube(const std::filesystem::path& directory,
+                        const std::vector<std::string>& files,
+                        const TextureSpecification& spec,
+                        bool flip);
+    
+    DEFINE_SOFTWARE_TEXTURE_DESTRUCTOR(TextureCube)
+    
+    // Usage
+    // ----------------------------------------
+    DEFINE_SOFTWARE_TEXTURE_BINDING_METHODS()
+
+protected:
+    DEFINE_SOFTWARE_TEXTURE_RESOURCE_METHODS()
+    void CreateTexture(const std::vector<const void *> &data) override;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DISABLE_COPY_AND_MOVE(SoftwareTextureCube);
+};
+
+} // namespace pixc
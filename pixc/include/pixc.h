@@ -48,11 +48,23 @@
 // --------------------------------------------
 
 #include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/Renderer2D.h"
+#include "Foundation/Renderer/Text/Font.h"
+#include "Foundation/Renderer/Text/TextRenderer.h"
 #include "Foundation/Renderer/RendererCommand.h"
 
 #include "Foundation/Renderer/Buffer/VertexBuffer.h"
 #include "Foundation/Renderer/Buffer/IndexBuffer.h"
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+#include "Foundation/Renderer/Buffer/StorageBuffer.h"
 #include "Foundation/Renderer/Buffer/FrameBuffer.h"
+#include "Foundation/Renderer/Buffer/FrameCapture.h"
+
+#include "Foundation/Renderer/Query/OcclusionQuery.h"
+#include "Foundation/Renderer/Query/Fence.h"
+#include "Foundation/Renderer/FrameSync.h"
+#include "Foundation/Renderer/Culling/ClusterCulling.h"
+#include "Foundation/Renderer/PostProcess/AutoExposure.h"
 
 #include "Foundation/Renderer/Shader/Shader.h"
 #include "Foundation/Renderer/Texture/Texture.h"
@@ -60,6 +72,7 @@
 #include "Foundation/Renderer/Texture/Texture2D.h"
 #include "Foundation/Renderer/Texture/Texture3D.h"
 #include "Foundation/Renderer/Texture/TextureCube.h"
+#include "Foundation/Renderer/Texture/Sampler.h"
 
 #include "Foundation/Renderer/Light/Shadow.h"
 #include "Foundation/Renderer/Light/LightProperty.h"
@@ -72,11 +85,19 @@
 #include "Foundation/Renderer/Light/Environment/IBLEnvironmentLight.h"
 
 #include "Foundation/Renderer/Material/Material.h"
+#include "Foundation/Renderer/Material/MaterialInstance.h"
 #include "Foundation/Renderer/Material/TextureMaterial.h"
 #include "Foundation/Renderer/Material/DepthMaterial.h"
 #include "Foundation/Renderer/Material/UnlitMaterial.h"
 #include "Foundation/Renderer/Material/LitMaterial.h"
 #include "Foundation/Renderer/Material/PhongMaterial.h"
+#include "Foundation/Renderer/Material/ToneMapMaterial.h"
+
+#include "Foundation/Renderer/Animation/Skeleton.h"
+#include "Foundation/Renderer/Animation/AnimationClip.h"
+#include "Foundation/Renderer/Animation/Pose.h"
+#include "Foundation/Renderer/Animation/Animator.h"
+#include "Foundation/Renderer/Animation/AnimationSystem.h"
 
 #include "Foundation/Renderer/Drawable/Drawable.h"
 #include "Foundation/Renderer/Drawable/Mesh/Mesh.h"
@@ -95,3 +116,7 @@
 #include "Foundation/Scene/Viewport.h"
 #include "Foundation/Scene/RenderPass.h"
 #include "Foundation/Scene/Scene.h"
+#include "Foundation/Scene/FramePacket.h"
+#include "Foundation/Scene/SceneSerializer.h"
+#include "Foundation/Core/AssetManager.h"
+#include "Foundation/Core/RenderThread.h"
@@ -0,0 +1,62 @@
+#shader vertex
+#version 330 core
+
+/**
+ * Represents the mapping of the screen to the view directions.
+ */
+struct Background
+{
+    mat4 Rays;                              ///< Screen position (x, y, 1) to direction in world space.
+};
+
+// Uniform buffer blocks
+uniform Background u_Background;            ///< Background properties
+
+// Outputs to fragment shader
+out vec3 v_Direction;                       ///< View direction in world space
+
+// Entry point of the vertex shader (no vertex data: a single triangle covering the screen is
+// generated from the vertex index, drawn with three vertices)
+void main()
+{
+    // Vertices (-1, -1), (3, -1) and (-1, 3) in normalized device coordinates
+    vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0f - 1.0f;
+    
+    // Reconstruct the view direction (linear over the screen)
+    v_Direction = mat3(u_Background.Rays) * vec3(position, 1.0f);
+    
+    // Place the vertex on the far plane, so that the background only passes where nothing
+    // has been drawn
+#ifdef PIXC_REVERSED_DEPTH
+    gl_Position = vec4(position, 0.0f, 1.0f);
+#else
+    gl_Position = vec4(position, 1.0f, 1.0f);
+#endif
+}
+
+#shader fragment
+#version 330 core
+
+/**
+ * Represents the material properties of an object.
+ */
+struct Material
+{
+    samplerCube TextureMap;                 ///< Texture map applied to the material.
+};
+
+// Specify the output color of the fragment shader
+layout (location = 0) out vec4 color;
+
+// Uniform buffer blocks
+uniform Material u_Material;                ///< Material properties
+
+// Input variables from the vertex shader
+in vec3 v_Direction;                        ///< View direction in world space
+
+// Entry point of the fragment shader
+void main()
+{
+    // Sample the environment in the view direction
+    color = texture(u_Material.TextureMap, normalize(v_Direction));
+}
@@ -25,7 +25,12 @@ void main()
     mat4 view = mat4(mat3(u_Transform.View));
     // Calculate the final position of the vertex in clip space
     vec4 clipPosition = u_Transform.Projection * view * worldPosition;
+    // Place the vertex on the far plane
+#ifdef PIXC_REVERSED_DEPTH
+    gl_Position = vec4(clipPosition.xy, 0.0, clipPosition.w);
+#else
     gl_Position = clipPosition.xyww;
+#endif
 }
 
 #shader fragment
@@ -0,0 +1,153 @@
+#shader compute
+#version 430 core
+
+// Each invocation projects a 2x2 block of texels, a work group covers a 16x16 tile of a face
+layout (local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+/**
+ * Represents the parameters of the projection.
+ */
+struct Projection
+{
+    samplerCube EnvironmentMap;                 ///< Environment cube map to be projected.
+    int Size;                                   ///< Resolution of the faces (at the sampled level).
+    float Lod;                                  ///< Mip level of the environment map sampled.
+};
+
+// Uniform buffer blocks
+uniform Projection u_Projection;                ///< Projection parameters.
+
+// Partial sums of the work groups: 27 SH values (9 RGB coefficients), solid angle,
+// weighted luminance and maximum luminance (padded to 32 floats per group)
+const uint PARTIAL_SIZE = 32u;
+layout (std430, binding = 1) writeonly buffer PartialBlock
+{
+    float Partials[];
+};
+
+// Partial sums of the invocations of the work group
+const uint GROUP_SIZE = 64u;
+shared vec3 s_Coefficients[9][GROUP_SIZE];
+shared vec3 s_Luminance[GROUP_SIZE];            ///< Solid angle, weighted luminance, maximum.
+
+// -----------------------------------------
+// Cube map
+// -----------------------------------------
+/**
+ * Computes the direction of a texel of a cube map face.
+ *
+ * @param face The index of the face (+X, -X, +Y, -Y, +Z, -Z).
+ * @param uv The coordinates of the texel in the face (in the range [-1, 1]).
+ *
+ * @return The direction (not normalized).
+ */
+vec3 cubeDirection(int face, vec2 uv)
+{
+    if (face == 0) return vec3( 1.0f, -uv.y, -uv.x);
+    if (face == 1) return vec3(-1.0f, -uv.y,  uv.x);
+    if (face == 2) return vec3( uv.x,  1.0f,  uv.y);
+    if (face == 3) return vec3( uv.x, -1.0f, -uv.y);
+    if (face == 4) return vec3( uv.x, -uv.y,  1.0f);
+    return vec3(-uv.x, -uv.y, -1.0f);
+}
+
+// -----------------------------------------
+// Spherical Harmonics
+// -----------------------------------------
+/**
+ * Evaluates the spherical harmonics basis (up to l=2) in a direction.
+ *
+ * @param n The normalized direction.
+ * @param Y The values of the basis functions (L00, L1-1, L10, L11, L2-2, L2-1, L20, L21, L22).
+ *
+ * @note Values taken from paper "An Efficient Representation for Irradiance Environment Maps".
+ */
+void evaluateSH(vec3 n, out float Y[9])
+{
+    Y[0] = 0.282095f;
+    Y[1] = 0.488603f * n.y;
+    Y[2] = 0.488603f * n.z;
+    Y[3] = 0.488603f * n.x;
+    Y[4] = 1.092548f * n.x * n.y;
+    Y[5] = 1.092548f * n.y * n.z;
+    Y[6] = 0.315392f * (3.0f * n.z * n.z - 1.0f);
+    Y[7] = 1.092548f * n.x * n.z;
+    Y[8] = 0.546274f * (n.x * n.x - n.y * n.y);
+}
+
+// -----------------------------------------
+
+// Entry point of the compute shader
+void main()
+{
+    uint index = gl_LocalInvocationIndex;
+    int face = int(gl_WorkGroupID.z);
+    ivec2 base = ivec2(gl_WorkGroupID.xy) * 16 + ivec2(gl_LocalInvocationID.xy) * 2;
+    
+    // Project the texels of the block
+    vec3 Llm[9];
+    for (int i = 0; i < 9; ++i)
+        Llm[i] = vec3(0.0f);
+    vec3 luminance = vec3(0.0f);
+    
+    for (int j = 0; j < 4; ++j)
+    {
+        ivec2 texel = base + ivec2(j & 1, j >> 1);
+        if (texel.x >= u_Projection.Size || texel.y >= u_Projection.Size)
+            continue;
+        
+        // Direction and solid angle of the texel
+        vec2 uv = (vec2(texel) + 0.5f) / float(u_Projection.Size) * 2.0f - 1.0f;
+        float r2 = 1.0f + dot(uv, uv);
+        float size = float(u_Projection.Size);
+        float deltaW = 4.0f / (r2 * sqrt(r2) * size * size);
+        vec3 wi = normalize(cubeDirection(face, uv));
+        
+        vec3 Li = textureLod(u_Projection.EnvironmentMap, wi, u_Projection.Lod).rgb;
+        
+        float Y[9];
+        evaluateSH(wi, Y);
+        for (int i = 0; i < 9; ++i)
+            Llm[i] += Y[i] * Li * deltaW;
+        
+        float L = dot(Li, vec3(0.2126f, 0.7152f, 0.0722f));
+        luminance += vec3(deltaW, L * deltaW, 0.0f);
+        luminance.z = max(luminance.z, L);
+    }
+    
+    for (int i = 0; i < 9; ++i)
+        s_Coefficients[i][index] = Llm[i];
+    s_Luminance[index] = luminance;
+    barrier();
+    
+    // Reduce the partial sums of the work group (tree reduction in shared memory)
+    for (uint stride = GROUP_SIZE / 2u; stride > 0u; stride >>= 1u)
+    {
+        if (index < stride)
+        {
+            for (int i = 0; i < 9; ++i)
+                s_Coefficients[i][index] += s_Coefficients[i][index + stride];
+            vec3 a = s_Luminance[index];
+            vec3 b = s_Luminance[index + stride];
+            s_Luminance[index] = vec3(a.xy + b.xy, max(a.z, b.z));
+        }
+        barrier();
+    }
+    
+    // Write the partial sums of the work group
+    if (index == 0u)
+    {
+        uint group = gl_WorkGroupID.x + gl_NumWorkGroups.x *
+                     (gl_WorkGroupID.y + gl_NumWorkGroups.y * gl_WorkGroupID.z);
+        uint offset = group * PARTIAL_SIZE;
+        for (int i = 0; i < 9; ++i)
+        {
+            Partials[offset + 3u * uint(i) + 0u] = s_Coefficients[i][0].r;
+            Partials[offset + 3u * uint(i) + 1u] = s_Coefficients[i][0].g;
+            Partials[offset + 3u * uint(i) + 2u] = s_Coefficients[i][0].b;
+        }
+        Partials[offset + 27u] = s_Luminance[0].x;
+        Partials[offset + 28u] = s_Luminance[0].y;
+        Partials[offset + 29u] = s_Luminance[0].z;
+    }
+}
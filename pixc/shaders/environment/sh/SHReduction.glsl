@@ -0,0 +1,84 @@
+#shader compute
+#version 430 core
+
+// A single work group reduces all the partial sums of the projection
+layout (local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+/**
+ * Represents the parameters of the reduction.
+ */
+struct Reduction
+{
+    int Count;                                  ///< Number of partial sums to be reduced.
+};
+
+// Uniform buffer blocks
+uniform Reduction u_Reduction;                  ///< Reduction parameters.
+
+// Partial sums of the projection: 27 SH values (9 RGB coefficients), solid angle,
+// weighted luminance and maximum luminance (padded to 32 floats per group)
+const uint PARTIAL_SIZE = 32u;
+layout (std430, binding = 0) readonly buffer PartialBlock
+{
+    float Partials[];
+};
+// Result: 27 SH values, average luminance and maximum luminance
+layout (std430, binding = 1) writeonly buffer ResultBlock
+{
+    float Result[];
+};
+
+// Values reduced by the invocations
+const uint GROUP_SIZE = 64u;
+const uint VALUE_COUNT = 30u;
+shared float s_Values[VALUE_COUNT][GROUP_SIZE];
+
+// Define constant variables
+const float PI = 3.14159265359f;
+
+// Entry point of the compute shader
+void main()
+{
+    uint index = gl_LocalInvocationIndex;
+    
+    // Accumulate a strided subset of the partial sums
+    float values[VALUE_COUNT];
+    for (uint v = 0u; v < VALUE_COUNT; ++v)
+        values[v] = 0.0f;
+    
+    for (uint p = index; p < uint(u_Reduction.Count); p += GROUP_SIZE)
+    {
+        uint offset = p * PARTIAL_SIZE;
+        for (uint v = 0u; v < VALUE_COUNT - 1u; ++v)
+            values[v] += Partials[offset + v];
+        values[VALUE_COUNT - 1u] = max(values[VALUE_COUNT - 1u], Partials[offset + VALUE_COUNT - 1u]);
+    }
+    
+    for (uint v = 0u; v < VALUE_COUNT; ++v)
+        s_Values[v][index] = values[v];
+    barrier();
+    
+    // Tree reduction in shared memory
+    for (uint stride = GROUP_SIZE / 2u; stride > 0u; stride >>= 1u)
+    {
+        if (index < stride)
+        {
+            for (uint v = 0u; v < VALUE_COUNT - 1u; ++v)
+                s_Values[v][index] += s_Values[v][index + stride];
+            s_Values[VALUE_COUNT - 1u][index] = max(s_Values[VALUE_COUNT - 1u][index],
+                                                    s_Values[VALUE_COUNT - 1u][index + stride]);
+        }
+        barrier();
+    }
+    
+    // Write the result (the coefficients are normalized by the total solid angle)
+    if (index == 0u)
+    {
+        float solidAngle = max(s_Values[27][0], 1e-6f);
+        float normalization = 4.0f * PI / solidAngle;
+        for (uint v = 0u; v < 27u; ++v)
+            Result[v] = s_Values[v][0] * normalization;
+        Result[27] = s_Values[28][0] / solidAngle;
+        Result[28] = s_Values[29][0];
+    }
+}
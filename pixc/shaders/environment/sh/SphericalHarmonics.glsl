@@ -1,11 +1,8 @@
 #shader vertex
 #version 330 core
 
-// Include transformation matrices
-#include "pixc/shaders/shared/structure/matrix/SimpleMatrix.glsl"
-
-// Include vertex shader
-#include "pixc/shaders/shared/chunk/vertex/Pos.vs.glsl"
+// Include vertex shader (fullscreen triangle)
+#include "pixc/shaders/shared/chunk/vertex/Fullscreen.vs.glsl"
 
 #shader fragment
 #version 330 core
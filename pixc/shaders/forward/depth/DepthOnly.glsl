@@ -10,6 +10,16 @@
 #shader fragment
 #version 330 core
 
+// Include the fade of the model
+#include "pixc/shaders/shared/structure/view/Fade.glsl"
+#include "pixc/shaders/shared/utils/DitherFade.glsl"
+
+///< Fade of the model (distance culling).
+uniform Fade u_Fade;
+
 // Entry point of the fragment shader
 void main()
-{}
+{
+    // Discard the fragments of a model fading out
+    ditherFade(u_Fade.Factor);
+}
@@ -0,0 +1,18 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "pixc/shaders/shared/structure/matrix/SimpleMatrix.glsl"
+
+// Include bone matrices
+#include "pixc/shaders/shared/structure/animation/BoneBlock.glsl"
+
+// Include vertex shader
+#include "pixc/shaders/shared/chunk/vertex/BaseSkin.vs.glsl"
+
+#shader fragment
+#version 330 core
+
+// Entry point of the fragment shader
+void main()
+{}
@@ -9,6 +9,11 @@
  */
 float linearizeDepth(float depth, float near, float far)
 {
+#ifdef PIXC_REVERSED_DEPTH
+    // Restore the standard depth (the near plane is at 1 and the far plane at 0)
+    depth = 1.0f - depth;
+#endif
+    
     // Calculate and return the linearized depth value
     return (2.0f * near * far) / (far + near - depth * (far - near));
 
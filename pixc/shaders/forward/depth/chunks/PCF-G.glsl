@@ -38,8 +38,13 @@ float PCF(sampler2D shadowMap, vec3 projectionCoord, int kernelSize, float sigma
            // Apply Gaussian weight to the sample based on the squared distance
            float weight = exp(-0.5 * (squaredDistance / (sigma * sigma)));
            
-           // Update the shadow value using the sampled depth and weight
+           // Update the shadow value using the sampled depth and weight (the nearest depth is
+           // the highest if the depth is reversed)
+#ifdef PIXC_REVERSED_DEPTH
+           shadow += currentDepth < pcfDepth ? weight : 0.0f;
+#else
            shadow += currentDepth > pcfDepth ? weight : 0.0f;
+#endif
        }
     }
     
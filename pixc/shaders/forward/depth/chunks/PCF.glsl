@@ -32,8 +32,13 @@ float PCF(sampler2D shadowMap, vec3 projectionCoord, int kernelSize, float opaci
            // Sample the shadow map at the offset position
            float pcfDepth = texture(shadowMap, projectionCoord.xy + sampleOffset).r;
            
-           // Update the shadow value using the sampled depth
+           // Update the shadow value using the sampled depth (the nearest depth is the highest if the
+           // depth is reversed)
+#ifdef PIXC_REVERSED_DEPTH
+           shadow += currentDepth < pcfDepth ? opacity : 0.0f;
+#else
            shadow += currentDepth > pcfDepth ? opacity : 0.0f;
+#endif
        }
     }
     
@@ -15,8 +15,12 @@
  */
 float calculateShadow(sampler2D shadowMap, vec4 position, float bias, int kernelSize, float weight)
 {
-    // Apply the bias value to account for depth bias
+    // Apply the bias value to account for depth bias (towards the light)
+#ifdef PIXC_REVERSED_DEPTH
+    vec3 projectionCoord = position.xyz + vec3(0.0f, 0.0f, bias);
+#else
     vec3 projectionCoord = position.xyz - vec3(0.0f, 0.0f, bias);
+#endif
 
     // Perform perspective divide to transform to normalized device coordinates
     projectionCoord /= position.w;
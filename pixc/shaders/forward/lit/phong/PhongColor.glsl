@@ -13,6 +13,7 @@
 // Include material, view and light properties
 #include "pixc/shaders/shared/structure/material/PhongColorMaterial.glsl"
 #include "pixc/shaders/shared/structure/view/SimpleView.glsl"
+#include "pixc/shaders/shared/structure/view/Fade.glsl"
 #include "pixc/shaders/shared/structure/light/SimpleLight.glsl"
 #include "pixc/shaders/shared/structure/environment/Environment.glsl"
 
@@ -22,6 +23,7 @@
 // Include additional functions
 #include "pixc/shaders/shared/utils/Saturate.glsl"
 #include "pixc/shaders/shared/utils/Attenuation.glsl"
+#include "pixc/shaders/shared/utils/DitherFade.glsl"
 
 #include "pixc/shaders/forward/lit/phong/chunks/PhongSpecular.glsl"
 #include "pixc/shaders/forward/lit/phong/chunks/Phong.glsl"
@@ -30,9 +32,15 @@
 const float PI = 3.14159265359f;
 const float INV_PI = 1.0f / PI;
 
+///< Fade of the model (distance culling).
+uniform Fade u_Fade;
+
 // Entry point of the fragment shader
 void main()
 {
+    // Discard the fragments of a model fading out
+    ditherFade(u_Fade.Factor);
+    
     // Define the initial reflectance
     vec3 reflectance = vec3(0.0f);
     // Shade based on each light source in the scene
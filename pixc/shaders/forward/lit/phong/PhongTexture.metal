@@ -28,15 +28,15 @@ fragment float4 fragment_main(const VertexOut in [[ stage_in ]],
                               constant Material &u_Material [[ buffer(BufferIndex::MaterialBuffer) ]],
                               constant View &u_View [[ buffer(BufferIndex::ViewBuffer) ]],
                               constant Environment &u_Environment [[ buffer(BufferIndex::EnvironmentBuffer) ]],
-                              texture2d<float> u_Material_DiffuseMap [[ texture(TextureIndex::DiffuseMap) ]],
-                              sampler s_Material_DiffuseMap [[ sampler(TextureIndex::DiffuseMap) ]],
-                              texture2d<float> u_Material_SpecularMap [[ texture(TextureIndex::SpecularMap) ]],
-                              sampler s_Material_SpecularMap [[ sampler(TextureIndex::SpecularMap) ]])
+                              texture2d<float> u_MaterialMaps_DiffuseMap [[ texture(TextureIndex::DiffuseMap) ]],
+                              sampler s_MaterialMaps_DiffuseMap [[ sampler(TextureIndex::DiffuseMap) ]],
+                              texture2d<float> u_MaterialMaps_SpecularMap [[ texture(TextureIndex::SpecularMap) ]],
+                              sampler s_MaterialMaps_SpecularMap [[ sampler(TextureIndex::SpecularMap) ]])
 {
     // Get the diffuse color (kd) from the DiffuseMap texture
-    float3 kd = u_Material_DiffuseMap.sample(s_Material_DiffuseMap, in.v_TextureCoord).rgb;
+    float3 kd = u_MaterialMaps_DiffuseMap.sample(s_MaterialMaps_DiffuseMap, in.v_TextureCoord).rgb;
     // Get the specular color (ks) from the SpecularMap texture
-    float3 ks = u_Material_SpecularMap.sample(s_Material_SpecularMap, in.v_TextureCoord).rgb;
+    float3 ks = u_MaterialMaps_SpecularMap.sample(s_MaterialMaps_SpecularMap, in.v_TextureCoord).rgb;
     
     // Define the initial reflectance
     float3 reflectance = float3(0.0f);
@@ -46,9 +46,9 @@ void main()
     vec3 normal = normalize(v_Normal);
 
     // Get the diffuse color (kd) from the DiffuseMap texture
-    vec3 kd = vec3(texture(u_Material.DiffuseMap, v_TextureCoord));
+    vec3 kd = vec3(texture(u_MaterialMaps.DiffuseMap, v_TextureCoord));
     // Get the specular color (ks) from the SpecularMap texture
-    vec3 ks = vec3(texture(u_Material.SpecularMap, v_TextureCoord));
+    vec3 ks = vec3(texture(u_MaterialMaps.SpecularMap, v_TextureCoord));
     
     // Define the initial reflectance
     vec3 reflectance = vec3(0.0f);
@@ -0,0 +1,96 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "pixc/shaders/shared/structure/matrix/SimpleMatrix.glsl"
+
+// Input vertex attributes
+layout (location = 0) in vec4 a_Position;       // Vertex position in world space
+layout (location = 1) in vec2 a_TextureCoord;   // Texture coordinates
+layout (location = 2) in vec4 a_Color;          // Tint color
+layout (location = 3) in float a_TextureIndex;  // Texture slot in the batch
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Output to fragment shader
+out vec2 v_TextureCoord;                        // Texture coordinates
+out vec4 v_Color;                               // Tint color
+flat out int v_TextureIndex;                    // Texture slot in the batch
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the vertex information to the fragment shader
+    v_TextureCoord = a_TextureCoord;
+    v_Color = a_Color;
+    v_TextureIndex = int(a_TextureIndex);
+    
+    // Vertices are already defined in world space (the model matrix is the identity)
+    gl_Position = u_Transform.Projection * u_Transform.View * u_Transform.Model * a_Position;
+#ifndef PIXC_DEPTH_ZERO_TO_ONE
+    // Convert [0,1] depth to OpenGL [-1,1]
+    gl_Position.z = gl_Position.z * 2.0 - gl_Position.w;
+#endif
+}
+
+#shader fragment
+#version 330 core
+
+// Maximum number of textures bound in a single batch
+#define MAX_TEXTURE_SLOTS 16
+
+/**
+ * Represents the textures bound for the current batch.
+ */
+struct Batch
+{
+    sampler2D Textures[MAX_TEXTURE_SLOTS];  ///< Texture slots used by the batched quads.
+};
+
+// Specify the output color of the fragment shader
+layout (location = 0) out vec4 color;
+
+// Uniform buffer blocks
+uniform Batch u_Batch;              // Batch textures
+
+// Input variables from the vertex shader
+in vec2 v_TextureCoord;             // Texture coordinates
+in vec4 v_Color;                    // Tint color
+flat in int v_TextureIndex;         // Texture slot in the batch
+
+// Sample the texture bound in a slot (GLSL 3.30 only allows constant sampler indices)
+vec4 SampleBatchTexture(int index, vec2 uv)
+{
+    switch (index)
+    {
+        case  0: return texture(u_Batch.Textures[ 0], uv);
+        case  1: return texture(u_Batch.Textures[ 1], uv);
+        case  2: return texture(u_Batch.Textures[ 2], uv);
+        case  3: return texture(u_Batch.Textures[ 3], uv);
+        case  4: return texture(u_Batch.Textures[ 4], uv);
+        case  5: return texture(u_Batch.Textures[ 5], uv);
+        case  6: return texture(u_Batch.Textures[ 6], uv);
+        case  7: return texture(u_Batch.Textures[ 7], uv);
+        case  8: return texture(u_Batch.Textures[ 8], uv);
+        case  9: return texture(u_Batch.Textures[ 9], uv);
+        case 10: return texture(u_Batch.Textures[10], uv);
+        case 11: return texture(u_Batch.Textures[11], uv);
+        case 12: return texture(u_Batch.Textures[12], uv);
+        case 13: return texture(u_Batch.Textures[13], uv);
+        case 14: return texture(u_Batch.Textures[14], uv);
+        case 15: return texture(u_Batch.Textures[15], uv);
+    }
+    return vec4(1.0);
+}
+
+// Entry point of the fragment shader
+void main()
+{
+    // Combine the sampled texture color with the tint of the quad
+    color = SampleBatchTexture(v_TextureIndex, v_TextureCoord) * v_Color;
+    
+    // Discard fully transparent fragments so they do not write depth
+    if (color.a == 0.0)
+        discard;
+}
@@ -0,0 +1,72 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "pixc/shaders/shared/structure/matrix/SimpleMatrix.glsl"
+
+// Input vertex attributes
+layout (location = 0) in vec4 a_Position;       // Vertex position (world or clip space)
+layout (location = 1) in vec2 a_TextureCoord;   // Texture coordinates in the atlas page
+layout (location = 2) in vec4 a_Color;          // Text color
+layout (location = 3) in float a_ScreenSpace;   // Position already defined in clip space
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Output to fragment shader
+out vec2 v_TextureCoord;                        // Texture coordinates
+out vec4 v_Color;                               // Text color
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the vertex information to the fragment shader
+    v_TextureCoord = a_TextureCoord;
+    v_Color = a_Color;
+
+    // Screen-space glyphs are already projected, world-space glyphs are defined in world space
+    if (a_ScreenSpace > 0.5)
+        gl_Position = a_Position;
+    else
+        gl_Position = u_Transform.Projection * u_Transform.View * u_Transform.Model * a_Position;
+#ifndef PIXC_DEPTH_ZERO_TO_ONE
+    // Convert [0,1] depth to OpenGL [-1,1]
+    gl_Position.z = gl_Position.z * 2.0 - gl_Position.w;
+#endif
+}
+
+#shader fragment
+#version 330 core
+
+/**
+ * Represents the glyph atlas bound for the current batch.
+ */
+struct Atlas
+{
+    sampler2D Page;                 ///< Signed distance field page (edge at 0.5).
+};
+
+// Specify the output color of the fragment shader
+layout (location = 0) out vec4 color;
+
+// Uniform buffer blocks
+uniform Atlas u_Atlas;              // Glyph atlas
+
+// Input variables from the vertex shader
+in vec2 v_TextureCoord;             // Texture coordinates
+in vec4 v_Color;                    // Text color
+
+// Entry point of the fragment shader
+void main()
+{
+    // Anti-aliased edge, with a width of about one pixel at any scale
+    float distance = texture(u_Atlas.Page, v_TextureCoord).r;
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    color = vec4(v_Color.rgb, v_Color.a * alpha);
+
+    // Discard the space around the glyphs so it does not write depth
+    if (color.a == 0.0)
+        discard;
+}
@@ -0,0 +1,61 @@
+#shader compute
+#version 430 core
+
+// Each invocation measures a pixel of the downsampled frame
+layout (local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+/**
+ * Represents the parameters of the histogram.
+ */
+struct Histogram
+{
+    sampler2D Frame;                            ///< Frame to be measured.
+    vec2 Size;                                  ///< Resolution of the downsampled frame.
+    float MinLogLuminance;                      ///< Lower bound of the histogram (log2).
+    float InverseLogRange;                      ///< Inverse of the range of the histogram (log2).
+};
+
+// Uniform buffer blocks
+uniform Histogram u_Histogram;                  ///< Histogram parameters.
+
+// Number of pixels in each bin
+const uint BIN_COUNT = 64u;
+layout (std430, binding = 1) buffer HistogramBlock
+{
+    uint Bins[];
+};
+
+// Bins of the work group
+shared uint s_Bins[BIN_COUNT];
+
+// Entry point of the compute shader
+void main()
+{
+    uint index = gl_LocalInvocationIndex;
+    if (index < BIN_COUNT)
+        s_Bins[index] = 0u;
+    barrier();
+    
+    vec2 texel = vec2(gl_GlobalInvocationID.xy);
+    if (texel.x < u_Histogram.Size.x && texel.y < u_Histogram.Size.y)
+    {
+        // Downsample the frame (four bilinear taps over the area of the pixel)
+        vec2 uv = (texel + 0.5f) / u_Histogram.Size;
+        vec2 offset = 0.25f / u_Histogram.Size;
+        vec3 color = textureLod(u_Histogram.Frame, uv + vec2(-offset.x, -offset.y), 0.0f).rgb +
+                     textureLod(u_Histogram.Frame, uv + vec2( offset.x, -offset.y), 0.0f).rgb +
+                     textureLod(u_Histogram.Frame, uv + vec2(-offset.x,  offset.y), 0.0f).rgb +
+                     textureLod(u_Histogram.Frame, uv + vec2( offset.x,  offset.y), 0.0f).rgb;
+        float luminance = dot(color * 0.25f, vec3(0.2126f, 0.7152f, 0.0722f));
+        
+        // Find the bin of the log-luminance
+        float t = (log2(max(luminance, 1e-5f)) - u_Histogram.MinLogLuminance) * u_Histogram.InverseLogRange;
+        uint bin = min(uint(clamp(t, 0.0f, 1.0f) * float(BIN_COUNT)), BIN_COUNT - 1u);
+        atomicAdd(s_Bins[bin], 1u);
+    }
+    barrier();
+    
+    // Merge the bins of the work group
+    if (index < BIN_COUNT && s_Bins[index] > 0u)
+        atomicAdd(Bins[index], s_Bins[index]);
+}
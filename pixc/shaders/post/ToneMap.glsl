@@ -0,0 +1,31 @@
+#shader vertex
+#version 330 core
+
+// Include vertex shader (fullscreen triangle)
+#include "pixc/shaders/shared/chunk/vertex/Fullscreen.vs.glsl"
+
+#shader fragment
+#version 330 core
+
+// Include material properties
+#include "pixc/shaders/shared/structure/material/TextureMaterial.glsl"
+// Include exposure properties
+#include "pixc/shaders/shared/structure/view/Exposure.glsl"
+
+// Include fragment inputs
+#include "pixc/shaders/shared/chunk/fragment/Tex.fs.glsl"
+
+// Include tone mapping operators
+#include "pixc/shaders/shared/utils/ToneMapping.glsl"
+
+uniform Exposure u_Exposure;    // Exposure properties
+
+// Entry point of the fragment shader
+void main()
+{
+    // Sample the color (high dynamic range) of the rendered frame
+    vec4 textureColor = texture(u_Material.TextureMap, v_TextureCoord);
+    
+    // Map it into the displayable range
+    color = vec4(toneMap(textureColor.rgb, u_Exposure), textureColor.a);
+}
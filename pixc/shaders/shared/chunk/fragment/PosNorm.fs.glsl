@@ -3,7 +3,9 @@ layout (location = 0) out vec4 color;
 
 // Uniform buffer blocks
 uniform View u_View;                        // View information
+#ifndef MATERIAL_BLOCK
 uniform Material u_Material;                // Material properties
+#endif
 uniform Environment u_Environment;          // Environment properties
 
 // Input variables from the vertex shader
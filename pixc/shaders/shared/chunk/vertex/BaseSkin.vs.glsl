@@ -0,0 +1,22 @@
+// Input vertex attributes
+layout (location = 0) in vec4 a_Position;       // Vertex position in object space (bind pose)
+layout (location = 3) in vec4 a_BoneIDs;        // Indices of the bones influencing the vertex
+layout (location = 4) in vec4 a_BoneWeights;    // Weights of the bones influencing the vertex
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Deform the vertex with the pose of the skeleton
+    vec4 position = skinMatrix(a_BoneIDs, a_BoneWeights) * a_Position;
+    
+    // Calculate the final position of the vertex in clip space
+    // by transforming the vertex position from object space to clip space
+    gl_Position = u_Transform.Projection * u_Transform.View * u_Transform.Model * position;
+#ifndef PIXC_DEPTH_ZERO_TO_ONE
+    // Convert [0,1] depth to OpenGL [-1,1]
+    gl_Position.z = gl_Position.z * 2.0 - gl_Position.w;
+#endif
+}
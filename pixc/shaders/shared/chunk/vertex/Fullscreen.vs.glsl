@@ -0,0 +1,14 @@
+// Output to fragment shader
+out vec2 v_TextureCoord;                        // Pass texture coordinates to the fragment shader
+
+// Entry point of the vertex shader (no vertex data: a single triangle covering the screen is
+// generated from the vertex index, drawn with three vertices)
+void main()
+{
+    // Vertices (0, 0), (2, 0) and (0, 2) in texture space, the screen is the [0, 1] square
+    vec2 coord = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    v_TextureCoord = coord;
+    
+    // Calculate the final position of the vertex in clip space
+    gl_Position = vec4(coord * 2.0f - 1.0f, 0.0f, 1.0f);
+}
@@ -23,6 +23,8 @@ void main()
 
     // Calculate the final position of the vertex in clip space
     gl_Position = u_Transform.Projection * u_Transform.View * worldPosition;
+#ifndef PIXC_DEPTH_ZERO_TO_ONE
     // Convert [0,1] depth to OpenGL [-1,1]
     gl_Position.z = gl_Position.z * 2.0 - gl_Position.w;
+#endif
 }
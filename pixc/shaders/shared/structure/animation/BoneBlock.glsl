@@ -0,0 +1,27 @@
+/**
+ * Represents the bone matrices of a skinned model.
+ *
+ * The matrices are stored in a uniform buffer (std140 layout) updated by the animation system.
+ */
+#define MAX_BONES 128
+#define BONE_BLOCK
+layout(std140) uniform BoneBlock
+{
+    mat4 Bones[MAX_BONES];  ///< Transformation of the bind pose mesh space into the animated pose.
+} u_Bones;
+
+/**
+ * Compute the skinning matrix of a vertex.
+ *
+ * @param boneIDs Indices of the bones influencing the vertex.
+ * @param boneWeights Weights of the bones influencing the vertex.
+ *
+ * @return The weighted sum of the bone matrices.
+ */
+mat4 skinMatrix(vec4 boneIDs, vec4 boneWeights)
+{
+    return u_Bones.Bones[int(boneIDs.x)] * boneWeights.x +
+           u_Bones.Bones[int(boneIDs.y)] * boneWeights.y +
+           u_Bones.Bones[int(boneIDs.z)] * boneWeights.z +
+           u_Bones.Bones[int(boneIDs.w)] * boneWeights.w;
+}
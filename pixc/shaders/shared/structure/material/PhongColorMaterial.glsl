@@ -1,7 +1,10 @@
 /**
  * Represents the material properties of an object.
+ *
+ * The properties are stored in a uniform buffer (std140 layout) updated by the material.
  */
-struct Material
+#define MATERIAL_BLOCK
+layout(std140) uniform MaterialBlock
 {
     vec3 Ka;          ///< Ambient reflectance/color of the material.
     vec3 Kd;          ///< Diffuse reflectance/color of the material.
@@ -9,4 +12,4 @@ struct Material
     
     float Shininess;  ///< Shininess/exponent of the material for specular highlights.
     float Alpha;      ///< Transparency/alpha value of the material.
-};
+} u_Material;
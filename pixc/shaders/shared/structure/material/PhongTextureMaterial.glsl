@@ -1,11 +1,22 @@
 /**
  * Represents the material properties of an object.
+ *
+ * The properties are stored in a uniform buffer (std140 layout) updated by the material.
  */
-struct Material
+#define MATERIAL_BLOCK
+layout(std140) uniform MaterialBlock
 {
-    sampler2D DiffuseMap;    ///< Diffuse texture map of the material.
-    sampler2D SpecularMap;   ///< Specular texture map of the material.
-    
     float Shininess;         ///< Shininess factor for specular highlights.
     float Alpha;             ///< Alpha transparency value of the material.
+} u_Material;
+
+/**
+ * Represents the texture maps of the material (samplers cannot be stored in uniform buffers).
+ */
+struct MaterialMaps
+{
+    sampler2D DiffuseMap;    ///< Diffuse texture map of the material.
+    sampler2D SpecularMap;   ///< Specular texture map of the material.
 };
+
+uniform MaterialMaps u_MaterialMaps;
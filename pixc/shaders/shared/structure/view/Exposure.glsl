@@ -0,0 +1,9 @@
+/**
+ * Represents the exposure and tone mapping applied when the image is displayed.
+ */
+struct Exposure
+{
+    float Value;          ///< Scale factor of the colors.
+    int Operator;         ///< Tone mapping operator (None, Reinhard, ACES, Uncharted2).
+    float WhitePoint;     ///< Smallest luminance mapped to white (Reinhard and Uncharted2).
+};
@@ -0,0 +1,7 @@
+/**
+ * Represents the fade of a model about to be culled (distance or screen size).
+ */
+struct Fade
+{
+    float Factor;         ///< Opacity of the model (1 when fully drawn, 0 when culled).
+};
@@ -0,0 +1,24 @@
+///< Thresholds of a 4x4 ordered dithering pattern (Bayer matrix).
+const float BAYER_4X4[16] = float[16](
+     0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
+    12.0f / 16.0f,  4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
+     3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
+    15.0f / 16.0f,  7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f
+);
+
+/**
+ * Discard a fraction of the fragments of a model following an ordered dithering pattern, so the
+ * model fades out without transparency sorting.
+ *
+ * @param factor Opacity of the model (1 keeps all the fragments, 0 discards all of them).
+ */
+void ditherFade(float factor)
+{
+    // Fully drawn models keep all their fragments
+    if (factor >= 1.0f)
+        return;
+    
+    ivec2 pixel = ivec2(gl_FragCoord.xy) & 3;
+    if (factor <= BAYER_4X4[pixel.y * 4 + pixel.x])
+        discard;
+}
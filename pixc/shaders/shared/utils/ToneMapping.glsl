@@ -0,0 +1,77 @@
+// -----------------------------------------
+// Tone mapping
+// -----------------------------------------
+/**
+ * Applies the extended Reinhard operator to the luminance of a color.
+ *
+ * @param color The color (high dynamic range).
+ * @param white The smallest luminance mapped to white.
+ *
+ * @return The tone mapped color.
+ */
+vec3 toneMapReinhard(vec3 color, float white)
+{
+    float L = dot(color, vec3(0.2126f, 0.7152f, 0.0722f));
+    float mapped = L * (1.0f + L / (white * white)) / (1.0f + L);
+    return color * (mapped / max(L, 1e-5f));
+}
+
+/**
+ * Applies the filmic curve fitted to the ACES reference transform (by Krzysztof Narkowicz).
+ *
+ * @param color The color (high dynamic range).
+ *
+ * @return The tone mapped color.
+ */
+vec3 toneMapACES(vec3 color)
+{
+    return clamp((color * (2.51f * color + 0.03f)) / (color * (2.43f * color + 0.59f) + 0.14f),
+                 0.0f, 1.0f);
+}
+
+/**
+ * Evaluates the filmic curve of Uncharted 2 (by John Hable).
+ *
+ * @param x The color (high dynamic range).
+ *
+ * @return The value of the curve.
+ */
+vec3 uncharted2Curve(vec3 x)
+{
+    const float A = 0.15f, B = 0.50f, C = 0.10f, D = 0.20f, E = 0.02f, F = 0.30f;
+    return ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F;
+}
+
+/**
+ * Applies the filmic operator of Uncharted 2.
+ *
+ * @param color The color (high dynamic range).
+ * @param white The smallest value mapped to white.
+ *
+ * @return The tone mapped color.
+ */
+vec3 toneMapUncharted2(vec3 color, float white)
+{
+    return uncharted2Curve(color) / uncharted2Curve(vec3(white));
+}
+
+/**
+ * Applies the exposure and the tone mapping operator to a color.
+ *
+ * @param color The color (high dynamic range).
+ * @param exposure The exposure properties.
+ *
+ * @return The displayable color.
+ */
+vec3 toneMap(vec3 color, Exposure exposure)
+{
+    color *= exposure.Value;
+    
+    if (exposure.Operator == 1)
+        return toneMapReinhard(color, exposure.WhitePoint);
+    if (exposure.Operator == 2)
+        return toneMapACES(color);
+    if (exposure.Operator == 3)
+        return toneMapUncharted2(color, exposure.WhitePoint);
+    return clamp(color, 0.0f, 1.0f);
+}
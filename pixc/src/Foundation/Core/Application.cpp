@@ -4,10 +4,15 @@
 #include "Foundation/Event/Event.h"
 #include "Foundation/Event/WindowEvent.h"
 
+#include "Foundation/Core/AssetManager.h"
+#include "Foundation/Core/RenderThread.h"
 #include "Foundation/Core/Timer.h"
 #include "Foundation/Core/Timestep.h"
 
 #include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/FrameSync.h"
+#include "Foundation/Renderer/Buffer/FrameCapture.h"
+#include "Foundation/Renderer/Animation/AnimationSystem.h"
 
 namespace pixc {
 
@@ -85,6 +90,11 @@ void Application::PopOverlay(const std::shared_ptr<Layer>& overlay)
  */
 void Application::Run()
 {
+    if (m_RenderThread)
+    {
+        RunWithRenderThread();
+        return;
+    }
     
     static Timer timer;
     
@@ -95,13 +105,109 @@ void Application::Run()
         Timestep deltaTime = (float)(timer.Elapsed());
         timer.Reset();
         
+        // Wait until the resources of the frame are no longer used by the GPU
+        FrameSync::BeginFrame();
+        
+        // Create the assets loaded in the background
+        AssetManager::Update();
+        
+        // Evaluate the animated characters
+        AnimationSystem::Update(deltaTime);
+        
         // Render layers (from bottom to top)
         for (std::shared_ptr<Layer>& layer : m_LayerStack)
             layer->OnUpdate(deltaTime);
         
-        // Update the window
+        // Update the window (the frame is issued to the GPU)
+        FrameSync::EndFrame();
         m_Window->OnUpdate();
+        
+        // Collect the frames captured
+        FrameCapture::Update();
+    }
+    
+    Shutdown();
+}
+
+/**
+ * @brief Run this current application, drawing the frames on a separate render thread.
+ *
+ * The main thread simulates a frame while the render thread draws the previous one.
+ */
+void Application::RunWithRenderThread()
+{
+    Timer timer;
+    uint64_t frame = 0;
+    
+    RenderThread::Init([this](const FramePacket& packet) { RenderFrame(packet); });
+    
+    // Run until the user quits
+    while (m_Running)
+    {
+        // Per-frame time logic
+        Timestep deltaTime = (float)(timer.Elapsed());
+        timer.Reset();
+        
+        FramePacket& packet = RenderThread::BeginFrame();
+        packet.DeltaTime = deltaTime;
+        packet.Frame = frame++;
+        
+        // Poll for and process the events
+        m_Window->PollEvents();
+        
+        // Simulate layers and capture what has to be drawn (from bottom to top)
+        for (std::shared_ptr<Layer>& layer : m_LayerStack)
+            layer->OnSimulate(deltaTime, packet);
+        
+        // Hand the frame over to the render thread
+        RenderThread::Submit();
     }
+    
+    Shutdown();
+}
+
+/**
+ * @brief Stop the application services and release the graphics resources.
+ *
+ * It is called once the application stops running, while the window (and its graphics
+ * context) is still alive.
+ */
+void Application::Shutdown()
+{
+    // Draw the last frame and give the graphics context back to this thread
+    if (RenderThread::IsRunning())
+        RenderThread::Shutdown();
+    
+    // Stop the background work and release the resources of the renderer
+    Renderer::Shutdown();
+}
+
+/**
+ * @brief Draw a frame (called on the render thread).
+ *
+ * @param packet The packet of the frame.
+ */
+void Application::RenderFrame(const FramePacket& packet)
+{
+    // Wait until the resources of the frame are no longer used by the GPU
+    FrameSync::BeginFrame();
+    
+    // Create the assets loaded in the background
+    AssetManager::Update();
+    
+    // Evaluate the animated characters
+    AnimationSystem::Update(packet.DeltaTime);
+    
+    // Render layers (from bottom to top)
+    for (std::shared_ptr<Layer>& layer : m_LayerStack)
+        layer->OnRender(packet);
+    
+    // Present the frame (the frame is issued to the GPU)
+    FrameSync::EndFrame();
+    m_Window->SwapBuffers();
+    
+    // Collect the frames captured
+    FrameCapture::Update();
 }
 
 /**
@@ -110,6 +216,26 @@ void Application::Run()
  * @param e Event to be handled.
  */
 void Application::OnEvent(Event& e)
+{
+    // The resize events are handled on the render thread (the graphics resources are resized)
+    if (RenderThread::IsRunning() && e.GetEventType() == EventType::WindowResize)
+    {
+        RenderThread::Enqueue([this, event = static_cast<WindowResizeEvent&>(e)]() mutable
+        {
+            DispatchEvent(event);
+        });
+        return;
+    }
+    
+    DispatchEvent(e);
+}
+
+/**
+ * @brief Dispatch an event to the application and to the rendered layers.
+ *
+ * @param e Event to be handled.
+ */
+void Application::DispatchEvent(Event& e)
 {
     // Define the event dispatcher
     EventDispatcher dispatcher(e);
@@ -0,0 +1,833 @@
+#include "pixcpch.h"
+#include "Foundation/Core/AssetManager.h"
+
+#include "Foundation/Core/Timer.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+namespace pixc {
+
+/**
+ * @brief Represents a load request waiting for a worker thread.
+ */
+struct AssetJob
+{
+    std::shared_ptr<AssetRecord> Record;            ///< Asset to be loaded.
+    AssetPriority Priority = AssetPriority::Normal; ///< Priority of the request.
+    uint64_t Ticket = 0;                            ///< Request identifier (submission order).
+
+    /// @brief Order the requests by priority, then by submission order.
+    bool operator<(const AssetJob& other) const
+    {
+        if (Priority != other.Priority)
+            return Priority < other.Priority;
+        return Ticket > other.Ticket;
+    }
+};
+
+/**
+ * @brief Represents the data of an asset decoded by a worker thread.
+ */
+struct DecodedAsset
+{
+    std::shared_ptr<AssetRecord> Record;            ///< Asset decoded.
+    AssetPriority Priority = AssetPriority::Normal; ///< Priority of the request.
+    TextureImage Image;                             ///< Decoded image (textures).
+    AssimpModelData Model;                          ///< Decoded model data (models).
+    bool Failed = false;                            ///< The source could not be decoded.
+};
+
+/**
+ * @brief Represents the state of the asset manager.
+ */
+struct AssetManagerData
+{
+    ///< Worker threads.
+    std::vector<std::thread> Workers;
+    bool Running = true;
+
+    ///< Shared between the workers and the main thread (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    std::priority_queue<AssetJob> Queue;
+    std::vector<DecodedAsset> Decoded;
+    ///< Signaled when a worker has decoded an asset (see `AssetManager::Wait()`).
+    std::condition_variable Progress;
+    uint32_t LoadingCount = 0;
+    uint64_t Ticket = 0;
+
+    ///< Shared between the threads requesting assets and the thread updating the manager (the
+    ///< update holds the lock, recursive since the callbacks of the assets can request others).
+    std::recursive_mutex RecordsMutex;
+    ///< Assets tracked (by type and source).
+    std::unordered_map<std::string, std::shared_ptr<AssetRecord>> Records;
+    ///< Assets decoded and waiting for their creation.
+    std::vector<DecodedAsset> Uploads;
+    ///< Materials waiting for their dependencies.
+    std::vector<std::shared_ptr<AssetRecord>> Waiting;
+
+    ///< Memory budgets and usage per type of asset (no budget if zero).
+    std::array<size_t, static_cast<size_t>(AssetType::Count)> Budgets = {};
+    std::array<size_t, static_cast<size_t>(AssetType::Count)> Usage = {};
+    ///< Time spent creating assets per update (milliseconds).
+    float UploadBudget = 4.0f;
+
+    ///< Hot reload of the modified source files.
+    bool HotReload = false;
+    float ReloadInterval = 1.0f;
+    Timer ReloadTimer;
+
+    ///< Current frame.
+    uint64_t Frame = 0;
+
+    ///< Throughput measurement.
+    Timer ThroughputTimer;
+    uint32_t WindowAssets = 0;
+    size_t WindowBytes = 0;
+
+    ///< Asset manager statistics.
+    AssetManager::Statistics Stats;
+};
+
+static std::unique_ptr<AssetManagerData> g_Data;
+
+/**
+ * @brief Get the key identifying an asset in the manager.
+ *
+ * @param type The type of asset.
+ * @param source The source of the asset (file path or name).
+ *
+ * @return The asset key.
+ */
+static std::string GetKey(AssetType type, const std::string& source)
+{
+    return std::to_string(static_cast<uint32_t>(type)) + ":" + source;
+}
+
+/**
+ * @brief Get the file to be watched for changes for an asset.
+ *
+ * @param record The asset record.
+ *
+ * @return The source file (empty if the asset has no source file).
+ */
+static std::filesystem::path GetSourceFile(const AssetRecord& record)
+{
+    if (record.Type == AssetType::Material)
+        return {};
+    // The shaders are requested without extension, the resolved file is known by the shader
+    if (record.Type == AssetType::Shader)
+        return record.Asset ? std::static_pointer_cast<Shader>(record.Asset)->GetPath() : std::filesystem::path();
+    return record.Path;
+}
+
+/**
+ * @brief Add a load request to the queue of the worker threads.
+ *
+ * @param record The asset to be loaded.
+ * @param priority The priority of the request.
+ */
+static void Enqueue(const std::shared_ptr<AssetRecord>& record, AssetPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        uint64_t ticket = ++g_Data->Ticket;
+        // Any previous request of the asset still in the queue becomes obsolete
+        record->Ticket = ticket;
+        record->Priority = priority;
+        g_Data->Queue.push({ record, priority, ticket });
+    }
+    g_Data->Condition.notify_one();
+}
+
+/**
+ * @brief Decode the sources of assets (worker threads).
+ */
+static void WorkerLoop()
+{
+    while (true)
+    {
+        AssetJob job;
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Condition.wait(lock, [] { return !g_Data->Running || !g_Data->Queue.empty(); });
+            if (!g_Data->Running)
+                return;
+
+            job = g_Data->Queue.top();
+            g_Data->Queue.pop();
+
+            // Skip the obsolete requests
+            if (job.Ticket != job.Record->Ticket)
+                continue;
+            g_Data->LoadingCount++;
+        }
+
+        auto& record = job.Record;
+        if (record->State != AssetState::Ready)
+            record->State = AssetState::Loading;
+
+        DecodedAsset decoded;
+        decoded.Record = record;
+        decoded.Priority = job.Priority;
+        switch (record->Type)
+        {
+            case AssetType::Texture:
+            case AssetType::EnvironmentMap:
+                decoded.Image = Texture2D::DecodeImage(record->Path, record->Flip);
+                decoded.Failed = !decoded.Image.Pixels;
+                break;
+            case AssetType::Model:
+                decoded.Model = AssimpModel::ReadModelData(record->Path);
+                decoded.Failed = decoded.Model.Meshes.empty();
+                break;
+            // Shaders are compiled by the rendering context (main thread)
+            default:
+                break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->LoadingCount--;
+            g_Data->Decoded.push_back(std::move(decoded));
+        }
+        g_Data->Progress.notify_all();
+    }
+}
+
+/**
+ * @brief Define a new version of an asset (main thread).
+ *
+ * @param record The asset record.
+ * @param asset The new version of the asset.
+ * @param memorySize The estimated memory used by the asset (bytes).
+ */
+static void Resolve(const std::shared_ptr<AssetRecord>& record, const std::shared_ptr<void>& asset,
+                    size_t memorySize)
+{
+    bool reload = record->Asset != nullptr;
+
+    // Update the memory usage
+    auto& usage = g_Data->Usage[static_cast<size_t>(record->Type)];
+    usage = usage - record->MemorySize + memorySize;
+    record->MemorySize = memorySize;
+
+    record->Asset = asset;
+    record->Version++;
+    record->Reloading = false;
+    record->LastUsedFrame = g_Data->Frame;
+    record->State = AssetState::Ready;
+
+    // Keep track of the source file loaded
+    std::error_code error;
+    auto source = GetSourceFile(*record);
+    if (!source.empty())
+        record->WriteTime = std::filesystem::last_write_time(source, error);
+
+    // Update the statistics
+    (reload ? g_Data->Stats.Reloaded : g_Data->Stats.Loaded)++;
+    g_Data->WindowAssets++;
+    g_Data->WindowBytes += memorySize;
+
+    for (const auto& callback : record->Callbacks)
+        callback();
+
+    // Rebuild the assets depending on the previous version
+    if (!reload)
+        return;
+    for (auto& [key, dependent] : g_Data->Records)
+    {
+        auto& dependencies = dependent->Dependencies;
+        if (dependent->Asset && !dependent->Reloading &&
+            std::find(dependencies.begin(), dependencies.end(), record) != dependencies.end())
+        {
+            dependent->Reloading = true;
+            g_Data->Waiting.push_back(dependent);
+        }
+    }
+}
+
+/**
+ * @brief Define an asset as failed (main thread).
+ *
+ * @param record The asset record.
+ */
+static void Reject(const std::shared_ptr<AssetRecord>& record)
+{
+    g_Data->Stats.Failed++;
+
+    // Keep the previous version if the asset was being reloaded
+    if (record->Asset)
+    {
+        PIXEL_CORE_WARN("Failed to reload: " + record->Path.filename().string());
+        record->Reloading = false;
+        record->State = AssetState::Ready;
+        return;
+    }
+    record->State = AssetState::Failed;
+}
+
+/**
+ * @brief Create the GPU resources of a decoded asset (main thread).
+ *
+ * @param decoded The decoded asset.
+ */
+static void Create(DecodedAsset& decoded)
+{
+    auto& record = decoded.Record;
+    if (decoded.Failed)
+    {
+        PIXEL_CORE_WARN("Failed to load: " + record->Path.filename().string());
+        Reject(record);
+        return;
+    }
+
+    switch (record->Type)
+    {
+        case AssetType::Texture:
+        case AssetType::EnvironmentMap:
+        {
+            auto texture = Texture2D::CreateFromImage(decoded.Image, record->Path, record->Flip);
+            if (!texture)
+            {
+                Reject(record);
+                return;
+            }
+            const auto& image = decoded.Image;
+            size_t size = (size_t)image.Width * image.Height * image.Channels * (image.HDR ? sizeof(float) : 1);
+            Resolve(record, texture, size);
+            break;
+        }
+        case AssetType::Model:
+        {
+            size_t size = 0;
+            for (const auto& mesh : decoded.Model.Meshes)
+                size += mesh.Vertices.size() * sizeof(AssimpVertexData) + mesh.Indices.size() * sizeof(uint32_t) +
+                        mesh.Skin.size() * sizeof(SkinVertexData);
+
+            auto model = std::make_shared<AssimpModel>(record->Path, decoded.Model, record->Primitive);
+            Resolve(record, model, size);
+            break;
+        }
+        case AssetType::Shader:
+        {
+            // Shaders are shared with the materials (by name)
+            auto& library = Material::GetShaderLibrary();
+            std::string name = record->Path.stem().string();
+
+            std::shared_ptr<Shader> shader;
+            if (library.Exists(name) && !record->Reloading)
+                shader = library.Get(name);
+            else
+            {
+                shader = Shader::Create(name, record->Path);
+                if (library.Exists(name))
+                    library.Update(name, shader);
+                else
+                    library.Add(name, shader);
+            }
+
+            std::error_code error;
+            size_t size = (size_t)std::filesystem::file_size(shader->GetPath(), error);
+            Resolve(record, shader, error ? 0 : size);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Create the materials whose dependencies are ready (main thread).
+ */
+static void BuildWaiting()
+{
+    auto& waiting = g_Data->Waiting;
+    for (auto it = waiting.begin(); it != waiting.end();)
+    {
+        auto& record = *it;
+
+        bool ready = true, failed = false;
+        for (const auto& dependency : record->Dependencies)
+        {
+            ready &= dependency->Asset != nullptr && !dependency->Reloading;
+            failed |= dependency->State == AssetState::Failed;
+        }
+
+        if (failed)
+        {
+            PIXEL_CORE_WARN("Dependencies of '" + record->Name + "' could not be loaded!");
+            Reject(record);
+        }
+        else if (ready)
+            Resolve(record, record->Build(), 0);
+        else
+        {
+            ++it;
+            continue;
+        }
+        it = waiting.erase(it);
+    }
+}
+
+/**
+ * @brief Request the reloading of the assets whose source file has been modified (main thread).
+ */
+static void CheckForChanges()
+{
+    for (auto& [key, record] : g_Data->Records)
+    {
+        auto source = GetSourceFile(*record);
+        if (record->State != AssetState::Ready || record->Reloading || source.empty())
+            continue;
+
+        std::error_code error;
+        auto writeTime = std::filesystem::last_write_time(source, error);
+        if (error || writeTime <= record->WriteTime)
+            continue;
+
+        record->Reloading = true;
+        Enqueue(record, AssetPriority::Normal);
+    }
+}
+
+/**
+ * @brief Check whether an asset is in use (referenced outside of the manager).
+ *
+ * @param record The asset record.
+ *
+ * @return `true` if the asset is in use.
+ */
+static bool IsInUse(const std::shared_ptr<AssetRecord>& record)
+{
+    // Only referenced by the records of the manager otherwise
+    return record.use_count() > 1 || (record->Asset && record->Asset.use_count() > 1);
+}
+
+/**
+ * @brief Evict the least recently used assets that are not in use, for the types of assets
+ * exceeding their memory budget (main thread).
+ */
+static void Evict()
+{
+    auto& records = g_Data->Records;
+    auto isOverBudget = [](size_t type)
+    {
+        return g_Data->Budgets[type] > 0 && g_Data->Usage[type] > g_Data->Budgets[type];
+    };
+
+    bool overBudget = false;
+    for (size_t type = 0; type < g_Data->Budgets.size(); type++)
+        overBudget |= isOverBudget(type);
+    if (!overBudget)
+        return;
+
+    // Release the materials not in use first (they keep their dependencies alive)
+    for (auto it = records.begin(); it != records.end();)
+    {
+        const auto& record = it->second;
+        if (record->Type == AssetType::Material && record->State == AssetState::Ready &&
+            !record->Reloading && !IsInUse(record))
+        {
+            it = records.erase(it);
+            g_Data->Stats.Evicted++;
+        }
+        else
+            ++it;
+    }
+
+    // Least recently used assets first
+    std::vector<std::pair<std::string, std::shared_ptr<AssetRecord>>> candidates;
+    for (auto& [key, record] : records)
+    {
+        if (isOverBudget(static_cast<size_t>(record->Type)) && record->State == AssetState::Ready &&
+            !record->Reloading && !IsInUse(record))
+            candidates.emplace_back(key, nullptr);
+    }
+    for (auto& [key, record] : candidates)
+        record = records[key];
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b)
+    {
+        return a.second->LastUsedFrame < b.second->LastUsedFrame;
+    });
+
+    for (auto& [key, record] : candidates)
+    {
+        size_t type = static_cast<size_t>(record->Type);
+        if (!isOverBudget(type))
+            continue;
+
+        g_Data->Usage[type] -= record->MemorySize;
+        records.erase(key);
+        g_Data->Stats.Evicted++;
+    }
+}
+
+/**
+ * @brief Initialize the asset manager.
+ *
+ * @param workerCount The number of worker threads (hardware concurrency if zero).
+ */
+void AssetManager::Init(uint32_t workerCount)
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<AssetManagerData>();
+
+    if (workerCount == 0)
+        workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+    for (uint32_t i = 0; i < workerCount; i++)
+        g_Data->Workers.emplace_back(WorkerLoop);
+}
+
+/**
+ * @brief Stop the worker threads and release all the assets tracked.
+ */
+void AssetManager::Shutdown()
+{
+    if (!g_Data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Condition.notify_all();
+    g_Data->Progress.notify_all();
+    for (auto& worker : g_Data->Workers)
+        worker.join();
+
+    g_Data.reset();
+}
+
+/**
+ * @brief Process the load requests (to be called once per frame, from the rendering thread).
+ *
+ * Creates the assets decoded by the workers (highest priority first, within the upload budget),
+ * the materials whose dependencies are ready, checks for modified source files and evicts the
+ * assets exceeding the memory budgets.
+ */
+void AssetManager::Update()
+{
+    if (!g_Data)
+        return;
+
+    std::lock_guard<std::recursive_mutex> records(g_Data->RecordsMutex);
+    g_Data->Frame++;
+
+    // Collect the assets decoded by the workers
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        for (auto& decoded : g_Data->Decoded)
+            g_Data->Uploads.push_back(std::move(decoded));
+        g_Data->Decoded.clear();
+    }
+    std::stable_sort(g_Data->Uploads.begin(), g_Data->Uploads.end(), [](const auto& a, const auto& b)
+    {
+        return a.Priority > b.Priority;
+    });
+
+    // Create the assets within the time budget (at least one per update)
+    Timer timer;
+    size_t count = 0;
+    while (count < g_Data->Uploads.size() &&
+           (count == 0 || timer.ElapsedMilliseconds() < g_Data->UploadBudget))
+        Create(g_Data->Uploads[count++]);
+    g_Data->Uploads.erase(g_Data->Uploads.begin(), g_Data->Uploads.begin() + count);
+
+    BuildWaiting();
+
+    // Check for modified source files
+    if (g_Data->HotReload && g_Data->ReloadTimer.Elapsed() >= g_Data->ReloadInterval)
+    {
+        CheckForChanges();
+        g_Data->ReloadTimer.Reset();
+    }
+
+    Evict();
+
+    // Measure the throughput
+    float elapsed = g_Data->ThroughputTimer.Elapsed();
+    if (elapsed >= 1.0f)
+    {
+        g_Data->Stats.AssetsPerSecond = g_Data->WindowAssets / elapsed;
+        g_Data->Stats.BytesPerSecond = g_Data->WindowBytes / elapsed;
+        g_Data->WindowAssets = 0;
+        g_Data->WindowBytes = 0;
+        g_Data->ThroughputTimer.Reset();
+    }
+}
+
+/**
+ * @brief Request the loading of an asset from a file.
+ *
+ * @param type The type of asset.
+ * @param filePath The source file path.
+ * @param priority The priority of the request.
+ * @param flip Flip the image vertically (textures).
+ * @param primitive The primitive used for rendering (models).
+ *
+ * @return The asset record.
+ *
+ * @note If the asset has already been requested, the existing record is returned (and its
+ * request promoted if the new priority is higher).
+ */
+std::shared_ptr<AssetRecord> AssetManager::Request(AssetType type, const std::filesystem::path& filePath,
+                                                   AssetPriority priority, bool flip,
+                                                   PrimitiveType primitive)
+{
+    Init();
+
+    std::lock_guard<std::recursive_mutex> lock(g_Data->RecordsMutex);
+    std::string key = GetKey(type, filePath.string());
+    auto it = g_Data->Records.find(key);
+    if (it != g_Data->Records.end())
+    {
+        // Promote the request if it is still waiting for a worker
+        if (it->second->State == AssetState::Queued && priority > it->second->Priority)
+            Enqueue(it->second, priority);
+        return it->second;
+    }
+
+    auto record = std::make_shared<AssetRecord>();
+    record->Type = type;
+    record->Path = filePath;
+    record->Flip = flip;
+    record->Primitive = primitive;
+    g_Data->Records[key] = record;
+
+    Enqueue(record, priority);
+    return record;
+}
+
+/**
+ * @brief Request the creation of a material from its dependencies.
+ *
+ * @param name The name of the material.
+ * @param dependencies The assets required to create the material.
+ * @param build The function creating the material.
+ *
+ * @return The asset record.
+ */
+std::shared_ptr<AssetRecord> AssetManager::RequestMaterial(const std::string& name,
+                                                           const std::vector<std::shared_ptr<AssetRecord>>& dependencies,
+                                                           const std::function<std::shared_ptr<void>()>& build)
+{
+    Init();
+
+    std::lock_guard<std::recursive_mutex> lock(g_Data->RecordsMutex);
+    std::string key = GetKey(AssetType::Material, name);
+    auto it = g_Data->Records.find(key);
+    if (it != g_Data->Records.end())
+        return it->second;
+
+    auto record = std::make_shared<AssetRecord>();
+    record->Type = AssetType::Material;
+    record->Name = name;
+    record->Dependencies = dependencies;
+    record->Build = build;
+    record->State = AssetState::Loading;
+    g_Data->Records[key] = record;
+
+    g_Data->Waiting.push_back(record);
+    return record;
+}
+
+/**
+ * @brief Request the loading of a 2D texture.
+ *
+ * @param filePath Texture file path.
+ * @param flip Flip the texture vertically.
+ * @param priority The priority of the request.
+ *
+ * @return A handle to the texture.
+ */
+AssetHandle<Texture2D> AssetManager::LoadTexture(const std::filesystem::path& filePath, bool flip,
+                                                 AssetPriority priority)
+{
+    return AssetHandle<Texture2D>(Request(AssetType::Texture, filePath, priority, flip));
+}
+
+/**
+ * @brief Request the loading of an environment map (equirectangular image).
+ *
+ * @param filePath Environment map file path.
+ * @param priority The priority of the request.
+ *
+ * @return A handle to the environment map.
+ */
+AssetHandle<Texture2D> AssetManager::LoadEnvironmentMap(const std::filesystem::path& filePath,
+                                                        AssetPriority priority)
+{
+    return AssetHandle<Texture2D>(Request(AssetType::EnvironmentMap, filePath, priority));
+}
+
+/**
+ * @brief Request the loading of a model.
+ *
+ * @param filePath Model file path.
+ * @param primitive The primitive used for rendering the model.
+ * @param priority The priority of the request.
+ *
+ * @return A handle to the model.
+ */
+AssetHandle<AssimpModel> AssetManager::LoadModel(const std::filesystem::path& filePath,
+                                                 const PrimitiveType& primitive,
+                                                 AssetPriority priority)
+{
+    return AssetHandle<AssimpModel>(Request(AssetType::Model, filePath, priority, true, primitive));
+}
+
+/**
+ * @brief Request the loading of a shader.
+ *
+ * @param filePath Shader file path (without extension).
+ * @param priority The priority of the request.
+ *
+ * @return A handle to the shader.
+ */
+AssetHandle<Shader> AssetManager::LoadShader(const std::filesystem::path& filePath,
+                                             AssetPriority priority)
+{
+    return AssetHandle<Shader>(Request(AssetType::Shader, filePath, priority));
+}
+
+/**
+ * @brief Block until an asset is ready (or has failed), processing the load requests meanwhile.
+ *
+ * Between two updates, the thread sleeps until a worker has decoded another asset (unless decoded
+ * assets are still waiting for their creation, because of the upload budget).
+ *
+ * @param record The asset record.
+ *
+ * @note It must be called from the thread updating the asset manager.
+ */
+void AssetManager::Wait(const std::shared_ptr<AssetRecord>& record)
+{
+    auto isLoaded = [&record]()
+    {
+        AssetState state = record->State;
+        return state == AssetState::Ready || state == AssetState::Failed;
+    };
+
+    while (g_Data && !isLoaded())
+    {
+        Update();
+        if (isLoaded() || !g_Data->Uploads.empty())
+            continue;
+
+        std::unique_lock<std::mutex> lock(g_Data->Mutex);
+        g_Data->Progress.wait(lock, [] { return !g_Data->Running || !g_Data->Decoded.empty(); });
+        if (!g_Data->Running)
+            return;
+    }
+}
+
+/**
+ * @brief Define the memory budget of a type of asset.
+ *
+ * @param type The type of asset.
+ * @param bytes The memory budget in bytes (no budget if zero).
+ */
+void AssetManager::SetMemoryBudget(AssetType type, size_t bytes)
+{
+    Init();
+
+    std::lock_guard<std::recursive_mutex> lock(g_Data->RecordsMutex);
+    g_Data->Budgets[static_cast<size_t>(type)] = bytes;
+}
+
+/**
+ * @brief Get the estimated memory used by a type of asset.
+ *
+ * @param type The type of asset.
+ *
+ * @return The memory usage in bytes.
+ */
+size_t AssetManager::GetMemoryUsage(AssetType type)
+{
+    return g_Data ? g_Data->Usage[static_cast<size_t>(type)] : 0;
+}
+
+/**
+ * @brief Define the time spent creating assets in each update.
+ *
+ * @param milliseconds The upload budget in milliseconds.
+ */
+void AssetManager::SetUploadBudget(float milliseconds)
+{
+    Init();
+    g_Data->UploadBudget = milliseconds;
+}
+
+/**
+ * @brief Enable or disable the reloading of the assets whose source file is modified.
+ *
+ * @param enabled Enable the hot reloading.
+ * @param interval Time between the checks of the source files (seconds).
+ */
+void AssetManager::EnableHotReload(bool enabled, float interval)
+{
+    Init();
+    g_Data->HotReload = enabled;
+    g_Data->ReloadInterval = interval;
+}
+
+/**
+ * @brief Get the current frame (number of updates).
+ *
+ * @return The current frame.
+ */
+uint64_t AssetManager::GetFrame()
+{
+    return g_Data ? g_Data->Frame : 0;
+}
+
+/**
+ * @brief Reset the statistics of the asset manager.
+ */
+void AssetManager::ResetStats()
+{
+    if (!g_Data)
+        return;
+
+    std::lock_guard<std::recursive_mutex> lock(g_Data->RecordsMutex);
+    float assetsPerSecond = g_Data->Stats.AssetsPerSecond;
+    float bytesPerSecond = g_Data->Stats.BytesPerSecond;
+    g_Data->Stats = Statistics();
+    g_Data->Stats.AssetsPerSecond = assetsPerSecond;
+    g_Data->Stats.BytesPerSecond = bytesPerSecond;
+}
+
+/**
+ * @brief Get the statistics of the asset manager.
+ *
+ * @return The statistics.
+ */
+AssetManager::Statistics AssetManager::GetStats()
+{
+    if (!g_Data)
+        return Statistics();
+
+    std::lock_guard<std::recursive_mutex> records(g_Data->RecordsMutex);
+    Statistics stats = g_Data->Stats;
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        stats.QueueDepth = (uint32_t)g_Data->Queue.size();
+        stats.LoadingCount = g_Data->LoadingCount;
+        stats.PendingCount = (uint32_t)g_Data->Decoded.size();
+    }
+    stats.PendingCount += (uint32_t)(g_Data->Uploads.size() + g_Data->Waiting.size());
+
+    for (const auto& [key, record] : g_Data->Records)
+        stats.ResidentCount += record->Asset ? 1 : 0;
+    for (size_t usage : g_Data->Usage)
+        stats.MemoryUsage += usage;
+    return stats;
+}
+
+} // namespace pixc
@@ -0,0 +1,302 @@
+#include "pixcpch.h"
+#include "Foundation/Core/RenderThread.h"
+
+#include "Foundation/Core/Timer.h"
+
+#include "Foundation/Renderer/GraphicsContext.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace pixc {
+
+/**
+ * @brief Represents the state of the render thread.
+ */
+struct RenderThreadData
+{
+    ///< Render thread, and function drawing a packet.
+    std::thread Worker;
+    std::function<void(const FramePacket&)> Render;
+    bool Running = true;
+    
+    ///< Packets (written by the main thread, then read by the render thread).
+    FramePacket Packets[2];
+    ///< Packet written by the main thread.
+    int Writing = 0;
+    ///< Packet submitted and not yet taken, and packet being drawn (-1 if none).
+    int Pending = -1;
+    int Rendering = -1;
+    
+    ///< Commands waiting for the render thread, and number of commands enqueued and executed.
+    std::vector<std::function<void()>> Commands;
+    uint64_t Enqueued = 0;
+    uint64_t Executed = 0;
+    
+    ///< Shared between the main thread and the render thread (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    
+    ///< Timings of the main thread.
+    Timer FrameTimer;
+    Timer SimulationTimer;
+    ///< Accumulated timings (ms).
+    double FrameTime = 0.0;
+    double SimulationTime = 0.0;
+    double RenderTime = 0.0;
+    double SimulationWait = 0.0;
+    double RenderWait = 0.0;
+    uint64_t Submitted = 0;
+    uint64_t Frames = 0;
+    uint32_t ExecutedCommands = 0;
+};
+
+static std::unique_ptr<RenderThreadData> g_Data;
+static std::atomic<std::thread::id> g_RenderThreadID;
+
+/**
+ * @brief Start the render thread.
+ *
+ * The graphics context is released by the calling (main) thread and made current on the render
+ * thread, until it is shut down.
+ *
+ * @param render Function drawing a packet (called on the render thread).
+ */
+void RenderThread::Init(const std::function<void(const FramePacket&)>& render)
+{
+    if (g_Data)
+        return;
+    
+    g_Data = std::make_unique<RenderThreadData>();
+    g_Data->Render = render;
+    
+    GraphicsContext::Get().ReleaseCurrent();
+    g_Data->Worker = std::thread(&RenderThread::Loop);
+    g_Data->FrameTimer.Reset();
+}
+
+/**
+ * @brief Stop the render thread, once the packet submitted and the commands are executed.
+ *
+ * The graphics context is made current again on the calling (main) thread.
+ */
+void RenderThread::Shutdown()
+{
+    if (!g_Data)
+        return;
+    
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Condition.notify_all();
+    if (g_Data->Worker.joinable())
+        g_Data->Worker.join();
+    
+    GraphicsContext::Get().MakeCurrent();
+    
+    // The commands enqueued after the last frame still have to be executed
+    for (auto& command : g_Data->Commands)
+        command();
+    g_Data.reset();
+}
+
+/**
+ * @brief Get the packet to capture the next frame into.
+ *
+ * Waits until the render thread is done with the packet (drawn two frames ago).
+ *
+ * @return The packet, emptied from the data of its previous frame.
+ */
+FramePacket& RenderThread::BeginFrame()
+{
+    PIXEL_CORE_ASSERT(g_Data, "The render thread is not running!");
+    
+    Timer wait;
+    std::unique_lock<std::mutex> lock(g_Data->Mutex);
+    const int writing = g_Data->Writing;
+    g_Data->Condition.wait(lock, [writing]
+    {
+        return g_Data->Pending != writing && g_Data->Rendering != writing;
+    });
+    g_Data->SimulationWait += wait.ElapsedMilliseconds();
+    
+    g_Data->SimulationTimer.Reset();
+    
+    FramePacket& packet = g_Data->Packets[writing];
+    packet.Reset();
+    return packet;
+}
+
+/**
+ * @brief Hand the packet captured over to the render thread.
+ *
+ * If commands have been enqueued, waits until the render thread executed them.
+ */
+void RenderThread::Submit()
+{
+    PIXEL_CORE_ASSERT(g_Data, "The render thread is not running!");
+    
+    std::unique_lock<std::mutex> lock(g_Data->Mutex);
+    g_Data->SimulationTime += g_Data->SimulationTimer.ElapsedMilliseconds();
+    
+    // The previous packet has to be taken first (it may still be pending if the render thread
+    // is slower)
+    Timer wait;
+    g_Data->Condition.wait(lock, [] { return g_Data->Pending < 0; });
+    
+    g_Data->Pending = g_Data->Writing;
+    g_Data->Writing = 1 - g_Data->Writing;
+    g_Data->Condition.notify_all();
+    
+    // Wait for the commands (executed before the packet is drawn)
+    const uint64_t enqueued = g_Data->Enqueued;
+    g_Data->Condition.wait(lock, [enqueued] { return g_Data->Executed >= enqueued; });
+    g_Data->SimulationWait += wait.ElapsedMilliseconds();
+    
+    g_Data->FrameTime += g_Data->FrameTimer.ElapsedMilliseconds();
+    g_Data->FrameTimer.Reset();
+    g_Data->Submitted++;
+}
+
+/**
+ * @brief Execute a command on the render thread, before it draws the next packet submitted.
+ *
+ * The command is executed right away if the render thread is not running, or if it is called
+ * from the render thread itself.
+ *
+ * @param command The command.
+ */
+void RenderThread::Enqueue(const std::function<void()>& command)
+{
+    if (!g_Data || IsRenderThread())
+    {
+        command();
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_Data->Mutex);
+    g_Data->Commands.push_back(command);
+    g_Data->Enqueued++;
+}
+
+/**
+ * @brief Check if the render thread is running.
+ *
+ * @return `true` if the frames are drawn on the render thread.
+ */
+bool RenderThread::IsRunning()
+{
+    return g_Data != nullptr;
+}
+
+/**
+ * @brief Check if the calling thread is the render thread.
+ *
+ * @return `true` if called from the render thread.
+ */
+bool RenderThread::IsRenderThread()
+{
+    return g_Data && std::this_thread::get_id() == g_RenderThreadID.load();
+}
+
+/**
+ * @brief Reset the timings of the render thread.
+ */
+void RenderThread::ResetStats()
+{
+    if (!g_Data)
+        return;
+    
+    std::lock_guard<std::mutex> lock(g_Data->Mutex);
+    g_Data->FrameTime = g_Data->SimulationTime = g_Data->RenderTime = 0.0;
+    g_Data->SimulationWait = g_Data->RenderWait = 0.0;
+    g_Data->Submitted = g_Data->Frames = 0;
+    g_Data->ExecutedCommands = 0;
+}
+
+/**
+ * @brief Get the timings of the render thread.
+ *
+ * @return The timings, averaged over the frames since the last reset.
+ */
+RenderThread::Statistics RenderThread::GetStats()
+{
+    Statistics stats;
+    if (!g_Data)
+        return stats;
+    
+    std::lock_guard<std::mutex> lock(g_Data->Mutex);
+    stats.Frames = g_Data->Frames;
+    stats.Commands = g_Data->ExecutedCommands;
+    
+    if (g_Data->Submitted > 0)
+    {
+        const double submitted = static_cast<double>(g_Data->Submitted);
+        stats.FrameTime = static_cast<float>(g_Data->FrameTime / submitted);
+        stats.SimulationTime = static_cast<float>(g_Data->SimulationTime / submitted);
+        stats.SimulationWait = static_cast<float>(g_Data->SimulationWait / submitted);
+    }
+    if (g_Data->Frames > 0)
+    {
+        const double frames = static_cast<double>(g_Data->Frames);
+        stats.RenderTime = static_cast<float>(g_Data->RenderTime / frames);
+        stats.RenderWait = static_cast<float>(g_Data->RenderWait / frames);
+    }
+    return stats;
+}
+
+/**
+ * @brief Loop of the render thread: executes the commands, then draws the packets submitted.
+ */
+void RenderThread::Loop()
+{
+    g_RenderThreadID = std::this_thread::get_id();
+    GraphicsContext::Get().MakeCurrent();
+    
+    std::vector<std::function<void()>> commands;
+    while (true)
+    {
+        Timer wait;
+        std::unique_lock<std::mutex> lock(g_Data->Mutex);
+        g_Data->Condition.wait(lock, [] { return g_Data->Pending >= 0 || !g_Data->Running; });
+        if (g_Data->Pending < 0)
+            break;
+        g_Data->RenderWait += wait.ElapsedMilliseconds();
+        
+        // Take the packet and the commands enqueued while it was captured
+        const int rendering = g_Data->Pending;
+        g_Data->Rendering = rendering;
+        g_Data->Pending = -1;
+        commands.swap(g_Data->Commands);
+        const uint64_t enqueued = g_Data->Enqueued;
+        lock.unlock();
+        
+        // The main thread is waiting while the commands are executed
+        for (auto& command : commands)
+            command();
+        
+        lock.lock();
+        g_Data->Executed = enqueued;
+        g_Data->ExecutedCommands += static_cast<uint32_t>(commands.size());
+        lock.unlock();
+        g_Data->Condition.notify_all();
+        commands.clear();
+        
+        // Draw the packet
+        Timer render;
+        g_Data->Render(g_Data->Packets[rendering]);
+        
+        lock.lock();
+        g_Data->RenderTime += render.ElapsedMilliseconds();
+        g_Data->Frames++;
+        g_Data->Rendering = -1;
+        lock.unlock();
+        g_Data->Condition.notify_all();
+    }
+    
+    GraphicsContext::Get().ReleaseCurrent();
+}
+
+} // namespace pixc
@@ -200,10 +200,11 @@ static void MouseMovedCallback(GLFWwindow *window, double x, double y) noexcept
  * @param title Window name.
  * @param width Size (width) of the window.
  * @param height Size (height) of the window.
+ * @param visible Show the window on screen (hidden for offscreen rendering, a display is still required).
  */
 Window::Window(const std::string& title, const uint32_t width,
-               const uint32_t height)
-: m_Data(title, width, height)
+               const uint32_t height, bool visible)
+: m_Data(title, width, height, true, visible)
 {
     Init();
 }
@@ -221,13 +222,30 @@ Window::~Window()
  */
 void Window::OnUpdate() const
 {
-    // Swap front and back buffers
-    m_Context->SwapBuffers();
-    
-    // Poll for and process events
+    SwapBuffers();
+    PollEvents();
+}
+
+/**
+ * @brief Poll for and process the events of the window.
+ *
+ * @note Must be called from the main thread.
+ */
+void Window::PollEvents() const
+{
     glfwPollEvents();
 }
 
+/**
+ * @brief Swap the front and back buffers (presents the frame rendered).
+ *
+ * @note Must be called from the thread owning the graphics context.
+ */
+void Window::SwapBuffers() const
+{
+    m_Context->SwapBuffers();
+}
+
 /**
  * @brief Update the size information when the window is resized.
  */
@@ -266,6 +284,7 @@ void Window::Init()
     
     // Define the window hints for on the graphics context
     GraphicsContext::SetWindowHints();
+    glfwWindowHint(GLFW_VISIBLE, m_Data.Visible ? GLFW_TRUE : GLFW_FALSE);
     
     // Create a windowed mode window and its OpenGL context
     m_Window = glfwCreateWindow(m_Data.Width, m_Data.Height,
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Gui/OpenGLGuiBackend.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Gui/SoftwareGuiBackend.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Gui/MetalGuiBackend.h"
 #endif
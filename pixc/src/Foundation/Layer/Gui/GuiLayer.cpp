@@ -8,6 +8,7 @@
 
 #include "Foundation/Core/Application.h"
 #include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/FrameSync.h"
 
 namespace pixc {
 
@@ -45,6 +46,10 @@ void GuiLayer::OnAttach()
  */
 void GuiLayer::OnDetach()
 {
+    // Release the copies of the draw data
+    for (auto& drawData : m_DrawData)
+        ReleaseDrawData(drawData);
+    
     // Shut down the appropriate ImGui backend based on the active graphics API
     m_Backend->Shutdown();
     
@@ -66,6 +71,46 @@ void GuiLayer::OnUpdate(Timestep ts)
     End();
 }
 
+/**
+ * @brief Build the GUI interface from the inputs (main thread, when the frames are drawn on the
+ * render thread).
+ *
+ * @param ts Time elapsed since the last frame, in seconds.
+ * @param packet Packet of the frame.
+ */
+void GuiLayer::OnSimulate(Timestep ts, FramePacket& packet)
+{
+    // The platform windows would have to be drawn with their own contexts on the render thread
+    ImGuiIO &io = ImGui::GetIO();
+    io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+    
+    ImGui_ImplGlfw_NewFrame();
+    ImGui::NewFrame();
+    GUIStats(ts);
+    
+    Application &app = Application::Get();
+    io.DisplaySize = ImVec2(app.GetWindow().GetWidth(), app.GetWindow().GetHeight());
+    ImGui::Render();
+    
+    // Keep a copy of the draw data until the frame is drawn (the next frame is built meanwhile)
+    CopyDrawData(m_DrawData[packet.Frame % m_DrawData.size()]);
+}
+
+/**
+ * @brief Draw the GUI interface built by `OnSimulate()` (render thread).
+ *
+ * @param packet Packet of the frame.
+ */
+void GuiLayer::OnRender(const FramePacket& packet)
+{
+    ImDrawData* drawData = m_DrawData[packet.Frame % m_DrawData.size()];
+    if (!drawData)
+        return;
+    
+    m_Backend->BeginFrame();
+    m_Backend->EndFrame(drawData);
+}
+
 /**
  * @brief Handle an event that possibly occurred inside the GUI layer.
  *
@@ -107,7 +152,7 @@ void GuiLayer::End()
     
     // Render
     ImGui::Render();
-    m_Backend->EndFrame();
+    m_Backend->EndFrame(ImGui::GetDrawData());
     
     // Update the context used to rendered
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
@@ -138,10 +183,49 @@ void GuiLayer::GUIStats(Timestep ts)
     ImGui::Separator();
     ImGui::Text("Render Passes: %d", stats.RenderPasses);
     ImGui::Text("Draw Calls: %d", stats.DrawCalls);
+    ImGui::Separator();
+    auto frames = FrameSync::GetStats();
+    ImGui::Text("Frames in Flight: %d / %d", frames.FramesInFlight, FrameSync::GetFramesInFlight());
+    ImGui::Text("GPU Latency (ms): %.2f", frames.Latency);
+    ImGui::Text("GPU Wait (ms): %.2f", frames.WaitTime);
     
     ImGui::End();
 }
 
+/**
+ * @brief Replace a copy of draw data with the draw data of the last frame built.
+ *
+ * @param copy The copy (released first, if any).
+ */
+void GuiLayer::CopyDrawData(ImDrawData*& copy)
+{
+    ReleaseDrawData(copy);
+    
+    ImDrawData* drawData = ImGui::GetDrawData();
+    if (!drawData || !drawData->Valid)
+        return;
+    
+    copy = IM_NEW(ImDrawData)(*drawData);
+    for (ImDrawList*& list : copy->CmdLists)
+        list = list->CloneOutput();
+}
+
+/**
+ * @brief Release a copy of draw data.
+ *
+ * @param copy The copy (null once released).
+ */
+void GuiLayer::ReleaseDrawData(ImDrawData*& copy)
+{
+    if (!copy)
+        return;
+    
+    for (ImDrawList* list : copy->CmdLists)
+        IM_DELETE(list);
+    IM_DELETE(copy);
+    copy = nullptr;
+}
+
 /**
  * @brief Check if the GUI is currently active or hovered in.
  *
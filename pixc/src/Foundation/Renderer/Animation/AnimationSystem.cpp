@@ -0,0 +1,291 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Animation/AnimationSystem.h"
+
+#include "Foundation/Core/Timer.h"
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+#include "Foundation/Renderer/FrameSync.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace pixc {
+
+/**
+ * @brief Represents the state of the animation system.
+ */
+struct AnimationSystemData
+{
+    ///< Number of animators evaluated by a thread at once.
+    static constexpr uint32_t BatchSize = 16;
+    ///< Size of the bone matrices of a character in the buffer (`BoneBlock`).
+    static constexpr uint32_t SlotSize = MaxSkeletonJoints * sizeof(glm::mat4);
+
+    ///< Worker threads.
+    std::vector<std::thread> Workers;
+    bool Running = true;
+
+    ///< Update shared with the workers (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Start;
+    std::condition_variable Done;
+    uint64_t Generation = 0;
+    uint32_t ActiveCount = 0;
+    float DeltaTime = 0.0f;
+    ///< Next batch of animators to be evaluated.
+    std::atomic<uint32_t> NextBatch = 0;
+
+    ///< Animators registered, and their slot in the bone matrix buffer.
+    std::vector<std::shared_ptr<Animator>> Animators;
+    std::unordered_map<const Animator*, uint32_t> Slots;
+
+    ///< Bone matrices of all the animators (CPU copy, and GPU buffer of each frame in flight).
+    std::vector<glm::mat4> BoneMatrices;
+    std::array<std::shared_ptr<UniformBuffer>, FrameSync::MaxFramesInFlight> BoneBuffers;
+
+    ///< Animation statistics.
+    AnimationSystem::Statistics Stats;
+};
+
+static std::unique_ptr<AnimationSystemData> g_Data;
+
+/**
+ * @brief Evaluate batches of animators until all of them have been updated.
+ */
+static void RunBatches()
+{
+    const uint32_t count = static_cast<uint32_t>(g_Data->Animators.size());
+    const float deltaTime = g_Data->DeltaTime;
+
+    while (true)
+    {
+        uint32_t begin = g_Data->NextBatch.fetch_add(1) * AnimationSystemData::BatchSize;
+        if (begin >= count)
+            return;
+
+        uint32_t end = std::min(begin + AnimationSystemData::BatchSize, count);
+        for (uint32_t i = begin; i < end; i++)
+        {
+            auto& animator = *g_Data->Animators[i];
+            animator.Update(deltaTime);
+
+            // Copy the bone matrices into the slot of the animator
+            const auto& matrices = animator.GetBoneMatrices();
+            std::copy_n(matrices.begin(), std::min<size_t>(matrices.size(), MaxSkeletonJoints),
+                        g_Data->BoneMatrices.begin() + (size_t)i * MaxSkeletonJoints);
+        }
+    }
+}
+
+/**
+ * @brief Evaluate batches of animators each time an update is started (worker threads).
+ */
+static void WorkerLoop()
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Start.wait(lock, [&generation] {
+                return !g_Data->Running || g_Data->Generation != generation;
+            });
+            if (!g_Data->Running)
+                return;
+            generation = g_Data->Generation;
+        }
+
+        RunBatches();
+
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->ActiveCount--;
+        }
+        g_Data->Done.notify_one();
+    }
+}
+
+/**
+ * @brief Initialize the animation system.
+ *
+ * @param workerCount The number of worker threads (hardware concurrency minus one if zero).
+ */
+void AnimationSystem::Init(uint32_t workerCount)
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<AnimationSystemData>();
+
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    for (uint32_t i = 0; i < workerCount; i++)
+        g_Data->Workers.emplace_back(WorkerLoop);
+    g_Data->Stats.ThreadCount = workerCount + 1;
+}
+
+/**
+ * @brief Stop the worker threads and release the animators.
+ */
+void AnimationSystem::Shutdown()
+{
+    if (!g_Data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Start.notify_all();
+    for (auto& worker : g_Data->Workers)
+        worker.join();
+
+    g_Data.reset();
+}
+
+/**
+ * @brief Register an animator to be updated every frame.
+ *
+ * @param animator The animator.
+ */
+void AnimationSystem::Register(const std::shared_ptr<Animator>& animator)
+{
+    Init();
+
+    if (!animator || g_Data->Slots.count(animator.get()))
+        return;
+
+    if (animator->GetSkeleton()->GetJointCount() > MaxSkeletonJoints)
+    {
+        PIXEL_CORE_WARN("Skeleton with more than {0} joints, the remaining joints are ignored",
+                        MaxSkeletonJoints);
+    }
+
+    g_Data->Slots[animator.get()] = static_cast<uint32_t>(g_Data->Animators.size());
+    g_Data->Animators.push_back(animator);
+
+    // Start from the current pose of the animator
+    const auto& matrices = animator->GetBoneMatrices();
+    g_Data->BoneMatrices.resize(g_Data->Animators.size() * MaxSkeletonJoints, glm::mat4(1.0f));
+    std::copy_n(matrices.begin(), std::min<size_t>(matrices.size(), MaxSkeletonJoints),
+                g_Data->BoneMatrices.end() - MaxSkeletonJoints);
+
+    g_Data->Stats.AnimatorCount++;
+    g_Data->Stats.JointCount += animator->GetSkeleton()->GetJointCount();
+}
+
+/**
+ * @brief Stop updating an animator.
+ *
+ * @param animator The animator.
+ */
+void AnimationSystem::Unregister(const std::shared_ptr<Animator>& animator)
+{
+    if (!g_Data || !animator)
+        return;
+
+    auto it = g_Data->Slots.find(animator.get());
+    if (it == g_Data->Slots.end())
+        return;
+
+    // Move the last animator into the free slot
+    uint32_t slot = it->second;
+    g_Data->Slots.erase(it);
+    if (slot + 1 < g_Data->Animators.size())
+    {
+        g_Data->Animators[slot] = g_Data->Animators.back();
+        g_Data->Slots[g_Data->Animators[slot].get()] = slot;
+        std::copy(g_Data->BoneMatrices.end() - MaxSkeletonJoints, g_Data->BoneMatrices.end(),
+                  g_Data->BoneMatrices.begin() + (size_t)slot * MaxSkeletonJoints);
+    }
+    g_Data->Animators.pop_back();
+    g_Data->BoneMatrices.resize(g_Data->Animators.size() * MaxSkeletonJoints);
+
+    g_Data->Stats.AnimatorCount--;
+    g_Data->Stats.JointCount -= animator->GetSkeleton()->GetJointCount();
+}
+
+/**
+ * @brief Update the registered animators and upload their bone matrices (once per frame).
+ *
+ * @param deltaTime The time elapsed since the last update (in seconds).
+ */
+void AnimationSystem::Update(float deltaTime)
+{
+    if (!g_Data || g_Data->Animators.empty())
+        return;
+
+    // Evaluate the animators on all the threads
+    Timer timer;
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->DeltaTime = deltaTime;
+        g_Data->NextBatch = 0;
+        g_Data->ActiveCount = static_cast<uint32_t>(g_Data->Workers.size());
+        g_Data->Generation++;
+    }
+    g_Data->Start.notify_all();
+
+    RunBatches();
+    {
+        std::unique_lock<std::mutex> lock(g_Data->Mutex);
+        g_Data->Done.wait(lock, [] { return g_Data->ActiveCount == 0; });
+    }
+    g_Data->Stats.EvaluationTime = timer.ElapsedMilliseconds();
+
+    // Upload all the bone matrices at once, into the buffer of the frame (not read by the frames
+    // still in flight). The buffer grows with the number of animators
+    uint32_t size = static_cast<uint32_t>(g_Data->Animators.size()) * AnimationSystemData::SlotSize;
+    auto& buffer = g_Data->BoneBuffers[FrameSync::GetSlot()];
+    if (!buffer || buffer->GetSize() < size)
+    {
+        uint32_t capacity = AnimationSystemData::SlotSize;
+        while (capacity < size)
+            capacity *= 2;
+        buffer = UniformBuffer::Create(capacity);
+    }
+    if (!buffer)
+        return;
+
+    buffer->SetData(g_Data->BoneMatrices.data(), size);
+    g_Data->Stats.UploadSize = size;
+}
+
+/**
+ * @brief Attach the bone matrices of an animator to the `BoneBlock` binding point.
+ *
+ * @param animator The animator (registered in the system).
+ *
+ * @return `true` if the bone matrices are available on the GPU.
+ */
+bool AnimationSystem::BindBoneMatrices(const Animator& animator)
+{
+    if (!g_Data)
+        return false;
+    const auto& buffer = g_Data->BoneBuffers[FrameSync::GetSlot()];
+    if (!buffer)
+        return false;
+
+    // The animators registered since the last update are not uploaded yet
+    auto it = g_Data->Slots.find(&animator);
+    if (it == g_Data->Slots.end() ||
+        (it->second + 1) * AnimationSystemData::SlotSize > buffer->GetSize())
+        return false;
+
+    buffer->BindRange(static_cast<uint32_t>(UniformBinding::Bones),
+                      it->second * AnimationSystemData::SlotSize,
+                      AnimationSystemData::SlotSize);
+    return true;
+}
+
+/**
+ * @brief Get the statistics of the animation system.
+ *
+ * @return The animation statistics.
+ */
+AnimationSystem::Statistics AnimationSystem::GetStats()
+{
+    return g_Data ? g_Data->Stats : Statistics();
+}
+
+} // namespace pixc
@@ -0,0 +1,231 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Animation/Animator.h"
+
+namespace pixc {
+
+/**
+ * @brief Find the key preceding a time, starting from the key used in the previous evaluation.
+ *
+ * While an animation is played forward, the key is either the same one or one of the next ones,
+ * so the search is constant in time. A binary search is used otherwise (e.g., after a loop).
+ *
+ * @param times The time of the keys (sorted).
+ * @param time The time of the evaluation.
+ * @param cursor The key used in the previous evaluation (updated).
+ *
+ * @return The index of the key.
+ */
+static uint32_t FindKey(const std::vector<float>& times, float time, uint32_t& cursor)
+{
+    const uint32_t count = static_cast<uint32_t>(times.size());
+    if (cursor >= count || times[cursor] > time)
+    {
+        auto it = std::upper_bound(times.begin(), times.end(), time);
+        cursor = it == times.begin() ? 0 : static_cast<uint32_t>(it - times.begin()) - 1;
+        return cursor;
+    }
+
+    while (cursor + 1 < count && times[cursor + 1] <= time)
+        cursor++;
+    return cursor;
+}
+
+/**
+ * @brief Get the interpolation factor between a key and the next one.
+ *
+ * @param times The time of the keys.
+ * @param key The index of the key.
+ * @param time The time of the evaluation.
+ *
+ * @return The interpolation factor (between 0 and 1).
+ */
+static float GetFactor(const std::vector<float>& times, uint32_t key, float time)
+{
+    if (key + 1 >= times.size())
+        return 0.0f;
+
+    float length = times[key + 1] - times[key];
+    return length > 0.0f ? glm::clamp((time - times[key]) / length, 0.0f, 1.0f) : 0.0f;
+}
+
+/**
+ * @brief Create an animator for a skeleton (in the bind pose).
+ *
+ * @param skeleton The skeleton animated.
+ */
+Animator::Animator(const std::shared_ptr<Skeleton>& skeleton)
+    : m_Skeleton(skeleton)
+{
+    PIXEL_CORE_ASSERT(m_Skeleton, "Animator defined without a skeleton!");
+
+    m_Pose.SetBindPose(*m_Skeleton);
+    m_Globals.resize(m_Skeleton->GetJointCount());
+    m_BoneMatrices.resize(m_Skeleton->GetJointCount());
+    ComputeBoneMatrices();
+}
+
+/**
+ * @brief Play an animation.
+ *
+ * @param clip The animation (of the same skeleton).
+ * @param fadeDuration The duration (in seconds) of the transition from the animation being played.
+ * @param loop Restart the animation when it ends.
+ */
+void Animator::Play(const std::shared_ptr<AnimationClip>& clip, float fadeDuration, bool loop)
+{
+    // Keep the animation being played during the transition
+    if (fadeDuration > 0.0f && m_Current.Clip)
+    {
+        m_Previous = std::move(m_Current);
+        m_FadeDuration = fadeDuration;
+        m_FadeTime = 0.0f;
+    }
+    else
+        m_Previous = Layer();
+
+    m_Current = Layer();
+    m_Current.Clip = clip;
+    m_Current.Loop = loop;
+    if (clip)
+        m_Current.Cursors.assign(clip->Channels.size() * 3, 0);
+}
+
+/**
+ * @brief Stop the animation and reset the skeleton to its bind pose.
+ */
+void Animator::Stop()
+{
+    m_Current = Layer();
+    m_Previous = Layer();
+
+    m_Pose.SetBindPose(*m_Skeleton);
+    ComputeBoneMatrices();
+}
+
+/**
+ * @brief Advance the animation(s) being played and update the bone matrices.
+ *
+ * @param deltaTime The time elapsed since the last update (in seconds).
+ */
+void Animator::Update(float deltaTime)
+{
+    if (!m_Current.Clip)
+        return;
+
+    if (!m_Paused)
+    {
+        deltaTime *= m_Speed;
+        Advance(m_Current, deltaTime);
+        if (m_Previous.Clip)
+        {
+            Advance(m_Previous, deltaTime);
+            m_FadeTime += std::abs(deltaTime);
+        }
+    }
+
+    Sample(m_Current, m_Pose);
+
+    // Blend the previous animation during the transition
+    if (m_Previous.Clip && m_FadeTime < m_FadeDuration)
+    {
+        Sample(m_Previous, m_PreviousPose);
+        m_PreviousPose.Blend(m_Pose, m_FadeTime / m_FadeDuration);
+        std::swap(m_Pose, m_PreviousPose);
+    }
+    else
+        m_Previous = Layer();
+
+    ComputeBoneMatrices();
+}
+
+/**
+ * @brief Advance the time of an animation being played.
+ *
+ * @param layer The animation being played.
+ * @param deltaTime The time elapsed (in seconds, negative to play backwards).
+ */
+void Animator::Advance(Layer& layer, float deltaTime)
+{
+    float duration = layer.Clip->Duration;
+    layer.Time += deltaTime;
+    if (duration <= 0.0f)
+    {
+        layer.Time = 0.0f;
+        return;
+    }
+
+    if (layer.Loop)
+    {
+        layer.Time = std::fmod(layer.Time, duration);
+        if (layer.Time < 0.0f)
+            layer.Time += duration;
+    }
+    else
+        layer.Time = glm::clamp(layer.Time, 0.0f, duration);
+}
+
+/**
+ * @brief Evaluate the keyframes of an animation at its current time.
+ *
+ * @param layer The animation being played.
+ * @param pose The local pose of the skeleton.
+ */
+void Animator::Sample(Layer& layer, Pose& pose) const
+{
+    // The joints without keys remain in their bind pose
+    pose.SetBindPose(*m_Skeleton);
+
+    const auto& channels = layer.Clip->Channels;
+    const float time = layer.Time;
+    for (size_t c = 0; c < channels.size(); c++)
+    {
+        const auto& channel = channels[c];
+        const uint32_t joint = channel.Joint;
+        if (joint >= pose.GetJointCount())
+            continue;
+
+        uint32_t* cursors = &layer.Cursors[c * 3];
+
+        if (!channel.Translations.empty())
+        {
+            uint32_t key = FindKey(channel.TranslationTimes, time, cursors[0]);
+            uint32_t next = std::min(key + 1, static_cast<uint32_t>(channel.Translations.size()) - 1);
+            glm::vec3 t = glm::mix(channel.Translations[key], channel.Translations[next],
+                                   GetFactor(channel.TranslationTimes, key, time));
+            pose.TX[joint] = t.x; pose.TY[joint] = t.y; pose.TZ[joint] = t.z;
+        }
+        if (!channel.Rotations.empty())
+        {
+            uint32_t key = FindKey(channel.RotationTimes, time, cursors[1]);
+            uint32_t next = std::min(key + 1, static_cast<uint32_t>(channel.Rotations.size()) - 1);
+            glm::quat r = glm::slerp(channel.Rotations[key], channel.Rotations[next],
+                                     GetFactor(channel.RotationTimes, key, time));
+            pose.RX[joint] = r.x; pose.RY[joint] = r.y; pose.RZ[joint] = r.z; pose.RW[joint] = r.w;
+        }
+        if (!channel.Scales.empty())
+        {
+            uint32_t key = FindKey(channel.ScaleTimes, time, cursors[2]);
+            uint32_t next = std::min(key + 1, static_cast<uint32_t>(channel.Scales.size()) - 1);
+            glm::vec3 s = glm::mix(channel.Scales[key], channel.Scales[next],
+                                   GetFactor(channel.ScaleTimes, key, time));
+            pose.SX[joint] = s.x; pose.SY[joint] = s.y; pose.SZ[joint] = s.z;
+        }
+    }
+}
+
+/**
+ * @brief Compute the bone matrices from the local pose of the skeleton.
+ */
+void Animator::ComputeBoneMatrices()
+{
+    const auto& joints = m_Skeleton->Joints;
+    for (size_t i = 0; i < joints.size(); i++)
+    {
+        // The parents are stored before their children
+        glm::mat4 local = m_Pose.GetMatrix(static_cast<uint32_t>(i));
+        m_Globals[i] = joints[i].Parent >= 0 ? m_Globals[joints[i].Parent] * local : local;
+        m_BoneMatrices[i] = m_Skeleton->GlobalInverse * m_Globals[i] * joints[i].Offset;
+    }
+}
+
+} // namespace pixc
@@ -11,15 +11,51 @@
 #include "Foundation/Renderer/RendererCommand.h"
 
 #include "Platform/OpenGL/Buffer/OpenGLFrameBuffer.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Buffer/SoftwareFrameBuffer.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Buffer/MetalFrameBuffer.h"
 #endif
 
+#include "Foundation/Renderer/Buffer/FrameCapture.h"
+
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
 
 namespace pixc {
 
+/**
+ * @brief Get the memory and resolve cost of the framebuffers (per sample count).
+ *
+ * The statistics are created on first use and never destroyed, since framebuffers owned by other
+ * static objects can be released after the static objects of this file.
+ *
+ * @return The statistics of each sample count.
+ */
+static std::map<uint32_t, FrameBuffer::SampleStatistics>& SampleStats()
+{
+    static auto* stats = new std::map<uint32_t, FrameBuffer::SampleStatistics>();
+    return *stats;
+}
+
+/**
+ * @brief Get the size of a pixel of an attachment.
+ *
+ * @param format The texture format.
+ *
+ * @return The size (bytes).
+ */
+static size_t GetPixelSize(TextureFormat format)
+{
+    // The packed depth/stencil formats are stored in four bytes
+    if (format == TextureFormat::DEPTH24STENCIL8)
+        return 4;
+    
+    uint32_t channels = std::max(utils::textures::GetChannelCount(format), 1u);
+    return channels * utils::textures::GetBytesPerChannel(format);
+}
+
 /**
  * @brief Create a framebuffer based on the active rendering API.
  *
@@ -40,6 +76,15 @@ void FrameBuffer::ReleaseFrameBuffer()
 {
     m_ColorAttachments.clear();
     m_DepthAttachment = nullptr;
+    
+    // Update the memory statistics
+    if (m_MemorySize)
+    {
+        auto& stats = SampleStats()[m_MemorySamples];
+        stats.FrameBufferCount--;
+        stats.Memory -= m_MemorySize;
+        m_MemorySize = 0;
+    }
 }
 
 /**
@@ -50,6 +95,32 @@ void FrameBuffer::Bind() const
     RendererCommand::SetViewport(0, 0, m_Spec.Width, m_Spec.Height > 0 ? m_Spec.Height : 1);
 }
 
+/**
+ * @brief Prepare the attachments of the framebuffer for a render pass (the framebuffer is bound).
+ *
+ * By default, the targets with an attachment to be cleared are cleared as a whole with the clear
+ * color of the pass, and the other attachments keep their content.
+ *
+ * @param actions The actions of the render pass.
+ */
+void FrameBuffer::ApplyLoadActions(const RenderPassActions& actions)
+{
+    RenderTargetMask targets = RenderTargetMask::None;
+    for (uint32_t i = 0; i < m_ColorAttachments.size(); i++)
+    {
+        if (actions.GetColorActions(i).Load == LoadAction::Clear)
+            targets = targets | RenderTargetMask::Color;
+    }
+    if (m_DepthAttachment && actions.Depth.Load == LoadAction::Clear)
+        targets = targets | RenderTargetMask::Depth;
+    
+    if (targets == RenderTargetMask::None)
+        return;
+    
+    RendererCommand::SetClearColor(actions.ClearColor);
+    RendererCommand::Clear(targets);
+}
+
 /**
  * @brief Define the framebuffer.
  *
@@ -157,16 +228,122 @@ void FrameBuffer::Blit(const std::shared_ptr<FrameBuffer>& src,
             return MetalFrameBuffer::Blit(std::dynamic_pointer_cast<MetalFrameBuffer>(src),
                                           std::dynamic_pointer_cast<MetalFrameBuffer>(dst),
                                           spec);
+#ifdef PIXC_SOFTWARE_RENDERER
+        case RendererAPI::API::Software:
+            return SoftwareFrameBuffer::Blit(std::dynamic_pointer_cast<SoftwareFrameBuffer>(src),
+                                             std::dynamic_pointer_cast<SoftwareFrameBuffer>(dst),
+                                             spec);
+#endif
     }
     PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");
     return nullptr;
 }
 
+/**
+ * @brief Blit the contents of a framebuffer directly to the screen (default framebuffer).
+ *
+ * @param src The source framebuffer from which to copy the contents.
+ * @param width The width of the screen area.
+ * @param height The height of the screen area.
+ * @param spec The blit-specific parameters such as filter type and source attachment index.
+ *
+ * @return `true` if the contents have been copied, `false` if the API cannot blit to the screen
+ *         (the contents should then be drawn).
+ */
+bool FrameBuffer::BlitToScreen(const std::shared_ptr<FrameBuffer>& src,
+                               const uint32_t width, const uint32_t height,
+                               const BlitSpecification& spec)
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            OpenGLFrameBuffer::BlitToScreen(std::dynamic_pointer_cast<OpenGLFrameBuffer>(src),
+                                            width, height, spec);
+            return true;
+#ifdef PIXC_SOFTWARE_RENDERER
+        case RendererAPI::API::Software:
+            SoftwareFrameBuffer::BlitToScreen(std::dynamic_pointer_cast<SoftwareFrameBuffer>(src),
+                                              width, height, spec);
+            return true;
+#endif
+        // The Metal drawable is only written by the render passes
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Resolve the multisampled attachments of a framebuffer into another one (same size).
+ *
+ * Only the selected attachments are resolved; the depth is only resolved if requested. The mipmaps
+ * of the destination are regenerated only if it uses them.
+ *
+ * @param src The multisampled framebuffer.
+ * @param dst The framebuffer receiving the resolved attachments (same attachment indices).
+ * @param colors The indices of the color attachments to be resolved.
+ * @param depth Resolve the depth attachment too.
+ */
+void FrameBuffer::Resolve(const std::shared_ptr<FrameBuffer>& src,
+                          const std::shared_ptr<FrameBuffer>& dst,
+                          const std::vector<uint32_t>& colors, const bool depth)
+{
+    PIXEL_CORE_ASSERT(src && dst, "Trying to resolve undefined framebuffer(s)");
+    if (colors.empty() && !depth)
+        return;
+    
+    // Update the resolve statistics
+    auto& stats = SampleStats()[std::max(src->m_Spec.Samples, 1u)];
+    const size_t pixels = size_t(src->m_Spec.Width) * std::max(src->m_Spec.Height, 1u) *
+                          std::max(src->m_Spec.Samples, 1u);
+    for (uint32_t index : colors)
+        stats.ResolvedMemory += pixels * GetPixelSize(src->m_ColorAttachmentsSpec[index].Format);
+    if (depth)
+        stats.ResolvedMemory += pixels * GetPixelSize(src->m_DepthAttachmentSpec.Format);
+    stats.ResolveCount += static_cast<uint32_t>(colors.size()) + (depth ? 1 : 0);
+    
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            OpenGLFrameBuffer::Resolve(std::dynamic_pointer_cast<OpenGLFrameBuffer>(src),
+                                       std::dynamic_pointer_cast<OpenGLFrameBuffer>(dst),
+                                       colors, depth);
+            return;
+        // Resolve each attachment with its own blit
+        default:
+        {
+            BlitSpecification spec;
+            for (uint32_t index : colors)
+            {
+                spec.SetAttachmentIndices(index, index);
+                Blit(src, dst, spec);
+            }
+            if (depth)
+            {
+                spec.SetAttachmentIndices(0, 0);
+                spec.SetTargets(RenderTargetMask::Depth);
+                Blit(src, dst, spec);
+            }
+            return;
+        }
+    }
+}
+
 /**
  * @brief Defines the attachments for the framebuffer.
  */
 void FrameBuffer::DefineAttachments()
 {
+    // Update the memory statistics
+    m_MemorySize = ComputeMemorySize();
+    m_MemorySamples = std::max(m_Spec.Samples, 1u);
+    auto& stats = SampleStats()[m_MemorySamples];
+    stats.FrameBufferCount++;
+    stats.Memory += m_MemorySize;
+    
+    // The render buffers are defined by the rendering API
+    if (UsesRenderBuffers())
+        return;
+    
     // Define the depth attachment
     if(m_DepthAttachmentSpec.Format != TextureFormat::None &&
        utils::textures::IsDepthFormat(m_DepthAttachmentSpec.Format))
@@ -220,6 +397,36 @@ void FrameBuffer::DefineAttachments()
     }
 }
 
+/**
+ * @brief Compute the memory used by the attachments of the framebuffer.
+ *
+ * @return The size of the attachments (bytes).
+ */
+size_t FrameBuffer::ComputeMemorySize() const
+{
+    const size_t samples = std::max(m_Spec.Samples, 1u);
+    
+    auto attachmentSize = [&](const TextureSpecification& spec) -> size_t
+    {
+        size_t size = size_t(spec.Width) * std::max(spec.Height, 1u) * GetPixelSize(spec.Format);
+        switch (spec.Type)
+        {
+            case TextureType::TEXTURE3D:     size *= std::max(spec.Depth, 1u); break;
+            case TextureType::TEXTURECUBE:   size *= 6; break;
+            case TextureType::TEXTURE2D:
+            case TextureType::TEXTURE2D_MULTISAMPLE: size *= samples; break;
+            default: break;
+        }
+        // The mipmaps add a third of the size of the base level
+        return spec.MipMaps && samples == 1 ? size + size / 3 : size;
+    };
+    
+    size_t size = HasDepthAttachment() ? attachmentSize(m_DepthAttachmentSpec) : 0;
+    for (const auto& spec : m_ColorAttachmentsSpec)
+        size += attachmentSize(spec);
+    return size;
+}
+
 /**
  * @brief Save a color attachment into an output file.
  *
@@ -239,30 +446,122 @@ void FrameBuffer::SaveAttachment(const uint32_t index,
     
     // Get the specifications from the attachment
     TextureSpecification spec = m_ColorAttachments[index]->GetSpecification();
-    int channels = m_ColorAttachments[index]->GetAlignedChannels();
-    int stride = m_ColorAttachments[index]->GetStride();
     
-    // Get the texture data from the framebuffer attachment
-    std::vector<char> pixels = GetAttachmentData(index);
+    CapturedImage image;
+    image.Path = path;
+    image.Width = spec.Width;
+    image.Height = spec.Height;
+    image.Channels = m_ColorAttachments[index]->GetAlignedChannels();
+    image.Stride = m_ColorAttachments[index]->GetStride();
+    
+    // Get the texture data from the framebuffer attachment and save it into an image file
+    image.Pixels = GetAttachmentData(index);
+    FrameCapture::Write(image);
+}
+
+/**
+ * @brief Save a color attachment into an output file, without stalling the rendering.
+ *
+ * The pixels are read back once the rendering is complete (see `FrameCapture::Update()`) and
+ * the image is written on a worker thread.
+ *
+ * @param index Index to the color attachment to be saved.
+ * @param path File path.
+ */
+void FrameBuffer::SaveAttachmentAsync(const uint32_t index,
+                                      const std::filesystem::path &path)
+{
+    // Verify the index for the attachment
+    PIXEL_CORE_ASSERT(index < m_ColorAttachments.size(), "Attachment index out of bounds!");
     
-    // Extract extension and normalize to lowercase
-    std::string extension = path.extension().string();
-    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    // Get the specifications from the attachment (at the moment of the capture)
+    TextureSpecification spec = m_ColorAttachments[index]->GetSpecification();
     
-    // Save the texture data into an image file
-    stbi_flip_vertically_on_write(true);
+    CapturedImage image;
+    image.Path = path;
+    image.Width = spec.Width;
+    image.Height = spec.Height;
+    image.Channels = m_ColorAttachments[index]->GetAlignedChannels();
+    image.Stride = m_ColorAttachments[index]->GetStride();
     
-    if (extension == ".png")
-        stbi_write_png(path.string().c_str(), spec.Width, spec.Height,
-                       channels, pixels.data(), stride);
-    else if (extension == ".jpg" || extension == ".jpeg")
-        stbi_write_jpg(path.string().c_str(), spec.Width, spec.Height,
-                       channels, pixels.data(), 100);
-    else if (extension == ".hdr")
-        stbi_write_hdr(path.string().c_str(), spec.Width, spec.Height,
-                       channels, reinterpret_cast<float*>(pixels.data()));
-    else
-        PIXEL_CORE_WARN("Unsupported file format!");
+    GetAttachmentDataAsync(index, [image](std::vector<char> pixels) mutable
+    {
+        image.Pixels = std::move(pixels);
+        FrameCapture::Submit(std::move(image));
+    });
+}
+
+/**
+ * @brief Complete the asynchronous readbacks of framebuffer attachments.
+ *
+ * @param wait Wait for all the readbacks to be complete.
+ */
+void FrameBuffer::ProcessReadbacks(bool wait)
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            OpenGLFrameBuffer::ProcessReadbacks(wait);
+            return;
+        // The readbacks of the other APIs are synchronous
+        default:
+            return;
+    }
+}
+
+/**
+ * @brief Complete the asynchronous readbacks and release their resources (before the graphics
+ * context is destroyed).
+ */
+void FrameBuffer::ReleaseReadbacks()
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            OpenGLFrameBuffer::ReleaseReadbacks();
+            return;
+        // The readbacks of the other APIs are synchronous
+        default:
+            return;
+    }
+}
+
+/**
+ * @brief Reset the resolve statistics (the memory statistics are kept).
+ */
+void FrameBuffer::ResetResolveStats()
+{
+    for (auto& [samples, stats] : SampleStats())
+    {
+        stats.ResolveCount = 0;
+        stats.ResolvedMemory = 0;
+    }
+}
+
+/**
+ * @brief Get the memory and resolve cost of the framebuffers, per sample count.
+ *
+ * @return The statistics of each sample count in use.
+ */
+std::map<uint32_t, FrameBuffer::SampleStatistics> FrameBuffer::GetSampleStats()
+{
+    return SampleStats();
+}
+
+/**
+ * @brief Get the number of asynchronous readbacks of framebuffer attachments not yet complete.
+ *
+ * @return The number of pending readbacks.
+ */
+uint32_t FrameBuffer::GetPendingReadbacks()
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return OpenGLFrameBuffer::GetPendingReadbacks();
+        default:
+            return 0;
+    }
 }
 
 } // namespace pixc
@@ -0,0 +1,221 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Buffer/FrameCapture.h"
+
+#include "Foundation/Renderer/Buffer/FrameBuffer.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include <stb_image_write.h>
+
+namespace pixc {
+
+/**
+ * @brief Represents the state of the capture pipeline.
+ */
+struct FrameCaptureData
+{
+    ///< Maximum number of images waiting to be written.
+    static constexpr size_t MaxQueuedImages = 32;
+
+    ///< Writer threads.
+    std::vector<std::thread> Workers;
+    bool Running = true;
+
+    ///< Images waiting to be written (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    std::condition_variable SpaceAvailable;
+    std::condition_variable Idle;
+    std::deque<CapturedImage> Queue;
+    uint32_t WritingCount = 0;
+
+    ///< Capture statistics.
+    FrameCapture::Statistics Stats;
+};
+
+static std::unique_ptr<FrameCaptureData> g_Data;
+
+/**
+ * @brief Write the images submitted (writer threads).
+ */
+static void WorkerLoop()
+{
+    while (true)
+    {
+        CapturedImage image;
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Condition.wait(lock, [] { return !g_Data->Running || !g_Data->Queue.empty(); });
+            if (g_Data->Queue.empty())
+                return;
+
+            image = std::move(g_Data->Queue.front());
+            g_Data->Queue.pop_front();
+            g_Data->WritingCount++;
+        }
+        g_Data->SpaceAvailable.notify_one();
+
+        bool written = FrameCapture::Write(image);
+
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->WritingCount--;
+            (written ? g_Data->Stats.WrittenCount : g_Data->Stats.FailedCount)++;
+        }
+        g_Data->Idle.notify_all();
+    }
+}
+
+/**
+ * @brief Initialize the capture pipeline.
+ *
+ * @param workerCount The number of writer threads (half the hardware concurrency if zero).
+ */
+void FrameCapture::Init(uint32_t workerCount)
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<FrameCaptureData>();
+
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (uint32_t i = 0; i < workerCount; i++)
+        g_Data->Workers.emplace_back(WorkerLoop);
+}
+
+/**
+ * @brief Write the pending images, stop the writer threads and release the readback buffers.
+ */
+void FrameCapture::Shutdown()
+{
+    Flush();
+    FrameBuffer::ReleaseReadbacks();
+
+    if (!g_Data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Condition.notify_all();
+    for (auto& worker : g_Data->Workers)
+        worker.join();
+
+    g_Data.reset();
+}
+
+/**
+ * @brief Collect the framebuffer readbacks that are complete (to be called once per frame).
+ */
+void FrameCapture::Update()
+{
+    FrameBuffer::ProcessReadbacks(false);
+}
+
+/**
+ * @brief Wait until all the captures requested have been written.
+ */
+void FrameCapture::Flush()
+{
+    FrameBuffer::ProcessReadbacks(true);
+
+    if (!g_Data)
+        return;
+
+    std::unique_lock<std::mutex> lock(g_Data->Mutex);
+    g_Data->Idle.wait(lock, [] { return g_Data->Queue.empty() && g_Data->WritingCount == 0; });
+}
+
+/**
+ * @brief Submit an image to be written in the background.
+ *
+ * @param image The captured image.
+ */
+void FrameCapture::Submit(CapturedImage&& image)
+{
+    Init();
+
+    {
+        std::unique_lock<std::mutex> lock(g_Data->Mutex);
+        g_Data->SpaceAvailable.wait(lock, [] { return g_Data->Queue.size() < FrameCaptureData::MaxQueuedImages; });
+        g_Data->Queue.push_back(std::move(image));
+    }
+    g_Data->Condition.notify_one();
+}
+
+/**
+ * @brief Write an image into a file (synchronously).
+ *
+ * The format is defined by the extension of the file (`.png`, `.jpg`/`.jpeg` or `.hdr`).
+ *
+ * @param image The captured image.
+ *
+ * @return `true` if the image has been written.
+ *
+ * @note This function does not use the rendering context and can be called from any thread.
+ */
+bool FrameCapture::Write(const CapturedImage& image)
+{
+    // Extract extension and normalize to lowercase
+    std::string extension = image.Path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    // The rows are read back from the bottom, the images are written from the top
+    // (flipped here as the flip flag of the writer is shared by all threads)
+    std::vector<char> pixels(image.Pixels.size());
+    size_t stride = static_cast<size_t>(image.Stride);
+    for (size_t row = 0; row < image.Height && (row + 1) * stride <= image.Pixels.size(); row++)
+        memcpy(&pixels[row * stride], &image.Pixels[(image.Height - 1 - row) * stride], stride);
+
+    int result = 0;
+    if (extension == ".png")
+        result = stbi_write_png(image.Path.string().c_str(), image.Width, image.Height,
+                                image.Channels, pixels.data(), image.Stride);
+    else if (extension == ".jpg" || extension == ".jpeg")
+        result = stbi_write_jpg(image.Path.string().c_str(), image.Width, image.Height,
+                                image.Channels, pixels.data(), 100);
+    else if (extension == ".hdr")
+        result = stbi_write_hdr(image.Path.string().c_str(), image.Width, image.Height,
+                                image.Channels, reinterpret_cast<float*>(pixels.data()));
+    else
+        PIXEL_CORE_WARN("Unsupported file format!");
+
+    return result != 0;
+}
+
+/**
+ * @brief Reset the statistics of the capture pipeline.
+ */
+void FrameCapture::ResetStats()
+{
+    if (!g_Data)
+        return;
+
+    std::lock_guard<std::mutex> lock(g_Data->Mutex);
+    g_Data->Stats = Statistics();
+}
+
+/**
+ * @brief Get the statistics of the capture pipeline.
+ *
+ * @return The statistics.
+ */
+FrameCapture::Statistics FrameCapture::GetStats()
+{
+    Statistics stats;
+    stats.PendingCount = FrameBuffer::GetPendingReadbacks();
+    if (!g_Data)
+        return stats;
+
+    std::lock_guard<std::mutex> lock(g_Data->Mutex);
+    stats.PendingCount += (uint32_t)g_Data->Queue.size() + g_Data->WritingCount;
+    stats.WrittenCount = g_Data->Stats.WrittenCount;
+    stats.FailedCount = g_Data->Stats.FailedCount;
+    return stats;
+}
+
+} // namespace pixc
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Buffer/OpenGLIndexBuffer.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Buffer/SoftwareIndexBuffer.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Buffer/MetalIndexBuffer.h"
 #endif
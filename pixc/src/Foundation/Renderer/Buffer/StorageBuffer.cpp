@@ -0,0 +1,34 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Buffer/StorageBuffer.h"
+
+#include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/RendererCommand.h"
+
+#include "Platform/OpenGL/Buffer/OpenGLStorageBuffer.h"
+
+namespace pixc {
+
+/**
+ * @brief Create a storage buffer based on the active rendering API.
+ *
+ * @param size The size (in bytes) of the buffer.
+ *
+ * @return A shared pointer to the created storage buffer, or nullptr if the API (or the device)
+ *         does not support the compute passes.
+ */
+std::shared_ptr<StorageBuffer> StorageBuffer::Create(const uint32_t size)
+{
+    if (!RendererCommand::IsComputeSupported())
+        return nullptr;
+    
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return std::make_shared<OpenGLStorageBuffer>(size);
+        // The compute passes are not supported in Metal yet
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace pixc
@@ -0,0 +1,30 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+
+#include "Foundation/Renderer/Renderer.h"
+
+#include "Platform/OpenGL/Buffer/OpenGLUniformBuffer.h"
+
+namespace pixc {
+
+/**
+ * @brief Create a uniform buffer based on the active rendering API.
+ *
+ * @param size The size (in bytes) of the buffer.
+ *
+ * @return A shared pointer to the created uniform buffer, or nullptr if the API does not
+ *         support them (the uniforms are then set individually).
+ */
+std::shared_ptr<UniformBuffer> UniformBuffer::Create(const uint32_t size)
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return std::make_shared<OpenGLUniformBuffer>(size);
+        // The Metal shaders already pack their uniforms into argument buffers
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace pixc
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Buffer/OpenGLVertexBuffer.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Buffer/SoftwareVertexBuffer.h"
+#endif
 #include "Platform/Metal/Buffer/MetalVertexBuffer.h"
 
 namespace pixc {
@@ -25,4 +28,19 @@ std::shared_ptr<VertexBuffer> VertexBuffer::Create(const void* vertices, const u
     CREATE_RENDERER_OBJECT(std::make_shared, VertexBuffer, vertices, size, count)
 }
 
+/**
+ * @brief Create an empty (dynamic) vertex buffer based on the active rendering API.
+ *
+ * The content of the buffer is expected to be streamed with `SetData()`.
+ *
+ * @param size Size of the buffer in bytes.
+ *
+ * @return A shared pointer to the created vertex buffer, or nullptr if the API
+ *         is not supported or an error occurs.
+ */
+std::shared_ptr<VertexBuffer> VertexBuffer::Create(const uint32_t size)
+{
+    CREATE_RENDERER_OBJECT(std::make_shared, VertexBuffer, size)
+}
+
 } // namespace pixc
@@ -1,6 +1,8 @@
 #include "pixcpch.h"
 #include "Foundation/Renderer/Camera/OrthographicCamera.h"
 
+#include "Foundation/Renderer/RendererAPI.h"
+
 #include "Foundation/Input/Input.h"
 #include "Foundation/Input/KeyCodes.h"
 #include "Foundation/Input/MouseCodes.h"
@@ -78,8 +80,9 @@ void OrthographicCamera::UpdateProjectionMatrix()
     float aspectRatio = (float)m_Width / (float)m_Height;
     
     // Update the projection matrix (left, right, bottom, top, near plane, far plane)
-    m_ProjectionMatrix = glm::ortho(-aspectRatio * m_ZoomLevel, aspectRatio * m_ZoomLevel,
-                                    -m_ZoomLevel, m_ZoomLevel, m_NearPlane, m_FarPlane);
+    glm::mat4 projection = glm::ortho(-aspectRatio * m_ZoomLevel, aspectRatio * m_ZoomLevel,
+                                      -m_ZoomLevel, m_ZoomLevel, m_NearPlane, m_FarPlane);
+    m_ProjectionMatrix = RendererAPI::GetDepthProjection(projection);
 }
 
 /**
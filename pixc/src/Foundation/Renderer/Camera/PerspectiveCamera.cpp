@@ -1,6 +1,8 @@
 #include "pixcpch.h"
 #include "Foundation/Renderer/Camera/PerspectiveCamera.h"
 
+#include "Foundation/Renderer/RendererAPI.h"
+
 #include "Foundation/Input/Input.h"
 #include "Foundation/Input/KeyCodes.h"
 #include "Foundation/Input/MouseCodes.h"
@@ -62,11 +64,22 @@ void PerspectiveCamera::OnUpdate(Timestep ts)
 
 /**
  * @brief Update the camera projection matrix (perspective projection).
+ *
+ * With an infinite far plane, the projection is the limit of the perspective projection when the
+ * far plane goes to infinity. The points at infinity then get a depth of 1 (or 0 if the depth is
+ * reversed).
  */
 void PerspectiveCamera::UpdateProjectionMatrix()
 {
-    m_ProjectionMatrix = glm::perspective(glm::radians(m_FieldOfView), GetAspectRatio(),
-                                          m_NearPlane, m_FarPlane);
+    glm::mat4 projection = glm::perspective(glm::radians(m_FieldOfView), GetAspectRatio(),
+                                            m_NearPlane, m_FarPlane);
+    if (m_InfiniteFarPlane)
+    {
+        projection[2][2] = -1.0f;
+        projection[3][2] = -m_NearPlane;
+    }
+    
+    m_ProjectionMatrix = RendererAPI::GetDepthProjection(projection);
 }
 
 /**
@@ -0,0 +1,423 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Culling/ClusterCulling.h"
+
+#include "Foundation/Renderer/Renderer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace pixc {
+
+/**
+ * @brief Result of the test of a cluster.
+ */
+enum class ClusterResult : uint8_t
+{
+    Visible = 0, OutsideFrustum, Backfacing,
+};
+
+/**
+ * @brief Represents the state of the cluster culling.
+ */
+struct ClusterCullingData
+{
+    ///< Number of clusters tested by a thread at once.
+    static constexpr uint32_t BatchSize = 64;
+    ///< Minimum number of clusters of a mesh to be tested over the worker threads.
+    static constexpr uint32_t ParallelThreshold = 512;
+
+    ///< Worker threads.
+    std::vector<std::thread> Workers;
+    bool Running = true;
+
+    ///< Test shared with the workers (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Start;
+    std::condition_variable Done;
+    uint64_t Generation = 0;
+    uint32_t ActiveCount = 0;
+    ///< Next batch of clusters to be tested.
+    std::atomic<uint32_t> NextBatch = 0;
+
+    ///< Mesh being tested.
+    const std::vector<MeshCluster>* Clusters = nullptr;
+    glm::mat4 Transform = glm::mat4(1.0f);
+    float Scale = 1.0f;
+    bool TestBackface = false;
+    ///< View frustum (world space) and position.
+    std::array<glm::vec4, 6> Planes;
+    glm::vec3 ViewPosition = glm::vec3(0.0f);
+    ///< Result of the test of each cluster.
+    std::vector<ClusterResult> Results;
+
+    ///< Tests applied to the clusters.
+    ClusterCullingMode Mode = ClusterCullingMode::Frustum;
+
+    ///< Culling statistics.
+    ClusterCulling::Statistics Stats;
+};
+
+static std::unique_ptr<ClusterCullingData> g_Data;
+
+/**
+ * @brief Test a cluster against the view frustum and the view position.
+ *
+ * @param cluster The cluster.
+ *
+ * @return The result of the test.
+ */
+static ClusterResult TestCluster(const MeshCluster& cluster)
+{
+    glm::vec3 center = glm::vec3(g_Data->Transform * glm::vec4(cluster.Center, 1.0f));
+    float radius = cluster.Radius * g_Data->Scale;
+
+    for (const auto& plane : g_Data->Planes)
+    {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+            return ClusterResult::OutsideFrustum;
+    }
+
+    // All the triangles face away if the view is inside the (negated) normal cone
+    if (g_Data->TestBackface && cluster.ConeCutoff < 1.0f)
+    {
+        glm::vec3 axis = glm::normalize(glm::mat3(g_Data->Transform) * cluster.ConeAxis);
+        glm::vec3 direction = center - g_Data->ViewPosition;
+        if (glm::dot(direction, axis) >= cluster.ConeCutoff * glm::length(direction) + radius)
+            return ClusterResult::Backfacing;
+    }
+    return ClusterResult::Visible;
+}
+
+/**
+ * @brief Test batches of clusters until all of them have been tested.
+ */
+static void RunBatches()
+{
+    const auto& clusters = *g_Data->Clusters;
+    const uint32_t count = static_cast<uint32_t>(clusters.size());
+
+    while (true)
+    {
+        uint32_t begin = g_Data->NextBatch.fetch_add(1) * ClusterCullingData::BatchSize;
+        if (begin >= count)
+            return;
+
+        uint32_t end = std::min(begin + ClusterCullingData::BatchSize, count);
+        for (uint32_t i = begin; i < end; i++)
+            g_Data->Results[i] = TestCluster(clusters[i]);
+    }
+}
+
+/**
+ * @brief Test batches of clusters each time a mesh is culled (worker threads).
+ */
+static void WorkerLoop()
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Start.wait(lock, [&generation] {
+                return !g_Data->Running || g_Data->Generation != generation;
+            });
+            if (!g_Data->Running)
+                return;
+            generation = g_Data->Generation;
+        }
+
+        RunBatches();
+
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->ActiveCount--;
+        }
+        g_Data->Done.notify_one();
+    }
+}
+
+/**
+ * @brief Initialize the cluster culling.
+ *
+ * @param workerCount The number of worker threads (hardware concurrency minus one if zero).
+ */
+void ClusterCulling::Init(uint32_t workerCount)
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<ClusterCullingData>();
+
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    for (uint32_t i = 0; i < workerCount; i++)
+        g_Data->Workers.emplace_back(WorkerLoop);
+    g_Data->Stats.ThreadCount = workerCount + 1;
+}
+
+/**
+ * @brief Stop the worker threads.
+ */
+void ClusterCulling::Shutdown()
+{
+    if (!g_Data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Start.notify_all();
+    for (auto& worker : g_Data->Workers)
+        worker.join();
+
+    g_Data.reset();
+}
+
+/**
+ * @brief Split the triangles of a mesh into clusters of neighbouring triangles.
+ *
+ * The triangles are sorted along a Morton curve (from the position of their centroid), then
+ * grouped by `MeshClusterTriangles`. The indices are reordered so the triangles of each cluster
+ * are contiguous.
+ *
+ * @param positions The positions of the vertices of the mesh.
+ * @param indices The indices of the triangles of the mesh (reordered).
+ *
+ * @return The clusters, or none if the mesh is too small to be worth splitting.
+ *
+ * @note Only CPU data is touched, so it is safe to call this function from a worker thread.
+ */
+std::vector<MeshCluster> ClusterCulling::BuildClusters(const std::vector<glm::vec3>& positions,
+                                                       std::vector<uint32_t>& indices)
+{
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+    if (triangleCount < 4 * MeshClusterTriangles || positions.empty())
+        return {};
+
+    // Sort the triangles along a Morton curve over the bounds of the mesh
+    glm::vec3 min = positions.front(), max = positions.front();
+    for (const auto& position : positions)
+    {
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+    glm::vec3 extent = glm::max(max - min, glm::vec3(1e-6f));
+
+    auto spread = [](uint32_t x)
+    {
+        x &= 0x3ff;
+        x = (x | (x << 16)) & 0x030000ff;
+        x = (x | (x << 8)) & 0x0300f00f;
+        x = (x | (x << 4)) & 0x030c30c3;
+        x = (x | (x << 2)) & 0x09249249;
+        return x;
+    };
+
+    std::vector<std::pair<uint32_t, uint32_t>> order(triangleCount);
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+        glm::vec3 centroid = (positions[indices[3 * t]] + positions[indices[3 * t + 1]] +
+                              positions[indices[3 * t + 2]]) / 3.0f;
+        glm::uvec3 cell = glm::uvec3(glm::clamp((centroid - min) / extent, 0.0f, 1.0f) * 1023.0f);
+        order[t] = { spread(cell.x) | (spread(cell.y) << 1) | (spread(cell.z) << 2), t };
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<uint32_t> sorted(indices.size() - indices.size() % 3);
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+        for (uint32_t k = 0; k < 3; k++)
+            sorted[3 * t + k] = indices[3 * order[t].second + k];
+    }
+    indices = std::move(sorted);
+
+    // Define the bounds of each group of triangles
+    std::vector<MeshCluster> clusters;
+    clusters.reserve((triangleCount + MeshClusterTriangles - 1) / MeshClusterTriangles);
+    for (uint32_t first = 0; first < triangleCount; first += MeshClusterTriangles)
+    {
+        MeshCluster cluster;
+        uint32_t last = std::min(first + MeshClusterTriangles, triangleCount);
+        cluster.IndexOffset = 3 * first;
+        cluster.IndexCount = 3 * (last - first);
+
+        // Bounding sphere (around the center of the bounding box)
+        glm::vec3 low = positions[indices[cluster.IndexOffset]], high = low;
+        for (uint32_t i = cluster.IndexOffset; i < cluster.IndexOffset + cluster.IndexCount; i++)
+        {
+            low = glm::min(low, positions[indices[i]]);
+            high = glm::max(high, positions[indices[i]]);
+        }
+        cluster.Center = (low + high) * 0.5f;
+        for (uint32_t i = cluster.IndexOffset; i < cluster.IndexOffset + cluster.IndexCount; i++)
+            cluster.Radius = std::max(cluster.Radius, glm::length(positions[indices[i]] - cluster.Center));
+
+        // Normal cone: average normal and the widest angle to it
+        std::vector<glm::vec3> normals;
+        normals.reserve(last - first);
+        glm::vec3 sum = glm::vec3(0.0f);
+        for (uint32_t t = first; t < last; t++)
+        {
+            const glm::vec3& a = positions[indices[3 * t]];
+            glm::vec3 normal = glm::cross(positions[indices[3 * t + 1]] - a,
+                                          positions[indices[3 * t + 2]] - a);
+            float length = glm::length(normal);
+            if (length <= 0.0f)
+                continue;
+            normals.push_back(normal / length);
+            sum += normals.back();
+        }
+        if (glm::length(sum) > 1e-6f)
+        {
+            cluster.ConeAxis = glm::normalize(sum);
+            float minDot = 1.0f;
+            for (const auto& normal : normals)
+                minDot = std::min(minDot, glm::dot(normal, cluster.ConeAxis));
+            // Normals spread over more than a hemisphere can always face the view
+            cluster.ConeCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+        }
+        clusters.push_back(cluster);
+    }
+    return clusters;
+}
+
+/**
+ * @brief Change the tests applied to the clusters of the meshes drawn next.
+ *
+ * @param mode The tests applied.
+ */
+void ClusterCulling::SetMode(ClusterCullingMode mode)
+{
+    Init();
+    g_Data->Mode = mode;
+}
+
+/**
+ * @brief Get the tests applied to the clusters of the meshes drawn.
+ *
+ * @return The tests applied.
+ */
+ClusterCullingMode ClusterCulling::GetMode()
+{
+    return g_Data ? g_Data->Mode : ClusterCullingMode::Frustum;
+}
+
+/**
+ * @brief Test the clusters of a mesh against the view of the scene being rendered.
+ *
+ * @param clusters The clusters of the mesh.
+ * @param transform The transformation matrix of the mesh (model matrix).
+ * @param ranges The ranges of indices to be drawn (adjacent clusters are merged).
+ *
+ * @return `false` if the clusters are not culled (the mesh must be drawn entirely).
+ */
+bool ClusterCulling::Cull(const std::vector<MeshCluster>& clusters, const glm::mat4& transform,
+                          std::vector<IndexRange>& ranges)
+{
+    Init();
+    ranges.clear();
+    if (g_Data->Mode == ClusterCullingMode::None || clusters.empty())
+        return false;
+
+    // Frustum planes from the view-projection matrix (normalized, world space)
+    glm::mat4 viewProjection = Renderer::GetProjectionMatrix() * Renderer::GetViewMatrix();
+    glm::vec4 rowX = glm::vec4(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+    glm::vec4 rowY = glm::vec4(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+    glm::vec4 rowZ = glm::vec4(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+    glm::vec4 rowW = glm::vec4(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+    g_Data->Planes = { rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowW + rowZ, rowW - rowZ };
+    for (auto& plane : g_Data->Planes)
+        plane /= std::max(glm::length(glm::vec3(plane)), 1e-6f);
+
+    // The normal cones are only kept by uniform scales
+    glm::vec3 scales = glm::vec3(glm::length(glm::vec3(transform[0])),
+                                 glm::length(glm::vec3(transform[1])),
+                                 glm::length(glm::vec3(transform[2])));
+    float scale = std::max({ scales.x, scales.y, scales.z });
+    bool uniform = scale - std::min({ scales.x, scales.y, scales.z }) <= 0.01f * scale;
+
+    g_Data->Clusters = &clusters;
+    g_Data->Transform = transform;
+    g_Data->Scale = scale;
+    g_Data->TestBackface = g_Data->Mode == ClusterCullingMode::FrustumAndBackface && uniform &&
+                           glm::determinant(glm::mat3(transform)) > 0.0f;
+    g_Data->ViewPosition = Renderer::GetViewPosition();
+    g_Data->Results.resize(clusters.size());
+
+    // Test the clusters (on all the threads for the large meshes)
+    const uint32_t count = static_cast<uint32_t>(clusters.size());
+    if (count >= ClusterCullingData::ParallelThreshold && !g_Data->Workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->NextBatch = 0;
+            g_Data->ActiveCount = static_cast<uint32_t>(g_Data->Workers.size());
+            g_Data->Generation++;
+        }
+        g_Data->Start.notify_all();
+
+        RunBatches();
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Done.wait(lock, [] { return g_Data->ActiveCount == 0; });
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < count; i++)
+            g_Data->Results[i] = TestCluster(clusters[i]);
+    }
+    g_Data->Clusters = nullptr;
+
+    // Gather the visible clusters into ranges of indices
+    for (uint32_t i = 0; i < count; i++)
+    {
+        switch (g_Data->Results[i])
+        {
+            case ClusterResult::OutsideFrustum:
+                g_Data->Stats.FrustumCulled++;
+                continue;
+            case ClusterResult::Backfacing:
+                g_Data->Stats.BackfaceCulled++;
+                continue;
+            case ClusterResult::Visible:
+                break;
+        }
+
+        const auto& cluster = clusters[i];
+        if (!ranges.empty() && ranges.back().Offset + ranges.back().Count == cluster.IndexOffset)
+            ranges.back().Count += cluster.IndexCount;
+        else
+            ranges.push_back({ cluster.IndexOffset, cluster.IndexCount });
+    }
+    g_Data->Stats.ClusterCount += count;
+    g_Data->Stats.DrawnRanges += static_cast<uint32_t>(ranges.size());
+    return true;
+}
+
+/**
+ * @brief Reset the statistics of the cluster culling.
+ */
+void ClusterCulling::ResetStats()
+{
+    if (!g_Data)
+        return;
+
+    uint32_t threadCount = g_Data->Stats.ThreadCount;
+    g_Data->Stats = Statistics();
+    g_Data->Stats.ThreadCount = threadCount;
+}
+
+/**
+ * @brief Get the statistics of the cluster culling.
+ *
+ * @return The culling statistics.
+ */
+ClusterCulling::Statistics ClusterCulling::GetStats()
+{
+    return g_Data ? g_Data->Stats : Statistics();
+}
+
+} // namespace pixc
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Drawable/OpenGLDrawable.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Drawable/SoftwareDrawable.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Drawable/MetalDrawable.h"
 #endif
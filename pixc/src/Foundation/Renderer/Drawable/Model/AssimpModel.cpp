@@ -1,12 +1,103 @@
 #include "pixcpch.h"
 #include "Foundation/Renderer/Drawable/Model/AssimpModel.h"
 
+#include "Foundation/Core/Resources.h"
+
+#include "Foundation/Renderer/Animation/AnimationSystem.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <type_traits>
+#include <unordered_set>
+
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 namespace pixc {
 
+/// @brief Identifier and version of the cached mesh blobs.
+static const char g_MeshBlobMagic[4] = { 'P', 'X', 'M', 'B' };
+static const uint32_t g_MeshBlobVersion = 4;
+
+/// @brief Layout of the structures copied as raw bytes into the mesh blobs. A blob written with
+/// a different byte order or different structure sizes (other compiler or platform) is discarded.
+static const uint32_t g_MeshBlobLayout[] = {
+    0x01020304u,
+    sizeof(AssimpVertexData), sizeof(SkinVertexData), sizeof(MeshCluster),
+    sizeof(glm::vec3), sizeof(glm::quat), sizeof(glm::mat4)
+};
+
+static_assert(std::is_trivially_copyable_v<AssimpVertexData>, "Mesh blob vertices are copied as raw bytes");
+static_assert(std::is_trivially_copyable_v<SkinVertexData>, "Mesh blob skins are copied as raw bytes");
+static_assert(std::is_trivially_copyable_v<MeshCluster>, "Mesh blob clusters are copied as raw bytes");
+static_assert(std::is_trivially_copyable_v<glm::quat> && std::is_trivially_copyable_v<glm::mat4>,
+              "Mesh blob joints and keys are copied as raw bytes");
+
+/**
+ * @brief Convert an ASSIMP matrix (row major) into a glm matrix (column major).
+ *
+ * @param matrix The ASSIMP matrix.
+ *
+ * @return The glm matrix.
+ */
+static glm::mat4 ToMat4(const aiMatrix4x4& matrix)
+{
+    return glm::transpose(glm::make_mat4(&matrix.a1));
+}
+
+/**
+ * @brief Mark the nodes that are part of the skeleton: the bones and all their ancestors.
+ *
+ * @param node The current node.
+ * @param bones The names of the bones of the meshes.
+ * @param joints The names of the nodes of the skeleton.
+ *
+ * @return `true` if the node is part of the skeleton.
+ */
+static bool MarkJoints(const aiNode *node, const std::unordered_set<std::string>& bones,
+                       std::unordered_set<std::string>& joints)
+{
+    bool joint = bones.count(node->mName.C_Str()) > 0;
+    for (uint32_t i = 0; i < node->mNumChildren; i++)
+        joint |= MarkJoints(node->mChildren[i], bones, joints);
+
+    if (joint)
+        joints.insert(node->mName.C_Str());
+    return joint;
+}
+
+/**
+ * @brief Add the nodes of the skeleton to its joints (parents before their children).
+ *
+ * @param node The current node.
+ * @param parent The index of the parent joint.
+ * @param joints The names of the nodes of the skeleton.
+ * @param skeleton The skeleton.
+ */
+static void AddJoints(const aiNode *node, int32_t parent,
+                      const std::unordered_set<std::string>& joints, Skeleton& skeleton)
+{
+    if (!joints.count(node->mName.C_Str()))
+        return;
+
+    aiVector3D scale, translation;
+    aiQuaternion rotation;
+    node->mTransformation.Decompose(scale, rotation, translation);
+
+    Joint joint;
+    joint.Name = node->mName.C_Str();
+    joint.Parent = parent;
+    joint.Translation = glm::vec3(translation.x, translation.y, translation.z);
+    joint.Rotation = glm::quat(rotation.w, rotation.x, rotation.y, rotation.z);
+    joint.Scale = glm::vec3(scale.x, scale.y, scale.z);
+    skeleton.Joints.push_back(joint);
+
+    int32_t index = static_cast<int32_t>(skeleton.Joints.size()) - 1;
+    for (uint32_t i = 0; i < node->mNumChildren; i++)
+        AddJoints(node->mChildren[i], index, joints, skeleton);
+}
+
 /**
  * @brief Load the model from the specified file path.
  *
@@ -14,34 +105,204 @@ namespace pixc {
  */
 void AssimpModel::LoadModel(const std::filesystem::path &filePath)
 {
+    // Save the file path
+    this->m_FilePath = filePath;
+    
+    // Read the geometry (from the mesh cache if available) and define the meshes
+    AssimpModelData data = ReadModelData(filePath);
+    if (data.Meshes.empty())
+    {
+        // The model stays empty (nothing is drawn) instead of stopping the application
+        PIXEL_CORE_WARN("Error loading model: " + filePath.filename().string());
+        return;
+    }
+    DefineModel(data);
+}
+
+/**
+ * @brief Read the data (geometry, skeleton and animations) of a model file.
+ *
+ * The data is read from the cached mesh blob if it is up to date and valid; otherwise the file is
+ * imported with ASSIMP and the blob is (re)generated (if the mesh cache is enabled).
+ *
+ * @param filePath The path to the model file.
+ *
+ * @return The data of the model (without any mesh if the file could not be read).
+ *
+ * @note Only CPU data is touched, so it is safe to call this function from a worker thread.
+ */
+AssimpModelData AssimpModel::ReadModelData(const std::filesystem::path &filePath)
+{
+    AssimpModelData data;
+    if (LoadMeshBlob(filePath, data))
+        return data;
+    
     // Read the model file using the ASSIMP library
     Assimp::Importer importer;
-    const aiScene *scene = importer.ReadFile(filePath.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals);
+    const aiScene *scene = importer.ReadFile(filePath.string(), aiProcess_Triangulate |
+                                             aiProcess_GenSmoothNormals | aiProcess_LimitBoneWeights);
 
     // Check for error(s) during loading
     bool success = scene && scene->mRootNode &&
                     !(scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE);
-    PIXEL_CORE_ASSERT(success, "Error loading model with Assimp: " +
-                std::string(importer.GetErrorString()));
-
-    // Save the file path
-    this->m_FilePath = filePath;
+    if (!success)
+    {
+        PIXEL_CORE_WARN("Error loading model with Assimp: " + std::string(importer.GetErrorString()));
+        return data;
+    }
 
-    // Process ASSIMP's root node recursively
-    ProcessNode(scene->mRootNode, scene);
+    // Process the skeleton (if any), then ASSIMP's root node recursively
+    data.Rig = ProcessSkeleton(scene);
+    ProcessNode(scene->mRootNode, scene, data);
+    
+    // Process the animations of the skeleton
+    if (data.Rig)
+    {
+        for (uint32_t i = 0; i < scene->mNumAnimations; i++)
+            data.Animations.push_back(ProcessAnimation(scene->mAnimations[i], *data.Rig));
+    }
     importer.FreeScene();
     
+    // Split the large static meshes into clusters (the skinned ones move with their bones)
+    for (auto& mesh : data.Meshes)
+    {
+        if (!mesh.Skin.empty())
+            continue;
+        
+        std::vector<glm::vec3> positions;
+        positions.reserve(mesh.Vertices.size());
+        for (const auto& vertex : mesh.Vertices)
+            positions.emplace_back(vertex.position);
+        mesh.Clusters = ClusterCulling::BuildClusters(positions, mesh.Indices);
+    }
+    
+    // Cache the data for the next loads
+    SaveMeshBlob(filePath, data);
+    return data;
+}
+
+/**
+ * @brief Define the meshes of the model (GPU resources) and its animations from its data.
+ *
+ * @param data The data of the model.
+ */
+void AssimpModel::DefineModel(const AssimpModelData& data)
+{
+    BufferLayout layout = {
+        { "a_Position", { DataType::Vec4 } },
+        { "a_TextureCoord", { DataType::Vec2 } },
+        { "a_Normal", { DataType::Vec3 } }
+    };
+    BufferLayout skinLayout = {
+        { "a_BoneIDs", { DataType::Vec4 } },
+        { "a_BoneWeights", { DataType::Vec4 } }
+    };
+    
+    for (const auto& mesh : data.Meshes)
+    {
+        // Update its bounding box
+        for (const auto& vertex : mesh.Vertices)
+            this->UpdateBBoxWithVertex(vertex.position);
+        
+        this->m_Meshes.emplace_back(mesh.Vertices, mesh.Indices, layout);
+        
+        // The bone weights follow the vertex data (locations 3 and 4)
+        if (data.Rig && mesh.Skin.size() == mesh.Vertices.size())
+        {
+            this->m_Meshes.back().AddVertexStream(mesh.Skin, skinLayout);
+            continue;
+        }
+        
+        // Static meshes also carry their positions alone (depth and shadow passes)
+        std::vector<glm::vec3> positions;
+        positions.reserve(mesh.Vertices.size());
+        for (const auto& vertex : mesh.Vertices)
+            positions.emplace_back(vertex.position);
+        this->m_Meshes.back().DefinePositionStream(positions);
+        this->m_Meshes.back().SetClusters(mesh.Clusters);
+    }
+    
+    m_Skeleton = data.Rig;
+    m_Animations = data.Animations;
+    
     // Update the model matrix for the model
     this->UpdateModelMatrix();
 }
 
+/**
+ * @brief Draw the model using the specified transformation matrix (and its animator if defined).
+ *
+ * @param transform The transformation matrix for the model.
+ */
+void AssimpModel::DrawModelWithTransform(const glm::mat4 &transform)
+{
+    if (m_Animator)
+        DrawAnimated(*m_Animator, transform);
+    else
+        Model<AssimpVertexData>::DrawModelWithTransform(transform);
+}
+
+/**
+ * @brief Draw the model deformed by the pose of an animator.
+ *
+ * @param animator The animator (registered in the `AnimationSystem`).
+ * @param transform The transformation matrix for the model.
+ *
+ * @note The meshes must use a skinned shader variant (their `BoneBlock` is attached to the bone
+ * matrices binding point when the shader is created); the model is drawn in its bind pose
+ * otherwise.
+ */
+void AssimpModel::DrawAnimated(const Animator& animator, const glm::mat4 &transform)
+{
+    if (IsSkinned())
+        AnimationSystem::BindBoneMatrices(animator);
+    
+    Model<AssimpVertexData>::DrawModelWithTransform(transform);
+}
+
+/**
+ * @brief Create an animator for the skeleton of the model, updated by the `AnimationSystem`.
+ *
+ * @return The animator, or null if the model is not skinned.
+ */
+std::shared_ptr<Animator> AssimpModel::CreateAnimator() const
+{
+    if (!IsSkinned())
+    {
+        PIXEL_CORE_WARN("Model " + m_FilePath.filename().string() + " has no skeleton to be animated");
+        return nullptr;
+    }
+    
+    auto animator = std::make_shared<Animator>(m_Skeleton);
+    AnimationSystem::Register(animator);
+    return animator;
+}
+
+/**
+ * @brief Get an animation of the model by its name.
+ *
+ * @param name The name of the animation.
+ *
+ * @return The animation, or null if the model has no animation with this name.
+ */
+std::shared_ptr<AnimationClip> AssimpModel::GetAnimation(const std::string &name) const
+{
+    for (const auto& animation : m_Animations)
+    {
+        if (animation->Name == name)
+            return animation;
+    }
+    return nullptr;
+}
+
 /**
  * @brief Processes the nodes in the ASSIMP scene recursively.
  *
  * @param node The current node being processed.
  * @param scene The ASSIMP scene containing the model data.
+ * @param data The data of the model (the processed meshes are added).
  */
-void AssimpModel::ProcessNode(aiNode *node, const aiScene *scene)
+void AssimpModel::ProcessNode(aiNode *node, const aiScene *scene, AssimpModelData& data)
 {
     // Process all meshes inside each node
     for (size_t i = 0; i < node->mNumMeshes; i++)
@@ -49,33 +310,27 @@ void AssimpModel::ProcessNode(aiNode *node, const aiScene *scene)
         // The node object only contains indices to index the actual
         // objects in the scene. The scene contains all the data
         aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
-        this->m_Meshes.push_back(ProcessMesh(mesh));
+        data.Meshes.push_back(ProcessMesh(mesh, data.Rig.get()));
     }
 
     // Then do the same for each child node
     for (size_t i = 0; i < node->mNumChildren; i++)
     {
-        ProcessNode(node->mChildren[i], scene);
+        ProcessNode(node->mChildren[i], scene, data);
     }
 }
 
 /**
- * @brief Processes an ASSIMP mesh and creates a corresponding `Mesh` object.
+ * @brief Processes an ASSIMP mesh and extracts its geometry.
  *
  * @param mesh The ASSIMP mesh to be processed.
- * @return The processed `Mesh` object.
+ * @param skeleton The skeleton of the model (null if the model is not skinned).
+ * @return The geometry of the mesh.
  */
-Mesh<AssimpVertexData> AssimpModel::ProcessMesh(aiMesh *mesh)
+AssimpMeshData AssimpModel::ProcessMesh(aiMesh *mesh, const Skeleton* skeleton)
 {
-    // Mesh attributes
-    // -----------------------
-    std::vector<AssimpVertexData> vertices;
-    std::vector<uint32_t> indices;
-    BufferLayout layout = {
-        { "a_Position", { DataType::Vec4 } },
-        { "a_TextureCoord", { DataType::Vec2 } },
-        { "a_Normal", { DataType::Vec3 } }
-    };
+    AssimpMeshData data;
+    data.Vertices.reserve(mesh->mNumVertices);
     
     // Process the vertex data
     // -----------------------
@@ -107,9 +362,7 @@ Mesh<AssimpVertexData> AssimpModel::ProcessMesh(aiMesh *mesh)
             vertex.normal.z = mesh->mNormals[i].z;
         }
         // Define the vertex of the model
-        vertices.push_back(vertex);
-        // Update its bounding box
-        this->UpdateBBoxWithVertex(vertex.position);
+        data.Vertices.push_back(vertex);
     }
     
     // Process indices
@@ -120,10 +373,456 @@ Mesh<AssimpVertexData> AssimpModel::ProcessMesh(aiMesh *mesh)
         // the corresponding vertex indices
         aiFace face = mesh->mFaces[i];
         for (size_t j = 0; j < face.mNumIndices; j++)
-            indices.push_back(face.mIndices[j]);
+            data.Indices.push_back(face.mIndices[j]);
+    }
+    
+    // Process bone weights
+    // -----------------------
+    if (!skeleton)
+        return data;
+    
+    data.Skin.resize(mesh->mNumVertices);
+    for (size_t i = 0; i < mesh->mNumBones; i++)
+    {
+        const aiBone *bone = mesh->mBones[i];
+        int32_t joint = skeleton->FindJoint(bone->mName.C_Str());
+        if (joint < 0)
+            continue;
+        
+        for (size_t j = 0; j < bone->mNumWeights; j++)
+        {
+            const aiVertexWeight& weight = bone->mWeights[j];
+            if (weight.mVertexId >= data.Skin.size())
+                continue;
+            
+            // Keep the strongest influences
+            auto& skin = data.Skin[weight.mVertexId];
+            uint32_t slot = 0;
+            for (uint32_t k = 1; k < MaxBoneInfluences; k++)
+            {
+                if (skin.weights[k] < skin.weights[slot])
+                    slot = k;
+            }
+            if (weight.mWeight > skin.weights[slot])
+            {
+                skin.joints[slot] = static_cast<float>(joint);
+                skin.weights[slot] = weight.mWeight;
+            }
+        }
+    }
+    
+    // Normalize the weights (the vertices without influences follow the root joint)
+    for (auto& skin : data.Skin)
+    {
+        float sum = skin.weights.x + skin.weights.y + skin.weights.z + skin.weights.w;
+        if (sum > 0.0f)
+            skin.weights /= sum;
+        else
+            skin.weights = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
     }
     
-    return Mesh<AssimpVertexData>(vertices, indices, layout);
+    return data;
+}
+
+/**
+ * @brief Build the skeleton deforming the meshes of an ASSIMP scene.
+ *
+ * The skeleton contains the bones of all the meshes and their ancestors (whose transformation
+ * also affects the bones).
+ *
+ * @param scene The ASSIMP scene containing the model data.
+ * @return The skeleton, or null if none of the meshes has bones.
+ */
+std::shared_ptr<Skeleton> AssimpModel::ProcessSkeleton(const aiScene *scene)
+{
+    // Gather the bones of all the meshes
+    std::unordered_set<std::string> bones;
+    std::unordered_map<std::string, glm::mat4> offsets;
+    for (uint32_t i = 0; i < scene->mNumMeshes; i++)
+    {
+        const aiMesh *mesh = scene->mMeshes[i];
+        for (uint32_t j = 0; j < mesh->mNumBones; j++)
+        {
+            bones.insert(mesh->mBones[j]->mName.C_Str());
+            offsets[mesh->mBones[j]->mName.C_Str()] = ToMat4(mesh->mBones[j]->mOffsetMatrix);
+        }
+    }
+    if (bones.empty())
+        return nullptr;
+    
+    // Define the joints from the node hierarchy
+    std::unordered_set<std::string> joints;
+    MarkJoints(scene->mRootNode, bones, joints);
+    
+    auto skeleton = std::make_shared<Skeleton>();
+    AddJoints(scene->mRootNode, -1, joints, *skeleton);
+    for (auto& joint : skeleton->Joints)
+    {
+        auto it = offsets.find(joint.Name);
+        if (it != offsets.end())
+            joint.Offset = it->second;
+    }
+    skeleton->GlobalInverse = glm::inverse(ToMat4(scene->mRootNode->mTransformation));
+    
+    if (skeleton->GetJointCount() > MaxSkeletonJoints)
+        PIXEL_CORE_WARN("Skeleton with {0} joints, only {1} joints are supported for skinning",
+                        skeleton->GetJointCount(), MaxSkeletonJoints);
+    return skeleton;
+}
+
+/**
+ * @brief Processes an ASSIMP animation and extracts its keyframes.
+ *
+ * @param animation The ASSIMP animation to be processed.
+ * @param skeleton The skeleton animated.
+ * @return The animation (the channels of the nodes outside of the skeleton are ignored).
+ */
+std::shared_ptr<AnimationClip> AssimpModel::ProcessAnimation(aiAnimation *animation,
+                                                             const Skeleton& skeleton)
+{
+    // The keys are defined in ticks (25 ticks per second if not defined)
+    float ticksPerSecond = animation->mTicksPerSecond > 0.0 ? (float)animation->mTicksPerSecond : 25.0f;
+    
+    auto clip = std::make_shared<AnimationClip>();
+    clip->Name = animation->mName.C_Str();
+    clip->Duration = (float)animation->mDuration / ticksPerSecond;
+    
+    for (uint32_t i = 0; i < animation->mNumChannels; i++)
+    {
+        const aiNodeAnim *node = animation->mChannels[i];
+        int32_t joint = skeleton.FindJoint(node->mNodeName.C_Str());
+        if (joint < 0)
+            continue;
+        
+        AnimationChannel channel;
+        channel.Joint = static_cast<uint32_t>(joint);
+        for (uint32_t k = 0; k < node->mNumPositionKeys; k++)
+        {
+            const auto& key = node->mPositionKeys[k];
+            channel.TranslationTimes.push_back((float)key.mTime / ticksPerSecond);
+            channel.Translations.emplace_back(key.mValue.x, key.mValue.y, key.mValue.z);
+        }
+        for (uint32_t k = 0; k < node->mNumRotationKeys; k++)
+        {
+            const auto& key = node->mRotationKeys[k];
+            channel.RotationTimes.push_back((float)key.mTime / ticksPerSecond);
+            channel.Rotations.emplace_back(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z);
+        }
+        for (uint32_t k = 0; k < node->mNumScalingKeys; k++)
+        {
+            const auto& key = node->mScalingKeys[k];
+            channel.ScaleTimes.push_back((float)key.mTime / ticksPerSecond);
+            channel.Scales.emplace_back(key.mValue.x, key.mValue.y, key.mValue.z);
+        }
+        clip->Channels.push_back(std::move(channel));
+    }
+    return clip;
+}
+
+/**
+ * @brief Define the directory where the geometry of the model files is cached.
+ *
+ * @param directory The cache directory (empty to disable the mesh cache, the default).
+ *
+ * @note The directory is the cache directory of the resources, shared with the font atlases (see
+ * `ResourcesManager::SetCachePath()`).
+ */
+void AssimpModel::SetCacheDirectory(const std::filesystem::path& directory)
+{
+    ResourcesManager::SetCachePath(directory);
+}
+
+/**
+ * @brief Get the path of the mesh blob where the geometry of a model file is cached.
+ *
+ * The name of the blob includes a hash of the absolute model path, so that models with the same
+ * file name in different directories do not share their blob.
+ *
+ * @param filePath The path to the model file.
+ *
+ * @return The mesh blob path, or an empty path if the mesh cache is disabled.
+ */
+std::filesystem::path AssimpModel::GetCachePath(const std::filesystem::path& filePath)
+{
+    std::filesystem::path directory = ResourcesManager::GetCachePath();
+    if (directory.empty())
+        return {};
+    
+    std::error_code error;
+    std::filesystem::path absolutePath = std::filesystem::absolute(filePath, error);
+    if (error)
+        absolutePath = filePath;
+    
+    std::stringstream name;
+    name << filePath.stem().string() << "." << std::hex
+         << std::hash<std::string>{}(absolutePath.lexically_normal().string()) << ".pxmesh";
+    return directory / name.str();
+}
+
+/**
+ * @brief Check that the data read from a mesh blob is consistent (indices within their ranges).
+ *
+ * @param data The data of the model.
+ *
+ * @return `true` if the data can be safely used to define the model.
+ */
+static bool IsValidModelData(const AssimpModelData& data)
+{
+    for (const auto& mesh : data.Meshes)
+    {
+        if (!mesh.Skin.empty() && mesh.Skin.size() != mesh.Vertices.size())
+            return false;
+        for (uint32_t index : mesh.Indices)
+        {
+            if (index >= mesh.Vertices.size())
+                return false;
+        }
+        for (const auto& cluster : mesh.Clusters)
+        {
+            if (uint64_t(cluster.IndexOffset) + cluster.IndexCount > mesh.Indices.size())
+                return false;
+        }
+    }
+    
+    if (!data.Rig)
+        return true;
+    
+    // The parents are stored before their children
+    const auto& joints = data.Rig->Joints;
+    for (size_t i = 0; i < joints.size(); i++)
+    {
+        if (joints[i].Parent < -1 || joints[i].Parent >= static_cast<int32_t>(i))
+            return false;
+    }
+    for (const auto& clip : data.Animations)
+    {
+        for (const auto& channel : clip->Channels)
+        {
+            if (channel.Joint >= joints.size())
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Read the data of a model from its mesh blob.
+ *
+ * @param filePath The path to the model file.
+ * @param data The data of the model.
+ *
+ * @return `true` if the blob exists, is valid and is up to date with the model file.
+ *
+ * @note A missing, outdated or corrupted blob is not an error: the model is imported again.
+ */
+bool AssimpModel::LoadMeshBlob(const std::filesystem::path& filePath, AssimpModelData& data)
+{
+    std::filesystem::path cachePath = GetCachePath(filePath);
+    if (cachePath.empty())
+        return false;
+    
+    // Verify that the blob is more recent than the model file
+    std::error_code error;
+    auto cacheTime = std::filesystem::last_write_time(cachePath, error);
+    if (error)
+        return false;
+    auto fileTime = std::filesystem::last_write_time(filePath, error);
+    if (!error && fileTime > cacheTime)
+        return false;
+    uintmax_t fileSize = std::filesystem::file_size(cachePath, error);
+    if (error)
+        return false;
+    
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    
+    auto read = [&file](auto& value) {
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    };
+    // The sizes are checked against the blob size before any allocation
+    auto readVector = [&file, &read, fileSize](auto& vector) {
+        uint32_t count = 0;
+        read(count);
+        if (file && uintmax_t(count) * sizeof(vector[0]) > fileSize)
+            file.setstate(std::ios::failbit);
+        if (!file)
+            return;
+        vector.resize(count);
+        file.read(reinterpret_cast<char*>(vector.data()), count * sizeof(vector[0]));
+    };
+    auto readString = [&file, &read, fileSize](std::string& string) {
+        uint32_t length = 0;
+        read(length);
+        if (file && length > fileSize)
+            file.setstate(std::ios::failbit);
+        if (!file)
+            return;
+        string.resize(length);
+        file.read(string.data(), length);
+    };
+    
+    // Validate the header (identifier, version and layout of the raw structures)
+    char magic[4];
+    uint32_t version, meshCount;
+    uint32_t layout[std::size(g_MeshBlobLayout)] = {};
+    file.read(magic, sizeof(magic));
+    read(version);
+    read(layout);
+    read(meshCount);
+    if (!file || memcmp(magic, g_MeshBlobMagic, sizeof(magic)) != 0 || version != g_MeshBlobVersion
+        || memcmp(layout, g_MeshBlobLayout, sizeof(layout)) != 0 || meshCount > fileSize)
+        return false;
+    
+    // Read the geometry of each mesh
+    data.Meshes.resize(meshCount);
+    for (auto& mesh : data.Meshes)
+    {
+        readVector(mesh.Vertices);
+        readVector(mesh.Indices);
+        readVector(mesh.Skin);
+        readVector(mesh.Clusters);
+        if (!file)
+            break;
+    }
+    
+    // Read the skeleton and its animations
+    uint32_t jointCount = 0;
+    read(jointCount);
+    if (jointCount > fileSize)
+        file.setstate(std::ios::failbit);
+    if (file && jointCount > 0)
+    {
+        data.Rig = std::make_shared<Skeleton>();
+        data.Rig->Joints.resize(jointCount);
+        for (auto& joint : data.Rig->Joints)
+        {
+            readString(joint.Name);
+            read(joint.Parent);
+            read(joint.Offset);
+            read(joint.Translation);
+            read(joint.Rotation);
+            read(joint.Scale);
+        }
+        read(data.Rig->GlobalInverse);
+        
+        uint32_t animationCount = 0;
+        read(animationCount);
+        for (uint32_t i = 0; file && i < animationCount; i++)
+        {
+            auto clip = std::make_shared<AnimationClip>();
+            readString(clip->Name);
+            read(clip->Duration);
+            
+            uint32_t channelCount = 0;
+            read(channelCount);
+            if (channelCount > fileSize)
+                file.setstate(std::ios::failbit);
+            clip->Channels.resize(file ? channelCount : 0);
+            for (auto& channel : clip->Channels)
+            {
+                read(channel.Joint);
+                readVector(channel.TranslationTimes);
+                readVector(channel.Translations);
+                readVector(channel.RotationTimes);
+                readVector(channel.Rotations);
+                readVector(channel.ScaleTimes);
+                readVector(channel.Scales);
+            }
+            data.Animations.push_back(clip);
+        }
+    }
+    
+    if (!file || !IsValidModelData(data))
+    {
+        PIXEL_CORE_WARN("Invalid mesh cache of " + filePath.filename().string() + ", importing the model again");
+        data = AssimpModelData();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Write the data of a model into its mesh blob.
+ *
+ * @param filePath The path to the model file.
+ * @param data The data of the model.
+ */
+void AssimpModel::SaveMeshBlob(const std::filesystem::path& filePath, const AssimpModelData& data)
+{
+    std::filesystem::path cachePath = GetCachePath(filePath);
+    if (cachePath.empty())
+        return;
+    
+    std::error_code error;
+    std::filesystem::create_directories(cachePath.parent_path(), error);
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_WARN("Unable to cache the geometry of " + filePath.filename().string());
+        return;
+    }
+    
+    auto write = [&file](const auto& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto writeVector = [&file, &write](const auto& vector) {
+        write(static_cast<uint32_t>(vector.size()));
+        file.write(reinterpret_cast<const char*>(vector.data()), vector.size() * sizeof(vector[0]));
+    };
+    auto writeString = [&file, &write](const std::string& string) {
+        write(static_cast<uint32_t>(string.size()));
+        file.write(string.data(), string.size());
+    };
+    
+    // Header
+    file.write(g_MeshBlobMagic, sizeof(g_MeshBlobMagic));
+    write(g_MeshBlobVersion);
+    write(g_MeshBlobLayout);
+    write(static_cast<uint32_t>(data.Meshes.size()));
+    
+    // Geometry of each mesh
+    for (const auto& mesh : data.Meshes)
+    {
+        writeVector(mesh.Vertices);
+        writeVector(mesh.Indices);
+        writeVector(mesh.Skin);
+        writeVector(mesh.Clusters);
+    }
+    
+    // Skeleton and animations
+    write(data.Rig ? data.Rig->GetJointCount() : 0u);
+    if (!data.Rig)
+        return;
+    
+    for (const auto& joint : data.Rig->Joints)
+    {
+        writeString(joint.Name);
+        write(joint.Parent);
+        write(joint.Offset);
+        write(joint.Translation);
+        write(joint.Rotation);
+        write(joint.Scale);
+    }
+    write(data.Rig->GlobalInverse);
+    
+    write(static_cast<uint32_t>(data.Animations.size()));
+    for (const auto& clip : data.Animations)
+    {
+        writeString(clip->Name);
+        write(clip->Duration);
+        write(static_cast<uint32_t>(clip->Channels.size()));
+        for (const auto& channel : clip->Channels)
+        {
+            write(channel.Joint);
+            writeVector(channel.TranslationTimes);
+            writeVector(channel.Translations);
+            writeVector(channel.RotationTimes);
+            writeVector(channel.Rotations);
+            writeVector(channel.ScaleTimes);
+            writeVector(channel.Scales);
+        }
+    }
 }
 
 } // namespace pixc
@@ -0,0 +1,274 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/FrameSync.h"
+
+#include "Foundation/Core/Timer.h"
+
+#include "Foundation/Renderer/Query/Fence.h"
+
+namespace pixc {
+
+/**
+ * @brief Represents a frame issued to the GPU.
+ */
+struct FrameRecord
+{
+    std::shared_ptr<Fence> Fence;       ///< Fence inserted at the end of the frame.
+    uint64_t Frame = 0;                 ///< Index of the frame.
+    float IssueTime = 0.0f;             ///< Time the frame ended on the CPU (s).
+    bool Pending = false;               ///< The frame is not known to be complete yet.
+};
+
+/**
+ * @brief Represents the state of the frame synchronization.
+ */
+struct FrameSyncData
+{
+    ///< Number of frames in flight allowed.
+    uint32_t FramesInFlight = 2;
+    ///< Index of the frame being recorded, and of the last frame known to be complete.
+    uint64_t Frame = 0;
+    uint64_t Completed = 0;
+    bool AnyCompleted = false;
+    
+    ///< Frames issued (by slot).
+    std::array<FrameRecord, FrameSync::MaxFramesInFlight> Records;
+    
+    ///< Clock of the measures.
+    Timer Clock;
+    ///< Timings accumulated over the current second (ms), and number of frames measured.
+    double WaitTime = 0.0;
+    double Latency = 0.0;
+    uint32_t WaitedFrames = 0;
+    uint32_t CompletedFrames = 0;
+    float SecondStart = 0.0f;
+    ///< Measures of the last second.
+    FrameSync::Statistics Stats;
+};
+
+static std::unique_ptr<FrameSyncData> g_Data;
+
+/**
+ * @brief Wait for the GPU to complete the frames issued, and release the fences.
+ */
+void FrameSync::Shutdown()
+{
+    if (!g_Data)
+        return;
+    
+    for (auto& record : g_Data->Records)
+    {
+        if (record.Pending && record.Fence)
+            record.Fence->Wait();
+    }
+    g_Data.reset();
+}
+
+/**
+ * @brief Start recording a new frame.
+ *
+ * Waits until the GPU completed the frame issued `N` frames earlier (`N` being the number of
+ * frames in flight), so its slot can be written again.
+ */
+void FrameSync::BeginFrame()
+{
+    if (!g_Data)
+        g_Data = std::make_unique<FrameSyncData>();
+    
+    CollectCompleted();
+    
+    const uint64_t frame = g_Data->Frame;
+    if (frame < g_Data->FramesInFlight)
+        return;
+    
+    Timer timer;
+    WaitForFrame(frame - g_Data->FramesInFlight);
+    g_Data->WaitTime += timer.ElapsedMilliseconds();
+    g_Data->WaitedFrames++;
+}
+
+/**
+ * @brief End the recording of the current frame (inserts its fence).
+ */
+void FrameSync::EndFrame()
+{
+    if (!g_Data)
+        return;
+    
+    auto& record = g_Data->Records[GetSlot()];
+    record.Fence = Fence::Create();
+    record.Frame = g_Data->Frame;
+    record.IssueTime = g_Data->Clock.Elapsed();
+    record.Pending = true;
+    
+    g_Data->Frame++;
+}
+
+/**
+ * @brief Check if the GPU completed a frame (never waits).
+ *
+ * @param frame The index of the frame.
+ *
+ * @return `true` if the frame is complete.
+ */
+bool FrameSync::IsFrameComplete(uint64_t frame)
+{
+    if (!g_Data)
+        return true;
+    if (frame >= g_Data->Frame)
+        return false;
+    
+    CollectCompleted();
+    if (g_Data->AnyCompleted && frame <= g_Data->Completed)
+        return true;
+    
+    // The slot of a frame older than the ones in flight has already been waited for
+    const auto& record = g_Data->Records[frame % MaxFramesInFlight];
+    return record.Frame != frame || !record.Pending;
+}
+
+/**
+ * @brief Wait until the GPU completed a frame (e.g., `GetFrame() - k` for the frame issued `k`
+ * frames earlier).
+ *
+ * @param frame The index of the frame.
+ */
+void FrameSync::WaitForFrame(uint64_t frame)
+{
+    if (!g_Data)
+        return;
+    
+    // The frame being recorded has no fence yet
+    PIXEL_CORE_ASSERT(frame < g_Data->Frame, "Cannot wait for a frame not issued yet!");
+    if (IsFrameComplete(frame))
+        return;
+    
+    // The frames complete in order: waiting for the fence of the frame is enough
+    auto& record = g_Data->Records[frame % MaxFramesInFlight];
+    if (record.Fence)
+        record.Fence->Wait();
+    CollectCompleted();
+}
+
+/**
+ * @brief Get the index of the frame being recorded.
+ *
+ * @return The frame index (the number of frames issued so far).
+ */
+uint64_t FrameSync::GetFrame()
+{
+    return g_Data ? g_Data->Frame : 0;
+}
+
+/**
+ * @brief Get the slot of the dynamic resources written by the frame being recorded.
+ *
+ * @return The slot, smaller than `MaxFramesInFlight`.
+ */
+uint32_t FrameSync::GetSlot()
+{
+    return static_cast<uint32_t>(GetFrame() % MaxFramesInFlight);
+}
+
+/**
+ * @brief Get the number of frames the CPU can record ahead of the GPU.
+ *
+ * @return The number of frames in flight.
+ */
+uint32_t FrameSync::GetFramesInFlight()
+{
+    return g_Data ? g_Data->FramesInFlight : 2;
+}
+
+/**
+ * @brief Set the number of frames the CPU can record ahead of the GPU (1 for the lowest latency,
+ * up to `MaxFramesInFlight` for the highest throughput).
+ *
+ * @param count The number of frames in flight.
+ */
+void FrameSync::SetFramesInFlight(uint32_t count)
+{
+    if (!g_Data)
+        g_Data = std::make_unique<FrameSyncData>();
+    
+    if (count < 1 || count > MaxFramesInFlight)
+        PIXEL_CORE_WARN("Frames in flight must be between 1 and {0}!", MaxFramesInFlight);
+    g_Data->FramesInFlight = std::clamp(count, 1u, MaxFramesInFlight);
+}
+
+/**
+ * @brief Reset the measures of the synchronization.
+ */
+void FrameSync::ResetStats()
+{
+    if (!g_Data)
+        return;
+    
+    g_Data->WaitTime = g_Data->Latency = 0.0;
+    g_Data->WaitedFrames = g_Data->CompletedFrames = 0;
+    g_Data->SecondStart = g_Data->Clock.Elapsed();
+    g_Data->Stats = Statistics();
+}
+
+/**
+ * @brief Get the measures of the synchronization.
+ *
+ * @return The statistics, averaged over the last second.
+ */
+FrameSync::Statistics FrameSync::GetStats()
+{
+    if (!g_Data)
+        return Statistics();
+    
+    Statistics stats = g_Data->Stats;
+    stats.FramesInFlight = 0;
+    for (const auto& record : g_Data->Records)
+        stats.FramesInFlight += record.Pending ? 1 : 0;
+    return stats;
+}
+
+/**
+ * @brief Poll the fences of the frames in flight (in order), and measure the frames completed.
+ *
+ * @note The latency is measured when the completion is noticed, at most a frame late when the
+ *       frames are not waited for.
+ */
+void FrameSync::CollectCompleted()
+{
+    const float now = g_Data->Clock.Elapsed();
+    for (uint32_t i = 0; i < MaxFramesInFlight; i++)
+    {
+        // Oldest frame first (the frames complete in order)
+        const uint64_t frame = g_Data->Frame + i;
+        auto& record = g_Data->Records[frame % MaxFramesInFlight];
+        if (!record.Pending)
+            continue;
+        if (record.Fence && !record.Fence->IsSignaled())
+            break;
+        
+        record.Pending = false;
+        record.Fence.reset();
+        g_Data->Completed = record.Frame;
+        g_Data->AnyCompleted = true;
+        
+        g_Data->Latency += (now - record.IssueTime) * 1000.0;
+        g_Data->CompletedFrames++;
+    }
+    
+    // Publish the measures of the last second
+    const float elapsed = now - g_Data->SecondStart;
+    if (elapsed < 1.0f)
+        return;
+    
+    auto& stats = g_Data->Stats;
+    stats.FramesPerSecond = g_Data->CompletedFrames / elapsed;
+    stats.Latency = g_Data->CompletedFrames > 0 ?
+        static_cast<float>(g_Data->Latency / g_Data->CompletedFrames) : 0.0f;
+    stats.WaitTime = g_Data->WaitedFrames > 0 ?
+        static_cast<float>(g_Data->WaitTime / g_Data->WaitedFrames) : 0.0f;
+    
+    g_Data->WaitTime = g_Data->Latency = 0.0;
+    g_Data->WaitedFrames = g_Data->CompletedFrames = 0;
+    g_Data->SecondStart = now;
+}
+
+} // namespace pixc
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/SoftwareContext.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/MetalContext.h"
 #endif
@@ -56,6 +59,12 @@ void GraphicsContext::SetWindowHints()
              MetalContext::SetWindowHints();
              return;
          #endif
+         
+         #ifdef PIXC_SOFTWARE_RENDERER
+         case RendererAPI::API::Software:
+             SoftwareContext::SetWindowHints();
+             return;
+         #endif
      }
      
      PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");
@@ -1,6 +1,8 @@
 #include "pixcpch.h"
 #include "Foundation/Renderer/Light/Environment/EnvironmentLight.h"
 
+#include "Foundation/Core/RenderThread.h"
+
 #include "Foundation/Renderer/Material/UnlitMaterial.h"
 
 #include "Foundation/Renderer/Drawable/Mesh/MeshUtils.h"
@@ -9,6 +11,26 @@
 
 namespace pixc {
 
+/// Number of faces of the environment cube map (one baking step each).
+static constexpr uint32_t g_CubeFaceCount = 6;
+
+/**
+ * @brief Check if the background can be drawn from a single triangle covering the screen (the
+ * API draws without vertex data, and reads the GLSL shaders).
+ *
+ * @return `true` if the fullscreen background is supported.
+ */
+static bool IsFullscreenBackgroundSupported()
+{
+    switch (RendererAPI::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /**
  * @brief Construct an environment ligth in the scene.
  *
@@ -46,10 +68,10 @@ void EnvironmentLight::SetupFrameBuffers(const uint32_t size)
 
     // Define the attachments:
     // - A cubemap texture for storing the environment map (RGB16F for high dynamic range)
-    // - A 2D depth texture to use as the depth buffer (DEPTH24)
+    // - A 2D depth texture to use as the depth buffer (DEPTH24, or DEPTH32F if the depth is reversed)
     spec.AttachmentsSpec = {
         { TextureType::TEXTURECUBE, TextureFormat::RGB16F },
-        { TextureType::TEXTURE2D, TextureFormat::DEPTH24 }
+        { TextureType::TEXTURE2D, RendererAPI::GetDepthFormat(TextureFormat::DEPTH24) }
     };
 
     // Enable mipmap generation for the environment cubemap
@@ -111,19 +133,36 @@ void EnvironmentLight::SetupResources()
 /**
  * Change the environment map.
  *
+ * The new environment is baked over the next frames (see `Update()`), the current one is used
+ * until then. Removing the environment map takes effect right away (from the next frame drawn).
+ * When the frames are drawn on the render thread, the change is handed over to it.
+ *
  * @param texture The texture to be used as the environment map.
  */
 void EnvironmentLight::SetEnvironmentMap(const std::shared_ptr<Texture>& texture)
 {
-    // Save the information of the environment map
-    m_EnvironmentMap = texture;
+    // The baking state is only modified by the thread drawing the frames
+    if (RenderThread::IsRunning() && !RenderThread::IsRenderThread())
+    {
+        RenderThread::Enqueue([light = weak_from_this(), texture]()
+        {
+            if (auto environment = light.lock())
+                environment->SetEnvironmentMap(texture);
+        });
+        return;
+    }
     
-    // Check for a valid texture
+    // Check for a valid texture (any baking in progress is abandoned)
     if (!texture)
+    {
+        m_EnvironmentMap = nullptr;
+        m_Bake = BakeState();
+        m_BakeProgress = 1.0f;
         return;
+    }
     
-    // Update the environment information
-    UpdateEnvironment();
+    // Bake the environment information
+    BeginBake(texture);
 }
 
 /**
@@ -182,10 +221,137 @@ void EnvironmentLight::DrawLight()
 }
 
 /**
- * Updates the environment lighting information.
+ * @brief Renders the environment as the background of the scene.
+ *
+ * To be drawn after the opaque models: a single triangle covering the screen is placed on the far
+ * plane, and the view direction of each pixel is reconstructed from the camera of the scene. The
+ * depth test (less or equal) then rejects the pixels covered by the models before they are
+ * shaded. The depth buffer is not modified.
+ *
+ * The APIs without vertex-less draws render the cube model instead (also on the far plane).
+ */
+void EnvironmentLight::DrawBackground()
+{
+    if (!(m_Model && m_EnvironmentMap))
+        return;
+    
+    auto environment = m_FrameBuffers.Get("Environment")->GetColorAttachment(0);
+    
+    RendererCommand::ConfigureDepthTesting(true, DepthFunction::LEqual);
+    RendererCommand::EnableDepthWriting(false);
+    
+    if (IsFullscreenBackgroundSupported())
+    {
+        auto& materialLibrary = Renderer::GetMaterialLibrary();
+        if (!materialLibrary.Exists("Background"))
+        {
+            materialLibrary.Create<TextureMaterial>("Background",
+                                                    "pixc/shaders/environment/Background");
+        }
+        auto material = std::dynamic_pointer_cast<TextureMaterial>(materialLibrary.Get("Background"));
+        material->SetTextureMap(environment);
+        
+        // Map the screen positions to the view directions in world space (from the scale and the
+        // offset of the projection, any depth convention or far plane)
+        const glm::mat4& projection = Renderer::GetProjectionMatrix();
+        glm::mat3 rays = glm::mat3(1.0f);
+        rays[0] = glm::vec3(1.0f / projection[0][0], 0.0f, 0.0f);
+        rays[1] = glm::vec3(0.0f, 1.0f / projection[1][1], 0.0f);
+        rays[2] = glm::vec3(projection[2][0] / projection[0][0], projection[2][1] / projection[1][1], -1.0f);
+        rays = glm::transpose(glm::mat3(Renderer::GetViewMatrix())) * rays;
+        
+        material->Bind();
+        material->GetShader()->SetMat4("u_Background.Rays", glm::mat4(rays));
+        RendererCommand::DrawFullscreen();
+        material->Unbind();
+    }
+    else
+    {
+        auto material = std::dynamic_pointer_cast<TextureMaterial>(Renderer::GetMaterialLibrary().Get("CubeMap"));
+        material->SetTextureMap(environment);
+        
+        m_Model->SetMaterial(material);
+        m_Model->DrawModel();
+    }
+    
+    RendererCommand::EnableDepthWriting(true);
+    RendererCommand::SetDepthFunction(DepthFunction::Less);
+}
+
+/**
+ * @brief Bake a part of the environment map being changed, if any.
+ *
+ * Up to the number of steps per frame are processed. A step waiting for the GPU is processed
+ * again on the next frame. Once all the steps are done,
+ * the new environment replaces the previous one.
+ */
+void EnvironmentLight::Update()
+{
+    if (!m_Bake.Source)
+        return;
+    
+    const uint32_t count = GetBakeStepCount();
+    uint32_t steps = 0;
+    while (m_Bake.Step < count && (m_BakeStepsPerFrame == 0 || steps < m_BakeStepsPerFrame))
+    {
+        if (!BakeStep(m_Bake.Step))
+            break;
+        
+        m_Bake.Step++;
+        steps++;
+    }
+    
+    if (m_Bake.Step == count)
+        FinishBake();
+    else
+        m_BakeProgress = static_cast<float>(m_Bake.Step) / static_cast<float>(count);
+}
+
+/**
+ * @brief Start baking an environment map (restarts the baking in progress, if any).
+ *
+ * The cube map is rendered into a separate framebuffer while an environment is in use. Otherwise,
+ * it is rendered directly into the environment framebuffer.
+ *
+ * @param texture The environment map to be baked.
  */
-void EnvironmentLight::UpdateEnvironment()
+void EnvironmentLight::BeginBake(const std::shared_ptr<Texture>& texture)
 {
+    m_Bake.Source = texture;
+    m_Bake.Step = 0;
+    m_BakeProgress = 0.0f;
+    
+    if (!m_Bake.Target)
+    {
+        auto& environment = m_FrameBuffers.Get("Environment");
+        m_Bake.Target = m_EnvironmentMap ? FrameBuffer::Create(environment->GetSpec()) : environment;
+    }
+}
+
+/**
+ * @brief Get the number of steps to bake an environment map.
+ *
+ * @return The number of steps (one per face of the cube map).
+ */
+uint32_t EnvironmentLight::GetBakeStepCount() const
+{
+    return g_CubeFaceCount;
+}
+
+/**
+ * @brief Process a step of the baking of the environment map.
+ *
+ * Each step renders a face of the cube map, the mipmaps are generated with the last one.
+ *
+ * @param step The index of the step.
+ *
+ * @return `true` if the step is done, `false` if it has to be processed again (next frame).
+ */
+bool EnvironmentLight::BakeStep(const uint32_t step)
+{
+    if (step >= g_CubeFaceCount)
+        return true;
+    
     // Define a cubemap to be rendered
     auto cubemap = utils::cubemap::BuildCubeMap(RendererAPI::GetAPI());
     // Apply rotation to the view matrices of the cubemap
@@ -196,10 +362,11 @@ void EnvironmentLight::UpdateEnvironment()
     auto& materialLibrary = Renderer::GetMaterialLibrary();
     // Update the current texture representing the environment map
     auto material = std::dynamic_pointer_cast<TextureMaterial>(materialLibrary.Get("EquirectangularMap"));
-    material->SetTextureMap(m_EnvironmentMap);
+    material->SetTextureMap(m_Bake.Source);
     
-    // Render the environment map into a cube map configuration
-    utils::cubemap::RenderCubeMap(cubemap, m_Model, material, m_FrameBuffers.Get("Environment"));
+    // Render the environment map into the face of the cube map
+    utils::cubemap::RenderCubeMapFace(cubemap, step, m_Model, material, m_Bake.Target,
+                                      0, 0, 0, step == g_CubeFaceCount - 1);
     
     // TODO: remove this and set it into another function. Make the static variables an enumeration.
     /*
@@ -225,6 +392,22 @@ void EnvironmentLight::UpdateEnvironment()
      mipWidth, mipHeight, mip, false);
      }
      */
+    
+    return true;
+}
+
+/**
+ * @brief Replace the environment in use with the one baked.
+ *
+ * The previous cube map is released (a new one is created for the next baking).
+ */
+void EnvironmentLight::FinishBake()
+{
+    m_FrameBuffers.Get("Environment") = m_Bake.Target;
+    m_EnvironmentMap = m_Bake.Source;
+    
+    m_Bake = BakeState();
+    m_BakeProgress = 1.0f;
 }
 
 } // namespace pixc
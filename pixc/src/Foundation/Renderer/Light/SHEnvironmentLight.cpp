@@ -10,6 +10,16 @@
 
 namespace pixc {
 
+/// Maximum resolution of the cube map faces projected by the compute pass (a lower mip level
+/// of the environment map is sampled for larger maps).
+static constexpr uint32_t g_MaxProjectionSize = 128;
+/// Size of the tiles of a face projected by a work group (`SHProjection` shader).
+static constexpr uint32_t g_ProjectionTileSize = 16;
+/// Number of floats written by a projection work group (padded).
+static constexpr uint32_t g_PartialSize = 32;
+/// Number of floats of the reduced result (27 SH values, average and maximum luminance).
+static constexpr uint32_t g_ResultSize = 29;
+
 /**
  * @brief Construct an environment ligth in the scene.
  *
@@ -57,6 +67,34 @@ void SHEnvironmentLight::SetupResources()
         materialLibrary.Create<TextureMaterial>("SphericalHarmonics",
                                                 "pixc/shaders/environment/sh/SphericalHarmonics");
     }
+    
+    // Compute path (if supported by the device)
+    SetupComputeResources();
+}
+
+/**
+ * @brief Setup the compute shaders and storage buffers used to project the environment.
+ *
+ * The resources are left undefined when the compute passes are not supported, the fragment
+ * pass is then used instead.
+ */
+void SHEnvironmentLight::SetupComputeResources()
+{
+    if (!RendererCommand::IsComputeSupported())
+        return;
+    
+    // Get the shader library shared by the materials
+    auto& shaderLibrary = Material::GetShaderLibrary();
+    if (!shaderLibrary.Exists("SHProjection"))
+        shaderLibrary.Load("SHProjection", "pixc/shaders/environment/sh/SHProjection");
+    if (!shaderLibrary.Exists("SHReduction"))
+        shaderLibrary.Load("SHReduction", "pixc/shaders/environment/sh/SHReduction");
+    
+    // Define the buffers for the largest projection
+    uint32_t tiles = g_MaxProjectionSize / g_ProjectionTileSize;
+    uint32_t groupCount = tiles * tiles * 6;
+    m_Partials = StorageBuffer::Create(groupCount * g_PartialSize * sizeof(float));
+    m_Result = StorageBuffer::Create(g_ResultSize * sizeof(float));
 }
 
 /**
@@ -94,23 +132,138 @@ void SHEnvironmentLight::DefineLightProperties(const std::shared_ptr<Shader> &sh
 }
 
 /**
- * Updates the environment lighting information.
+ * @brief Start baking an environment map (restarts the baking in progress, if any).
+ *
+ * @param texture The environment map to be baked.
+ */
+void SHEnvironmentLight::BeginBake(const std::shared_ptr<Texture>& texture)
+{
+    EnvironmentLight::BeginBake(texture);
+    
+    m_Projected = false;
+    m_Readback.reset();
+}
+
+/**
+ * @brief Get the number of steps to bake an environment map.
+ *
+ * @return The number of steps (the cube map, then the projection and the readback of the SH
+ *         coefficients).
+ */
+uint32_t SHEnvironmentLight::GetBakeStepCount() const
+{
+    return EnvironmentLight::GetBakeStepCount() + 2;
+}
+
+/**
+ * @brief Process a step of the baking of the environment map.
+ *
+ * Once the cube map is rendered, the environment is projected into SH coefficients. The projection
+ * is submitted with the frame before its result is requested, and the readback is waited for
+ * over the next frames.
+ *
+ * @param step The index of the step.
+ *
+ * @return `true` if the step is done, `false` if it has to be processed again (next frame).
+ */
+bool SHEnvironmentLight::BakeStep(const uint32_t step)
+{
+    const uint32_t environmentSteps = EnvironmentLight::GetBakeStepCount();
+    if (step < environmentSteps)
+        return EnvironmentLight::BakeStep(step);
+    
+    // Projection of the environment map
+    if (step == environmentSteps)
+    {
+        if (m_Projected)
+            return true;
+        
+        // Use the compute passes (if supported)
+        if (m_Partials && m_Result)
+            ProjectEnvironment(m_Bake.Target);
+        else
+            RenderCoefficients(m_Bake.Target);
+        
+        m_Projected = true;
+        return false;
+    }
+    
+    // Readback of the coefficients
+    return RetrieveCoefficients();
+}
+
+/**
+ * @brief Replace the environment and the SH coefficients in use with the ones baked.
  */
-void SHEnvironmentLight::UpdateEnvironment()
+void SHEnvironmentLight::FinishBake()
 {
-    // Call base function related to the general environment light
-    EnvironmentLight::UpdateEnvironment();
+    EnvironmentLight::FinishBake();
     
+    m_Coefficients = m_BakedCoefficients;
+    m_Luminance = m_BakedLuminance;
+    
+    m_Projected = false;
+    m_Readback.reset();
+}
+
+/**
+ * @brief Project an environment cube map into SH coefficients using the compute passes.
+ *
+ * The texels of the environment map are projected by tiles into partial sums (one per work
+ * group), which are then reduced by a single work group. The result is read back once the
+ * GPU is done (see `RetrieveCoefficients()`), so this function never waits for the GPU.
+ *
+ * @param environment The framebuffer holding the environment cube map.
+ */
+void SHEnvironmentLight::ProjectEnvironment(const std::shared_ptr<FrameBuffer>& environment)
+{
+    auto& shaderLibrary = Material::GetShaderLibrary();
+    
+    // Sample the first mip level that fits in the projection resolution
+    uint32_t lod = 0;
+    while ((environment->GetSpec().Width >> lod) > g_MaxProjectionSize)
+        lod++;
+    uint32_t size = std::max(environment->GetSpec().Width >> lod, 1u);
+    uint32_t tiles = (size + g_ProjectionTileSize - 1) / g_ProjectionTileSize;
+    uint32_t groupCount = tiles * tiles * 6;
+    
+    // Project the texels of the six faces into partial sums
+    auto projection = shaderLibrary.Get("SHProjection");
+    projection->Bind();
+    projection->SetTexture("u_Projection.EnvironmentMap", environment->GetColorAttachment(0), 0);
+    projection->SetInt("u_Projection.Size", static_cast<int>(size));
+    projection->SetFloat("u_Projection.Lod", static_cast<float>(lod));
+    m_Partials->Bind(static_cast<uint32_t>(StorageBinding::Output));
+    RendererCommand::DispatchCompute(tiles, tiles, 6);
+    
+    // Reduce the partial sums into the coefficients
+    auto reduction = shaderLibrary.Get("SHReduction");
+    reduction->Bind();
+    reduction->SetInt("u_Reduction.Count", static_cast<int>(groupCount));
+    m_Partials->Bind(static_cast<uint32_t>(StorageBinding::Input));
+    m_Result->Bind(static_cast<uint32_t>(StorageBinding::Output));
+    RendererCommand::DispatchCompute(1);
+    reduction->Unbind();
+    
+    // Request the result (retrieved once the GPU is done)
+    m_Result->BeginReadback();
+}
+
+/**
+ * @brief Compute the SH coefficients of an environment cube map using a fragment pass.
+ *
+ * The coefficients are rendered into a small framebuffer, read back once the GPU is done (see
+ * `RetrieveCoefficients()`).
+ *
+ * @param environment The framebuffer holding the environment cube map.
+ */
+void SHEnvironmentLight::RenderCoefficients(const std::shared_ptr<FrameBuffer>& environment)
+{
     // Get the material library defined in the renderer
     auto& materialLibrary = Renderer::GetMaterialLibrary();
     // Update the current texture representing the environment map
     auto material = std::dynamic_pointer_cast<TextureMaterial>(materialLibrary.Get("SphericalHarmonics"));
-    material->SetTextureMap(m_FrameBuffers.Get("Environment")->GetColorAttachment(0));
-    
-    // Create a plane geometry (to render to) using the material
-    using VertexData = GeoVertexData<glm::vec4>;
-    auto geometry = utils::geometry::ModelPlane<VertexData>(material);
-    geometry->SetScale(glm::vec3(2.0f));
+    material->SetTextureMap(environment->GetColorAttachment(0));
     
     // Get the spherical harmonics framebuffer
     auto& framebuffer = m_FrameBuffers.Get("SphericalHarmonics");
@@ -120,16 +273,52 @@ void SHEnvironmentLight::UpdateEnvironment()
     RendererCommand::SetClearColor(glm::vec4(0.0f));
     RendererCommand::Clear();
     
-    Renderer::BeginScene();
-    geometry->SetMaterial(material);
-    geometry->DrawModel();
-    Renderer::EndScene();
+    Renderer::DrawFullscreen(material);
     
     RendererCommand::EndRenderPass();
-    GraphicsContext::Get().SwapBuffers();
+}
+
+/**
+ * @brief Retrieve the SH coefficients of the environment being baked, if they are ready.
+ *
+ * @return `true` if the coefficients have been retrieved.
+ */
+bool SHEnvironmentLight::RetrieveCoefficients()
+{
+    // Compute path: the result of the reduction
+    if (m_Partials && m_Result)
+    {
+        if (!m_Result->IsReadbackPending() || !m_Result->IsReadbackReady())
+            return false;
+        
+        std::vector<float> data(g_ResultSize);
+        m_Result->GetData(data.data(), g_ResultSize * sizeof(float));
+        
+        m_BakedLuminance.Average = data[27];
+        m_BakedLuminance.Max = data[28];
+        
+        // Compute the SH matrices from the coefficents
+        data.resize(27);
+        m_BakedCoefficients.UpdateFromCoefficients(data);
+        return true;
+    }
+    
+    // Fragment path: request the pixels of the SH framebuffer (rendered in a previous frame)
+    if (!m_Readback)
+    {
+        auto readback = std::make_shared<std::vector<char>>();
+        m_Readback = readback;
+        m_FrameBuffers.Get("SphericalHarmonics")->GetAttachmentDataAsync(0,
+            [readback](std::vector<char> pixels) { *readback = std::move(pixels); });
+        return false;
+    }
+    
+    FrameBuffer::ProcessReadbacks();
+    if (m_Readback->empty())
+        return false;
     
     // Retrieve the information of the SH coefficients
-    std::vector<char> rawData = framebuffer->GetAttachmentData(0);
+    const std::vector<char>& rawData = *m_Readback;
     // Ensure the raw data size is compatible with half float conversion
     PIXEL_CORE_ASSERT(rawData.size() % sizeof(uint16_t) == 0, "Data size is not a multiple of float size!");
     
@@ -145,9 +334,15 @@ void SHEnvironmentLight::UpdateEnvironment()
         if (!hasAlpha || (i % 4) != 3)
             data.push_back(glm::detail::toFloat32(halfData[i]));
     }
-
+    
     // Compute the SH matrices from the coefficents
-    m_Coefficients.UpdateFromCoefficients(data);
+    m_BakedCoefficients.UpdateFromCoefficients(data);
+    
+    // Estimate the average luminance from the constant term (mean radiance = L00 * Y00)
+    glm::vec3 average = glm::vec3(data[0], data[1], data[2]) * 0.282095f;
+    m_BakedLuminance.Average = glm::dot(average, glm::vec3(0.2126f, 0.7152f, 0.0722f));
+    m_BakedLuminance.Max = m_BakedLuminance.Average;
+    return true;
 }
 
 /**
@@ -0,0 +1,190 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/PostProcess/AutoExposure.h"
+
+#include "Foundation/Renderer/RendererCommand.h"
+#include "Foundation/Renderer/Material/Material.h"
+
+#include <chrono>
+
+namespace pixc {
+
+/// Number of bins of the luminance histogram (`LuminanceHistogram` shader).
+static constexpr uint32_t g_BinCount = 64;
+/// Size of the tiles of the downsampled frame processed by a work group.
+static constexpr uint32_t g_TileSize = 16;
+/// Largest side of the downsampled frame measured.
+static constexpr uint32_t g_MeasureSize = 128;
+/// Largest time step used for the adaptation (avoids jumps after a stall).
+static constexpr float g_MaxTimeStep = 0.25f;
+
+/**
+ * @brief Define the auto-exposure stage.
+ *
+ * @param settings The exposure settings.
+ */
+AutoExposure::AutoExposure(const ExposureSettings& settings)
+    : m_Settings(settings)
+{
+    if (!RendererCommand::IsComputeSupported())
+        return;
+    
+    // Get the shader library shared by the materials
+    auto& shaderLibrary = Material::GetShaderLibrary();
+    if (!shaderLibrary.Exists("LuminanceHistogram"))
+        shaderLibrary.Load("LuminanceHistogram", "pixc/shaders/post/LuminanceHistogram");
+    
+    for (auto& histogram : m_Histograms)
+        histogram = StorageBuffer::Create(g_BinCount * sizeof(uint32_t));
+}
+
+/**
+ * @brief Measure the luminance of a frame and adapt the exposure.
+ *
+ * The histogram of the frame is requested, and the exposure adapts to the last histogram read
+ * back (usually the one of a previous frame).
+ *
+ * @param frame The frame (high dynamic range colors) to be displayed.
+ */
+void AutoExposure::Update(const std::shared_ptr<Texture>& frame)
+{
+    // Measure the time elapsed since the last update
+    double now = std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    float deltaTime = m_LastUpdate < 0.0 ? 0.0f :
+        std::min(static_cast<float>(now - m_LastUpdate), g_MaxTimeStep);
+    m_LastUpdate = now;
+    
+    float compensation = std::exp2(m_Settings.Compensation);
+    if (!m_Settings.AutoExposure || !IsSupported())
+    {
+        m_Exposure = compensation;
+        return;
+    }
+    
+    // Use the histograms the GPU is done with, then request the one of this frame
+    RetrieveHistograms();
+    if (frame)
+        BuildHistogram(frame);
+    
+    // Adapt to the measured luminance (exponential decay, faster towards a brighter scene)
+    float speed = m_TargetLuminance > m_AdaptedLuminance ? m_Settings.SpeedUp : m_Settings.SpeedDown;
+    m_AdaptedLuminance += (m_TargetLuminance - m_AdaptedLuminance) * (1.0f - std::exp(-deltaTime * speed));
+    
+    m_Exposure = m_Settings.KeyValue / std::max(m_AdaptedLuminance, 1e-4f) * compensation;
+}
+
+/**
+ * @brief Set the exposure properties into the uniforms of the shader program.
+ *
+ * @param shader The shader program displaying the frame.
+ */
+void AutoExposure::SetProperties(const std::shared_ptr<Shader>& shader) const
+{
+    shader->SetFloat("u_Exposure.Value", m_Exposure);
+    shader->SetInt("u_Exposure.Operator", static_cast<int>(m_Settings.Operator));
+    shader->SetFloat("u_Exposure.WhitePoint", m_Settings.WhitePoint);
+}
+
+/**
+ * @brief Request the luminance histogram of a frame.
+ *
+ * The histogram is skipped if all the buffers are still waiting to be read back.
+ *
+ * @param frame The frame to be measured.
+ */
+void AutoExposure::BuildHistogram(const std::shared_ptr<Texture>& frame)
+{
+    auto& histogram = m_Histograms[m_NextHistogram];
+    if (histogram->IsReadbackPending())
+        return;
+    
+    // Downsample the frame (keeping its aspect ratio)
+    const auto& spec = frame->GetSpecification();
+    float scale = std::min(1.0f, static_cast<float>(g_MeasureSize) /
+                           static_cast<float>(std::max({ spec.Width, spec.Height, 1u })));
+    uint32_t width = std::max(static_cast<uint32_t>(spec.Width * scale), 1u);
+    uint32_t height = std::max(static_cast<uint32_t>(spec.Height * scale), 1u);
+    
+    // Reset the bins
+    static const std::vector<uint32_t> zeros(g_BinCount, 0);
+    histogram->SetData(zeros.data(), g_BinCount * sizeof(uint32_t));
+    
+    // Build the histogram
+    float range = std::max(m_Settings.MaxLogLuminance - m_Settings.MinLogLuminance, 1e-3f);
+    auto shader = Material::GetShaderLibrary().Get("LuminanceHistogram");
+    shader->Bind();
+    shader->SetTexture("u_Histogram.Frame", frame, 0);
+    shader->SetVec2("u_Histogram.Size", glm::vec2(width, height));
+    shader->SetFloat("u_Histogram.MinLogLuminance", m_Settings.MinLogLuminance);
+    shader->SetFloat("u_Histogram.InverseLogRange", 1.0f / range);
+    histogram->Bind(static_cast<uint32_t>(StorageBinding::Output));
+    RendererCommand::DispatchCompute((width + g_TileSize - 1) / g_TileSize,
+                                     (height + g_TileSize - 1) / g_TileSize);
+    shader->Unbind();
+    
+    histogram->BeginReadback();
+    m_NextHistogram = (m_NextHistogram + 1) % m_Histograms.size();
+}
+
+/**
+ * @brief Read back the histograms the GPU is done with (oldest first) and update the
+ * measured luminance.
+ */
+void AutoExposure::RetrieveHistograms()
+{
+    std::vector<uint32_t> bins(g_BinCount);
+    for (size_t i = 0; i < m_Histograms.size(); i++)
+    {
+        auto& histogram = m_Histograms[(m_NextHistogram + i) % m_Histograms.size()];
+        if (!histogram->IsReadbackPending() || !histogram->IsReadbackReady())
+            continue;
+        
+        histogram->GetData(bins.data(), g_BinCount * sizeof(uint32_t));
+        m_TargetLuminance = ComputeAverageLuminance(bins);
+    }
+}
+
+/**
+ * @brief Compute the average luminance described by a histogram.
+ *
+ * The darkest and brightest pixels (`LowPercent` and `HighPercent`) are ignored, and the
+ * average is computed in the log domain.
+ *
+ * @param bins The number of pixels in each bin of the histogram.
+ *
+ * @return The average luminance, or the previous measure if the histogram is empty.
+ */
+float AutoExposure::ComputeAverageLuminance(const std::vector<uint32_t>& bins) const
+{
+    float total = 0.0f;
+    for (uint32_t count : bins)
+        total += static_cast<float>(count);
+    if (total <= 0.0f)
+        return m_TargetLuminance;
+    
+    // Range of pixels (sorted by luminance) taken into account
+    float low = total * glm::clamp(m_Settings.LowPercent, 0.0f, 1.0f);
+    float high = total * glm::clamp(m_Settings.HighPercent, 0.0f, 1.0f);
+    
+    float range = m_Settings.MaxLogLuminance - m_Settings.MinLogLuminance;
+    float sum = 0.0f;
+    float weight = 0.0f;
+    float cumulated = 0.0f;
+    for (uint32_t i = 0; i < g_BinCount; i++)
+    {
+        // Part of the bin inside the range of pixels
+        float count = static_cast<float>(bins[i]);
+        float inside = std::max(0.0f, std::min(cumulated + count, high) - std::max(cumulated, low));
+        cumulated += count;
+        
+        float logLuminance = m_Settings.MinLogLuminance + (i + 0.5f) / g_BinCount * range;
+        sum += logLuminance * inside;
+        weight += inside;
+    }
+    
+    if (weight <= 0.0f)
+        return m_TargetLuminance;
+    return std::exp2(sum / weight);
+}
+
+} // namespace pixc
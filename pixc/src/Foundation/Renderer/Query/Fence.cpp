@@ -0,0 +1,28 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Query/Fence.h"
+
+#include "Foundation/Renderer/Renderer.h"
+
+#include "Platform/OpenGL/Query/OpenGLFence.h"
+
+namespace pixc {
+
+/**
+ * @brief Insert a fence into the command stream, based on the active rendering API.
+ *
+ * @return A shared pointer to the created fence, or nullptr if the API does not support them
+ *         (or synchronizes its frames internally).
+ */
+std::shared_ptr<Fence> Fence::Create()
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return std::make_shared<OpenGLFence>();
+        // The other APIs synchronize their frames in flight internally
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace pixc
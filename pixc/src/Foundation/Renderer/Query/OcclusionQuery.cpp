@@ -0,0 +1,28 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Query/OcclusionQuery.h"
+
+#include "Foundation/Renderer/Renderer.h"
+
+#include "Platform/OpenGL/Query/OpenGLOcclusionQuery.h"
+
+namespace pixc {
+
+/**
+ * @brief Create an occlusion query based on the active rendering API.
+ *
+ * @return A shared pointer to the created query, or nullptr if the API does not support them
+ *         (the objects are then always drawn).
+ */
+std::shared_ptr<OcclusionQuery> OcclusionQuery::Create()
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::OpenGL:
+            return std::make_shared<OpenGLOcclusionQuery>();
+        // Metal visibility results are not supported yet
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace pixc
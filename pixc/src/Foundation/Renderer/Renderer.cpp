@@ -2,8 +2,19 @@
 #include "Foundation/Renderer/Renderer.h"
 
 #include "Foundation/Renderer/RendererCommand.h"
+#include "Foundation/Renderer/Renderer2D.h"
+#include "Foundation/Renderer/FrameSync.h"
+#include "Foundation/Renderer/Text/TextRenderer.h"
+#include "Foundation/Renderer/Texture/Sampler.h"
+#include "Foundation/Renderer/Buffer/FrameCapture.h"
+#include "Foundation/Renderer/Animation/AnimationSystem.h"
+#include "Foundation/Renderer/Culling/ClusterCulling.h"
 #include "Foundation/Renderer/Material/LitMaterial.h"
 
+#include "Foundation/Renderer/Drawable/Model/ModelUtils.h"
+
+#include "Foundation/Core/AssetManager.h"
+
 namespace pixc {
 
 // Define the renderer variable(s)
@@ -17,6 +28,16 @@ static const glm::mat4 g_TextureMatrix = glm::mat4(
     0.0f, 0.0f, 0.5f, 0.0f,
     0.5f, 0.5f, 0.5f, 1.0f
 );
+/// Texture matrix used with the reversed depth (the depth is already in [0, 1]).
+static const glm::mat4 g_ReversedTextureMatrix = glm::mat4(
+    0.5f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.5f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.5f, 0.5f, 0.0f, 1.0f
+);
+
+/// Plane covering the screen, drawn for the fullscreen passes whose shaders read vertex data.
+static std::shared_ptr<BaseModel> g_FullscreenPlane;
 
 /**
  * @brief Initialize the renderer.
@@ -26,6 +47,29 @@ void Renderer::Init()
     RendererCommand::Init();
 }
 
+/**
+ * @brief Stop the rendering services and release the graphics resources owned by the renderer.
+ *
+ * @note It must be called before the window (and its graphics context) is destroyed.
+ */
+void Renderer::Shutdown()
+{
+    // Let the GPU complete the frames in flight
+    FrameSync::Shutdown();
+    
+    // Stop the background loading and writing
+    AssetManager::Shutdown();
+    FrameCapture::Shutdown();
+    AnimationSystem::Shutdown();
+    ClusterCulling::Shutdown();
+    
+    // Release the graphics resources while the context is still alive
+    Renderer2D::Shutdown();
+    TextRenderer::Shutdown();
+    g_FullscreenPlane.reset();
+    Sampler::ClearCache();
+}
+
 /**
  * @brief Start the rendering of a scene by defining its general parameters.
  *
@@ -63,6 +107,17 @@ void Renderer::BeginScene(const glm::mat4 &view, const glm::mat4 &projection,
     s_SceneData->ProjectionMatrix = projection;
 }
 
+/**
+ * @brief Set the opacity of the models drawn next (dithered fade before they get culled).
+ *
+ * @param fade The opacity, from 0 (fully faded out) to 1 (fully drawn).
+ * @note Only the shaders declaring the `u_Fade` uniform are affected.
+ */
+void Renderer::SetFade(float fade)
+{
+    s_SceneData->Fade = glm::clamp(fade, 0.0f, 1.0f);
+}
+
 /**
  * @brief End the rendering of a scene.
  */
@@ -85,6 +140,22 @@ void Renderer::Draw(const std::shared_ptr<Drawable>& drawable, const PrimitiveTy
     g_Stats.DrawCalls++;
 }
 
+/**
+ * @brief Render only the first indices of a drawable object (e.g. a partially filled batch).
+ *
+ * @param drawable The drawable object containing the data for rendering.
+ * @param indexCount The number of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void Renderer::DrawIndexed(const std::shared_ptr<Drawable>& drawable, const uint32_t indexCount,
+                           const PrimitiveType &primitive)
+{
+    // Render the geometry
+    RendererCommand::DrawIndexed(drawable, indexCount, primitive);
+    // Add the drawing count
+    g_Stats.DrawCalls++;
+}
+
 /**
  * @brief Render primitives from a drawable object using the specified primitive type.
  *
@@ -95,6 +166,83 @@ void Renderer::Draw(const std::shared_ptr<Drawable>& drawable, const PrimitiveTy
  */
 void Renderer::Draw(const std::shared_ptr<Drawable>& drawable, const std::shared_ptr<Material>& material,
                     const glm::mat4 &transform, const PrimitiveType &primitive)
+{
+    BindMaterial(material, transform);
+    
+    // Render the geometry
+    Draw(drawable, primitive);
+    
+    // Unbind the material
+    material->Unbind();
+}
+
+/**
+ * @brief Render a pass covering the whole target (e.g., post effects, displaying an image).
+ *
+ * The shaders without vertex inputs draw a single triangle generated from the vertex index:
+ * no vertex data, no transformation uniforms. The other shaders draw a plane covering the
+ * screen instead (identity view and projection). Depth testing is disabled.
+ *
+ * @param material The material used for shading.
+ */
+void Renderer::DrawFullscreen(const std::shared_ptr<Material>& material)
+{
+    RendererCommand::EnableDepthTesting(false);
+    
+    if (material->GetShader()->IsVertexless())
+    {
+        material->Bind();
+        RendererCommand::DrawFullscreen();
+        material->Unbind();
+        g_Stats.DrawCalls++;
+        return;
+    }
+    
+    if (!g_FullscreenPlane)
+    {
+        using VertexData = GeoVertexData<glm::vec4, glm::vec2>;
+        g_FullscreenPlane = utils::geometry::ModelPlane<VertexData>();
+        g_FullscreenPlane->SetScale(glm::vec3(2.0f));
+    }
+    
+    // Draw the plane without changing the scene being rendered
+    SceneData scene = *s_SceneData;
+    BeginScene(glm::mat4(1.0f), glm::mat4(1.0f));
+    g_FullscreenPlane->SetMaterial(material);
+    g_FullscreenPlane->DrawModel();
+    *s_SceneData = scene;
+}
+
+/**
+ * @brief Render several ranges of indices of a drawable object (e.g. the visible clusters of a mesh).
+ *
+ * @param drawable The drawable object containing the data for rendering.
+ * @param material The material used for shading.
+ * @param ranges The ranges of indices to be rendered.
+ * @param transform The transformation matrix of the geometry (model matrix).
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void Renderer::DrawRanges(const std::shared_ptr<Drawable>& drawable, const std::shared_ptr<Material>& material,
+                          const std::vector<IndexRange>& ranges, const glm::mat4 &transform,
+                          const PrimitiveType &primitive)
+{
+    BindMaterial(material, transform);
+    
+    // Render the geometry
+    RendererCommand::DrawRanges(drawable, ranges, primitive);
+    g_Stats.DrawCalls++;
+    
+    // Unbind the material
+    material->Unbind();
+}
+
+/**
+ * @brief Bind a material and set the information of the scene into it for the shading.
+ *
+ * @param material The material.
+ * @param transform The transformation matrix of the geometry (model matrix).
+ */
+void Renderer::BindMaterial(const std::shared_ptr<Material>& material, const glm::mat4& transform)
 {
     // Bind the material and set the corresponding information into it for the shading
     material->Bind();
@@ -109,21 +257,21 @@ void Renderer::Draw(const std::shared_ptr<Drawable>& drawable, const std::shared
         material->GetShader()->SetVec3("u_View.Position", s_SceneData->ViewPosition);
     if (material->HasProperty(MaterialProperty::NormalMatrix))
         material->GetShader()->SetMat4("u_Transform.Normal", glm::transpose(glm::inverse(transform)));
+    if (material->GetShader()->IsUniform("u_Fade.Factor"))
+        material->GetShader()->SetFloat("u_Fade.Factor", s_SceneData->Fade);
     
-    auto litMaterial = std::dynamic_pointer_cast<LitMaterial>(material);
+    // Material instances use the light properties of the material they are defined from
+    auto litMaterial = dynamic_cast<LitMaterial*>(&material->GetDefinition());
     if (litMaterial)
     {
         // Check the flags for the lighted material
         const auto& lightProperties = litMaterial->GetLightProperties();
         if (Light::HasProperty(lightProperties, LightProperty::ShadowProperties))
-            material->GetShader()->SetMat4("u_Transform.Texture", g_TextureMatrix);
+        {
+            const glm::mat4& texture = RendererAPI::IsDepthReversed() ? g_ReversedTextureMatrix : g_TextureMatrix;
+            material->GetShader()->SetMat4("u_Transform.Texture", texture);
+        }
     }
-    
-    // Render the geometry
-    Draw(drawable, primitive);
-    
-    // Unbind the material
-    material->Unbind();
 }
 
 /**
@@ -0,0 +1,476 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Renderer2D.h"
+
+#include "Foundation/Core/Resources.h"
+
+#include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/RendererCommand.h"
+#include "Foundation/Renderer/FrameSync.h"
+
+#include "Foundation/Renderer/Drawable/Drawable.h"
+#include "Foundation/Renderer/Texture/Texture2D.h"
+
+#include <numeric>
+
+namespace pixc {
+
+/**
+ * @brief Represents a vertex of a batched quad.
+ */
+struct QuadVertex
+{
+    glm::vec4 Position;         ///< Vertex position (world space).
+    glm::vec2 TextureCoord;     ///< Texture coordinates.
+    glm::vec4 Color;            ///< Tint color.
+    float TextureIndex;         ///< Texture slot inside the batch.
+};
+
+/**
+ * @brief Represents a quad submitted to the batch and waiting to be flushed.
+ */
+struct QuadCommand
+{
+    std::array<QuadVertex, 4> Vertices;     ///< Quad vertices (texture index defined when flushed).
+    Texture* TextureMap = nullptr;          ///< Texture used by the quad (not owned).
+    float Depth = 0.0f;                     ///< Depth of the quad center (view space).
+};
+
+/**
+ * @brief Represents the state of the 2D batch renderer.
+ */
+struct Renderer2DData
+{
+    ///< Maximum number of quads rendered in a single draw call.
+    static constexpr uint32_t MaxQuads = 16384;
+    static constexpr uint32_t MaxVertices = MaxQuads * 4;
+    static constexpr uint32_t MaxIndices = MaxQuads * 6;
+    ///< Maximum number of textures per batch (must match `MAX_TEXTURE_SLOTS` in the shader).
+    static constexpr uint32_t MaxTextureSlots = 16;
+
+    ///< Geometry (streaming vertex buffer of each frame in flight, and static index buffer).
+    std::array<std::shared_ptr<Drawable>, FrameSync::MaxFramesInFlight> QuadDrawables;
+    std::array<std::shared_ptr<VertexBuffer>, FrameSync::MaxFramesInFlight> QuadVertexBuffers;
+    ///< Shader used to render the quads.
+    std::shared_ptr<Shader> QuadShader;
+    ///< Default texture (slot 0) used by non-textured quads.
+    std::shared_ptr<Texture> WhiteTexture;
+
+    ///< Camera matrices of the current scene.
+    glm::mat4 ViewMatrix = glm::mat4(1.0f);
+    glm::mat4 ProjectionMatrix = glm::mat4(1.0f);
+    ///< Sorting applied to the quads of the current scene.
+    QuadSortMode SortMode = QuadSortMode::None;
+
+    ///< Quads submitted in the current scene.
+    std::vector<QuadCommand> Quads;
+    ///< Submission order (after sorting).
+    std::vector<uint32_t> Order;
+
+    ///< Vertices of the batch currently being built.
+    std::vector<QuadVertex> Vertices;
+    uint32_t QuadCount = 0;
+    ///< Textures bound in the batch currently being built.
+    std::array<Texture*, MaxTextureSlots> TextureSlots = {};
+    uint32_t TextureSlotCount = 1;
+
+    ///< Rendering statistics.
+    Renderer2D::Statistics Stats;
+};
+
+static std::unique_ptr<Renderer2DData> g_Data;
+
+/// @brief Local coordinates of the quad corners (centered at the origin).
+static const glm::vec4 g_QuadPositions[4] = {
+    { -0.5f, -0.5f, 0.0f, 1.0f },
+    {  0.5f, -0.5f, 0.0f, 1.0f },
+    {  0.5f,  0.5f, 0.0f, 1.0f },
+    { -0.5f,  0.5f, 0.0f, 1.0f }
+};
+
+/**
+ * @brief Add a quad to the list of quads of the current scene.
+ *
+ * @param corners The quad corners in world space.
+ * @param textureRect The texture coordinates sub-rectangle (min.x, min.y, max.x, max.y).
+ * @param tint The color multiplied with the texture.
+ * @param texture The texture of the quad (white texture if null).
+ */
+static void SubmitQuad(const std::array<glm::vec4, 4>& corners, const glm::vec4& textureRect,
+                       const glm::vec4& tint, Texture* texture)
+{
+    PIXEL_CORE_ASSERT(g_Data, "Renderer2D::BeginScene() must be called before drawing quads!");
+
+    QuadCommand& quad = g_Data->Quads.emplace_back();
+
+    const glm::vec2 uvs[4] = {
+        { textureRect.x, textureRect.y },
+        { textureRect.z, textureRect.y },
+        { textureRect.z, textureRect.w },
+        { textureRect.x, textureRect.w }
+    };
+    for (uint32_t i = 0; i < 4; i++)
+        quad.Vertices[i] = { corners[i], uvs[i], tint, 0.0f };
+
+    quad.TextureMap = texture ? texture : g_Data->WhiteTexture.get();
+
+    // Only the depth of the quad center is needed for sorting
+    if (g_Data->SortMode == QuadSortMode::BackToFront ||
+        g_Data->SortMode == QuadSortMode::FrontToBack)
+    {
+        glm::vec4 center = 0.5f * (corners[0] + corners[2]);
+        quad.Depth = (g_Data->ViewMatrix * center).z;
+    }
+}
+
+/**
+ * @brief Initialize the 2D renderer (geometry buffers and shader).
+ */
+void Renderer2D::Init()
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<Renderer2DData>();
+
+    // Define the streaming vertex buffers (one per frame in flight)
+    for (auto& buffer : g_Data->QuadVertexBuffers)
+    {
+        buffer = VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex));
+        buffer->SetLayout({
+            { "a_Position", { DataType::Vec4 } },
+            { "a_TextureCoord", { DataType::Vec2 } },
+            { "a_Color", { DataType::Vec4 } },
+            { "a_TextureIndex", { DataType::Float } }
+        });
+    }
+
+    // Define the index buffer (same pattern for all the quads)
+    std::vector<uint32_t> indices(Renderer2DData::MaxIndices);
+    for (uint32_t i = 0, offset = 0; i < Renderer2DData::MaxIndices; i += 6, offset += 4)
+    {
+        indices[i + 0] = offset + 0;
+        indices[i + 1] = offset + 1;
+        indices[i + 2] = offset + 2;
+
+        indices[i + 3] = offset + 2;
+        indices[i + 4] = offset + 3;
+        indices[i + 5] = offset + 0;
+    }
+
+    // Define the shader
+    g_Data->QuadShader = Shader::Create(ResourcesManager::GeneralPath("pixc/shaders/forward/unlit/Sprite"));
+    g_Data->QuadShader->Bind();
+    for (uint32_t i = 0; i < Renderer2DData::MaxTextureSlots; i++)
+        g_Data->QuadShader->SetInt("u_Batch.Textures[" + std::to_string(i) + "]", i);
+    g_Data->QuadShader->Unbind();
+
+    // Define the drawable objects
+    for (uint32_t i = 0; i < FrameSync::MaxFramesInFlight; i++)
+    {
+        g_Data->QuadDrawables[i] = Drawable::Create();
+        g_Data->QuadDrawables[i]->AddVertexBuffer(g_Data->QuadVertexBuffers[i]);
+        g_Data->QuadDrawables[i]->SetIndexData(indices);
+        g_Data->QuadDrawables[i]->SetShader(g_Data->QuadShader);
+    }
+
+    // Define the default texture
+    g_Data->WhiteTexture = utils::textures::WhiteTexture2D();
+    g_Data->TextureSlots[0] = g_Data->WhiteTexture.get();
+
+    // Pre-allocate the batch storage
+    g_Data->Vertices.resize(Renderer2DData::MaxVertices);
+}
+
+/**
+ * @brief Release the resources of the 2D renderer.
+ */
+void Renderer2D::Shutdown()
+{
+    g_Data.reset();
+}
+
+/**
+ * @brief Start a 2D scene.
+ *
+ * @param camera Rendering camera (identity matrices if not defined).
+ * @param sort Sorting applied to the quads when the scene ends.
+ */
+void Renderer2D::BeginScene(const std::shared_ptr<Camera>& camera, const QuadSortMode sort)
+{
+    if (!camera)
+    {
+        BeginScene(glm::mat4(1.0f), glm::mat4(1.0f), sort);
+        return;
+    }
+
+    BeginScene(camera->GetViewMatrix(), camera->GetProjectionMatrix(), sort);
+}
+
+/**
+ * @brief Start a 2D scene.
+ *
+ * @param view The view matrix transformation.
+ * @param projection The projection matrix transformation.
+ * @param sort Sorting applied to the quads when the scene ends.
+ */
+void Renderer2D::BeginScene(const glm::mat4& view, const glm::mat4& projection,
+                            const QuadSortMode sort)
+{
+    // Make sure the renderer has been initialized
+    Init();
+
+    g_Data->ViewMatrix = view;
+    g_Data->ProjectionMatrix = projection;
+    g_Data->SortMode = sort;
+
+    g_Data->Quads.clear();
+}
+
+/**
+ * @brief End the 2D scene and render all the submitted quads.
+ */
+void Renderer2D::EndScene()
+{
+    PIXEL_CORE_ASSERT(g_Data, "Renderer2D::BeginScene() has not been called!");
+
+    auto& quads = g_Data->Quads;
+    if (quads.empty())
+        return;
+
+    // Sort the quads (the indices only, to avoid moving the vertex data around)
+    auto& order = g_Data->Order;
+    order.resize(quads.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    switch (g_Data->SortMode)
+    {
+        case QuadSortMode::BackToFront:
+            // Camera looks towards -z: farthest quads have the lowest depth
+            std::stable_sort(order.begin(), order.end(), [&quads](uint32_t a, uint32_t b)
+                             { return quads[a].Depth < quads[b].Depth; });
+            break;
+        case QuadSortMode::FrontToBack:
+            std::stable_sort(order.begin(), order.end(), [&quads](uint32_t a, uint32_t b)
+                             { return quads[a].Depth > quads[b].Depth; });
+            break;
+        case QuadSortMode::Texture:
+            std::stable_sort(order.begin(), order.end(), [&quads](uint32_t a, uint32_t b)
+                             { return std::less<Texture*>()(quads[a].TextureMap, quads[b].TextureMap); });
+            break;
+        case QuadSortMode::None:
+        default:
+            break;
+    }
+
+    // Blend the quads, then restore the blending state of the caller
+    bool blending = RendererCommand::IsBlendingEnabled();
+    RendererCommand::EnableBlending(true);
+
+    // Fill the batches, flushing them when they run out of quads or texture slots
+    for (uint32_t index : order)
+    {
+        const QuadCommand& quad = quads[index];
+
+        if (g_Data->QuadCount == Renderer2DData::MaxQuads)
+            Flush();
+
+        // Look for the texture in the slots of the current batch
+        uint32_t slot = 0;
+        while (slot < g_Data->TextureSlotCount && g_Data->TextureSlots[slot] != quad.TextureMap)
+            slot++;
+
+        // Define a new slot for the texture
+        if (slot == g_Data->TextureSlotCount)
+        {
+            if (g_Data->TextureSlotCount == Renderer2DData::MaxTextureSlots)
+                Flush();
+
+            slot = g_Data->TextureSlotCount++;
+            g_Data->TextureSlots[slot] = quad.TextureMap;
+        }
+
+        // Copy the vertices into the batch
+        QuadVertex* vertex = &g_Data->Vertices[g_Data->QuadCount * 4];
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            vertex[i] = quad.Vertices[i];
+            vertex[i].TextureIndex = static_cast<float>(slot);
+        }
+        g_Data->QuadCount++;
+    }
+    Flush();
+
+    RendererCommand::EnableBlending(blending);
+
+    g_Data->Stats.QuadCount += static_cast<uint32_t>(quads.size());
+    quads.clear();
+}
+
+/**
+ * @brief Render the batch currently being built.
+ */
+void Renderer2D::Flush()
+{
+    if (g_Data->QuadCount == 0)
+        return;
+
+    // Upload the vertex data
+    uint32_t vertexCount = g_Data->QuadCount * 4;
+    const uint32_t slot = FrameSync::GetSlot();
+    g_Data->QuadVertexBuffers[slot]->SetData(g_Data->Vertices.data(),
+                                             vertexCount * sizeof(QuadVertex), vertexCount);
+
+    // Bind the textures of the batch
+    for (uint32_t i = 0; i < g_Data->TextureSlotCount; i++)
+        g_Data->TextureSlots[i]->BindToTextureUnit(i);
+
+    // Set the camera information (vertices are already in world space)
+    g_Data->QuadShader->Bind();
+    g_Data->QuadShader->SetMat4("u_Transform.Model", glm::mat4(1.0f));
+    g_Data->QuadShader->SetMat4("u_Transform.View", g_Data->ViewMatrix);
+    g_Data->QuadShader->SetMat4("u_Transform.Projection", g_Data->ProjectionMatrix);
+
+    // Render the batch
+    Renderer::DrawIndexed(g_Data->QuadDrawables[slot], g_Data->QuadCount * 6);
+    g_Data->Stats.DrawCalls++;
+
+    // Reset the batch
+    g_Data->QuadCount = 0;
+    g_Data->TextureSlotCount = 1;
+}
+
+/**
+ * @brief Submit a quad.
+ *
+ * @param quad The quad specification.
+ */
+void Renderer2D::DrawQuad(const QuadSpecification& quad)
+{
+    // Define the corner offsets (rotation around the z-axis)
+    glm::vec2 halfSize = 0.5f * quad.Size;
+    glm::vec2 axisX = glm::vec2(halfSize.x, 0.0f);
+    glm::vec2 axisY = glm::vec2(0.0f, halfSize.y);
+    if (quad.Rotation != 0.0f)
+    {
+        float angle = glm::radians(quad.Rotation);
+        float c = std::cos(angle);
+        float s = std::sin(angle);
+        axisX = glm::vec2(c, s) * halfSize.x;
+        axisY = glm::vec2(-s, c) * halfSize.y;
+    }
+
+    const glm::vec4 center = glm::vec4(quad.Position, 1.0f);
+    const std::array<glm::vec4, 4> corners = {
+        center + glm::vec4(-axisX - axisY, 0.0f, 0.0f),
+        center + glm::vec4( axisX - axisY, 0.0f, 0.0f),
+        center + glm::vec4( axisX + axisY, 0.0f, 0.0f),
+        center + glm::vec4(-axisX + axisY, 0.0f, 0.0f)
+    };
+
+    SubmitQuad(corners, quad.TextureRect, quad.Tint, quad.TextureMap.get());
+}
+
+/**
+ * @brief Submit a colored quad.
+ *
+ * @param position Center of the quad.
+ * @param size Size of the quad.
+ * @param color Color of the quad.
+ */
+void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
+                          const glm::vec4& color)
+{
+    DrawRotatedQuad(position, size, 0.0f, nullptr, color);
+}
+
+/**
+ * @brief Submit a textured quad.
+ *
+ * @param position Center of the quad.
+ * @param size Size of the quad.
+ * @param texture Texture of the quad.
+ * @param tint Color multiplied with the texture.
+ */
+void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
+                          const std::shared_ptr<Texture>& texture, const glm::vec4& tint)
+{
+    DrawRotatedQuad(position, size, 0.0f, texture, tint);
+}
+
+/**
+ * @brief Submit a colored quad rotated around the z-axis.
+ *
+ * @param position Center of the quad.
+ * @param size Size of the quad.
+ * @param rotation Rotation angle (degrees).
+ * @param color Color of the quad.
+ */
+void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size,
+                                 const float rotation, const glm::vec4& color)
+{
+    DrawRotatedQuad(position, size, rotation, nullptr, color);
+}
+
+/**
+ * @brief Submit a textured quad rotated around the z-axis.
+ *
+ * @param position Center of the quad.
+ * @param size Size of the quad.
+ * @param rotation Rotation angle (degrees).
+ * @param texture Texture of the quad.
+ * @param tint Color multiplied with the texture.
+ */
+void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size,
+                                 const float rotation, const std::shared_ptr<Texture>& texture,
+                                 const glm::vec4& tint)
+{
+    QuadSpecification quad;
+    quad.Position = position;
+    quad.Size = size;
+    quad.Rotation = rotation;
+    quad.Tint = tint;
+    quad.TextureMap = texture;
+    DrawQuad(quad);
+}
+
+/**
+ * @brief Submit a quad defined by a transformation matrix (applied to a unit quad).
+ *
+ * @param transform The transformation matrix of the quad.
+ * @param texture Texture of the quad.
+ * @param textureRect Texture coordinates sub-rectangle (min.x, min.y, max.x, max.y).
+ * @param tint Color multiplied with the texture.
+ */
+void Renderer2D::DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture,
+                          const glm::vec4& textureRect, const glm::vec4& tint)
+{
+    const std::array<glm::vec4, 4> corners = {
+        transform * g_QuadPositions[0],
+        transform * g_QuadPositions[1],
+        transform * g_QuadPositions[2],
+        transform * g_QuadPositions[3]
+    };
+
+    SubmitQuad(corners, textureRect, tint, texture.get());
+}
+
+/**
+ * @brief Reset the 2D rendering statistics.
+ */
+void Renderer2D::ResetStats()
+{
+    if (g_Data)
+        g_Data->Stats = Statistics();
+}
+
+/**
+ * @brief Get the current 2D rendering statistics.
+ *
+ * @return The rendering statistics structure.
+ */
+Renderer2D::Statistics Renderer2D::GetStats()
+{
+    return g_Data ? g_Data->Stats : Statistics();
+}
+
+} // namespace pixc
@@ -4,6 +4,9 @@
 #include "Foundation/Renderer/GraphicsContext.h"
 
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/SoftwareRendererAPI.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/MetalRendererAPI.h"
 #endif
@@ -11,7 +14,12 @@
 namespace pixc {
 
 // Define static variables
+#ifdef PIXC_SOFTWARE_RENDERER
+RendererAPI::API RendererAPI::s_API = RendererAPI::API::Software;
+#else
 RendererAPI::API RendererAPI::s_API = RendererAPI::API::Metal;
+#endif
+bool RendererAPI::s_ReversedDepth = false;
 
 /**
  * Creates a new Renderer API instance based on the selected API.
@@ -33,12 +41,95 @@ std::unique_ptr<RendererAPI> RendererAPI::Create()
         case RendererAPI::API::Metal:
             return std::make_unique<MetalRendererAPI>();
 #endif
+            
+#ifdef PIXC_SOFTWARE_RENDERER
+        case RendererAPI::API::Software:
+            return std::make_unique<SoftwareRendererAPI>();
+#endif
     }
     
     PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");
     return nullptr;
 }
 
+/**
+ * @brief Get the depth function to be used with the current depth convention.
+ *
+ * The depth functions are always defined for the standard depth (the nearest fragments have the
+ * lowest depth). When the depth is reversed, the comparisons are flipped.
+ *
+ * @param function The depth function (for the standard depth).
+ *
+ * @return The depth function to be used.
+ */
+DepthFunction RendererAPI::GetDepthFunction(const DepthFunction function)
+{
+    if (!s_ReversedDepth)
+        return function;
+    
+    switch (function)
+    {
+        case DepthFunction::Less:       return DepthFunction::Greater;
+        case DepthFunction::LEqual:     return DepthFunction::GEqual;
+        case DepthFunction::Greater:    return DepthFunction::Less;
+        case DepthFunction::GEqual:     return DepthFunction::LEqual;
+        default:                        return function;
+    }
+}
+
+/**
+ * @brief Get the projection matrix to be used with the current depth convention.
+ *
+ * The projections are always defined for the standard depth in [0, 1]. When the depth is
+ * reversed, the clip space depth becomes `w - z` (near plane at 1, far plane at 0).
+ *
+ * @param projection The projection matrix (for the standard depth).
+ *
+ * @return The projection matrix to be used.
+ */
+glm::mat4 RendererAPI::GetDepthProjection(const glm::mat4& projection)
+{
+    if (!s_ReversedDepth)
+        return projection;
+    
+    glm::mat4 reverse = glm::mat4(1.0f);
+    reverse[2][2] = -1.0f;
+    reverse[3][2] = 1.0f;
+    return reverse * projection;
+}
+
+/**
+ * @brief Enable or disable the reversed depth.
+ *
+ * The clip space depth is mapped to [0, 1] with the near plane at 1 and the far plane at 0. The
+ * floating-point precision then gets distributed (almost) evenly over the distance, instead of
+ * being concentrated close to the near plane. The projections of the cameras, the depth functions
+ * and the depth clears follow the mode, and the shaders are compiled with the
+ * `PIXC_REVERSED_DEPTH` and `PIXC_DEPTH_ZERO_TO_ONE` definitions.
+ *
+ * @note The mode has to be defined before the shaders, the framebuffers and the cameras are
+ * created (i.e., right after the renderer is initialized).
+ *
+ * @param enabled Pass true to reverse the depth, false to restore the standard depth.
+ */
+void RendererAPI::SetReversedDepth(const bool enabled)
+{
+    if (enabled == s_ReversedDepth)
+        return;
+    
+    if (enabled && !IsReversedDepthSupported())
+    {
+        PIXEL_CORE_WARN("Reversed depth is not supported by the rendering API!");
+        return;
+    }
+    
+    ApplyReversedDepth(enabled);
+    s_ReversedDepth = enabled;
+    
+    // Restore the default depth function for the new convention
+    SetDepthFunction(GetDepthFunction(DepthFunction::Less));
+}
+
 /**
  * @brief Initialize a new rendering pass.
  *
@@ -55,6 +146,40 @@ void RendererAPI::BeginRenderPass(const std::shared_ptr<FrameBuffer>& framebuffe
     m_ActiveFrameBuffer->Bind();                // render into the framebuffer
 }
 
+/**
+ * @brief Apply the load actions of the current rendering pass, and keep its store actions for the
+ * end of the pass.
+ *
+ * @param actions The actions of the render pass.
+ */
+void RendererAPI::ApplyLoadActions(const RenderPassActions& actions)
+{
+    m_ActiveActions = actions;
+    
+    // The clear depth is defined for the standard depth
+    if (s_ReversedDepth)
+        m_ActiveActions->ClearDepth = 1.0f - actions.ClearDepth;
+    
+    if (m_ActiveFrameBuffer)
+    {
+        m_ActiveFrameBuffer->ApplyLoadActions(*m_ActiveActions);
+        return;
+    }
+    
+    // The screen is cleared as a whole
+    RenderTargetMask targets = RenderTargetMask::None;
+    if (actions.Color.Load == LoadAction::Clear)
+        targets = targets | RenderTargetMask::Color;
+    if (actions.Depth.Load == LoadAction::Clear)
+        targets = targets | RenderTargetMask::Depth;
+    
+    if (targets == RenderTargetMask::None)
+        return;
+    
+    SetClearColor(actions.ClearColor);
+    Clear(targets);
+}
+
 /**
  * @brief Finalize the current rendering pass.
  */
@@ -62,13 +187,47 @@ void RendererAPI::EndRenderPass()
 {
     // If no framebuffer is active, return
     if (!m_ActiveFrameBuffer)
+    {
+        m_ActiveActions.reset();
         return;
+    }
+    
+    // Resolve and release the attachments that are not needed anymore
+    if (m_ActiveActions)
+    {
+        ResolveAttachments(*m_ActiveActions);
+        m_ActiveFrameBuffer->ApplyStoreActions(*m_ActiveActions);
+        m_ActiveActions.reset();
+    }
     
     // Unbound the framebuffer if necessary
     m_ActiveFrameBuffer->Unbind();
     m_ActiveFrameBuffer = nullptr;
 }
 
+/**
+ * @brief Resolve the attachments with a `StoreAction::Resolve` into the resolve target (the
+ * other attachments, and the depth unless requested, are not resolved).
+ *
+ * @param actions The actions of the render pass.
+ */
+void RendererAPI::ResolveAttachments(const RenderPassActions& actions)
+{
+    std::vector<uint32_t> colors;
+    for (uint32_t i = 0; i < m_ActiveFrameBuffer->GetColorAttachmentCount(); i++)
+    {
+        if (actions.GetColorActions(i).Store == StoreAction::Resolve)
+            colors.push_back(i);
+    }
+    bool depth = m_ActiveFrameBuffer->HasDepthAttachment() && actions.Depth.Store == StoreAction::Resolve;
+    
+    if (colors.empty() && !depth)
+        return;
+    
+    PIXEL_CORE_ASSERT(actions.ResolveTarget, "Resolving an attachment without a resolve target!");
+    FrameBuffer::Resolve(m_ActiveFrameBuffer, actions.ResolveTarget, colors, depth);
+}
+
 /**
  * @brief Clear the buffers to preset values.
  */
@@ -47,6 +47,19 @@ void RendererCommand::BeginRenderPass(const std::shared_ptr<FrameBuffer>& frameb
     s_API->BeginRenderPass(framebuffer);
 }
 
+/**
+ * @brief Initialize a new rendering pass with load and store actions for its attachments.
+ *
+ * @param framebuffer Buffer to hold to result of the rendered pass.
+ * @param actions The actions applied to the attachments when the pass begins and ends.
+ */
+void RendererCommand::BeginRenderPass(const std::shared_ptr<FrameBuffer>& framebuffer,
+                                      const RenderPassActions& actions)
+{
+    s_API->BeginRenderPass(framebuffer);
+    s_API->ApplyLoadActions(actions);
+}
+
 /**
  * @brief Finalize the current rendering pass.
  */
@@ -85,6 +98,64 @@ void RendererCommand::Draw(const std::shared_ptr<Drawable>& drawable,
     s_API->Draw(drawable, primitive);
 }
 
+/**
+ * @brief Render only the first indices of a drawable object.
+ *
+ * @param drawable The drawable object containing the data for rendering.
+ * @param indexCount The number of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void RendererCommand::DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                                  const uint32_t indexCount,
+                                  const PrimitiveType &primitive)
+{
+    s_API->DrawIndexed(drawable, indexCount, primitive);
+}
+
+/**
+ * @brief Render several ranges of indices of a drawable object.
+ *
+ * @param drawable The drawable object containing the data for rendering.
+ * @param ranges The ranges of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void RendererCommand::DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                                 const std::vector<IndexRange>& ranges,
+                                 const PrimitiveType &primitive)
+{
+    s_API->DrawRanges(drawable, ranges, primitive);
+}
+
+/**
+ * @brief Render a single triangle covering the screen, without vertex data.
+ */
+void RendererCommand::DrawFullscreen()
+{
+    s_API->DrawFullscreen();
+}
+
+/**
+ * @brief Check if the compute passes are supported by the rendering API.
+ *
+ * @return `true` if compute shaders and storage buffers can be used.
+ */
+bool RendererCommand::IsComputeSupported()
+{
+    return s_API->IsComputeSupported();
+}
+
+/**
+ * @brief Run the compute shader currently bound.
+ *
+ * @param x The number of work groups in the x dimension.
+ * @param y The number of work groups in the y dimension.
+ * @param z The number of work groups in the z dimension.
+ */
+void RendererCommand::DispatchCompute(const uint32_t x, const uint32_t y, const uint32_t z)
+{
+    s_API->DispatchCompute(x, y, z);
+}
+
 /**
  * @brief Enable or disable depth testing.
  *
@@ -98,11 +169,13 @@ void RendererCommand::EnableDepthTesting(const bool enabled)
 /**
  * @brief Set the depth comparison function used during depth testing.
  *
+ * The function is defined for the standard depth, and flipped if the depth is reversed.
+ *
  * @param function The depth function to use (e.g., Less, LessEqual, Greater, Always).
  */
 void RendererCommand::SetDepthFunction(const DepthFunction function)
 {
-    s_API->SetDepthFunction(function);
+    s_API->SetDepthFunction(RendererAPI::GetDepthFunction(function));
 }
 
 /**
@@ -114,7 +187,17 @@ void RendererCommand::SetDepthFunction(const DepthFunction function)
 void RendererCommand::ConfigureDepthTesting(const bool enabled,
                                             const DepthFunction function)
 {
-    s_API->ConfigureDepthTesting(enabled, function);
+    s_API->ConfigureDepthTesting(enabled, RendererAPI::GetDepthFunction(function));
+}
+
+/**
+ * @brief Enable or disable the reversed depth (see `RendererAPI::SetReversedDepth()`).
+ *
+ * @param enabled Pass true to reverse the depth, false to restore the standard depth.
+ */
+void RendererCommand::SetReversedDepth(const bool enabled)
+{
+    s_API->SetReversedDepth(enabled);
 }
 
 /**
@@ -137,4 +220,35 @@ void RendererCommand::SetCubeMapSeamless(const bool enabled)
     s_API->SetCubeMapSeamless(enabled);
 }
 
+/**
+ * @brief Enable or disable alpha blending.
+ *
+ * @param enabled Set to `true` to enable alpha blending, or `false` to disable it.
+ */
+void RendererCommand::EnableBlending(const bool enabled)
+{
+    s_Blending = enabled;
+    s_API->EnableBlending(enabled);
+}
+
+/**
+ * @brief Enable or disable the writing into the color attachments.
+ *
+ * @param enabled Set to `true` to write the color of the fragments, or `false` to discard it.
+ */
+void RendererCommand::EnableColorWriting(const bool enabled)
+{
+    s_API->EnableColorWriting(enabled);
+}
+
+/**
+ * @brief Enable or disable the writing into the depth buffer.
+ *
+ * @param enabled Set to `true` to write the depth of the fragments, or `false` to keep the buffer.
+ */
+void RendererCommand::EnableDepthWriting(const bool enabled)
+{
+    s_API->EnableDepthWriting(enabled);
+}
+
 } // namespace pixc
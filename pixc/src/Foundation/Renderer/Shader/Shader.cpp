@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Shader/OpenGLShader.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Shader/SoftwareShader.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Shader/MetalShader.h"
 #endif
@@ -61,6 +64,28 @@ std::string Shader::ReadFile(const std::filesystem::path& filePath)
     return buffer.str();
 }
 
+/**
+ * @brief Get the definitions added to the sources of the shaders (after their `#version` line).
+ *
+ * They select the variants of the shader chunks matching the depth conventions of the renderer:
+ * - `PIXC_DEPTH_ZERO_TO_ONE`: the clip space depth is in [0, 1], as output by the projections
+ *   (it is otherwise remapped to the OpenGL range [-1, 1]).
+ * - `PIXC_REVERSED_DEPTH`: the depth is reversed (near plane at 1, far plane at 0).
+ *
+ * @return The definitions (one per line).
+ */
+std::string Shader::GetDefinitions()
+{
+    const bool reversed = RendererAPI::IsDepthReversed();
+    
+    std::string definitions;
+    if (reversed || Renderer::GetAPI() != RendererAPI::API::OpenGL)
+        definitions += "#define PIXC_DEPTH_ZERO_TO_ONE\n";
+    if (reversed)
+        definitions += "#define PIXC_REVERSED_DEPTH\n";
+    return definitions;
+}
+
 /**
  * @brief Verify if the uniform is defined in the shader program.
  *
@@ -107,6 +132,13 @@ std::filesystem::path Shader::GetFullFilePath(const std::filesystem::path& fileP
             break;
 #endif
             
+#ifdef PIXC_SOFTWARE_RENDERER
+        // The software shaders read the GLSL sources (see SoftwareShader)
+        case RendererAPI::API::Software:
+            extension = ".glsl";
+            break;
+#endif
+            
         default:
             PIXEL_CORE_ASSERT(false, "Unknown Renderer API!");
             return filePath;
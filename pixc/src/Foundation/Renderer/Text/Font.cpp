@@ -0,0 +1,391 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Text/Font.h"
+
+#include "Foundation/Core/Resources.h"
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+
+namespace pixc {
+
+/// @brief Identifier and version of the cached atlas files.
+static const char g_AtlasMagic[4] = { 'P', 'X', 'S', 'F' };
+static const uint32_t g_AtlasVersion = 1;
+
+/// @brief Value stored in the distance field on the glyph contour.
+static const unsigned char g_OnEdgeValue = 128;
+
+/**
+ * @brief Opaque TrueType font information.
+ */
+struct Font::FontInfo
+{
+    stbtt_fontinfo Info;
+};
+
+/**
+ * @brief Compute a hash of a block of data (FNV-1a), used to validate cached atlases.
+ *
+ * @param data The data to be hashed.
+ *
+ * @return The hash value.
+ */
+static uint64_t HashData(const std::vector<unsigned char>& data)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Load a font from a TTF file.
+ *
+ * The glyph atlas is read from the disk cache if available, or generated (and cached, if the cache
+ * directory of the resources is defined) otherwise.
+ *
+ * @param filePath The TTF file path.
+ * @param spec The atlas specification.
+ */
+Font::Font(const std::filesystem::path& filePath, const FontSpecification& spec)
+    : m_FilePath(filePath), m_Spec(spec), m_Info(std::make_unique<FontInfo>())
+{
+    // Read the font file
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_WARN("Failed to load: " + filePath.filename().string());
+        return;
+    }
+    m_Data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    // Parse the font information
+    if (!stbtt_InitFont(&m_Info->Info, m_Data.data(), stbtt_GetFontOffsetForIndex(m_Data.data(), 0)))
+    {
+        PIXEL_CORE_WARN("Invalid font file: " + filePath.filename().string());
+        return;
+    }
+    m_Scale = stbtt_ScaleForMappingEmToPixels(&m_Info->Info, 1.0f);
+
+    // Read the atlas from the cache, or generate it
+    std::vector<std::vector<uint8_t>> pages;
+    std::filesystem::path cachePath = GetCachePath(filePath, m_Spec);
+    if (cachePath.empty() || !LoadAtlas(cachePath, pages))
+    {
+        GenerateAtlas(pages);
+        if (!cachePath.empty())
+            SaveAtlas(cachePath, pages);
+    }
+
+    CreatePages(pages);
+}
+
+/**
+ * @brief Delete the font.
+ */
+Font::~Font() = default;
+
+/**
+ * @brief Get the path where the atlas of a font is cached.
+ *
+ * The atlases are cached in the cache directory of the resources (see
+ * `ResourcesManager::SetCachePath()`). Their name includes a hash of the absolute font path, so
+ * that fonts with the same file name in different directories do not share their atlas.
+ *
+ * @param filePath The TTF file path.
+ * @param spec The atlas specification.
+ *
+ * @return The cache file path, or an empty path if the cache is disabled.
+ */
+std::filesystem::path Font::GetCachePath(const std::filesystem::path& filePath,
+                                         const FontSpecification& spec)
+{
+    std::filesystem::path directory = ResourcesManager::GetCachePath();
+    if (directory.empty())
+        return {};
+
+    std::error_code error;
+    std::filesystem::path absolutePath = std::filesystem::absolute(filePath, error);
+    if (error)
+        absolutePath = filePath;
+
+    std::stringstream name;
+    name << filePath.stem().string() << "." << std::hex
+         << std::hash<std::string>{}(absolutePath.lexically_normal().string()) << std::dec
+         << "." << spec.GlyphSize << ".sdfatlas";
+    return directory / name.str();
+}
+
+/**
+ * @brief Get the information of a glyph.
+ *
+ * @param codepoint The character (unicode codepoint).
+ *
+ * @return The glyph, or the glyph of '?' if the character is not part of the atlas.
+ */
+const Glyph& Font::GetGlyph(uint32_t codepoint) const
+{
+    auto it = m_Glyphs.find(codepoint);
+    if (it != m_Glyphs.end())
+        return it->second;
+
+    static const Glyph empty;
+    it = m_Glyphs.find('?');
+    return it != m_Glyphs.end() ? it->second : empty;
+}
+
+/**
+ * @brief Get the kerning adjustment between two characters.
+ *
+ * @param first The first character.
+ * @param second The character following the first one.
+ *
+ * @return The horizontal adjustment (em units).
+ */
+float Font::GetKerning(uint32_t first, uint32_t second) const
+{
+    if (m_Data.empty())
+        return 0.0f;
+
+    return stbtt_GetCodepointKernAdvance(&m_Info->Info, first, second) * m_Scale;
+}
+
+/**
+ * @brief Rasterize the glyphs of the font into distance field pages (shelf packing).
+ *
+ * @param pages The pixel data of the pages (single channel, first row at the top).
+ */
+void Font::GenerateAtlas(std::vector<std::vector<uint8_t>>& pages)
+{
+    PIXEL_CORE_INFO("Generating SDF atlas for " + m_FilePath.filename().string());
+
+    const stbtt_fontinfo* info = &m_Info->Info;
+    const uint32_t atlasSize = m_Spec.AtlasSize;
+    const float pixelScale = stbtt_ScaleForMappingEmToPixels(info, (float)m_Spec.GlyphSize);
+    const float pixelDistanceScale = (float)g_OnEdgeValue / (float)m_Spec.Padding;
+
+    // Define the vertical metrics
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(info, &ascent, &descent, &lineGap);
+    m_Ascender = ascent * m_Scale;
+    m_Descender = descent * m_Scale;
+    m_LineHeight = (ascent - descent + lineGap) * m_Scale;
+
+    // Packing cursor
+    uint32_t penX = 0, penY = 0, rowHeight = 0;
+    pages.emplace_back(atlasSize * atlasSize, 0);
+
+    for (uint32_t codepoint = m_Spec.FirstCodepoint; codepoint <= m_Spec.LastCodepoint; codepoint++)
+    {
+        int index = stbtt_FindGlyphIndex(info, codepoint);
+        if (index == 0 && codepoint != ' ')
+            continue;
+
+        Glyph glyph;
+        int advance, leftBearing;
+        stbtt_GetGlyphHMetrics(info, index, &advance, &leftBearing);
+        glyph.Advance = advance * m_Scale;
+
+        // Rasterize the distance field (empty glyphs, e.g. spaces, only advance the pen)
+        int width, height, offsetX, offsetY;
+        unsigned char* sdf = stbtt_GetGlyphSDF(info, pixelScale, index, m_Spec.Padding,
+                                               g_OnEdgeValue, pixelDistanceScale,
+                                               &width, &height, &offsetX, &offsetY);
+        if (!sdf)
+        {
+            m_Glyphs[codepoint] = glyph;
+            continue;
+        }
+
+        // A glyph larger than a page cannot be packed (it only advances the pen)
+        if ((uint32_t)width + 1 > atlasSize || (uint32_t)height + 1 > atlasSize)
+        {
+            PIXEL_CORE_WARN("Glyph {0} of {1} does not fit in an atlas page", codepoint,
+                            m_FilePath.filename().string());
+            stbtt_FreeSDF(sdf, nullptr);
+            m_Glyphs[codepoint] = glyph;
+            continue;
+        }
+
+        // Move to the next row or page if the glyph does not fit (1px gap avoids bleeding)
+        if (penX + width + 1 > atlasSize)
+        {
+            penX = 0;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        if (penY + height + 1 > atlasSize)
+        {
+            pages.emplace_back(atlasSize * atlasSize, 0);
+            penX = 0;
+            penY = 0;
+            rowHeight = 0;
+        }
+
+        // Copy the glyph into the page
+        PIXEL_CORE_ASSERT(penX + width <= atlasSize && penY + height <= atlasSize,
+                          "Glyph outside of its atlas page!");
+        auto& page = pages.back();
+        for (int y = 0; y < height; y++)
+            memcpy(&page[(penY + y) * atlasSize + penX], &sdf[y * width], width);
+        stbtt_FreeSDF(sdf, nullptr);
+
+        // Bottom-left and top-right corners (the first row of the page is its top)
+        glyph.Page = static_cast<uint32_t>(pages.size() - 1);
+        glyph.TextureRect = glm::vec4((float)penX, (float)(penY + height),
+                                      (float)(penX + width), (float)penY) / (float)atlasSize;
+        glyph.PlaneRect = glm::vec4((float)offsetX, (float)-(offsetY + height),
+                                    (float)(offsetX + width), (float)-offsetY) / (float)m_Spec.GlyphSize;
+        m_Glyphs[codepoint] = glyph;
+
+        penX += width + 1;
+        rowHeight = std::max(rowHeight, (uint32_t)height);
+    }
+}
+
+/**
+ * @brief Read the atlas from the disk cache.
+ *
+ * @param cachePath The cache file path.
+ * @param pages The pixel data of the pages.
+ *
+ * @return `true` if a valid atlas (same font and specification) has been read.
+ */
+bool Font::LoadAtlas(const std::filesystem::path& cachePath,
+                     std::vector<std::vector<uint8_t>>& pages)
+{
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    auto read = [&file](auto& value) {
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    };
+
+    // Validate the header
+    char magic[4];
+    uint32_t version;
+    uint64_t hash;
+    FontSpecification spec;
+    file.read(magic, sizeof(magic));
+    read(version);
+    read(hash);
+    read(spec.GlyphSize); read(spec.Padding); read(spec.AtlasSize);
+    read(spec.FirstCodepoint); read(spec.LastCodepoint);
+
+    if (!file || memcmp(magic, g_AtlasMagic, sizeof(magic)) != 0 ||
+        version != g_AtlasVersion || hash != HashData(m_Data) || !(spec == m_Spec))
+        return false;
+
+    // Vertical metrics
+    read(m_LineHeight); read(m_Ascender); read(m_Descender);
+
+    // Glyphs
+    uint32_t glyphCount;
+    read(glyphCount);
+    for (uint32_t i = 0; i < glyphCount && file; i++)
+    {
+        uint32_t codepoint;
+        Glyph glyph;
+        read(codepoint);
+        read(glyph.Page); read(glyph.TextureRect); read(glyph.PlaneRect); read(glyph.Advance);
+        m_Glyphs[codepoint] = glyph;
+    }
+
+    // Pages (their count is checked against the file size before any allocation)
+    uint32_t pageCount = 0;
+    read(pageCount);
+    std::error_code error;
+    uintmax_t fileSize = std::filesystem::file_size(cachePath, error);
+    if (error || uintmax_t(pageCount) * m_Spec.AtlasSize * m_Spec.AtlasSize > fileSize)
+        file.setstate(std::ios::failbit);
+    pages.resize(file ? pageCount : 0);
+    for (auto& page : pages)
+    {
+        page.resize(m_Spec.AtlasSize * m_Spec.AtlasSize);
+        file.read(reinterpret_cast<char*>(page.data()), page.size());
+    }
+
+    // The glyphs must refer to the pages read
+    bool valid = true;
+    for (const auto& [codepoint, glyph] : m_Glyphs)
+        valid &= glyph.Page < pages.size();
+
+    if (!file || !valid)
+    {
+        m_Glyphs.clear();
+        pages.clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Write the atlas into the disk cache.
+ *
+ * @param cachePath The cache file path.
+ * @param pages The pixel data of the pages.
+ */
+void Font::SaveAtlas(const std::filesystem::path& cachePath,
+                     const std::vector<std::vector<uint8_t>>& pages) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(cachePath.parent_path(), error);
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_WARN("Unable to cache the font atlas in " + cachePath.string());
+        return;
+    }
+
+    auto write = [&file](const auto& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    // Header
+    file.write(g_AtlasMagic, sizeof(g_AtlasMagic));
+    write(g_AtlasVersion);
+    write(HashData(m_Data));
+    write(m_Spec.GlyphSize); write(m_Spec.Padding); write(m_Spec.AtlasSize);
+    write(m_Spec.FirstCodepoint); write(m_Spec.LastCodepoint);
+
+    // Vertical metrics
+    write(m_LineHeight); write(m_Ascender); write(m_Descender);
+
+    // Glyphs
+    write(static_cast<uint32_t>(m_Glyphs.size()));
+    for (const auto& [codepoint, glyph] : m_Glyphs)
+    {
+        write(codepoint);
+        write(glyph.Page); write(glyph.TextureRect); write(glyph.PlaneRect); write(glyph.Advance);
+    }
+
+    // Pages
+    write(static_cast<uint32_t>(pages.size()));
+    for (const auto& page : pages)
+        file.write(reinterpret_cast<const char*>(page.data()), page.size());
+}
+
+/**
+ * @brief Upload the atlas pages into textures.
+ *
+ * @param pages The pixel data of the pages.
+ */
+void Font::CreatePages(const std::vector<std::vector<uint8_t>>& pages)
+{
+    TextureSpecification spec;
+    spec.SetTextureSize(m_Spec.AtlasSize, m_Spec.AtlasSize);
+    spec.Format = TextureFormat::R8;
+    spec.SetMinMagFilter(TextureFilter::Linear);
+    spec.Wrap = TextureWrap::ClampToEdge;
+    spec.MipMaps = false;
+
+    m_Pages.clear();
+    for (const auto& page : pages)
+        m_Pages.push_back(Texture2D::CreateFromData(page.data(), spec));
+}
+
+} // namespace pixc
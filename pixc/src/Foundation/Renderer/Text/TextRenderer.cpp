@@ -0,0 +1,425 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Text/TextRenderer.h"
+
+#include "Foundation/Core/Resources.h"
+
+#include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/RendererCommand.h"
+#include "Foundation/Renderer/FrameSync.h"
+
+#include "Foundation/Renderer/Drawable/Drawable.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace pixc {
+
+/**
+ * @brief Represents a vertex of a glyph quad.
+ */
+struct TextVertex
+{
+    glm::vec4 Position;         ///< Vertex position (world space, or clip space for screen-space text).
+    glm::vec2 TextureCoord;     ///< Texture coordinates in the atlas page.
+    glm::vec4 Color;            ///< Text color.
+    float ScreenSpace;          ///< Whether the position is already defined in clip space (1) or not (0).
+};
+
+/**
+ * @brief Represents the state of the text renderer.
+ */
+struct TextRendererData
+{
+    ///< Maximum number of glyphs rendered in a single draw call.
+    static constexpr uint32_t MaxGlyphs = 16384;
+    static constexpr uint32_t MaxVertices = MaxGlyphs * 4;
+    static constexpr uint32_t MaxIndices = MaxGlyphs * 6;
+
+    ///< Geometry (streaming vertex buffer of each frame in flight, and static index buffer).
+    std::array<std::shared_ptr<Drawable>, FrameSync::MaxFramesInFlight> GlyphDrawables;
+    std::array<std::shared_ptr<VertexBuffer>, FrameSync::MaxFramesInFlight> GlyphVertexBuffers;
+    ///< Shader used to render the glyphs.
+    std::shared_ptr<Shader> TextShader;
+
+    ///< Camera information of the current scene.
+    glm::mat4 ViewMatrix = glm::mat4(1.0f);
+    glm::mat4 ProjectionMatrix = glm::mat4(1.0f);
+    glm::vec2 ViewportSize = glm::vec2(1.0f);
+
+    ///< Atlas pages used in the current scene, and the glyph vertices grouped by page.
+    std::vector<Texture2D*> Pages;
+    std::vector<std::vector<TextVertex>> PageVertices;
+
+    ///< Rendering statistics.
+    TextRenderer::Statistics Stats;
+};
+
+static std::unique_ptr<TextRendererData> g_Data;
+
+/**
+ * @brief Decode the next character of an UTF-8 string.
+ *
+ * @param text The string.
+ * @param i The position of the character, moved to the following character.
+ *
+ * @return The unicode codepoint ('?' for invalid sequences).
+ */
+static uint32_t DecodeUTF8(const std::string& text, size_t& i)
+{
+    unsigned char c = text[i++];
+    if (c < 0x80)
+        return c;
+
+    uint32_t length = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : (c >= 0xC0) ? 1 : 0;
+    if (length == 0 || i + length > text.size())
+        return '?';
+
+    uint32_t codepoint = c & (0x3F >> length);
+    for (uint32_t j = 0; j < length; j++)
+        codepoint = (codepoint << 6) | (text[i++] & 0x3F);
+    return codepoint;
+}
+
+/**
+ * @brief Get the vertex list of an atlas page, registering the page in the scene if needed.
+ *
+ * @param page The atlas page.
+ *
+ * @return The vertices of the glyphs rendered with the page.
+ */
+static std::vector<TextVertex>& GetPageVertices(Texture2D* page)
+{
+    auto it = std::find(g_Data->Pages.begin(), g_Data->Pages.end(), page);
+    if (it != g_Data->Pages.end())
+        return g_Data->PageVertices[std::distance(g_Data->Pages.begin(), it)];
+
+    g_Data->Pages.push_back(page);
+    return g_Data->PageVertices.emplace_back();
+}
+
+/**
+ * @brief Lay out a string into glyph quads.
+ *
+ * The quads are defined in a local 2D space with the origin on the baseline of the first line,
+ * scaled by the size of the text. Each quad is forwarded to a function that places it.
+ *
+ * @param text The string (UTF-8).
+ * @param font The font.
+ * @param spec The text specification.
+ * @param place Function converting a local position into a vertex position.
+ * @param screenSpace Whether the vertex positions are defined in clip space.
+ */
+static void LayoutString(const std::string& text, const Font& font, const TextSpecification& spec,
+                         const std::function<glm::vec4(const glm::vec2&)>& place, bool screenSpace)
+{
+    PIXEL_CORE_ASSERT(g_Data, "TextRenderer::BeginScene() must be called before drawing text!");
+
+    const auto& pages = font.GetPages();
+    if (pages.empty())
+        return;
+
+    const float lineHeight = font.GetLineHeight() * spec.LineSpacing * spec.Size;
+    const float space = screenSpace ? 1.0f : 0.0f;
+
+    size_t lineStart = 0;
+    float y = 0.0f;
+    while (lineStart <= text.size())
+    {
+        size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+            lineEnd = text.size();
+
+        // Decode the line
+        std::vector<uint32_t> codepoints;
+        for (size_t i = lineStart; i < lineEnd;)
+            codepoints.push_back(DecodeUTF8(text, i));
+
+        // Measure the line to align it
+        float width = 0.0f;
+        for (size_t i = 0; i < codepoints.size(); i++)
+        {
+            width += font.GetGlyph(codepoints[i]).Advance;
+            if (i + 1 < codepoints.size())
+                width += font.GetKerning(codepoints[i], codepoints[i + 1]);
+        }
+        width *= spec.Size;
+
+        float x = 0.0f;
+        if (spec.Alignment == TextAlignment::Center)
+            x = -0.5f * width;
+        else if (spec.Alignment == TextAlignment::Right)
+            x = -width;
+
+        // Define the glyph quads
+        for (size_t i = 0; i < codepoints.size(); i++)
+        {
+            const Glyph& glyph = font.GetGlyph(codepoints[i]);
+
+            if (glyph.PlaneRect.x != glyph.PlaneRect.z && glyph.Page < pages.size())
+            {
+                const glm::vec4 rect = glyph.PlaneRect * spec.Size + glm::vec4(x, y, x, y);
+                const glm::vec4& uv = glyph.TextureRect;
+
+                auto& vertices = GetPageVertices(pages[glyph.Page].get());
+                vertices.push_back({ place({ rect.x, rect.y }), { uv.x, uv.y }, spec.Color, space });
+                vertices.push_back({ place({ rect.z, rect.y }), { uv.z, uv.y }, spec.Color, space });
+                vertices.push_back({ place({ rect.z, rect.w }), { uv.z, uv.w }, spec.Color, space });
+                vertices.push_back({ place({ rect.x, rect.w }), { uv.x, uv.w }, spec.Color, space });
+                g_Data->Stats.GlyphCount++;
+            }
+
+            x += glyph.Advance * spec.Size;
+            if (i + 1 < codepoints.size())
+                x += font.GetKerning(codepoints[i], codepoints[i + 1]) * spec.Size;
+        }
+
+        y -= lineHeight;
+        lineStart = lineEnd + 1;
+    }
+}
+
+/**
+ * @brief Initialize the text renderer (geometry buffers and shader).
+ */
+void TextRenderer::Init()
+{
+    if (g_Data)
+        return;
+
+    g_Data = std::make_unique<TextRendererData>();
+
+    // Define the streaming vertex buffers (one per frame in flight)
+    for (auto& buffer : g_Data->GlyphVertexBuffers)
+    {
+        buffer = VertexBuffer::Create(TextRendererData::MaxVertices * sizeof(TextVertex));
+        buffer->SetLayout({
+            { "a_Position", { DataType::Vec4 } },
+            { "a_TextureCoord", { DataType::Vec2 } },
+            { "a_Color", { DataType::Vec4 } },
+            { "a_ScreenSpace", { DataType::Float } }
+        });
+    }
+
+    // Define the index buffer (same pattern for all the glyphs)
+    std::vector<uint32_t> indices(TextRendererData::MaxIndices);
+    for (uint32_t i = 0, offset = 0; i < TextRendererData::MaxIndices; i += 6, offset += 4)
+    {
+        indices[i + 0] = offset + 0;
+        indices[i + 1] = offset + 1;
+        indices[i + 2] = offset + 2;
+
+        indices[i + 3] = offset + 2;
+        indices[i + 4] = offset + 3;
+        indices[i + 5] = offset + 0;
+    }
+
+    // Define the shader
+    g_Data->TextShader = Shader::Create(ResourcesManager::GeneralPath("pixc/shaders/forward/unlit/Text"));
+    g_Data->TextShader->Bind();
+    g_Data->TextShader->SetInt("u_Atlas.Page", 0);
+    g_Data->TextShader->Unbind();
+
+    // Define the drawable objects
+    for (uint32_t i = 0; i < FrameSync::MaxFramesInFlight; i++)
+    {
+        g_Data->GlyphDrawables[i] = Drawable::Create();
+        g_Data->GlyphDrawables[i]->AddVertexBuffer(g_Data->GlyphVertexBuffers[i]);
+        g_Data->GlyphDrawables[i]->SetIndexData(indices);
+        g_Data->GlyphDrawables[i]->SetShader(g_Data->TextShader);
+    }
+}
+
+/**
+ * @brief Release the resources of the text renderer.
+ */
+void TextRenderer::Shutdown()
+{
+    g_Data.reset();
+}
+
+/**
+ * @brief Start a text scene.
+ *
+ * @param camera Rendering camera (its size defines the viewport of the screen-space text).
+ */
+void TextRenderer::BeginScene(const std::shared_ptr<Camera>& camera)
+{
+    PIXEL_CORE_ASSERT(camera, "Undefined camera for text rendering!");
+
+    BeginScene(camera->GetViewMatrix(), camera->GetProjectionMatrix(),
+               glm::vec2(camera->GetWidth(), camera->GetHeight()));
+}
+
+/**
+ * @brief Start a text scene.
+ *
+ * @param view The view matrix transformation.
+ * @param projection The projection matrix transformation.
+ * @param viewportSize The size of the viewport (in pixels).
+ */
+void TextRenderer::BeginScene(const glm::mat4& view, const glm::mat4& projection,
+                              const glm::vec2& viewportSize)
+{
+    // Make sure the renderer has been initialized
+    Init();
+
+    g_Data->ViewMatrix = view;
+    g_Data->ProjectionMatrix = projection;
+    g_Data->ViewportSize = glm::max(viewportSize, glm::vec2(1.0f));
+
+    g_Data->Pages.clear();
+    g_Data->PageVertices.clear();
+}
+
+/**
+ * @brief End the text scene and render all the submitted strings (one batch per atlas page).
+ */
+void TextRenderer::EndScene()
+{
+    PIXEL_CORE_ASSERT(g_Data, "TextRenderer::BeginScene() has not been called!");
+
+    if (g_Data->Pages.empty())
+        return;
+
+    // Set the camera information (world-space vertices are already transformed)
+    g_Data->TextShader->Bind();
+    g_Data->TextShader->SetMat4("u_Transform.Model", glm::mat4(1.0f));
+    g_Data->TextShader->SetMat4("u_Transform.View", g_Data->ViewMatrix);
+    g_Data->TextShader->SetMat4("u_Transform.Projection", g_Data->ProjectionMatrix);
+
+    // Blend the glyphs, then restore the blending state of the caller
+    bool blending = RendererCommand::IsBlendingEnabled();
+    RendererCommand::EnableBlending(true);
+
+    const uint32_t slot = FrameSync::GetSlot();
+    for (size_t p = 0; p < g_Data->Pages.size(); p++)
+    {
+        const auto& vertices = g_Data->PageVertices[p];
+        g_Data->Pages[p]->BindToTextureUnit(0);
+
+        // Split the page into batches if it exceeds the size of the buffer
+        for (size_t offset = 0; offset < vertices.size(); offset += TextRendererData::MaxVertices)
+        {
+            uint32_t vertexCount = static_cast<uint32_t>(
+                std::min<size_t>(vertices.size() - offset, TextRendererData::MaxVertices));
+            g_Data->GlyphVertexBuffers[slot]->SetData(&vertices[offset],
+                                                      vertexCount * sizeof(TextVertex), vertexCount);
+
+            Renderer::DrawIndexed(g_Data->GlyphDrawables[slot], (vertexCount / 4) * 6);
+            g_Data->Stats.DrawCalls++;
+        }
+    }
+
+    RendererCommand::EnableBlending(blending);
+
+    g_Data->Pages.clear();
+    g_Data->PageVertices.clear();
+}
+
+/**
+ * @brief Submit a string in world space.
+ *
+ * The text lies on the xy-plane of the transformation, starting at its origin (baseline of the
+ * first line).
+ *
+ * @param text The string (UTF-8, lines separated by '\n').
+ * @param font The font.
+ * @param transform The transformation of the text.
+ * @param spec The text specification (size in world units).
+ */
+void TextRenderer::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+                              const glm::mat4& transform, const TextSpecification& spec)
+{
+    PIXEL_CORE_ASSERT(font, "Undefined font for text rendering!");
+
+    LayoutString(text, *font, spec, [&transform](const glm::vec2& local)
+                 { return transform * glm::vec4(local, 0.0f, 1.0f); }, false);
+}
+
+/**
+ * @brief Submit a string in world space, aligned with the xy-plane.
+ *
+ * @param text The string (UTF-8, lines separated by '\n').
+ * @param font The font.
+ * @param position The origin of the text (baseline of the first line).
+ * @param spec The text specification (size in world units).
+ */
+void TextRenderer::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+                              const glm::vec3& position, const TextSpecification& spec)
+{
+    DrawString(text, font, glm::translate(glm::mat4(1.0f), position), spec);
+}
+
+/**
+ * @brief Submit a screen-space label anchored to a world position.
+ *
+ * The label faces the screen, keeps a constant size in pixels and is depth-tested at the depth
+ * of its anchor. Labels whose anchor is behind the camera are skipped.
+ *
+ * @param text The string (UTF-8, lines separated by '\n').
+ * @param font The font.
+ * @param anchor The world position the label is attached to.
+ * @param offset The offset of the label origin from the projected anchor (in pixels).
+ * @param spec The text specification (size in pixels).
+ */
+void TextRenderer::DrawLabel(const std::string& text, const std::shared_ptr<Font>& font,
+                             const glm::vec3& anchor, const glm::vec2& offset,
+                             const TextSpecification& spec)
+{
+    PIXEL_CORE_ASSERT(font, "Undefined font for text rendering!");
+    PIXEL_CORE_ASSERT(g_Data, "TextRenderer::BeginScene() must be called before drawing text!");
+
+    glm::vec4 clip = g_Data->ProjectionMatrix * g_Data->ViewMatrix * glm::vec4(anchor, 1.0f);
+    if (clip.w <= 0.0f)
+        return;
+
+    const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+    const glm::vec2 pixelToNDC = 2.0f / g_Data->ViewportSize;
+
+    LayoutString(text, *font, spec, [&ndc, &offset, &pixelToNDC](const glm::vec2& local)
+                 { return glm::vec4(glm::vec2(ndc) + (local + offset) * pixelToNDC, ndc.z, 1.0f); },
+                 true);
+}
+
+/**
+ * @brief Submit a string in screen space (e.g. HUD text), rendered in front of the scene.
+ *
+ * @param text The string (UTF-8, lines separated by '\n').
+ * @param font The font.
+ * @param position The origin of the text in pixels (from the bottom-left corner of the viewport).
+ * @param spec The text specification (size in pixels).
+ */
+void TextRenderer::DrawScreenString(const std::string& text, const std::shared_ptr<Font>& font,
+                                    const glm::vec2& position, const TextSpecification& spec)
+{
+    PIXEL_CORE_ASSERT(font, "Undefined font for text rendering!");
+    PIXEL_CORE_ASSERT(g_Data, "TextRenderer::BeginScene() must be called before drawing text!");
+
+    const glm::vec2 pixelToNDC = 2.0f / g_Data->ViewportSize;
+    // On the near plane, so that the text stays in front of the scene with either depth convention
+    const float depth = RendererAPI::GetNearDepth();
+
+    LayoutString(text, *font, spec, [&position, &pixelToNDC, depth](const glm::vec2& local)
+                 { return glm::vec4((position + local) * pixelToNDC - 1.0f, depth, 1.0f); },
+                 true);
+}
+
+/**
+ * @brief Reset the text rendering statistics.
+ */
+void TextRenderer::ResetStats()
+{
+    if (g_Data)
+        g_Data->Stats = Statistics();
+}
+
+/**
+ * @brief Get the text rendering statistics.
+ *
+ * @return The statistics.
+ */
+TextRenderer::Statistics TextRenderer::GetStats()
+{
+    return g_Data ? g_Data->Stats : Statistics();
+}
+
+} // namespace pixc
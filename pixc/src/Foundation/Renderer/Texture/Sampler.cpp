@@ -0,0 +1,99 @@
+#include "pixcpch.h"
+#include "Foundation/Renderer/Texture/Sampler.h"
+
+#include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/Utils/FactoryUtils.h"
+
+#include "Platform/OpenGL/Texture/OpenGLSampler.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Texture/SoftwareSampler.h"
+#endif
+#ifdef __APPLE__
+#include "Platform/Metal/Texture/MetalSampler.h"
+#endif
+
+namespace pixc {
+
+/**
+ * @brief Hash function for the sampler specifications (key of the sampler cache).
+ */
+struct SamplerSpecificationHash
+{
+    size_t operator()(const SamplerSpecification& spec) const
+    {
+        size_t seed = 0;
+        auto combine = [&seed](size_t value)
+        {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        
+        combine(static_cast<size_t>(spec.Filter.Min));
+        combine(static_cast<size_t>(spec.Filter.Mag));
+        combine(static_cast<size_t>(spec.Filter.Mip));
+        combine(static_cast<size_t>(spec.Wrap));
+        for (int i = 0; i < 4; i++)
+            combine(std::hash<float>()(spec.BorderColor[i]));
+        combine(spec.MipMaps);
+        combine(spec.CompareDepth);
+        return seed;
+    }
+};
+
+///< Samplers created (one per sampling state).
+static std::unordered_map<SamplerSpecification, std::shared_ptr<Sampler>, SamplerSpecificationHash> g_Samplers;
+
+/**
+ * @brief Create a sampler based on the active rendering API.
+ *
+ * @param spec The sampler specifications.
+ *
+ * @return A shared pointer to the created sampler, or nullptr if the API is not supported.
+ */
+static std::shared_ptr<Sampler> CreateSampler(const SamplerSpecification& spec)
+{
+    CREATE_RENDERER_OBJECT(std::make_shared, Sampler, spec)
+}
+
+/**
+ * @brief Get the sampler with a specific sampling state (created if it is not cached yet).
+ *
+ * @param spec The sampler specifications.
+ *
+ * @return A shared pointer to the sampler.
+ */
+std::shared_ptr<Sampler> Sampler::Get(const SamplerSpecification& spec)
+{
+    auto it = g_Samplers.find(spec);
+    if (it != g_Samplers.end())
+        return it->second;
+    
+    auto sampler = CreateSampler(spec);
+    if (sampler)
+        g_Samplers.emplace(spec, sampler);
+    return sampler;
+}
+
+/**
+ * @brief Get the number of samplers created.
+ *
+ * @return The number of unique sampling states.
+ */
+uint32_t Sampler::GetCacheSize()
+{
+    return static_cast<uint32_t>(g_Samplers.size());
+}
+
+/**
+ * @brief Release all the samplers (to be called before the graphics context is destroyed).
+ *
+ * The resources of the samplers still referenced (e.g., by the materials) are released as well:
+ * the textures they are used with are then read with their own sampling state.
+ */
+void Sampler::ClearCache()
+{
+    for (auto& [spec, sampler] : g_Samplers)
+        sampler->Release();
+    g_Samplers.clear();
+}
+
+} // namespace pixc
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Texture/OpenGLTexture1D.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Texture/SoftwareTexture1D.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Texture/MetalTexture1D.h"
 #endif
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Texture/OpenGLTexture2D.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Texture/SoftwareTexture2D.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Texture/MetalTexture2D.h"
 #endif
@@ -99,6 +102,82 @@ std::shared_ptr<Texture2D> Texture2D::CreateFromFile(const std::filesystem::path
     CREATE_RENDERER_OBJECT(std::make_shared, Texture2D, filePath, spec, flip)
 }
 
+/**
+ * @brief Create a 2D texture from an image decoded from a file.
+ *
+ * The texture specification is derived from the image, as when the texture is loaded from
+ * the file directly.
+ *
+ * @param image The decoded image.
+ * @param filePath Texture file path (source of the image).
+ * @param flip Whether the image has been flipped vertically.
+ *
+ * @return A shared pointer to the created texture, or nullptr if the image is not supported.
+ */
+std::shared_ptr<Texture2D> Texture2D::CreateFromImage(const TextureImage& image,
+                                                      const std::filesystem::path& filePath,
+                                                      bool flip)
+{
+    // Verify that the image has been decoded correctly
+    if (!image.Pixels)
+    {
+        PIXEL_CORE_WARN("Failed to load: " + filePath.filename().string());
+        return nullptr;
+    }
+    
+    // Define the format of the data to be used
+    TextureSpecification spec;
+    spec.SetTextureSize(image.Width, image.Height);
+    if (!image.HDR && image.Channels == 4)
+        spec.Format = TextureFormat::RGBA8;
+    else if (!image.HDR && image.Channels == 3)
+        spec.Format = TextureFormat::RGB8;
+    else if (image.HDR && image.Channels == 3)
+        spec.Format = TextureFormat::RGB32F;
+    else
+    {
+        PIXEL_CORE_WARN("Trying to load a texture not supported!");
+        return nullptr;
+    }
+    spec.Wrap = image.HDR ? TextureWrap::ClampToEdge : TextureWrap::Repeat;
+    spec.SetMinMagFilter(TextureFilter::Linear);
+    spec.Filter.Mip = TextureFilter::Linear;
+    
+    // Generate the 2D texture and keep track of its source
+    auto texture = CreateFromData(image.Pixels.get(), spec);
+    texture->m_Path = filePath;
+    texture->m_Flip = flip;
+    return texture;
+}
+
+/**
+ * @brief Decode an image file without creating the texture.
+ *
+ * @param filePath Texture file path.
+ * @param flip Flip the image vertically.
+ *
+ * @return The decoded image (without pixels if the file could not be decoded).
+ *
+ * @note This function does not use the rendering context and can be called from any thread.
+ */
+TextureImage Texture2D::DecodeImage(const std::filesystem::path& filePath, bool flip)
+{
+    TextureImage image;
+    image.HDR = filePath.extension().string() == ".hdr";
+    
+    // Determine whether to flip the image vertically (for the calling thread only)
+    stbi_set_flip_vertically_on_load_thread(flip);
+    
+    // Load the image into the local buffer
+    void* data = image.HDR ?
+        (void*)stbi_loadf(filePath.string().c_str(), &image.Width, &image.Height, &image.Channels, 0) :
+        (void*)stbi_load(filePath.string().c_str(), &image.Width, &image.Height, &image.Channels, 0);
+    
+    if (data)
+        image.Pixels = std::shared_ptr<void>(data, stbi_image_free);
+    return image;
+}
+
 /**
  * @brief Load the texture from an input (image) source file.
  *
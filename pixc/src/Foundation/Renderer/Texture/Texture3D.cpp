@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Texture/OpenGLTexture3D.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Texture/SoftwareTexture3D.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Texture/MetalTexture3D.h"
 #endif
@@ -5,6 +5,9 @@
 #include "Foundation/Renderer/Utils/FactoryUtils.h"
 
 #include "Platform/OpenGL/Texture/OpenGLTextureCube.h"
+#ifdef PIXC_SOFTWARE_RENDERER
+#include "Platform/Software/Texture/SoftwareTextureCube.h"
+#endif
 #ifdef __APPLE__
 #include "Platform/Metal/Texture/MetalTextureCube.h"
 #endif
@@ -3,136 +3,704 @@
 
 namespace pixc {
 
+/**
+ * @brief Check whether a model is drawn deformed by an animator (see `AssimpModel::DrawAnimated()`).
+ *
+ * @param model The model.
+ *
+ * @return `true` if the model is skinned and animated.
+ */
+static bool IsAnimated(const std::shared_ptr<BaseModel>& model)
+{
+    auto assimp = std::dynamic_pointer_cast<AssimpModel>(model);
+    return assimp && assimp->IsSkinned() && assimp->GetAnimator();
+}
+
+/**
+ * @brief Get the skinned variant of the depth only material, used to draw the animated models in
+ * the passes using the `Depth` material (e.g., shadow maps), so that they follow their pose.
+ *
+ * @return The skinned depth material.
+ */
+static std::shared_ptr<Material> GetSkinnedDepthMaterial()
+{
+    auto& library = Renderer::GetMaterialLibrary();
+    if (!library.Exists("DepthSkinned"))
+    {
+        library.Create<Material>("DepthSkinned",
+                                 ResourcesManager::GeneralPath("pixc/shaders/forward/depth/DepthOnlySkinned"));
+    }
+    return library.Get("DepthSkinned");
+}
+
 /**
  * Define a scene to be rendered.
  *
  * @param width Viewport width.
  * @param height Viewport height.
  * @param viewportShader The shader file path to be used for shading the viewport.
+ * @param viewportFormat The format of the screen buffer (high dynamic range formats can be
+ *                       displayed with an exposure, see `Viewport::SetExposure()`).
  */
 Scene::Scene(uint32_t width, uint32_t height,
-             const std::filesystem::path& viewportShader)
+             const std::filesystem::path& viewportShader,
+             const TextureFormat viewportFormat)
 {
     // Define a generic rendering camera (can be changed with the method SetCamera())
     m_Camera = std::make_shared<pixc::PerspectiveCamera>(width, height);
     
     // Define the viewport
-    m_Viewport = std::make_shared<Viewport>(width, height, viewportShader);
+    m_Viewport = std::make_shared<Viewport>(width, height, viewportShader, viewportFormat);
     // Add viewport to the model and framebuffer library
     m_Models.Add("Viewport", m_Viewport->s_Geometry);
     m_FrameBuffers.Add("ScreenBuffer", m_Viewport->m_ScreenBuffer);
 }
 
+/**
+ * Removes a model from the scene.
+ *
+ * Its occlusion state is released once the next captured packet is drawn, so it should be removed
+ * with this function rather than directly from the model library.
+ *
+ * @param name The name of the model.
+ */
+void Scene::RemoveModel(const std::string& name)
+{
+    if (auto model = m_Models.Remove(name))
+        m_RemovedModels.push_back(model.get());
+}
+
+/**
+ * Executes a function once a set of assets requested to the `AssetManager` are loaded (ready, or
+ * failed). The function is executed by `UpdateLoads()` on the thread capturing the scene, so it
+ * can modify the scene (e.g., add a model once its meshes are loaded).
+ *
+ * @param assets The assets required.
+ * @param function The function to be executed.
+ */
+void Scene::WhenLoaded(const std::vector<std::shared_ptr<AssetRecord>>& assets,
+                       const std::function<void(Scene&)>& function)
+{
+    m_PendingLoads.push_back({ assets, function });
+}
+
+/**
+ * Executes the functions whose assets are loaded (done each time the scene is captured).
+ */
+void Scene::UpdateLoads()
+{
+    auto isLoaded = [](const std::shared_ptr<AssetRecord>& record)
+    {
+        AssetState state = record->State;
+        return state == AssetState::Ready || state == AssetState::Failed;
+    };
+    
+    // The functions can request other loads
+    std::vector<PendingLoad> pending;
+    pending.swap(m_PendingLoads);
+    for (auto& load : pending)
+    {
+        if (std::all_of(load.Assets.begin(), load.Assets.end(), isLoaded))
+            load.Function(*this);
+        else
+            m_PendingLoads.push_back(std::move(load));
+    }
+}
+
+/**
+ * Blocks until all the assets requested for the scene are loaded, and executes their functions.
+ *
+ * @note The loads are processed meanwhile (see `AssetManager::Wait()`), so it must be called
+ * from the thread updating the asset manager.
+ */
+void Scene::WaitForLoads()
+{
+    while (IsLoading())
+    {
+        for (const auto& load : m_PendingLoads)
+        {
+            for (const auto& record : load.Assets)
+                AssetManager::Wait(record);
+        }
+        UpdateLoads();
+    }
+}
+
 /**
  * Draws the scene according to the specified render passes.
  */
 void Scene::Draw()
 {
+    Capture(m_Packet);
+    Draw(m_Packet);
+}
+
+/**
+ * Captures the state needed to draw the scene into a packet.
+ *
+ * The passes are copied with the models left by the contribution culling (after their setup
+ * function), along with the state of their cameras, of the lights and the transformation of the
+ * models. The packet can then be drawn while the scene keeps being updated (e.g., on the render
+ * thread, see `RenderThread`). The assets loaded since the last capture are defined first (see
+ * `WhenLoaded()`).
+ *
+ * @param packet The packet filled.
+ */
+void Scene::Capture(ScenePacket& packet)
+{
+    UpdateLoads();
+    packet.Reset();
+    packet.RemovedModels.swap(m_RemovedModels);
+    
+    // Capture the state of the lights
+    packet.Lights.reserve(m_Lights.Size());
+    packet.LightStates.reserve(m_Lights.Size());
+    for (const auto& [name, light] : m_Lights)
+    {
+        packet.Lights.push_back(light);
+        packet.LightStates.push_back(light->Capture());
+    }
+    packet.LightCasters = m_Lights.GetLightCastersNumber();
+    
+    packet.Passes.reserve(m_RenderPasses.m_Order.size());
+    
+    for (const auto& name : m_RenderPasses.m_Order)
+    {
+        const auto& pass = m_RenderPasses.Get(name);
+        
+        // Copy the specification of the pass, without its models
+        auto& captured = packet.Passes.emplace_back();
+        captured.Name = name;
+        
+        auto& spec = captured.Specification;
+        spec.Active = pass.Active;
+        spec.Target = pass.Target;
+        spec.Culling = pass.Culling;
+        spec.Hooks = pass.Hooks;
+        spec.Render.Camera = pass.Render.Camera;
+        spec.Render.RenderLights = pass.Render.RenderLights;
+        spec.Render.RenderBackground = pass.Render.RenderBackground;
+        spec.Render.SortByPipeline = pass.Render.SortByPipeline;
+        spec.Render.Occlusion = pass.Render.Occlusion;
+        spec.Render.OcclusionInterval = pass.Render.OcclusionInterval;
+        spec.Render.Clusters = pass.Render.Clusters;
+        if (!pass.Active)
+            continue;
+        
+        // Capture the camera of the pass
+        const auto& camera = pass.Render.Camera;
+        if (camera && !packet.Cameras.count(camera.get()))
+        {
+            packet.Cameras[camera.get()] = { camera->GetViewMatrix(), camera->GetProjectionMatrix(),
+                                             camera->GetPosition(), camera->GetNearPlane() };
+        }
+        
+        // Skip the models that barely contribute to the pass
+        auto& materials = Renderer::GetMaterialLibrary();
+        spec.Render.Models.reserve(pass.Render.Models.size());
+        captured.Fades.reserve(pass.Render.Models.size());
+        captured.Models.reserve(pass.Render.Models.size());
+        captured.Materials.reserve(pass.Render.Models.size());
+        for (const auto& renderable : pass.Render.Models)
+        {
+            if (!m_Models.Exists(renderable.ModelName))
+                continue;
+            auto model = m_Models.Get(renderable.ModelName);
+            if (!model)
+                continue;
+            
+            // The setup can move the model, it is done before capturing its transformation
+            if (renderable.ModelSetupFunction)
+                renderable.ModelSetupFunction(model);
+            
+            std::shared_ptr<Material> material;
+            if (!renderable.MaterialName.empty())
+            {
+                if (!materials.Exists(renderable.MaterialName))
+                    continue;
+                material = materials.Get(renderable.MaterialName);
+                
+                // The animated models cast the shadow of their pose, not of their bind pose
+                if (renderable.MaterialName == "Depth" && IsAnimated(model))
+                    material = GetSkinnedDepthMaterial();
+            }
+            
+            float fade = ComputeContribution(*model, renderable.Culling.value_or(pass.Culling));
+            if (fade <= 0.0f)
+            {
+                captured.CulledModels++;
+                continue;
+            }
+            spec.Render.Models.push_back(renderable);
+            captured.Fades.push_back(fade);
+            captured.Models.push_back(model);
+            captured.Materials.push_back(material);
+            packet.Transforms[model.get()] = model->GetModelMatrix();
+        }
+    }
+}
+
+/**
+ * Draws a packet captured from the scene (see `Capture()`).
+ *
+ * @param packet The packet to be drawn.
+ */
+void Scene::Draw(const ScenePacket& packet)
+{
+    m_Stats = Statistics();
+    
+    // Release the occlusion state of the models removed from the scene
+    for (const BaseModel* model : packet.RemovedModels)
+    {
+        for (auto& [name, states] : m_Occlusion)
+            states.erase(model);
+    }
+    
+    // Draw the lights with their state when the packet was captured
+    for (size_t i = 0; i < packet.Lights.size(); i++)
+        packet.Lights[i]->Apply(packet.LightStates[i]);
+    
+    // Update the resources of the lights before any pass uses them
+    UpdateLights(packet);
+    
     // Iterate through all render passes in the order they were added
-    for (auto& name : m_RenderPasses.m_Order)
+    for (const auto& pass : packet.Passes)
     {
-        // Retrieve the render pass specification by name
-        auto& pass = m_RenderPasses.Get(name);
-        if (pass.Active)
+        const auto& spec = pass.Specification;
+        if (spec.Active)
         {
             // If the render pass is active, perform the full rendering workflow
-            Draw(pass);
+            Draw(pass, packet);
         }
         else
         {
             // If the render pass is inactive but has a framebuffer target,
             // apply clear/viewport settings to keep buffers consistent
-            if (!pass.Target.FrameBuffer)
+            if (!spec.Target.FrameBuffer)
                 continue;
 
-            RendererCommand::BeginRenderPass(pass.Target.FrameBuffer);
-            ApplyTargetSettings(pass.Target);
+            if (spec.Target.Actions)
+                RendererCommand::BeginRenderPass(spec.Target.FrameBuffer, *spec.Target.Actions);
+            else
+                RendererCommand::BeginRenderPass(spec.Target.FrameBuffer);
+            ApplyTargetSettings(spec.Target);
             RendererCommand::EndRenderPass();
         }
     }
+    
+    m_Frame++;
 }
 
 /**
- * Draws the scene using the provided render pass specification.
+ * Draws a render pass captured from the scene.
  *
- * @param pass The render pass specification containing the parameters for drawing the scene.
+ * @param pass The render pass, containing the parameters for drawing the scene.
+ * @param packet The packet the pass was captured in.
  */
-void Scene::Draw(const RenderPassSpecification &pass)
+void Scene::Draw(const PassPacket& pass, const ScenePacket& packet)
 {
-    if (!pass.Active)
-            return;
+    const auto& spec = pass.Specification;
+    if (!spec.Active)
+        return;
     
     // Run pre-render hook
-    if (pass.Hooks.PreRenderCode)
-        pass.Hooks.PreRenderCode();
+    if (spec.Hooks.PreRenderCode)
+        spec.Hooks.PreRenderCode();
     
-    // Begin render pass
-    RendererCommand::BeginRenderPass(pass.Target.FrameBuffer);
+    // Begin render pass (with the load actions of its attachments, if defined)
+    if (spec.Target.Actions)
+        RendererCommand::BeginRenderPass(spec.Target.FrameBuffer, *spec.Target.Actions);
+    else
+        RendererCommand::BeginRenderPass(spec.Target.FrameBuffer);
     
     // Apply the settings specific for the rendering target
-    ApplyTargetSettings(pass.Target);
+    ApplyTargetSettings(spec.Target);
     
-    // Begin the scene with the specified camera
-    Renderer::BeginScene(pass.Render.Camera);
+    // Begin the scene with the state of the camera when the pass was captured
+    auto camera = spec.Render.Camera ? packet.Cameras.find(spec.Render.Camera.get())
+                                     : packet.Cameras.end();
+    if (camera != packet.Cameras.end())
+        Renderer::BeginScene(camera->second.View, camera->second.Projection, camera->second.Position);
+    else
+        Renderer::BeginScene();
     
     // Render light sources separately
-    if (pass.Render.RenderLights)
-        DrawLights();
+    if (spec.Render.RenderLights)
+        DrawLights(packet, spec.Render.RenderBackground);
     
     // Render each model
-    DrawModels(pass.Render.Models);
+    ClusterCulling::SetMode(spec.Render.Clusters);
+    DrawModels(pass, packet);
+    ClusterCulling::SetMode(ClusterCullingMode::Frustum);
+    
+    // Render the background last, where no model has been drawn
+    if (spec.Render.RenderBackground)
+        DrawBackground(packet);
     
     // End scene and render pass
     Renderer::EndScene();
     RendererCommand::EndRenderPass();
 
     // Run post-render hook
-    if (pass.Hooks.PostRenderCode)
-        pass.Hooks.PostRenderCode();
+    if (spec.Hooks.PostRenderCode)
+        spec.Hooks.PostRenderCode();
+}
+
+/**
+ * Updates the resources of the scene lights (e.g., a part of the baking of an environment).
+ *
+ * @param packet The packet the lights were captured in.
+ */
+void Scene::UpdateLights(const ScenePacket& packet)
+{
+    for (const auto& light : packet.Lights)
+        light->Update();
 }
 
 /**
  * Draws the scene lights.
+ *
+ * @param packet The packet the lights were captured in.
+ * @param background Whether the background is drawn by the pass (the lights representing the
+ *                   background are then skipped).
  */
- void Scene::DrawLights()
+ void Scene::DrawLights(const ScenePacket& packet, const bool background)
  {
-     for (auto& [name, light] : m_Lights)
+     for (const auto& light : packet.Lights)
+     {
+         if (background && light->HasBackground())
+             continue;
          light->DrawLight();
+     }
  }
 
+/**
+ * Draws the background of the scene (e.g., the environment), behind the models already drawn.
+ *
+ * @param packet The packet the lights were captured in.
+ */
+void Scene::DrawBackground(const ScenePacket& packet)
+{
+    for (const auto& light : packet.Lights)
+    {
+        if (light->HasBackground())
+            light->DrawBackground();
+    }
+}
+
 /**
  * @brief Renders a collection of models defined by renderables.
  *
- * @param models The list of renderables to be drawn, including model and material information.
+ * The models too far or too small on screen for the thresholds of the pass (or their own ones)
+ * have already been skipped when the pass was captured, the others are drawn with their opacity
+ * (fading out). When occlusion culling is enabled, the occluders are drawn first. The bounding box of each
+ * other model is then tested against the resulting depth buffer, and the result of the test
+ * decides whether the model is drawn (on the GPU with a conditional render, or on the CPU from
+ * the result of a previous frame). A model found visible is only tested again every few frames.
+ *
+ * @param pass The render pass, including the list of renderables to be drawn.
+ * @param packet The packet the pass was captured in.
  */
-void Scene::DrawModels(const std::vector<Renderable>& models)
+void Scene::DrawModels(const PassPacket& pass, const ScenePacket& packet)
 {
-    for (const auto& renderable : models)
+    const auto& settings = pass.Specification.Render;
+    auto& stats = m_Stats.Passes[pass.Name];
+    stats.CulledModels = pass.CulledModels;
+    m_Stats.ContributionCulled += pass.CulledModels;
+    
+    // Indices of the renderables, in drawing order
+    std::vector<size_t> order(settings.Models.size());
+    for (size_t i = 0; i < settings.Models.size(); i++)
     {
-        // Get the model from library
-        auto& model = m_Models.Get(renderable.ModelName);
-        if (!model)
-            continue;
-        
-        if (renderable.ModelSetupFunction)
-            renderable.ModelSetupFunction(model);
+        if (pass.Fades[i] < 1.0f)
+            stats.FadingModels++;
+        order[i] = i;
+    }
+    
+    // Group the models using the same pipeline (shader), then the same material
 
-        // Assign material if specified
-        if (!renderable.MaterialName.empty())
+    if (settings.SortByPipeline)
+    {
+        auto key = [&pass](size_t index) -> std::pair<uint32_t, uint32_t>
         {
-            auto& material = Renderer::GetMaterialLibrary().Get(renderable.MaterialName);
+            const auto& material = pass.Materials[index];
             if (!material)
-                continue;
+                return { 0, 0 };
+            return { material->GetPipelineID(), material->GetInstanceID() };
+        };
+        std::stable_sort(order.begin(), order.end(), [&key](size_t a, size_t b)
+        {
+            return key(a) < key(b);
+        });
+    }
+    
+    // Draw all the models if no occlusion culling is applied
+    if (settings.Occlusion == OcclusionCulling::None || !PrepareOcclusion())
+    {
+        for (size_t index : order)
+            DrawRenderable(pass, index, packet);
+        stats.DrawnModels += static_cast<uint32_t>(order.size());
+        return;
+    }
+    
+    // Draw the occluders first: they fill the depth buffer the other models are tested against
+    for (size_t index : order)
+    {
+        if (!settings.Models[index].Occluder)
+            continue;
+        DrawRenderable(pass, index, packet);
+        stats.DrawnModels++;
+    }
+    
+    // Test the bounding box of the other models (without writing into the framebuffer)
+    struct Candidate
+    {
+        size_t Index;
+        OcclusionState* State;
+        bool Tested;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(order.size());
+    
+    auto camera = settings.Camera ? packet.Cameras.find(settings.Camera.get()) : packet.Cameras.end();
+    const CameraState view = camera != packet.Cameras.end() ? camera->second : CameraState();
+    const uint32_t interval = std::max(settings.OcclusionInterval, 1u);
+    auto& occlusion = m_Occlusion[pass.Name];
+    
+    RendererCommand::EnableColorWriting(false);
+    RendererCommand::EnableDepthWriting(false);
+    for (size_t index : order)
+    {
+        const auto& entry = settings.Models[index];
+        if (entry.Occluder)
+            continue;
+        
+        const auto& model = pass.Models[index];
+        auto [it, created] = occlusion.try_emplace(model.get());
+        auto& state = it->second;
+        if (created)
+        {
+            state.Query = OcclusionQuery::Create();
+            // Spread the tests of the visible models over the frames
+            state.NextTest = m_Frame + candidates.size() % interval;
+        }
+        
+        // Collect the result of the previous test once it is available (never stalls)
+        if (state.Query->IsPending() && state.Query->IsResultAvailable())
+            state.Visible = state.Query->GetResult();
+        
+        // A hidden model is tested every frame, a visible one only every few frames
+        bool test = !state.Visible || m_Frame >= state.NextTest;
+        // Only one test at a time can be read back
+        if (settings.Occlusion == OcclusionCulling::Readback && state.Query->IsPending())
+            test = false;
+        
+        // The bounding box cannot be tested if it crosses the near plane (it would be clipped),
+        // this includes the camera being inside it
+        if (CrossesNearPlane(*model, view, packet))
+        {
+            state.Visible = true;
+            test = false;
+        }
+        
+        if (test)
+        {
+            state.Query->Begin();
+            DrawOcclusionProxy(model, packet);
+            state.Query->End();
+            state.NextTest = m_Frame + interval;
+            m_Stats.OcclusionTests++;
+        }
+        candidates.push_back({ index, &state, test });
+    }
+    RendererCommand::EnableDepthWriting(true);
+    RendererCommand::EnableColorWriting(true);
+    
+    // Draw the models according to the result of the tests
+    for (const auto& candidate : candidates)
+    {
+        if (settings.Occlusion == OcclusionCulling::Conditional && candidate.Tested)
+        {
+            candidate.State->Query->BeginConditionalRender();
+            DrawRenderable(pass, candidate.Index, packet);
+            candidate.State->Query->EndConditionalRender();
+            m_Stats.ConditionalDraws++;
+            stats.DrawnModels++;
+        }
+        else if (settings.Occlusion == OcclusionCulling::Readback && !candidate.State->Visible)
+        {
+            m_Stats.OcclusionCulled++;
+        }
+        else
+        {
+            DrawRenderable(pass, candidate.Index, packet);
+            stats.DrawnModels++;
+        }
+    }
+}
+
+/**
+ * @brief Renders a single model with its material.
+ *
+ * The model and the material are the ones captured with the pass, and the model is drawn with
+ * its transformation at that time.
+ *
+ * @param pass The render pass the renderable was captured in.
+ * @param index The index of the renderable in the pass.
+ * @param packet The packet the pass was captured in.
+ */
+void Scene::DrawRenderable(const PassPacket& pass, size_t index, const ScenePacket& packet)
+{
+    const auto& renderable = pass.Specification.Render.Models[index];
+    const auto& model = pass.Models[index];
 
-            if (renderable.MaterialSetupFunction)
-                renderable.MaterialSetupFunction(material);
+    // Assign material if specified
+    if (const auto& material = pass.Materials[index])
+    {
+        if (renderable.MaterialSetupFunction)
+            renderable.MaterialSetupFunction(material);
 
-            DefineShadowProperties(material);
-            model->SetMaterial(material);
-        }
+        DefineShadowProperties(material, packet);
+        model->SetMaterial(material);
+    }
 
+    Renderer::SetFade(pass.Fades[index]);
+    auto transform = packet.Transforms.find(model.get());
+    if (transform == packet.Transforms.end())
         model->DrawModel();
+    else
+        model->DrawModelWithTransform(transform->second);
+    Renderer::SetFade(1.0f);
+    m_Stats.DrawnModels++;
+}
+
+/**
+ * @brief Compute how much a model contributes to a render pass, from its distance and its
+ * projected size as seen by the scene camera.
+ *
+ * @param model The model.
+ * @param culling The culling thresholds.
+ *
+ * @return The opacity of the model: 1 if fully drawn, 0 if culled, in between while fading out.
+ */
+float Scene::ComputeContribution(const BaseModel& model, const CullingSettings& culling) const
+{
+    if ((culling.MaxDistance <= 0.0f && culling.MinScreenSize <= 0.0f) || !m_Camera)
+        return 1.0f;
+    
+    // Bounding sphere of the model in world space
+    const BBox& bbox = model.GetBBox();
+    const glm::mat4& matrix = model.GetModelMatrix();
+    glm::vec3 center = glm::vec3(matrix * glm::vec4((bbox.max + bbox.min) / 2.0f, 1.0f));
+    float scale = std::max({ glm::length(glm::vec3(matrix[0])),
+                             glm::length(glm::vec3(matrix[1])),
+                             glm::length(glm::vec3(matrix[2])) });
+    float radius = glm::length(bbox.max - bbox.min) * 0.5f * scale;
+    float distance = glm::length(center - m_Camera->GetPosition());
+    
+    // Fade linearly over the fade range before reaching the threshold
+    auto fadeOut = [&culling](float margin, float threshold)
+    {
+        if (culling.FadeRange <= 0.0f)
+            return margin > 0.0f ? 1.0f : 0.0f;
+        return glm::clamp(margin / (threshold * culling.FadeRange), 0.0f, 1.0f);
+    };
+    
+    float fade = 1.0f;
+    if (culling.MaxDistance > 0.0f)
+        fade = std::min(fade, fadeOut(culling.MaxDistance - std::max(distance - radius, 0.0f),
+                                      culling.MaxDistance));
+    
+    if (culling.MinScreenSize > 0.0f)
+    {
+        // Projected diameter over the viewport height (orthographic projections ignore the distance)
+        const glm::mat4& projection = m_Camera->GetProjectionMatrix();
+        bool orthographic = projection[3][3] == 1.0f;
+        float size = radius * projection[1][1] / (orthographic ? 1.0f : std::max(distance, 1e-4f));
+        fade = std::min(fade, fadeOut(size - culling.MinScreenSize, culling.MinScreenSize));
     }
+    return fade;
+}
+
+/**
+ * @brief Create the resources used to test the bounding boxes of the models.
+ *
+ * @return `true` if the occlusion queries are supported by the rendering API.
+ */
+bool Scene::PrepareOcclusion()
+{
+    if (m_OcclusionReady)
+        return m_OcclusionProxy != nullptr;
+    m_OcclusionReady = true;
+    
+    if (!OcclusionQuery::Create())
+    {
+        PIXEL_CORE_WARN("Occlusion queries are not supported, occlusion culling is disabled!");
+        return false;
+    }
+    
+    // The bounding boxes are drawn with the depth only material
+    auto& library = Renderer::GetMaterialLibrary();
+    if (!library.Exists("Depth"))
+    {
+        library.Create<Material>("Depth",
+                                 ResourcesManager::GeneralPath("pixc/shaders/forward/depth/DepthOnly"));
+    }
+    m_OcclusionProxy = utils::geometry::ModelCube<GeoVertexData<glm::vec4>>(library.Get("Depth"));
+    return true;
+}
+
+/**
+ * @brief Check whether the bounding box of a model (as drawn by `DrawOcclusionProxy()`) crosses
+ * the near plane of a camera.
+ *
+ * @param model The model to be tested.
+ * @param camera The state of the camera.
+ * @param packet The packet the model was captured in.
+ *
+ * @return `true` if a corner of the box is not beyond the near plane.
+ */
+bool Scene::CrossesNearPlane(const BaseModel& model, const CameraState& camera,
+                             const ScenePacket& packet) const
+{
+    const BBox& bbox = model.GetBBox();
+    glm::vec3 center = (bbox.max + bbox.min) / 2.0f;
+    glm::vec3 extent = glm::max(bbox.max - bbox.min, glm::vec3(1e-3f)) / 2.0f;
+    
+    auto captured = packet.Transforms.find(&model);
+    glm::mat4 transform = camera.View * (captured != packet.Transforms.end() ? captured->second
+                                                                              : model.GetModelMatrix());
+    for (int i = 0; i < 8; i++)
+    {
+        glm::vec3 corner = center + extent * glm::vec3(i & 1 ? 1.0f : -1.0f,
+                                                       i & 2 ? 1.0f : -1.0f,
+                                                       i & 4 ? 1.0f : -1.0f);
+        // The camera looks down the negative z-axis of the view space
+        if (-(transform * glm::vec4(corner, 1.0f)).z <= camera.NearPlane)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Draw the bounding box of a model (unit cube scaled to the box).
+ *
+ * @param model The model to be tested.
+ * @param packet The packet the model was captured in.
+ */
+void Scene::DrawOcclusionProxy(const std::shared_ptr<BaseModel>& model, const ScenePacket& packet)
+{
+    const BBox& bbox = model->GetBBox();
+    glm::vec3 center = (bbox.max + bbox.min) / 2.0f;
+    // Avoid a degenerated box for flat models (e.g., planes)
+    glm::vec3 size = glm::max(bbox.max - bbox.min, glm::vec3(1e-3f));
+    
+    auto captured = packet.Transforms.find(model.get());
+    glm::mat4 transform = captured != packet.Transforms.end() ? captured->second
+                                                              : model->GetModelMatrix();
+    transform = glm::translate(transform, center);
+    transform = glm::scale(transform, size);
+    m_OcclusionProxy->DrawModelWithTransform(transform);
 }
 
 /**
@@ -145,7 +713,8 @@ void Scene::ApplyTargetSettings(const TargetSettings& target)
     if (target.ViewportSize)
         RendererCommand::SetViewport(0, 0, target.ViewportSize->x, target.ViewportSize->y);
 
-    if (!target.ClearEnabled)
+    // The clears are part of the load actions
+    if (!target.ClearEnabled || target.Actions)
         return;
     
     RendererCommand::SetClearColor(target.ClearColor);
@@ -160,17 +729,19 @@ void Scene::ApplyTargetSettings(const TargetSettings& target)
  * Define shadow properties for a given material.
  *
  * @param baseMaterial The base material to define shadow properties for.
+ * @param packet The packet the lights were captured in.
  * @note If the "Shadow" render pass does not exist in the scene, no shadows maps will be defined.
  */
- void Scene::DefineShadowProperties(const std::shared_ptr<Material>& baseMaterial)
+ void Scene::DefineShadowProperties(const std::shared_ptr<Material>& baseMaterial,
+                                    const ScenePacket& packet)
  {
-     // Attempt to cast the base material to a LightedMaterial
-     auto material = std::dynamic_pointer_cast<LitMaterial>(baseMaterial);
+     // Attempt to cast the base material (or the one it is instanced from) to a LightedMaterial
+     auto material = dynamic_cast<LitMaterial*>(&baseMaterial->GetDefinition());
      if (!material)
          return; // Base material is not a LightedMaterial, so return early
      
      // Define the properties of the material related to the light sources
-     material->DefineLightProperties(m_Lights);
+     material->DefineLightProperties(packet.Lights, packet.LightCasters);
  }
 
 } // namespace pixc
@@ -0,0 +1,1136 @@
+#include "pixcpch.h"
+#include "Foundation/Scene/SceneSerializer.h"
+
+#include "Foundation/Renderer/Renderer.h"
+#include "Foundation/Renderer/Texture/Texture2D.h"
+
+#include "Foundation/Renderer/Light/DirectionalLight.h"
+#include "Foundation/Renderer/Light/PositionalLight.h"
+#include "Foundation/Renderer/Light/Environment/SHEnvironmentLight.h"
+
+#include "Foundation/Renderer/Material/UnlitMaterial.h"
+#include "Foundation/Renderer/Material/DepthMaterial.h"
+#include "Foundation/Renderer/Material/PhongMaterial.h"
+
+#include "Foundation/Renderer/Drawable/Model/AssimpModel.h"
+
+namespace pixc {
+
+/// @brief Identifier and version of the scene files.
+static const char g_SceneMagic[4] = { 'P', 'X', 'S', 'N' };
+static const uint32_t g_SceneVersion = 8;
+
+/// @brief Names of the resources owned by the scene itself (created with the scene).
+static const std::string g_ScreenBufferName = "ScreenBuffer";
+static const std::string g_ViewportModelName = "Viewport";
+
+/**
+ * @brief Types of materials that can be serialized.
+ */
+enum class MaterialKind : uint32_t
+{
+    None = 0, Unlit = 1, Depth = 2, PhongColor = 3, PhongTexture = 4
+};
+
+/**
+ * @brief Types of lights that can be serialized.
+ */
+enum class LightKind : uint32_t
+{
+    None = 0, Positional = 1, Directional = 2, Environment = 3, SHEnvironment = 4
+};
+
+/**
+ * @brief Origin of a texture referenced in the scene.
+ */
+enum class TextureSource : uint8_t
+{
+    None = 0,           ///< No texture.
+    White = 1,          ///< Default white texture.
+    File = 2,           ///< Image file (index in the texture table).
+    Attachment = 3,     ///< Attachment of a framebuffer of the scene.
+};
+
+/**
+ * @brief Owner of a framebuffer or camera referenced by a render pass.
+ */
+enum class ResourceSource : uint8_t
+{
+    None = 0,           ///< No resource (default one used).
+    Scene = 1,          ///< Resource of the scene (framebuffer library or scene camera).
+    Light = 2,          ///< Shadow resource of a light source.
+};
+
+/**
+ * @brief Accumulates binary data in memory.
+ */
+class BinaryWriter
+{
+public:
+    /// @brief Write a value (trivially copyable).
+    /// @param value The value.
+    template<typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written!");
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        m_Data.insert(m_Data.end(), bytes, bytes + sizeof(T));
+    }
+    /// @brief Write a string (size followed by its characters).
+    /// @param value The string.
+    void WriteString(const std::string& value)
+    {
+        Write(static_cast<uint32_t>(value.size()));
+        m_Data.insert(m_Data.end(), value.begin(), value.end());
+    }
+    /// @brief Get the data written.
+    /// @return The binary data.
+    const std::vector<char>& GetData() const { return m_Data; }
+
+private:
+    ///< Binary data.
+    std::vector<char> m_Data;
+};
+
+/**
+ * @brief Reads binary data from memory sequentially.
+ *
+ * Reading past the end of the data invalidates the reader and returns default values.
+ */
+class BinaryReader
+{
+public:
+    /// @brief Create a reader.
+    /// @param data The binary data.
+    BinaryReader(const std::vector<char>& data) : m_Data(data) {}
+
+    /// @brief Read a value (trivially copyable).
+    /// @return The value.
+    template<typename T>
+    T Read()
+    {
+        T value{};
+        if (!m_Valid || m_Offset + sizeof(T) > m_Data.size())
+        {
+            m_Valid = false;
+            return value;
+        }
+        memcpy(&value, &m_Data[m_Offset], sizeof(T));
+        m_Offset += sizeof(T);
+        return value;
+    }
+    /// @brief Read a string.
+    /// @return The string.
+    std::string ReadString()
+    {
+        uint32_t size = Read<uint32_t>();
+        if (!m_Valid || m_Offset + size > m_Data.size())
+        {
+            m_Valid = false;
+            return {};
+        }
+        std::string value(&m_Data[m_Offset], size);
+        m_Offset += size;
+        return value;
+    }
+    /// @brief Check whether all the reads have been valid.
+    /// @return `true` if the data read is valid.
+    bool IsValid() const { return m_Valid; }
+
+private:
+    ///< Binary data.
+    const std::vector<char>& m_Data;
+    ///< Read position.
+    size_t m_Offset = 0;
+    ///< Validity of the reads.
+    bool m_Valid = true;
+};
+
+/**
+ * @brief Reference to a texture used by a material or light.
+ */
+struct TextureReference
+{
+    TextureSource Source = TextureSource::None;     ///< Origin of the texture.
+    uint32_t Index = 0;                             ///< Index in the texture table (files).
+    std::string FrameBuffer;                        ///< Framebuffer name (attachments).
+    int32_t Attachment = 0;                         ///< Color attachment index (-1 for depth).
+};
+
+/**
+ * @brief Description of a material read from a scene file.
+ */
+struct MaterialDescription
+{
+    std::string Name;
+    MaterialKind Kind = MaterialKind::None;
+    std::filesystem::path ShaderPath;
+
+    glm::vec4 Color = glm::vec4(1.0f);
+    glm::vec3 Ka = glm::vec3(1.0f), Kd = glm::vec3(1.0f), Ks = glm::vec3(1.0f);
+    float Alpha = 1.0f;
+    float Shininess = 32.0f;
+    bool LinearizeDepth = true;
+    float NearPlane = 0.1f, FarPlane = 100.0f;
+    std::array<TextureReference, 2> Textures;
+};
+
+/**
+ * @brief Description of a model read from a scene file.
+ */
+struct ModelDescription
+{
+    std::string Name;
+    uint32_t Mesh = 0;
+    PrimitiveType Primitive = PrimitiveType::Triangle;
+    glm::vec3 Position = glm::vec3(0.0f), Rotation = glm::vec3(0.0f);
+    glm::vec3 Scale = glm::vec3(1.0f), UpAxis = glm::vec3(0.0f, 1.0f, 0.0f);
+};
+
+/**
+ * @brief Description of a light read from a scene file.
+ */
+struct LightDescription
+{
+    std::string Name;
+    LightKind Kind = LightKind::None;
+
+    // Light casters
+    glm::vec3 Color = glm::vec3(1.0f);
+    float DiffuseStrength = 1.0f, SpecularStrength = 1.0f;
+    glm::vec3 Vector = glm::vec3(0.0f);         ///< Position or direction.
+    float Parameter = 0.0f;                     ///< Angle (positional) or distance (directional).
+    glm::vec3 ModelScale = glm::vec3(1.0f);
+    bool Shadow = false;
+    uint32_t ShadowWidth = 0, ShadowHeight = 0;
+    TextureFormat ShadowFormat = TextureFormat::DEPTH24;
+
+    // Environment
+    float AmbientStrength = 1.0f;
+    TextureReference EnvironmentMap;
+};
+
+/**
+ * @brief Description of a render pass read from a scene file.
+ */
+struct RenderPassDescription
+{
+    std::string Name;
+    RenderPassSpecification Spec;
+    ResourceSource Target = ResourceSource::None;
+    std::string TargetName;
+    ResourceSource Camera = ResourceSource::None;
+    std::string CameraName;
+    std::string ResolveTargetName;
+};
+
+/**
+ * @brief Write the specification of a texture.
+ *
+ * @param writer The binary writer.
+ * @param spec The texture specification.
+ */
+static void WriteTextureSpecification(BinaryWriter& writer, const TextureSpecification& spec)
+{
+    writer.Write(spec.Width); writer.Write(spec.Height); writer.Write(spec.Depth);
+    writer.Write(spec.Type); writer.Write(spec.Format);
+    writer.Write(spec.Filter.Min); writer.Write(spec.Filter.Mag); writer.Write(spec.Filter.Mip);
+    writer.Write(spec.Wrap); writer.Write(spec.MipMaps);
+}
+
+/**
+ * @brief Read the specification of a texture.
+ *
+ * @param reader The binary reader.
+ *
+ * @return The texture specification.
+ */
+static TextureSpecification ReadTextureSpecification(BinaryReader& reader)
+{
+    TextureSpecification spec;
+    spec.Width = reader.Read<uint32_t>();
+    spec.Height = reader.Read<uint32_t>();
+    spec.Depth = reader.Read<uint32_t>();
+    spec.Type = reader.Read<TextureType>();
+    spec.Format = reader.Read<TextureFormat>();
+    spec.Filter.Min = reader.Read<TextureFilter>();
+    spec.Filter.Mag = reader.Read<TextureFilter>();
+    spec.Filter.Mip = reader.Read<TextureFilter>();
+    spec.Wrap = reader.Read<TextureWrap>();
+    spec.MipMaps = reader.Read<bool>();
+    return spec;
+}
+
+/**
+ * @brief Read a texture reference.
+ *
+ * @param reader The binary reader.
+ *
+ * @return The texture reference.
+ */
+static TextureReference ReadTextureReference(BinaryReader& reader)
+{
+    TextureReference reference;
+    reference.Source = reader.Read<TextureSource>();
+    if (reference.Source == TextureSource::File)
+        reference.Index = reader.Read<uint32_t>();
+    else if (reference.Source == TextureSource::Attachment)
+    {
+        reference.FrameBuffer = reader.ReadString();
+        reference.Attachment = reader.Read<int32_t>();
+    }
+    return reference;
+}
+
+/**
+ * @brief Save the scene into a binary file.
+ *
+ * @param filePath The scene file path.
+ *
+ * @return `true` if the scene has been saved.
+ */
+bool SceneSerializer::Serialize(const std::filesystem::path& filePath)
+{
+    // The tables of referenced files are only known once the scene has been traversed,
+    // so the resources are written first and the tables are placed before them in the file
+    BinaryWriter body;
+
+    std::vector<std::pair<std::filesystem::path, bool>> textureTable;
+    std::unordered_map<Texture*, uint32_t> textureIndices;
+    std::vector<std::filesystem::path> meshTable;
+    std::unordered_map<std::string, uint32_t> meshIndices;
+
+    auto& frameBuffers = m_Scene.GetFrameBuffers();
+    auto& materials = Renderer::GetMaterialLibrary();
+    auto& models = m_Scene.GetModels();
+    auto& lights = m_Scene.GetLights();
+    auto& passes = m_Scene.GetRenderPasses();
+
+    // Write a reference to a texture
+    auto writeTexture = [&](const std::shared_ptr<Texture>& texture)
+    {
+        if (!texture)
+        {
+            body.Write(TextureSource::None);
+            return;
+        }
+        if (texture == utils::textures::WhiteTexture2D())
+        {
+            body.Write(TextureSource::White);
+            return;
+        }
+
+        // Image file
+        auto texture2D = std::dynamic_pointer_cast<Texture2D>(texture);
+        if (texture2D && !texture2D->GetPath().empty())
+        {
+            auto it = textureIndices.find(texture.get());
+            if (it == textureIndices.end())
+            {
+                it = textureIndices.emplace(texture.get(), (uint32_t)textureTable.size()).first;
+                textureTable.emplace_back(texture2D->GetPath(), texture2D->IsFlipped());
+            }
+            body.Write(TextureSource::File);
+            body.Write(it->second);
+            return;
+        }
+
+        // Framebuffer attachment
+        for (auto& [name, frameBuffer] : frameBuffers)
+        {
+            int32_t index = frameBuffer->GetDepthAttachment() == texture ? -1 : -2;
+            const auto& attachments = frameBuffer->GetColorAttachments();
+            for (size_t i = 0; i < attachments.size() && index == -2; i++)
+                index = attachments[i] == texture ? (int32_t)i : -2;
+
+            if (index == -2)
+                continue;
+
+            body.Write(TextureSource::Attachment);
+            body.WriteString(name);
+            body.Write(index);
+            return;
+        }
+
+        PIXEL_CORE_WARN("Texture without a source cannot be serialized!");
+        body.Write(TextureSource::None);
+    };
+
+    // Framebuffers
+    // ----------------------------------------
+    body.Write(static_cast<uint32_t>(frameBuffers.Size() - (frameBuffers.Exists(g_ScreenBufferName) ? 1 : 0)));
+    for (auto& [name, frameBuffer] : frameBuffers)
+    {
+        if (name == g_ScreenBufferName)
+            continue;
+
+        const auto& spec = frameBuffer->GetSpec();
+        body.WriteString(name);
+        body.Write(spec.Width); body.Write(spec.Height); body.Write(spec.Depth);
+        body.Write(spec.Samples); body.Write(spec.MipMaps); body.Write(spec.RenderBuffers);
+        body.Write(static_cast<uint32_t>(spec.AttachmentsSpec.TexturesSpec.size()));
+        for (const auto& textureSpec : spec.AttachmentsSpec.TexturesSpec)
+            WriteTextureSpecification(body, textureSpec);
+    }
+
+    // Materials
+    // ----------------------------------------
+    std::vector<std::pair<std::string, MaterialKind>> materialKinds;
+    for (auto& [name, material] : materials)
+    {
+        MaterialKind kind = std::dynamic_pointer_cast<UnlitMaterial>(material) ? MaterialKind::Unlit :
+                            std::dynamic_pointer_cast<DepthMaterial>(material) ? MaterialKind::Depth :
+                            std::dynamic_pointer_cast<PhongColorMaterial>(material) ? MaterialKind::PhongColor :
+                            std::dynamic_pointer_cast<PhongTextureMaterial>(material) ? MaterialKind::PhongTexture :
+                            MaterialKind::None;
+        if (kind == MaterialKind::None)
+        {
+            PIXEL_CORE_WARN("Material '" + name + "' cannot be serialized!");
+            continue;
+        }
+        materialKinds.emplace_back(name, kind);
+    }
+
+    body.Write(static_cast<uint32_t>(materialKinds.size()));
+    for (auto& [name, kind] : materialKinds)
+    {
+        auto& material = materials.Get(name);
+        std::filesystem::path shaderPath = material->GetShader()->GetPath();
+
+        body.WriteString(name);
+        body.Write(kind);
+        body.WriteString(shaderPath.replace_extension().string());
+
+        switch (kind)
+        {
+            case MaterialKind::Unlit:
+            {
+                auto unlit = std::dynamic_pointer_cast<UnlitMaterial>(material);
+                body.Write(unlit->GetColor());
+                writeTexture(unlit->GetTextureMap());
+                break;
+            }
+            case MaterialKind::Depth:
+            {
+                auto depth = std::dynamic_pointer_cast<DepthMaterial>(material);
+                body.Write(depth->IsLinearizeDepth());
+                body.Write(depth->GetNearPlane());
+                body.Write(depth->GetFarPlane());
+                writeTexture(depth->GetTextureMap());
+                break;
+            }
+            case MaterialKind::PhongColor:
+            {
+                auto phong = std::dynamic_pointer_cast<PhongColorMaterial>(material);
+                body.Write(phong->GetAmbientColor());
+                body.Write(phong->GetDiffuseColor());
+                body.Write(phong->GetSpecularColor());
+                body.Write(phong->GetColor().a);
+                body.Write(phong->GetShininess());
+                break;
+            }
+            case MaterialKind::PhongTexture:
+            {
+                auto phong = std::dynamic_pointer_cast<PhongTextureMaterial>(material);
+                body.Write(phong->GetShininess());
+                writeTexture(phong->GetDiffuseMap());
+                writeTexture(phong->GetSpecularMap());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Models (by reference to their source files)
+    // ----------------------------------------
+    std::vector<std::pair<std::string, std::shared_ptr<AssimpModel>>> loadedModels;
+    for (auto& [name, model] : models)
+    {
+        auto loaded = std::dynamic_pointer_cast<AssimpModel>(model);
+        if (loaded)
+            loadedModels.emplace_back(name, loaded);
+        else if (name != g_ViewportModelName)
+            PIXEL_CORE_WARN("Model '" + name + "' is not loaded from a file and cannot be serialized!");
+    }
+
+    body.Write(static_cast<uint32_t>(loadedModels.size()));
+    for (auto& [name, model] : loadedModels)
+    {
+        std::string path = model->GetPath().string();
+        auto it = meshIndices.find(path);
+        if (it == meshIndices.end())
+        {
+            it = meshIndices.emplace(path, (uint32_t)meshTable.size()).first;
+            meshTable.push_back(model->GetPath());
+        }
+
+        body.WriteString(name);
+        body.Write(it->second);
+        body.Write(model->GetPrimitive());
+        body.Write(model->GetPosition());
+        body.Write(model->GetRotation());
+        body.Write(model->GetScale());
+        body.Write(model->GetUpAxis());
+    }
+
+    // Lights
+    // ----------------------------------------
+    std::vector<std::pair<std::string, LightKind>> lightKinds;
+    for (auto& [name, light] : lights)
+    {
+        LightKind kind = std::dynamic_pointer_cast<PositionalLight>(light) ? LightKind::Positional :
+                         std::dynamic_pointer_cast<DirectionalLight>(light) ? LightKind::Directional :
+                         std::dynamic_pointer_cast<SHEnvironmentLight>(light) ? LightKind::SHEnvironment :
+                         std::dynamic_pointer_cast<EnvironmentLight>(light) ? LightKind::Environment :
+                         LightKind::None;
+        if (kind == LightKind::None)
+        {
+            PIXEL_CORE_WARN("Light '" + name + "' cannot be serialized!");
+            continue;
+        }
+        lightKinds.emplace_back(name, kind);
+    }
+
+    body.Write(static_cast<uint32_t>(lightKinds.size()));
+    for (auto& [name, kind] : lightKinds)
+    {
+        auto& light = lights.Get(name);
+        body.WriteString(name);
+        body.Write(kind);
+
+        if (auto environment = std::dynamic_pointer_cast<EnvironmentLight>(light))
+        {
+            body.Write(environment->GetAmbientStrength());
+            writeTexture(environment->GetEnvironmentMap());
+            continue;
+        }
+
+        auto caster = std::dynamic_pointer_cast<LightCaster>(light);
+        body.Write(caster->GetColor());
+        body.Write(caster->GetDiffuseStrength());
+        body.Write(caster->GetSpecularStrength());
+
+        if (auto positional = std::dynamic_pointer_cast<PositionalLight>(light))
+        {
+            auto camera = std::dynamic_pointer_cast<PerspectiveCamera>(positional->GetShadowCamera());
+            body.Write(positional->GetPosition());
+            body.Write(camera ? camera->GetFieldOfView() : 90.0f);
+        }
+        else if (auto directional = std::dynamic_pointer_cast<DirectionalLight>(light))
+        {
+            body.Write(directional->GetDirection());
+            body.Write(directional->GetDistance());
+        }
+        body.Write(light->GetModel() ? light->GetModel()->GetScale() : glm::vec3(1.0f));
+
+        // Shadow map
+        const auto& shadow = caster->GetShadowFrameBuffer();
+        body.Write(shadow != nullptr);
+        if (shadow)
+        {
+            const auto& spec = shadow->GetSpec();
+            body.Write(spec.Width);
+            body.Write(spec.Height);
+            body.Write(spec.AttachmentsSpec.TexturesSpec.empty() ? TextureFormat::DEPTH24 :
+                       spec.AttachmentsSpec.TexturesSpec[0].Format);
+        }
+    }
+
+    // Render passes
+    // ----------------------------------------
+    // Find the name of the light owning a shadow resource
+    auto findShadowOwner = [&lights](const auto& matches) -> std::string
+    {
+        for (auto& [name, light] : lights)
+        {
+            auto caster = std::dynamic_pointer_cast<LightCaster>(light);
+            if (caster && matches(caster))
+                return name;
+        }
+        return "";
+    };
+
+    body.Write(static_cast<uint32_t>(passes.GetOrder().size()));
+    for (const auto& name : passes.GetOrder())
+    {
+        const auto& pass = passes.Get(name);
+        body.WriteString(name);
+        body.Write(pass.Active);
+
+        // Target
+        const auto& target = pass.Target;
+        std::string frameBufferName;
+        ResourceSource frameBufferSource = ResourceSource::None;
+        if (target.FrameBuffer)
+        {
+            for (auto& [fbName, frameBuffer] : frameBuffers)
+            {
+                if (frameBuffer == target.FrameBuffer)
+                {
+                    frameBufferName = fbName;
+                    frameBufferSource = ResourceSource::Scene;
+                }
+            }
+            if (frameBufferSource == ResourceSource::None)
+            {
+                frameBufferName = findShadowOwner([&target](const std::shared_ptr<LightCaster>& light)
+                                                  { return light->GetShadowFrameBuffer() == target.FrameBuffer; });
+                frameBufferSource = frameBufferName.empty() ? ResourceSource::None : ResourceSource::Light;
+            }
+            if (frameBufferSource == ResourceSource::None)
+                PIXEL_CORE_WARN("Render pass '" + name + "' targets a framebuffer outside of the scene!");
+        }
+        body.Write(frameBufferSource);
+        body.WriteString(frameBufferName);
+
+        body.Write(target.ViewportSize.has_value());
+        body.Write(target.ViewportSize.value_or(glm::vec2(0.0f)));
+        body.Write(target.ClearEnabled);
+        body.Write(target.ClearColor);
+        body.Write(target.ClearTargets.has_value());
+        body.Write(target.ClearTargets.value_or(RenderTargetMask::None));
+        
+        // Load/store actions (the resolve target is one of the scene framebuffers)
+        body.Write(target.Actions.has_value());
+        if (target.Actions)
+        {
+            const auto& actions = *target.Actions;
+            body.Write(actions.Color);
+            body.Write(static_cast<uint32_t>(actions.ColorAttachments.size()));
+            for (const auto& attachment : actions.ColorAttachments)
+                body.Write(attachment);
+            body.Write(actions.Depth);
+            body.Write(actions.ClearColor);
+            body.Write(actions.ClearDepth);
+            body.Write(actions.ClearStencil);
+            
+            std::string resolveName;
+            for (auto& [fbName, frameBuffer] : frameBuffers)
+            {
+                if (actions.ResolveTarget && frameBuffer == actions.ResolveTarget)
+                    resolveName = fbName;
+            }
+            if (actions.ResolveTarget && resolveName.empty())
+                PIXEL_CORE_WARN("Render pass '" + name + "' resolves into a framebuffer outside of the scene!");
+            body.WriteString(resolveName);
+        }
+
+        // Camera
+        const auto& camera = pass.Render.Camera;
+        std::string cameraName;
+        ResourceSource cameraSource = ResourceSource::None;
+        if (camera == m_Scene.GetCamera())
+            cameraSource = ResourceSource::Scene;
+        else if (camera)
+        {
+            cameraName = findShadowOwner([&camera](const std::shared_ptr<LightCaster>& light)
+                                         { return light->GetShadowCamera() == camera; });
+            cameraSource = cameraName.empty() ? ResourceSource::Scene : ResourceSource::Light;
+            if (cameraName.empty())
+                PIXEL_CORE_WARN("Render pass '" + name + "' uses a custom camera, replaced by the scene camera!");
+        }
+        body.Write(cameraSource);
+        body.WriteString(cameraName);
+
+        // Models
+        bool hasCode = pass.Hooks.PreRenderCode || pass.Hooks.PostRenderCode;
+        body.Write(static_cast<uint32_t>(pass.Render.Models.size()));
+        for (const auto& renderable : pass.Render.Models)
+        {
+            body.WriteString(renderable.ModelName);
+            body.WriteString(renderable.MaterialName);
+            body.Write(renderable.Occluder);
+            body.Write(renderable.Culling.has_value());
+            if (renderable.Culling)
+                body.Write(*renderable.Culling);
+            hasCode |= renderable.ModelSetupFunction || renderable.MaterialSetupFunction;
+        }
+        body.Write(pass.Render.RenderLights);
+        body.Write(pass.Render.RenderBackground);
+        body.Write(pass.Render.SortByPipeline);
+        body.Write(pass.Render.Occlusion);
+        body.Write(pass.Render.OcclusionInterval);
+        body.Write(pass.Culling);
+        body.Write(pass.Render.Clusters);
+
+        if (hasCode)
+            PIXEL_CORE_WARN("Code defined in render pass '" + name + "' is not serialized!");
+    }
+
+    // Write the file: header, tables of referenced files and resources
+    // ----------------------------------------
+    BinaryWriter header;
+    header.Write(g_SceneMagic);
+    header.Write(g_SceneVersion);
+
+    header.Write(static_cast<uint32_t>(textureTable.size()));
+    for (const auto& [path, flip] : textureTable)
+    {
+        header.WriteString(path.string());
+        header.Write(flip);
+    }
+    header.Write(static_cast<uint32_t>(meshTable.size()));
+    for (const auto& path : meshTable)
+        header.WriteString(path.string());
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_WARN("Unable to save the scene in " + filePath.string());
+        return false;
+    }
+    file.write(header.GetData().data(), header.GetData().size());
+    file.write(body.GetData().data(), body.GetData().size());
+    return file.good();
+}
+
+/**
+ * @brief Load a scene from a binary file into the scene.
+ *
+ * Resources whose name is already defined in the scene are kept and not loaded again.
+ *
+ * The function returns once the file is parsed: the referenced images and models are loaded in
+ * the background by the `AssetManager`, and the scene defines them as they become ready (see
+ * `Scene::WhenLoaded()`). Use `Scene::WaitForLoads()` to block until they are all defined.
+ *
+ * @param filePath The scene file path.
+ *
+ * @return `true` if the scene file has been read.
+ */
+bool SceneSerializer::Deserialize(const std::filesystem::path& filePath)
+{
+    // Read the whole file at once
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        PIXEL_CORE_WARN("Failed to load: " + filePath.filename().string());
+        return false;
+    }
+    std::vector<char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(data.data(), data.size());
+    file.close();
+
+    BinaryReader reader(data);
+
+    // Header
+    // ----------------------------------------
+    auto magic = reader.Read<std::array<char, 4>>();
+    uint32_t version = reader.Read<uint32_t>();
+    if (!reader.IsValid() || memcmp(magic.data(), g_SceneMagic, sizeof(g_SceneMagic)) != 0 ||
+        version != g_SceneVersion)
+    {
+        PIXEL_CORE_WARN("Invalid scene file: " + filePath.filename().string());
+        return false;
+    }
+
+    // Referenced files (loaded in the background while the rest of the file is parsed)
+    // ----------------------------------------
+    std::vector<std::pair<std::filesystem::path, bool>> textureTable(reader.Read<uint32_t>());
+    for (auto& [path, flip] : textureTable)
+    {
+        path = reader.ReadString();
+        flip = reader.Read<bool>();
+    }
+    std::vector<std::filesystem::path> meshTable(reader.Read<uint32_t>());
+    for (auto& path : meshTable)
+        path = reader.ReadString();
+
+    if (!reader.IsValid())
+    {
+        PIXEL_CORE_WARN("Corrupted scene file: " + filePath.filename().string());
+        return false;
+    }
+
+    std::vector<AssetHandle<Texture2D>> textures;
+    textures.reserve(textureTable.size());
+    for (const auto& [path, flip] : textureTable)
+        textures.push_back(AssetManager::LoadTexture(path, flip));
+    std::vector<AssetHandle<AssimpModel>> meshes;
+    meshes.reserve(meshTable.size());
+    for (const auto& path : meshTable)
+        meshes.push_back(AssetManager::LoadModel(path));
+
+    // Framebuffers
+    // ----------------------------------------
+    std::vector<std::pair<std::string, FrameBufferSpecification>> frameBufferDescriptions(reader.Read<uint32_t>());
+    for (auto& [name, spec] : frameBufferDescriptions)
+    {
+        name = reader.ReadString();
+        spec.Width = reader.Read<uint32_t>();
+        spec.Height = reader.Read<uint32_t>();
+        spec.Depth = reader.Read<uint32_t>();
+        spec.Samples = reader.Read<uint32_t>();
+        spec.MipMaps = reader.Read<bool>();
+        spec.RenderBuffers = reader.Read<bool>();
+
+        uint32_t attachmentCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < attachmentCount && reader.IsValid(); i++)
+            spec.AttachmentsSpec.TexturesSpec.push_back(ReadTextureSpecification(reader));
+    }
+
+    // Materials
+    // ----------------------------------------
+    std::vector<MaterialDescription> materialDescriptions(reader.Read<uint32_t>());
+    for (auto& material : materialDescriptions)
+    {
+        material.Name = reader.ReadString();
+        material.Kind = reader.Read<MaterialKind>();
+        material.ShaderPath = reader.ReadString();
+
+        switch (material.Kind)
+        {
+            case MaterialKind::Unlit:
+                material.Color = reader.Read<glm::vec4>();
+                material.Textures[0] = ReadTextureReference(reader);
+                break;
+            case MaterialKind::Depth:
+                material.LinearizeDepth = reader.Read<bool>();
+                material.NearPlane = reader.Read<float>();
+                material.FarPlane = reader.Read<float>();
+                material.Textures[0] = ReadTextureReference(reader);
+                break;
+            case MaterialKind::PhongColor:
+                material.Ka = reader.Read<glm::vec3>();
+                material.Kd = reader.Read<glm::vec3>();
+                material.Ks = reader.Read<glm::vec3>();
+                material.Alpha = reader.Read<float>();
+                material.Shininess = reader.Read<float>();
+                break;
+            case MaterialKind::PhongTexture:
+                material.Shininess = reader.Read<float>();
+                material.Textures[0] = ReadTextureReference(reader);
+                material.Textures[1] = ReadTextureReference(reader);
+                break;
+            default:
+                PIXEL_CORE_WARN("Corrupted scene file: " + filePath.filename().string());
+                return false;
+        }
+    }
+
+    // Models
+    // ----------------------------------------
+    std::vector<ModelDescription> modelDescriptions(reader.Read<uint32_t>());
+    for (auto& model : modelDescriptions)
+    {
+        model.Name = reader.ReadString();
+        model.Mesh = reader.Read<uint32_t>();
+        model.Primitive = reader.Read<PrimitiveType>();
+        model.Position = reader.Read<glm::vec3>();
+        model.Rotation = reader.Read<glm::vec3>();
+        model.Scale = reader.Read<glm::vec3>();
+        model.UpAxis = reader.Read<glm::vec3>();
+    }
+
+    // Lights
+    // ----------------------------------------
+    std::vector<LightDescription> lightDescriptions(reader.Read<uint32_t>());
+    for (auto& light : lightDescriptions)
+    {
+        light.Name = reader.ReadString();
+        light.Kind = reader.Read<LightKind>();
+
+        if (light.Kind == LightKind::Environment || light.Kind == LightKind::SHEnvironment)
+        {
+            light.AmbientStrength = reader.Read<float>();
+            light.EnvironmentMap = ReadTextureReference(reader);
+            continue;
+        }
+
+        light.Color = reader.Read<glm::vec3>();
+        light.DiffuseStrength = reader.Read<float>();
+        light.SpecularStrength = reader.Read<float>();
+        light.Vector = reader.Read<glm::vec3>();
+        light.Parameter = reader.Read<float>();
+        light.ModelScale = reader.Read<glm::vec3>();
+
+        light.Shadow = reader.Read<bool>();
+        if (light.Shadow)
+        {
+            light.ShadowWidth = reader.Read<uint32_t>();
+            light.ShadowHeight = reader.Read<uint32_t>();
+            light.ShadowFormat = reader.Read<TextureFormat>();
+        }
+    }
+
+    // Render passes
+    // ----------------------------------------
+    std::vector<RenderPassDescription> passDescriptions(reader.Read<uint32_t>());
+    for (auto& pass : passDescriptions)
+    {
+        pass.Name = reader.ReadString();
+        pass.Spec.Active = reader.Read<bool>();
+
+        auto& target = pass.Spec.Target;
+        pass.Target = reader.Read<ResourceSource>();
+        pass.TargetName = reader.ReadString();
+        if (reader.Read<bool>())
+            target.ViewportSize = reader.Read<glm::vec2>();
+        else
+            reader.Read<glm::vec2>();
+        target.ClearEnabled = reader.Read<bool>();
+        target.ClearColor = reader.Read<glm::vec4>();
+        if (reader.Read<bool>())
+            target.ClearTargets = reader.Read<RenderTargetMask>();
+        else
+            reader.Read<RenderTargetMask>();
+        if (reader.Read<bool>())
+        {
+            RenderPassActions actions;
+            actions.Color = reader.Read<AttachmentActions>();
+            uint32_t attachmentCount = reader.Read<uint32_t>();
+            for (uint32_t i = 0; i < attachmentCount && reader.IsValid(); i++)
+                actions.ColorAttachments.push_back(reader.Read<AttachmentActions>());
+            actions.Depth = reader.Read<AttachmentActions>();
+            actions.ClearColor = reader.Read<glm::vec4>();
+            actions.ClearDepth = reader.Read<float>();
+            actions.ClearStencil = reader.Read<int32_t>();
+            pass.ResolveTargetName = reader.ReadString();
+            target.Actions = actions;
+        }
+
+        pass.Camera = reader.Read<ResourceSource>();
+        pass.CameraName = reader.ReadString();
+
+        uint32_t modelCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < modelCount && reader.IsValid(); i++)
+        {
+            Renderable renderable;
+            renderable.ModelName = reader.ReadString();
+            renderable.MaterialName = reader.ReadString();
+            renderable.Occluder = reader.Read<bool>();
+            if (reader.Read<bool>())
+                renderable.Culling = reader.Read<CullingSettings>();
+            pass.Spec.Render.Models.push_back(renderable);
+        }
+        pass.Spec.Render.RenderLights = reader.Read<bool>();
+        pass.Spec.Render.RenderBackground = reader.Read<bool>();
+        pass.Spec.Render.SortByPipeline = reader.Read<bool>();
+        pass.Spec.Render.Occlusion = reader.Read<OcclusionCulling>();
+        pass.Spec.Render.OcclusionInterval = reader.Read<uint32_t>();
+        pass.Spec.Culling = reader.Read<CullingSettings>();
+        pass.Spec.Render.Clusters = reader.Read<ClusterCullingMode>();
+    }
+
+    if (!reader.IsValid())
+    {
+        PIXEL_CORE_WARN("Corrupted scene file: " + filePath.filename().string());
+        return false;
+    }
+
+    // Create the resources in bulk (dependency order, the loaded files are defined once ready)
+    // ----------------------------------------
+    auto& frameBuffers = m_Scene.GetFrameBuffers();
+    auto& materials = Renderer::GetMaterialLibrary();
+    auto& models = m_Scene.GetModels();
+    auto& lights = m_Scene.GetLights();
+    auto& passes = m_Scene.GetRenderPasses();
+
+    for (const auto& [name, spec] : frameBufferDescriptions)
+    {
+        if (!frameBuffers.Exists(name))
+            frameBuffers.Create(name, spec);
+    }
+
+    // Textures (the ones read from files are defined once loaded)
+    auto findTexture = [&frameBuffers](const TextureReference& reference) -> std::shared_ptr<Texture>
+    {
+        switch (reference.Source)
+        {
+            case TextureSource::White:
+                return utils::textures::WhiteTexture2D();
+            case TextureSource::Attachment:
+            {
+                if (!frameBuffers.Exists(reference.FrameBuffer))
+                    return nullptr;
+                auto& frameBuffer = frameBuffers.Get(reference.FrameBuffer);
+                return reference.Attachment < 0 ? frameBuffer->GetDepthAttachment() :
+                       frameBuffer->GetColorAttachment(reference.Attachment);
+            }
+            case TextureSource::None:
+            default:
+                return nullptr;
+        }
+    };
+
+    using DefineTexture = std::function<void(const std::shared_ptr<Texture>&)>;
+    auto resolveTexture = [&](const TextureReference& reference, const DefineTexture& define)
+    {
+        if (reference.Source != TextureSource::File)
+        {
+            define(findTexture(reference));
+            return;
+        }
+        if (reference.Index >= textures.size())
+            return;
+
+        auto handle = textures[reference.Index];
+        m_Scene.WhenLoaded({ handle.GetRecord() }, [handle, define](Scene&)
+        {
+            if (auto texture = handle.Get())
+                define(texture);
+        });
+    };
+
+    // Materials
+    for (const auto& description : materialDescriptions)
+    {
+        if (materials.Exists(description.Name))
+            continue;
+
+        switch (description.Kind)
+        {
+            case MaterialKind::Unlit:
+            {
+                auto material = materials.Create<UnlitMaterial>(description.Name, description.ShaderPath);
+                material->SetColor(description.Color);
+                resolveTexture(description.Textures[0], [material](const std::shared_ptr<Texture>& texture)
+                {
+                    material->SetTextureMap(texture);
+                });
+                break;
+            }
+            case MaterialKind::Depth:
+            {
+                auto material = materials.Create<DepthMaterial>(description.Name, description.ShaderPath);
+                material->EnableLinearizeDepth(description.LinearizeDepth);
+                material->SetNearFar(description.NearPlane, description.FarPlane);
+                resolveTexture(description.Textures[0], [material](const std::shared_ptr<Texture>& texture)
+                {
+                    material->SetTextureMap(texture);
+                });
+                break;
+            }
+            case MaterialKind::PhongColor:
+            {
+                auto material = materials.Create<PhongColorMaterial>(description.Name, description.ShaderPath);
+                material->SetColor(glm::vec4(description.Kd, description.Alpha));
+                material->SetAmbientColor(description.Ka);
+                material->SetSpecularColor(description.Ks);
+                material->SetShininess(description.Shininess);
+                break;
+            }
+            case MaterialKind::PhongTexture:
+            {
+                auto material = materials.Create<PhongTextureMaterial>(description.Name, description.ShaderPath);
+                material->SetShininess(description.Shininess);
+                resolveTexture(description.Textures[0], [material](const std::shared_ptr<Texture>& texture)
+                {
+                    material->SetDiffuseMap(texture);
+                });
+                resolveTexture(description.Textures[1], [material](const std::shared_ptr<Texture>& texture)
+                {
+                    material->SetSpecularMap(texture);
+                });
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Models (added to the scene once their meshes are loaded, sharing them between instances)
+    for (const auto& description : modelDescriptions)
+    {
+        if (models.Exists(description.Name) || description.Mesh >= meshes.size())
+            continue;
+
+        auto handle = meshes[description.Mesh];
+        m_Scene.WhenLoaded({ handle.GetRecord() }, [handle, description](Scene& scene)
+        {
+            auto source = handle.Get();
+            auto& library = scene.GetModels();
+            if (!source || library.Exists(description.Name))
+                return;
+
+            auto model = library.Create<AssimpModel>(description.Name, *source, description.Primitive);
+            model->SetUpAxis(description.UpAxis);
+            model->SetScale(description.Scale);
+            model->SetRotation(description.Rotation);
+            model->SetPosition(description.Position);
+        });
+    }
+
+    // Lights
+    for (const auto& description : lightDescriptions)
+    {
+        if (lights.Exists(description.Name))
+            continue;
+
+        if (description.Kind == LightKind::Environment || description.Kind == LightKind::SHEnvironment)
+        {
+            std::shared_ptr<EnvironmentLight> light;
+            if (description.Kind == LightKind::SHEnvironment)
+                light = lights.Create<SHEnvironmentLight>(description.Name);
+            else
+                light = lights.Create<EnvironmentLight>(description.Name);
+
+            light->SetAmbientStrength(description.AmbientStrength);
+            resolveTexture(description.EnvironmentMap, [light](const std::shared_ptr<Texture>& map)
+            {
+                if (map)
+                    light->SetEnvironmentMap(map);
+            });
+            continue;
+        }
+
+        std::shared_ptr<LightCaster> light;
+        if (description.Kind == LightKind::Positional)
+            light = lights.Create<PositionalLight>(description.Name, description.Color,
+                                                   description.Vector, description.Parameter);
+        else
+        {
+            auto directional = lights.Create<DirectionalLight>(description.Name, description.Color,
+                                                               description.Vector);
+            directional->SetDistance(description.Parameter);
+            light = directional;
+        }
+
+        light->SetDiffuseStrength(description.DiffuseStrength);
+        light->SetSpecularStrength(description.SpecularStrength);
+        if (light->GetModel())
+            light->GetModel()->SetScale(description.ModelScale);
+        if (description.Shadow)
+            light->InitShadowFrameBuffer(description.ShadowWidth, description.ShadowHeight,
+                                         description.ShadowFormat);
+    }
+
+    // Render passes
+    for (auto& description : passDescriptions)
+    {
+        if (passes.Exists(description.Name))
+            continue;
+
+        auto shadowOwner = [&lights](const std::string& name) -> std::shared_ptr<LightCaster>
+        {
+            return lights.Exists(name) ? std::dynamic_pointer_cast<LightCaster>(lights.Get(name)) : nullptr;
+        };
+
+        auto& spec = description.Spec;
+        if (description.Target == ResourceSource::Scene && frameBuffers.Exists(description.TargetName))
+            spec.Target.FrameBuffer = frameBuffers.Get(description.TargetName);
+        else if (description.Target == ResourceSource::Light)
+        {
+            if (auto light = shadowOwner(description.TargetName))
+                spec.Target.FrameBuffer = light->GetShadowFrameBuffer();
+        }
+
+        if (spec.Target.Actions && frameBuffers.Exists(description.ResolveTargetName))
+            spec.Target.Actions->ResolveTarget = frameBuffers.Get(description.ResolveTargetName);
+
+        if (description.Camera == ResourceSource::Scene)
+            spec.Render.Camera = m_Scene.GetCamera();
+        else if (description.Camera == ResourceSource::Light)
+        {
+            if (auto light = shadowOwner(description.CameraName))
+                spec.Render.Camera = light->GetShadowCamera();
+        }
+
+        passes.Add(description.Name, spec);
+    }
+
+    return true;
+}
+
+} // namespace pixc
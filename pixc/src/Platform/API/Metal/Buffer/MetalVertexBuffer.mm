@@ -16,7 +16,7 @@ namespace pixc {
  */
 MetalVertexBuffer::MetalVertexBuffer(const void *vertices, const uint32_t size,
                                      const uint32_t count)
-    : VertexBuffer(count)
+    : VertexBuffer(size, count)
 {
     // Get the Metal graphics context
     MetalContext* context = dynamic_cast<MetalContext*>(&GraphicsContext::Get());
@@ -32,4 +32,43 @@ MetalVertexBuffer::MetalVertexBuffer(const void *vertices, const uint32_t size,
     m_Buffer = reinterpret_cast<void*>(buffer);
 }
 
+/**
+ * @brief Generate an empty vertex buffer to be updated frequently.
+ *
+ * @param size Size of the buffer in bytes.
+ */
+MetalVertexBuffer::MetalVertexBuffer(const uint32_t size)
+    : VertexBuffer(size, 0)
+{
+    // Get the Metal graphics context
+    MetalContext* context = dynamic_cast<MetalContext*>(&GraphicsContext::Get());
+    PIXEL_CORE_ASSERT(context, "Graphic context is not Metal!");
+    // Get the Metal device from the context
+    id<MTLDevice> device = reinterpret_cast<id<MTLDevice>>(context->GetDevice());
+    
+    // Create the Metal buffer
+    id<MTLBuffer> buffer = [device
+                            newBufferWithLength:size
+                            options:MTLResourceStorageModeShared];
+    m_Buffer = reinterpret_cast<void*>(buffer);
+}
+
+/**
+ * @brief Update the content of the vertex buffer.
+ *
+ * @param vertices The new vertex data.
+ * @param size Size of the vertex data in bytes.
+ * @param count Number of vertices.
+ */
+void MetalVertexBuffer::SetData(const void *vertices, const uint32_t size,
+                                const uint32_t count)
+{
+    PIXEL_CORE_ASSERT(size <= m_Size, "Vertex data exceeds the size of the buffer!");
+    
+    id<MTLBuffer> buffer = reinterpret_cast<id<MTLBuffer>>(m_Buffer);
+    memcpy([buffer contents], vertices, size);
+    
+    m_Count = count;
+}
+
 } // namespace pixc
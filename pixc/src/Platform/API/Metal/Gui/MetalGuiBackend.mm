@@ -36,6 +36,8 @@ void MetalGuiBackend::Init()
     // Initialize ImGui Glfw and Metal
     ImGui_ImplGlfw_InitForOther(window, true);
     ImGui_ImplMetal_Init(device);
+    // Create the device objects right away (the frames may be built on another thread)
+    ImGui_ImplMetal_CreateDeviceObjects(device);
 }
 
 /**
@@ -78,8 +80,10 @@ void MetalGuiBackend::BeginFrame()
 
 /**
  * @brief Renders the ImGui draw data using Metal.
+ *
+ * @param drawData The draw data of the frame.
  */
-void MetalGuiBackend::EndFrame()
+void MetalGuiBackend::EndFrame(ImDrawData* drawData)
 {
     @autoreleasepool
     {
@@ -88,7 +92,7 @@ void MetalGuiBackend::EndFrame()
         auto encoder = reinterpret_cast<id<MTLRenderCommandEncoder>>(m_Context->GetCommandEncoder());
         
         // Render the imgui data
-        ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, encoder);
+        ImGui_ImplMetal_RenderDrawData(drawData, commandBuffer, encoder);
     }
 }
 
@@ -277,6 +277,20 @@ void MetalRendererAPI::Clear(const RenderTargetMask targets)
  */
  void MetalRendererAPI::Draw(const std::shared_ptr<Drawable>& drawable,
                              const PrimitiveType &primitive)
+{
+    DrawIndexed(drawable, drawable->GetIndexBuffer()->GetCount(), primitive);
+}
+
+/**
+ * @brief Render only the first indices of a drawable object.
+ *
+ * @param drawable The drawable containing the vertex and index buffers for rendering.
+ * @param indexCount The number of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void MetalRendererAPI::DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                                   const uint32_t indexCount,
+                                   const PrimitiveType &primitive)
 {
     // Get the command encoder to encode rendering commands into the buffer
     auto encoder = reinterpret_cast<id<MTLRenderCommandEncoder>>(m_Context->GetCommandEncoder());
@@ -296,7 +310,7 @@ void MetalRendererAPI::Clear(const RenderTargetMask targets)
     auto indexBuffer = reinterpret_cast<id<MTLBuffer>>(metalIndexBuffer->GetBuffer());
     [encoder
         drawIndexedPrimitives:utils::graphics::mtl::ToMetalPrimitive(primitive)
-        indexCount:metalIndexBuffer->GetCount()
+        indexCount:indexCount
         indexType:MTLIndexTypeUInt32
         indexBuffer:indexBuffer
         indexBufferOffset:0
@@ -3,6 +3,7 @@
 
 #include "Platform/Metal/MetalRendererUtils.h"
 #include "Platform/Metal/Texture/MetalTexture.h"
+#include "Platform/Metal/Texture/MetalSampler.h"
 
 #include <Metal/Metal.h>
 
@@ -214,10 +215,12 @@ void MetalShader::SetMat4(const std::string& name, const glm::mat4& value)
  * @param texture The texture map.
  * @param name Uniform name.
  * @param slot The texture slot.
+ * @param sampler The sampler used to read the texture (the sampler of the texture if not defined).
  */
 void MetalShader::SetTexture(const std::string &name,
                              const std::shared_ptr<Texture>& texture,
-                             int slot)
+                             int slot,
+                             const std::shared_ptr<Sampler>& sampler)
 {
     // Return early if the texture pointer is null
     if(!texture)
@@ -236,6 +239,9 @@ void MetalShader::SetTexture(const std::string &name,
         // Get the Metal texture and sampler
         auto rawTexture = reinterpret_cast<id<MTLTexture>>(metalTexture->MTLGetTexture());
         auto rawSampler = reinterpret_cast<id<MTLSamplerState>>(metalTexture->MTLGetSampler());
+        auto metalSampler = std::dynamic_pointer_cast<MetalSampler>(sampler);
+        if (metalSampler && metalSampler->MTLGetSampler())
+            rawSampler = reinterpret_cast<id<MTLSamplerState>>(metalSampler->MTLGetSampler());
         
         // Get the texture uniform information
         auto [group, member] = utils::SplitString(name);
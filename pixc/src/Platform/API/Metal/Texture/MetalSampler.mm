@@ -0,0 +1,92 @@
+#include "pixcpch.h"
+#include "Platform/Metal/Texture/MetalSampler.h"
+
+#include "Foundation/Renderer/RendererAPI.h"
+
+#include "Platform/Metal/MetalRendererUtils.h"
+#include "Platform/Metal/Texture/MetalTextureUtils.h"
+
+#include <Metal/Metal.h>
+
+namespace pixc {
+
+/**
+ * @brief Get the Metal border color closest to a color (Metal only supports three of them).
+ *
+ * @param color The border color.
+ *
+ * @return The Metal border color.
+ */
+static MTLSamplerBorderColor ToMetalBorderColor(const glm::vec4& color)
+{
+    if (color.a < 0.5f)
+        return MTLSamplerBorderColorTransparentBlack;
+    return glm::dot(glm::vec3(color), glm::vec3(1.0f)) < 1.5f ? MTLSamplerBorderColorOpaqueBlack
+                                                               : MTLSamplerBorderColorOpaqueWhite;
+}
+
+/**
+ * @brief Create a sampler state object with a specific sampling state.
+ *
+ * @param spec The sampler specifications.
+ */
+MetalSampler::MetalSampler(const SamplerSpecification& spec)
+    : Sampler(spec)
+{
+    @autoreleasepool
+    {
+        // Get the Metal device from the context
+        MetalContext& context = dynamic_cast<MetalContext&>(GraphicsContext::Get());
+        id<MTLDevice> device = reinterpret_cast<id<MTLDevice>>(context.GetDevice());
+        
+        MTLSamplerDescriptor *descriptor = [[MTLSamplerDescriptor alloc] init];
+        
+        // Define the filter apply when sampling
+        descriptor.minFilter = utils::textures::mtl::ToMetalMinMaxFilter(m_Spec.Filter.Min);
+        descriptor.magFilter = utils::textures::mtl::ToMetalMinMaxFilter(m_Spec.Filter.Mag);
+        descriptor.mipFilter = utils::textures::mtl::ToMetalMipFilter(m_Spec.Filter.Mip, m_Spec.MipMaps);
+        
+        // Define the wrapping mode
+        descriptor.sAddressMode = utils::textures::mtl::ToMetalWrap(m_Spec.Wrap);
+        descriptor.tAddressMode = utils::textures::mtl::ToMetalWrap(m_Spec.Wrap);
+        descriptor.rAddressMode = utils::textures::mtl::ToMetalWrap(m_Spec.Wrap);
+        descriptor.borderColor = ToMetalBorderColor(m_Spec.BorderColor);
+        
+        // Define the depth comparison (shadow samplers, the closest depth is the largest one if reversed)
+        if (m_Spec.CompareDepth)
+        {
+            DepthFunction compare = RendererAPI::IsDepthReversed() ? DepthFunction::GEqual : DepthFunction::LEqual;
+            descriptor.compareFunction = utils::graphics::mtl::ToMetalCompareFunction(compare);
+        }
+        
+        // Create the sampler
+        id<MTLSamplerState> sampler = [device newSamplerStateWithDescriptor:descriptor];
+        PIXEL_CORE_ASSERT(sampler, "Error creating sampler!");
+        m_Sampler = reinterpret_cast<void*>(sampler);
+        
+        // Release the memory of the descriptor
+        [descriptor release];
+    } // autoreleasepool
+}
+
+/**
+ * @brief Delete the sampler state object.
+ */
+MetalSampler::~MetalSampler()
+{
+    Release();
+}
+
+/**
+ * @brief Delete the sampler state object (the sampler states of the textures are used from then on).
+ */
+void MetalSampler::Release()
+{
+    if (!m_Sampler)
+        return;
+    
+    [reinterpret_cast<id<MTLSamplerState>>(m_Sampler) release];
+    m_Sampler = nullptr;
+}
+
+} // namespace pixc
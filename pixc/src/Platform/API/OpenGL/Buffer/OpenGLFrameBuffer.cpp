@@ -15,8 +15,71 @@
 
 #include <GL/glew.h>
 
+#include <deque>
+
 namespace pixc {
 
+/**
+ * @brief Represents a copy of an attachment into a pixel buffer, waiting for the GPU.
+ */
+struct PixelReadback
+{
+    uint32_t Buffer = 0;                                ///< Pixel buffer receiving the data.
+    size_t Size = 0;                                    ///< Size of the data (bytes).
+    size_t Capacity = 0;                                ///< Size of the pixel buffer (bytes).
+    GLsync Fence = nullptr;                             ///< Signaled once the copy is complete.
+    std::function<void(std::vector<char>)> Callback;    ///< Function receiving the data.
+};
+
+///< Readbacks in submission order.
+static std::deque<PixelReadback> g_Readbacks;
+///< Pixel buffers available for new readbacks (and their size).
+static std::vector<std::pair<uint32_t, size_t>> g_FreeBuffers;
+///< Maximum number of pixel buffers kept for new readbacks.
+static constexpr size_t g_MaxFreeBuffers = 4;
+
+/**
+ * @brief Check if the content of the attachments can be invalidated.
+ *
+ * @return `true` if `glInvalidateFramebuffer` is available (OpenGL 4.3 or ARB_invalidate_subdata).
+ */
+static bool IsInvalidateSupported()
+{
+    static const bool supported = GLEW_VERSION_4_3 || GLEW_ARB_invalidate_subdata;
+    return supported;
+}
+
+/**
+ * @brief Check if a color format stores unsigned integers (cleared with integer values).
+ *
+ * @param format The texture format.
+ *
+ * @return `true` if the format is an unsigned integer format.
+ */
+static bool IsUnsignedIntegerFormat(TextureFormat format)
+{
+    return format == TextureFormat::R8UI || format == TextureFormat::RG8UI ||
+           format == TextureFormat::RGB8UI || format == TextureFormat::RGBA8UI;
+}
+
+/**
+ * @brief Draw into the first color attachments of the bound framebuffer.
+ *
+ * @param count The number of color attachments.
+ */
+static void SetDrawBuffers(const uint32_t count)
+{
+    if (count == 0)
+    {
+        glDrawBuffer(GL_NONE);
+        return;
+    }
+    
+    PIXEL_CORE_ASSERT(count <= 4, "Using more than 4 color attachments in the Framebuffer!");
+    GLenum buffers[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
+    glDrawBuffers((int)count, buffers);
+}
+
 /**
  * @brief Generate a framebuffer.
  *
@@ -76,6 +139,126 @@ std::vector<char> OpenGLFrameBuffer::GetAttachmentData(const uint32_t index)
     //              buffer.data());
 }
 
+/**
+ * @brief Copies the pixel data of a color attachment into a pixel buffer, and retrieves it once
+ * the GPU has completed the copy (see `ProcessReadbacks()`).
+ *
+ * @param index The index of the color attachment to retrieve data from.
+ * @param callback Function receiving the pixel data.
+ */
+void OpenGLFrameBuffer::GetAttachmentDataAsync(const uint32_t index,
+                                               const std::function<void(std::vector<char>)>& callback)
+{
+    // Verify the index for the attachment
+    PIXEL_CORE_ASSERT(index < m_ColorAttachments.size(), "Attachment index out of bounds!");
+    
+    // Get the specifications from the attachment
+    TextureSpecification spec = m_ColorAttachments[index]->GetSpecification();
+    int stride = m_ColorAttachments[index]->GetStride();
+    uint32_t height = spec.Height > 0 ? spec.Height : 1;
+    
+    PixelReadback readback;
+    readback.Size = static_cast<size_t>(stride) * height;
+    readback.Callback = callback;
+    
+    // Reuse a pixel buffer large enough if available
+    auto it = std::find_if(g_FreeBuffers.begin(), g_FreeBuffers.end(),
+                           [&readback](const auto& buffer) { return buffer.second >= readback.Size; });
+    if (it != g_FreeBuffers.end())
+    {
+        readback.Buffer = it->first;
+        readback.Capacity = it->second;
+        g_FreeBuffers.erase(it);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.Buffer);
+    }
+    else
+    {
+        glGenBuffers(1, &readback.Buffer);
+        readback.Capacity = readback.Size;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.Buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, readback.Size, nullptr, GL_STREAM_READ);
+    }
+    
+    // Copy the attachment into the pixel buffer (on the GPU)
+    BindForReadAttachment(index);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, spec.Width, height,
+                 utils::textures::gl::ToOpenGLBaseFormat(spec.Format),
+                 utils::textures::gl::ToOpenGLDataFormat(spec.Format),
+                 nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    
+    // Signal the end of the copy
+    readback.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    
+    g_Readbacks.push_back(std::move(readback));
+}
+
+/**
+ * @brief Retrieves the pixel data of the readbacks completed by the GPU (in submission order).
+ *
+ * @param wait Wait for all the readbacks to be completed.
+ */
+void OpenGLFrameBuffer::ProcessReadbacks(bool wait)
+{
+    while (!g_Readbacks.empty())
+    {
+        auto& readback = g_Readbacks.front();
+        
+        // Check whether the copy is complete
+        GLenum status = glClientWaitSync(readback.Fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                         wait ? GL_TIMEOUT_IGNORED : 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+            return;
+        glDeleteSync(readback.Fence);
+        
+        // Retrieve the data
+        std::vector<char> data(readback.Size);
+        if (status != GL_WAIT_FAILED)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.Buffer);
+            void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.Size, GL_MAP_READ_BIT);
+            if (mapped)
+                memcpy(data.data(), mapped, readback.Size);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        
+        // Keep the pixel buffer for the next readbacks (or delete it if enough are kept)
+        if (g_FreeBuffers.size() < g_MaxFreeBuffers)
+            g_FreeBuffers.emplace_back(readback.Buffer, readback.Capacity);
+        else
+            glDeleteBuffers(1, &readback.Buffer);
+        
+        auto callback = std::move(readback.Callback);
+        g_Readbacks.pop_front();
+        callback(std::move(data));
+    }
+}
+
+/**
+ * @brief Completes the pending readbacks and deletes the pixel buffers kept for new ones.
+ */
+void OpenGLFrameBuffer::ReleaseReadbacks()
+{
+    ProcessReadbacks(true);
+    
+    for (auto& [buffer, capacity] : g_FreeBuffers)
+        glDeleteBuffers(1, &buffer);
+    g_FreeBuffers.clear();
+}
+
+/**
+ * @brief Get the number of readbacks not yet completed.
+ *
+ * @return The number of pending readbacks.
+ */
+uint32_t OpenGLFrameBuffer::GetPendingReadbacks()
+{
+    return static_cast<uint32_t>(g_Readbacks.size());
+}
+
 /**
  * @brief Bind the framebuffer.
  */
@@ -137,8 +320,8 @@ void OpenGLFrameBuffer::BindForDrawAttachmentCube(const uint32_t index,
  */
 void OpenGLFrameBuffer::Unbind(const bool& genMipMaps)
 {
-    // Generate mipmaps if necesary
-    if (m_Spec.MipMaps && genMipMaps)
+    // Generate mipmaps if necesary (the multisampled attachments have no mipmaps)
+    if (m_Spec.MipMaps && genMipMaps && m_Spec.Samples <= 1)
     {
         for (auto& attachment : m_ColorAttachments)
         {
@@ -170,6 +353,78 @@ void OpenGLFrameBuffer::ClearAttachment(const uint32_t index, const int value)
      
 }
 
+/**
+ * @brief Prepare the attachments of the framebuffer for a render pass (the framebuffer is bound).
+ *
+ * Each attachment to be cleared is cleared on its own, and the attachments whose content is not
+ * needed are invalidated so the driver does not load it.
+ *
+ * @param actions The actions of the render pass.
+ */
+void OpenGLFrameBuffer::ApplyLoadActions(const RenderPassActions& actions)
+{
+    std::vector<GLenum> invalidated;
+    
+    for (uint32_t i = 0; i < GetColorAttachmentCount(); i++)
+    {
+        const LoadAction load = actions.GetColorActions(i).Load;
+        if (load == LoadAction::DontCare)
+            invalidated.push_back(GL_COLOR_ATTACHMENT0 + i);
+        if (load != LoadAction::Clear)
+            continue;
+        
+        if (IsUnsignedIntegerFormat(m_ColorAttachmentsSpec[i].Format))
+        {
+            glm::uvec4 value = glm::uvec4(actions.ClearColor);
+            glClearBufferuiv(GL_COLOR, i, &value[0]);
+        }
+        else
+            glClearBufferfv(GL_COLOR, i, &actions.ClearColor[0]);
+    }
+    
+    if (HasDepthAttachment())
+    {
+        const TextureFormat format = m_DepthAttachmentSpec.Format;
+        if (actions.Depth.Load == LoadAction::DontCare)
+            invalidated.push_back(utils::textures::gl::ToOpenGLDepthAttachment(format));
+        else if (actions.Depth.Load == LoadAction::Clear && format == TextureFormat::DEPTH24STENCIL8)
+            glClearBufferfi(GL_DEPTH_STENCIL, 0, actions.ClearDepth, actions.ClearStencil);
+        else if (actions.Depth.Load == LoadAction::Clear)
+            glClearBufferfv(GL_DEPTH, 0, &actions.ClearDepth);
+    }
+    
+    if (!invalidated.empty() && IsInvalidateSupported())
+        glInvalidateFramebuffer(GL_FRAMEBUFFER, (GLsizei)invalidated.size(), invalidated.data());
+}
+
+/**
+ * @brief Invalidate the attachments whose content is not needed after the render pass (discarded
+ * or already resolved), so the driver does not write it back to memory.
+ *
+ * @param actions The actions of the render pass.
+ */
+void OpenGLFrameBuffer::ApplyStoreActions(const RenderPassActions& actions)
+{
+    if (!IsInvalidateSupported())
+        return;
+    
+    std::vector<GLenum> invalidated;
+    for (uint32_t i = 0; i < GetColorAttachmentCount(); i++)
+    {
+        if (actions.GetColorActions(i).Store != StoreAction::Store)
+            invalidated.push_back(GL_COLOR_ATTACHMENT0 + i);
+    }
+    if (HasDepthAttachment() && actions.Depth.Store != StoreAction::Store)
+        invalidated.push_back(utils::textures::gl::ToOpenGLDepthAttachment(m_DepthAttachmentSpec.Format));
+    
+    if (invalidated.empty())
+        return;
+    
+    // The framebuffer may have been unbound by the resolve
+    glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, (GLsizei)invalidated.size(), invalidated.data());
+}
+
 /**
  * @brief Blit the contents of a source framebuffer to a destination framebuffer, optionally specifying color attachments.
  *
@@ -211,6 +466,100 @@ void OpenGLFrameBuffer::Blit(const std::shared_ptr<OpenGLFrameBuffer>& src,
     glDrawBuffer(GL_BACK);
 }
 
+/**
+ * @brief Blit the contents of a framebuffer directly to the default framebuffer.
+ *
+ * @param src The source framebuffer from which to copy the contents.
+ * @param width The width of the screen area.
+ * @param height The height of the screen area.
+ * @param spec The blit-specific parameters such as filter type and source attachment index.
+ */
+void OpenGLFrameBuffer::BlitToScreen(const std::shared_ptr<OpenGLFrameBuffer>& src,
+                                     const uint32_t width, const uint32_t height,
+                                     const BlitSpecification& spec)
+{
+    PIXEL_CORE_ASSERT(src, "Trying to blit an undefined framebuffer");
+    PIXEL_CORE_ASSERT(spec.SrcAttachmentIndex < src->GetSpec().AttachmentsSpec.TexturesSpec.size(),
+                "Invalid source color attachment index!");
+    
+    // Bind the source framebuffer and set the read buffer to the specified color attachment
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, src->m_ID);
+    glReadBuffer(GL_COLOR_ATTACHMENT0 + spec.SrcAttachmentIndex);
+    // Write into the back buffer of the default framebuffer
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    
+    // Perform the blit operation (scaling the contents to the screen area)
+    glBlitFramebuffer(0, 0, src->m_Spec.Width, src->m_Spec.Height,
+                      0, 0, width, height,
+                      GL_COLOR_BUFFER_BIT, utils::textures::gl::ToOpenGLMagFilter(spec.Filter));
+    
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**
+ * @brief Resolve the multisampled attachments of a framebuffer into another one (same size).
+ *
+ * The framebuffers are bound once for all the attachments, and the depth is resolved by the same
+ * blit as the first color attachment.
+ *
+ * @param src The multisampled framebuffer.
+ * @param dst The framebuffer receiving the resolved attachments (same attachment indices).
+ * @param colors The indices of the color attachments to be resolved.
+ * @param depth Resolve the depth attachment too.
+ */
+void OpenGLFrameBuffer::Resolve(const std::shared_ptr<OpenGLFrameBuffer>& src,
+                                const std::shared_ptr<OpenGLFrameBuffer>& dst,
+                                const std::vector<uint32_t>& colors, const bool depth)
+{
+    PIXEL_CORE_ASSERT(src && dst, "Trying to resolve undefined framebuffer(s)");
+    // The blit does not scale the multisampled attachments, and only resolves into single samples
+    PIXEL_CORE_ASSERT(src->m_Spec.Width == dst->m_Spec.Width && src->m_Spec.Height == dst->m_Spec.Height,
+                      "Trying to resolve framebuffers of different sizes");
+    PIXEL_CORE_ASSERT(dst->m_Spec.Samples <= 1 || dst->m_Spec.Samples == src->m_Spec.Samples,
+                      "Trying to resolve into a framebuffer with a different sample count");
+    
+    const GLint width = (GLint)src->m_Spec.Width;
+    const GLint height = (GLint)std::max(src->m_Spec.Height, 1u);
+    
+    GLbitfield depthMask = 0;
+    if (depth)
+    {
+        depthMask = src->m_DepthAttachmentSpec.Format == TextureFormat::DEPTH24STENCIL8 ?
+            GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT : GL_DEPTH_BUFFER_BIT;
+    }
+    
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, src->m_ID);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dst->m_ID);
+    
+    if (colors.empty())
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, depthMask, GL_NEAREST);
+    
+    for (size_t i = 0; i < colors.size(); i++)
+    {
+        PIXEL_CORE_ASSERT(colors[i] < src->GetColorAttachmentCount() &&
+                          colors[i] < dst->GetColorAttachmentCount(), "Invalid color attachment index!");
+        glReadBuffer(GL_COLOR_ATTACHMENT0 + colors[i]);
+        glDrawBuffer(GL_COLOR_ATTACHMENT0 + colors[i]);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height,
+                          GL_COLOR_BUFFER_BIT | (i == 0 ? depthMask : 0), GL_NEAREST);
+    }
+    
+    // Restore the draw buffers of the destination
+    if (!colors.empty())
+        SetDrawBuffers(dst->GetColorAttachmentCount());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    
+    // Regenerate the mipmaps of the resolved attachments only (if used)
+    if (!dst->m_Spec.MipMaps)
+        return;
+    for (uint32_t index : colors)
+    {
+        auto& attachment = dst->m_ColorAttachments[index];
+        attachment->Bind();
+        glGenerateMipmap(utils::textures::gl::ToOpenGLTextureTarget(attachment->m_Spec.Type));
+    }
+}
+
 /**
  * @brief Define/re-define the framebuffer and its attachments.
  */
@@ -224,8 +573,10 @@ void OpenGLFrameBuffer::Invalidate()
     glGenFramebuffers(1, &m_ID);
     glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
     
-    // Define the framebuffer texture(s)
+    // Define the framebuffer texture(s), or render buffers
     DefineAttachments();
+    if (UsesRenderBuffers())
+        DefineRenderBuffers();
     
     // Attach defined textures to framebuffer
     for (uint32_t i = 0; i < m_ColorAttachments.size(); i++)
@@ -264,21 +615,49 @@ void OpenGLFrameBuffer::Invalidate()
                                utils::textures::gl::ToOpenGLTextureTarget(m_DepthAttachment->m_Spec.Type), attachment->m_ID, 0);
     }
     
-    // Draw the color attachments
-    if (m_ColorAttachments.size() > 1)
+    // Draw the color attachments (none for a depth-only pass)
+    if (GetColorAttachmentCount() != 1)
+        SetDrawBuffers(GetColorAttachmentCount());
+    
+    PIXEL_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**
+ * @brief Define multisampled render buffers for the attachments and attach them to the bound
+ * framebuffer (they cost no texture setup and can be kept in tile memory by the driver).
+ */
+void OpenGLFrameBuffer::DefineRenderBuffers()
+{
+    const GLsizei samples = (GLsizei)m_Spec.Samples;
+    const GLsizei width = (GLsizei)m_Spec.Width;
+    const GLsizei height = (GLsizei)std::max(m_Spec.Height, 1u);
+    
+    m_ColorRenderBuffers.resize(GetColorAttachmentCount());
+    if (!m_ColorRenderBuffers.empty())
+        glGenRenderbuffers((GLsizei)m_ColorRenderBuffers.size(), m_ColorRenderBuffers.data());
+    for (uint32_t i = 0; i < m_ColorRenderBuffers.size(); i++)
     {
-        PIXEL_CORE_ASSERT(m_ColorAttachments.size() <= 4, "Using more than 4 color attachments in the Framebuffer!");
-        GLenum buffers[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
-        glDrawBuffers((int)m_ColorAttachments.size(), buffers);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_ColorRenderBuffers[i]);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples,
+                                         utils::textures::gl::ToOpenGLInternalFormat(m_ColorAttachmentsSpec[i].Format),
+                                         width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_RENDERBUFFER, m_ColorRenderBuffers[i]);
     }
-    // Only depth-pass
-    else if (m_ColorAttachments.empty())
+    
+    if (HasDepthAttachment())
     {
-        glDrawBuffer(GL_NONE);
+        const TextureFormat format = m_DepthAttachmentSpec.Format;
+        glGenRenderbuffers(1, &m_DepthRenderBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_DepthRenderBuffer);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples,
+                                         utils::textures::gl::ToOpenGLInternalFormat(format),
+                                         width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, utils::textures::gl::ToOpenGLDepthAttachment(format),
+                                  GL_RENDERBUFFER, m_DepthRenderBuffer);
     }
     
-    PIXEL_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
 }
 
 /**
@@ -287,6 +666,14 @@ void OpenGLFrameBuffer::Invalidate()
 void OpenGLFrameBuffer::ReleaseFrameBuffer()
 {
     glDeleteFramebuffers(1, &m_ID);
+    
+    if (!m_ColorRenderBuffers.empty())
+        glDeleteRenderbuffers((GLsizei)m_ColorRenderBuffers.size(), m_ColorRenderBuffers.data());
+    if (m_DepthRenderBuffer)
+        glDeleteRenderbuffers(1, &m_DepthRenderBuffer);
+    m_ColorRenderBuffers.clear();
+    m_DepthRenderBuffer = 0;
+    
     FrameBuffer::ReleaseFrameBuffer();
 }
 
@@ -0,0 +1,119 @@
+#include "pixcpch.h"
+#include "Platform/OpenGL/Buffer/OpenGLStorageBuffer.h"
+
+#include <GL/glew.h>
+
+namespace pixc {
+
+/**
+ * @brief Generate a storage buffer with zero-initialized data.
+ *
+ * @param size The size (in bytes) of the buffer.
+ */
+OpenGLStorageBuffer::OpenGLStorageBuffer(const uint32_t size)
+    : StorageBuffer(size)
+{
+    std::vector<char> zeros(size, 0);
+    glGenBuffers(1, &m_ID);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)size, zeros.data(), GL_DYNAMIC_COPY);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+/**
+ * @brief Delete the storage buffer.
+ */
+OpenGLStorageBuffer::~OpenGLStorageBuffer()
+{
+    ReleaseFence();
+    glDeleteBuffers(1, &m_ID);
+}
+
+/**
+ * @brief Attach the buffer to a shader storage block binding point.
+ *
+ * @param binding The binding point.
+ */
+void OpenGLStorageBuffer::Bind(const uint32_t binding) const
+{
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_ID);
+}
+
+/**
+ * @brief Request the data written by the commands issued so far.
+ *
+ * A fence is inserted after these commands, a previous pending request is replaced.
+ */
+void OpenGLStorageBuffer::BeginReadback()
+{
+    ReleaseFence();
+    m_Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_ReadbackPending = true;
+}
+
+/**
+ * @brief Check if the requested data can be read without waiting for the GPU.
+ *
+ * @return `true` if the fence of the readback has been signaled.
+ */
+bool OpenGLStorageBuffer::IsReadbackReady()
+{
+    if (!m_Fence)
+        return false;
+    
+    // Poll the fence (no timeout), flushing the commands so the fence is eventually reached
+    GLenum status = glClientWaitSync(static_cast<GLsync>(m_Fence), GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+/**
+ * @brief Update the data of the buffer.
+ *
+ * @param data The new data.
+ * @param size The size (in bytes) of the data.
+ * @param offset The offset (in bytes) where the data is written.
+ */
+void OpenGLStorageBuffer::SetData(const void *data, const uint32_t size, const uint32_t offset)
+{
+    PIXEL_CORE_ASSERT(offset + size <= m_Size, "Data exceeds the size of the storage buffer!");
+    
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, (GLintptr)offset, (GLsizeiptr)size, data);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+/**
+ * @brief Copy the data of the buffer into the CPU memory.
+ *
+ * The copy waits for the GPU if the pending readback is not ready yet, check
+ * `IsReadbackReady()` first to avoid the stall.
+ *
+ * @param data The destination of the data.
+ * @param size The size (in bytes) of the data.
+ * @param offset The offset (in bytes) where the data is read.
+ */
+void OpenGLStorageBuffer::GetData(void *data, const uint32_t size, const uint32_t offset)
+{
+    PIXEL_CORE_ASSERT(offset + size <= m_Size, "Data exceeds the size of the storage buffer!");
+    
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, (GLintptr)offset, (GLsizeiptr)size, data);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    
+    ReleaseFence();
+    m_ReadbackPending = false;
+}
+
+/**
+ * @brief Delete the fence of the pending readback (if any).
+ */
+void OpenGLStorageBuffer::ReleaseFence()
+{
+    if (!m_Fence)
+        return;
+    
+    glDeleteSync(static_cast<GLsync>(m_Fence));
+    m_Fence = nullptr;
+}
+
+} // namespace pixc
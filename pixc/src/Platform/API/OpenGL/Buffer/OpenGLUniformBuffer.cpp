@@ -0,0 +1,59 @@
+#include "pixcpch.h"
+#include "Platform/OpenGL/Buffer/OpenGLUniformBuffer.h"
+
+#include <GL/glew.h>
+
+namespace pixc {
+
+/**
+ * @brief Generate a uniform buffer with uninitialized data.
+ *
+ * @param size The size (in bytes) of the buffer.
+ */
+OpenGLUniformBuffer::OpenGLUniformBuffer(const uint32_t size)
+    : UniformBuffer(size)
+{
+    glGenBuffers(1, &m_ID);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+    glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+/**
+ * @brief Delete the uniform buffer.
+ */
+OpenGLUniformBuffer::~OpenGLUniformBuffer()
+{
+    glDeleteBuffers(1, &m_ID);
+}
+
+/**
+ * @brief Attach a range of the buffer to a uniform block binding point.
+ *
+ * @param binding The binding point.
+ * @param offset The offset (in bytes) of the range.
+ * @param size The size (in bytes) of the range.
+ */
+void OpenGLUniformBuffer::BindRange(const uint32_t binding, const uint32_t offset,
+                                    const uint32_t size) const
+{
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, m_ID, (GLintptr)offset, (GLsizeiptr)size);
+}
+
+/**
+ * @brief Update the data of the buffer.
+ *
+ * @param data The new data.
+ * @param size The size (in bytes) of the data.
+ * @param offset The offset (in bytes) where the data is written.
+ */
+void OpenGLUniformBuffer::SetData(const void *data, const uint32_t size, const uint32_t offset)
+{
+    PIXEL_CORE_ASSERT(offset + size <= m_Size, "Data exceeds the size of the uniform buffer!");
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+    glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr)offset, (GLsizeiptr)size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+} // namespace pixc
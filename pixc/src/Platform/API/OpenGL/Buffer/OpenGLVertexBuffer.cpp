@@ -14,13 +14,26 @@ namespace pixc {
  */
 OpenGLVertexBuffer::OpenGLVertexBuffer(const void *vertices, const uint32_t size,
                                        const uint32_t count)
-: VertexBuffer(count)
+: VertexBuffer(size, count)
 {
     glGenBuffers(1, &m_ID);
     glBindBuffer(GL_ARRAY_BUFFER, m_ID);
     glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
 }
 
+/**
+ * @brief Generate an empty vertex buffer to be updated frequently.
+ *
+ * @param size Size of the buffer in bytes.
+ */
+OpenGLVertexBuffer::OpenGLVertexBuffer(const uint32_t size)
+: VertexBuffer(size, 0)
+{
+    glGenBuffers(1, &m_ID);
+    glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+}
+
 /**
  * @brief Delete the vertex buffer.
  */
@@ -45,4 +58,26 @@ void OpenGLVertexBuffer::Unbind() const
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+/**
+ * @brief Update the content of the vertex buffer.
+ *
+ * The previous storage is orphaned before uploading the new data, so the driver can hand out
+ * fresh memory instead of waiting for pending draw calls that still read from the buffer.
+ *
+ * @param vertices The new vertex data.
+ * @param size Size of the vertex data in bytes.
+ * @param count Number of vertices.
+ */
+void OpenGLVertexBuffer::SetData(const void *vertices, const uint32_t size,
+                                 const uint32_t count)
+{
+    PIXEL_CORE_ASSERT(size <= m_Size, "Vertex data exceeds the size of the buffer!");
+    
+    glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+    glBufferData(GL_ARRAY_BUFFER, m_Size, nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, vertices);
+    
+    m_Count = count;
+}
+
 } // namespace pixc
@@ -27,6 +27,8 @@ void OpenGLGuiBackend::Init()
     // Initialize
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init("#version 330");
+    // Create the device objects right away (the frames may be built on another thread)
+    ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
 /**
@@ -55,10 +57,12 @@ void OpenGLGuiBackend::BeginFrame()
 
 /**
  * @brief Renders the ImGui draw data using OpenGL.
+ *
+ * @param drawData The draw data of the frame.
  */
-void OpenGLGuiBackend::EndFrame()
+void OpenGLGuiBackend::EndFrame(ImDrawData* drawData)
 {
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    ImGui_ImplOpenGL3_RenderDrawData(drawData);
 }
 
 } // namespace pixc
@@ -40,6 +40,22 @@ void OpenGLContext::Init()
     PIXEL_CORE_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
 }
 
+/**
+ *  Makes the context current on the calling thread.
+ */
+void OpenGLContext::MakeCurrent()
+{
+    glfwMakeContextCurrent(m_WindowHandle);
+}
+
+/**
+ *  Releases the context from the calling thread (so it can be made current on another one).
+ */
+void OpenGLContext::ReleaseCurrent()
+{
+    glfwMakeContextCurrent(nullptr);
+}
+
 /**
  *  Sets the window hints required for a OpenGL context.
  *
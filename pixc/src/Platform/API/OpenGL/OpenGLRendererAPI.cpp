@@ -103,6 +103,66 @@ void OpenGLRendererAPI::SetCubeMapSeamless(const bool enabled)
         glDisable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 }
 
+/**
+ * @brief Enable or disable (straight) alpha blending.
+ *
+ * @param enabled Set to `true` to enable alpha blending, or `false` to disable it.
+ */
+void OpenGLRendererAPI::EnableBlending(const bool enabled)
+{
+    if (enabled)
+    {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+    else
+        glDisable(GL_BLEND);
+}
+
+/**
+ * @brief Enable or disable the writing into the color attachments.
+ *
+ * @param enabled Set to `true` to write the color of the fragments, or `false` to discard it.
+ */
+void OpenGLRendererAPI::EnableColorWriting(const bool enabled)
+{
+    glColorMask(enabled, enabled, enabled, enabled);
+}
+
+/**
+ * @brief Enable or disable the writing into the depth buffer.
+ *
+ * @param enabled Set to `true` to write the depth of the fragments, or `false` to keep the buffer.
+ */
+void OpenGLRendererAPI::EnableDepthWriting(const bool enabled)
+{
+    glDepthMask(enabled);
+}
+
+/**
+ * @brief Check if the reversed depth is supported (the clip control is needed to map the clip
+ * space depth to [0, 1], otherwise the precision of the floating-point depth is lost).
+ *
+ * @return `true` if the reversed depth can be used.
+ */
+bool OpenGLRendererAPI::IsReversedDepthSupported() const
+{
+    static const bool supported = GLEW_VERSION_4_5 || GLEW_ARB_clip_control;
+    return supported;
+}
+
+/**
+ * @brief Map the clip space depth to [0, 1] and clear the depth to the far plane (0) when the
+ * depth is reversed, or restore the OpenGL conventions.
+ *
+ * @param enabled Pass true to reverse the depth, false to restore the standard depth.
+ */
+void OpenGLRendererAPI::ApplyReversedDepth(const bool enabled)
+{
+    glClipControl(GL_LOWER_LEFT, enabled ? GL_ZERO_TO_ONE : GL_NEGATIVE_ONE_TO_ONE);
+    glClearDepth(enabled ? 0.0 : 1.0);
+}
+
 /**
  * @brief Initialize a new rendering pass.
  *
@@ -142,11 +202,95 @@ void OpenGLRendererAPI::Clear(const RenderTargetMask targets)
  */
 void OpenGLRendererAPI::Draw(const std::shared_ptr<Drawable>& drawable,
                              const PrimitiveType &primitive)
+{
+    DrawIndexed(drawable, drawable->GetIndexBuffer()->GetCount(), primitive);
+}
+
+/**
+ * @brief Render only the first indices of a drawable object.
+ *
+ * @param drawable The Vertex Array containing the vertex and index buffers for rendering.
+ * @param indexCount The number of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                                    const uint32_t indexCount,
+                                    const PrimitiveType &primitive)
 {
     drawable->Bind();
     glDrawElements(utils::graphics::gl::ToOpenGLPrimitive(primitive),
-                   drawable->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+                   indexCount, GL_UNSIGNED_INT, nullptr);
+    drawable->Unbind();
+}
+
+/**
+ * @brief Render several ranges of indices of a drawable object with a single command.
+ *
+ * @param drawable The Vertex Array containing the vertex and index buffers for rendering.
+ * @param ranges The ranges of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void OpenGLRendererAPI::DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                                   const std::vector<IndexRange>& ranges,
+                                   const PrimitiveType &primitive)
+{
+    m_RangeCounts.clear();
+    m_RangeOffsets.clear();
+    for (const auto& range : ranges)
+    {
+        m_RangeCounts.push_back(static_cast<int32_t>(range.Count));
+        m_RangeOffsets.push_back(reinterpret_cast<const void*>((size_t)range.Offset * sizeof(uint32_t)));
+    }
+    
+    drawable->Bind();
+    glMultiDrawElements(utils::graphics::gl::ToOpenGLPrimitive(primitive), m_RangeCounts.data(),
+                        GL_UNSIGNED_INT, m_RangeOffsets.data(), static_cast<GLsizei>(ranges.size()));
     drawable->Unbind();
 }
 
+/**
+ * @brief Render a single triangle covering the screen, without vertex data.
+ *
+ * The vertices are generated by the vertex shader from their index (`gl_VertexID`).
+ */
+void OpenGLRendererAPI::DrawFullscreen()
+{
+    if (!m_EmptyVertexArray)
+        glGenVertexArrays(1, &m_EmptyVertexArray);
+    
+    glBindVertexArray(m_EmptyVertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+}
+
+/**
+ * @brief Check if the compute passes are supported.
+ *
+ * The context is requested as 3.3 core, the compute shaders and storage buffers are only
+ * available when the driver provides OpenGL 4.3 (or the equivalent extensions).
+ *
+ * @return `true` if compute shaders and storage buffers can be used.
+ */
+bool OpenGLRendererAPI::IsComputeSupported() const
+{
+    static const bool supported = GLEW_VERSION_4_3 ||
+        (GLEW_ARB_compute_shader && GLEW_ARB_shader_storage_buffer_object);
+    return supported;
+}
+
+/**
+ * @brief Run the compute shader currently bound.
+ *
+ * The writes of the pass are made visible to the following passes and to the buffer readbacks.
+ *
+ * @param x The number of work groups in the x dimension.
+ * @param y The number of work groups in the y dimension.
+ * @param z The number of work groups in the z dimension.
+ */
+void OpenGLRendererAPI::DispatchCompute(const uint32_t x, const uint32_t y, const uint32_t z)
+{
+    glDispatchCompute(x, y, z);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
 } // namespace pixc
@@ -0,0 +1,54 @@
+#include "pixcpch.h"
+#include "Platform/OpenGL/Query/OpenGLFence.h"
+
+#include <GL/glew.h>
+
+namespace pixc {
+
+/**
+ * @brief Insert a fence after the commands issued so far.
+ */
+OpenGLFence::OpenGLFence()
+{
+    m_Sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+/**
+ * @brief Delete the fence.
+ */
+OpenGLFence::~OpenGLFence()
+{
+    if (m_Sync)
+        glDeleteSync(static_cast<GLsync>(m_Sync));
+}
+
+/**
+ * @brief Check if the fence has been signaled (never waits).
+ *
+ * The commands are flushed, so the fence is eventually reached.
+ *
+ * @return `true` if the commands issued before the fence are complete.
+ */
+bool OpenGLFence::IsSignaled() const
+{
+    return Wait(0);
+}
+
+/**
+ * @brief Wait until the fence is signaled.
+ *
+ * @param timeout Maximum time to wait (in nanoseconds).
+ *
+ * @return `true` if the fence has been signaled.
+ */
+bool OpenGLFence::Wait(uint64_t timeout) const
+{
+    if (!m_Sync)
+        return true;
+    
+    GLenum status = glClientWaitSync(static_cast<GLsync>(m_Sync), GL_SYNC_FLUSH_COMMANDS_BIT,
+                                     static_cast<GLuint64>(timeout));
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+} // namespace pixc
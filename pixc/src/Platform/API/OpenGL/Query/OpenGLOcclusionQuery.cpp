@@ -0,0 +1,85 @@
+#include "pixcpch.h"
+#include "Platform/OpenGL/Query/OpenGLOcclusionQuery.h"
+
+#include <GL/glew.h>
+
+namespace pixc {
+
+/**
+ * @brief Generate an occlusion query.
+ */
+OpenGLOcclusionQuery::OpenGLOcclusionQuery()
+{
+    glGenQueries(1, &m_ID);
+}
+
+/**
+ * @brief Delete the occlusion query.
+ */
+OpenGLOcclusionQuery::~OpenGLOcclusionQuery()
+{
+    glDeleteQueries(1, &m_ID);
+}
+
+/**
+ * @brief Start the query.
+ */
+void OpenGLOcclusionQuery::Begin()
+{
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, m_ID);
+}
+
+/**
+ * @brief End the query.
+ */
+void OpenGLOcclusionQuery::End()
+{
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+    m_Pending = true;
+}
+
+/**
+ * @brief Discard the following draw calls if no sample of the query passed.
+ *
+ * @param wait Let the GPU wait for the result of the query (`GL_QUERY_WAIT`); the draw calls are
+ *             executed if the result is not available otherwise (`GL_QUERY_NO_WAIT`).
+ */
+void OpenGLOcclusionQuery::BeginConditionalRender(bool wait) const
+{
+    glBeginConditionalRender(m_ID, wait ? GL_QUERY_WAIT : GL_QUERY_NO_WAIT);
+}
+
+/**
+ * @brief End the conditional rendering.
+ */
+void OpenGLOcclusionQuery::EndConditionalRender() const
+{
+    glEndConditionalRender();
+}
+
+/**
+ * @brief Check if the result of the query can be read without stalling.
+ *
+ * @return `true` if the result is available.
+ */
+bool OpenGLOcclusionQuery::IsResultAvailable() const
+{
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(m_ID, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available == GL_TRUE;
+}
+
+/**
+ * @brief Read the result of the query (waits for it if it is not available yet).
+ *
+ * @return `true` if any sample passed the depth test.
+ */
+bool OpenGLOcclusionQuery::GetResult() const
+{
+    GLuint result = GL_FALSE;
+    glGetQueryObjectuiv(m_ID, GL_QUERY_RESULT, &result);
+    m_Pending = false;
+    return result != GL_FALSE;
+}
+
+} // namespace pixc
@@ -1,7 +1,10 @@
 #include "pixcpch.h"
 #include "Platform/OpenGL/Shader/OpenGLShader.h"
 
+#include "Foundation/Renderer/Buffer/UniformBuffer.h"
+
 #include "Platform/OpenGL/OpenGLRendererUtils.h"
+#include "Platform/OpenGL/Texture/OpenGLSampler.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -20,8 +23,11 @@ OpenGLShader::OpenGLShader(const std::string& name, const std::filesystem::path&
     // Parse the shader and divide it in the different program sources
     OpenGLShaderSource source = ParseShader(filePath);
     // Create the shader program
-    m_ID = CreateShader(source.VertexSource, source.FragmentSource,
-                        source.GeometrySource);
+    if (!source.ComputeSource.empty())
+        m_ID = CreateComputeShader(source.ComputeSource);
+    else
+        m_ID = CreateShader(source.VertexSource, source.FragmentSource,
+                            source.GeometrySource);
     // Define the shader attributes and uniforms
     ExtractShaderResources();
 }
@@ -175,18 +181,49 @@ void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
  * @param texture The texture map.
  * @param name Uniform name.
  * @param slot The texture slot.
+ * @param sampler The sampler used to read the texture (the sampling state of the texture
+ *                is used if not defined).
  */
 void OpenGLShader::SetTexture(const std::string &name,
                               const std::shared_ptr<Texture>& texture,
-                              int slot)
+                              int slot,
+                              const std::shared_ptr<Sampler>& sampler)
 {
     if(!texture)
         return;
 
     texture->BindToTextureUnit(slot);
+    if (sampler)
+        sampler->BindToTextureUnit(slot);
+    else
+        OpenGLSampler::UnbindTextureUnit(slot);
     SetInt(name, slot);
 }
 
+/**
+ * @brief Attach a uniform block of the shader to a binding point.
+ *
+ * @param name The name of the uniform block.
+ * @param binding The binding point.
+ *
+ * @return `true` if the shader defines the uniform block.
+ */
+bool OpenGLShader::SetUniformBlock(const std::string& name, uint32_t binding)
+{
+    auto it = m_UniformBlocks.find(name);
+    if (it == m_UniformBlocks.end())
+        return false;
+    
+    // The binding is part of the program state, only update it when it changes
+    auto& [index, current] = it->second;
+    if (current != static_cast<int32_t>(binding))
+    {
+        glUniformBlockBinding(m_ID, index, binding);
+        current = static_cast<int32_t>(binding);
+    }
+    return true;
+}
+
 /**
  * @brief Compile the shader from its input file source.
  *
@@ -222,6 +259,9 @@ uint32_t OpenGLShader::CompileShader(uint32_t type, const std::string& source)
         case GL_GEOMETRY_SHADER:
             shaderType = "geometry";
             break;
+        case GL_COMPUTE_SHADER:
+            shaderType = "compute";
+            break;
         default:
             shaderType = "unknown";
             break;
@@ -279,12 +319,43 @@ uint32_t OpenGLShader::CreateShader(const std::string& vertexShader,
     return program;
 }
 
+/**
+ * @brief Generate a compute shader program.
+ *
+ * @param computeShader Source of the compute shader.
+ *
+ * @return ID of the shader program.
+ *
+ * @note Compute shaders require OpenGL 4.3, check `RendererCommand::IsComputeSupported()`
+ *       before loading them.
+ */
+uint32_t OpenGLShader::CreateComputeShader(const std::string& computeShader)
+{
+    // Define a shader program
+    uint32_t program = glCreateProgram();
+    
+    // Compute shader
+    uint32_t cs = CompileShader(GL_COMPUTE_SHADER, computeShader);
+    glAttachShader(program, cs);
+    
+    // Link the program
+    glLinkProgram(program);
+    glValidateProgram(program);
+    
+    // De-allocate the shader resources
+    glDeleteShader(cs);
+    
+    // Return the shader program
+    return program;
+}
+
 /**
  * @brief Extracts and stores information about active attributes and uniforms from the shader program.
  *
  * @pre  The shader program should be successfully linked (`m_ID` should be valid).
  * @post  `m_Attributes` will contain information about the active attributes.
  * @post  `m_Uniforms` will contain information about the active uniforms.
+ * @post  `m_UniformBlocks` will contain the active uniform blocks.
  */
 void OpenGLShader::ExtractShaderResources()
 {
@@ -299,24 +370,61 @@ void OpenGLShader::ExtractShaderResources()
     for (GLint i = 0; i < count; ++i)
     {
         glGetActiveAttrib(m_ID, i, sizeof(name), nullptr, nullptr, &type, name);
+        // Built-in inputs (e.g., gl_VertexID) are not read from the vertex buffers
+        if (std::string(name).rfind("gl_", 0) == 0)
+            continue;
         
         DataElement element(utils::graphics::gl::ToDataType(type));
         m_Attributes.Add(name, element);
     }
 
     // Retrieve uniforms
+    GLint size;
     glGetProgramiv(m_ID, GL_ACTIVE_UNIFORMS, &count);
     for (GLint i = 0; i < count; ++i)
     {
-        glGetActiveUniform(m_ID, i, sizeof(name), nullptr, nullptr, &type, name);
-
-        auto [group, member] = utils::SplitString(name);
-        GLint location = glGetUniformLocation(m_ID, name);
-
-        UniformElement element(utils::graphics::gl::ToDataType(type));
-        element.Location = static_cast<int32_t>(location);
-        m_Uniforms.Add(group, member, element);
+        glGetActiveUniform(m_ID, i, sizeof(name), nullptr, &size, &type, name);
+        
+        // Members of uniform blocks are updated through their buffer
+        GLuint index = static_cast<GLuint>(i);
+        GLint blockIndex;
+        glGetActiveUniformsiv(m_ID, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+        if (blockIndex != -1)
+            continue;
+        
+        // Arrays of basic types are reported once (as "name[0]"), register each element
+        std::string uniformName = name;
+        const std::string arraySuffix = "[0]";
+        bool isArray = size > 1 && uniformName.size() > arraySuffix.size() &&
+            uniformName.compare(uniformName.size() - arraySuffix.size(),
+                                arraySuffix.size(), arraySuffix) == 0;
+        std::string baseName = isArray ?
+            uniformName.substr(0, uniformName.size() - arraySuffix.size()) : uniformName;
+        
+        for (GLint j = 0; j < (isArray ? size : 1); ++j)
+        {
+            std::string elementName = isArray ?
+                baseName + "[" + std::to_string(j) + "]" : uniformName;
+            
+            auto [group, member] = utils::SplitString(elementName);
+            GLint location = glGetUniformLocation(m_ID, elementName.c_str());
+            
+            UniformElement element(utils::graphics::gl::ToDataType(type));
+            element.Location = static_cast<int32_t>(location);
+            m_Uniforms.Add(group, member, element);
+        }
     }
+    
+    // Retrieve uniform blocks
+    glGetProgramiv(m_ID, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+    for (GLint i = 0; i < count; ++i)
+    {
+        glGetActiveUniformBlockName(m_ID, i, sizeof(name), nullptr, name);
+        m_UniformBlocks[name] = { static_cast<uint32_t>(i), -1 };
+    }
+    
+    // The bone matrices always use the same binding point, attached once for the program
+    SetUniformBlock("BoneBlock", static_cast<uint32_t>(UniformBinding::Bones));
 }
 
 /**
@@ -333,7 +441,7 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
     
     // Parse the file
     std::string line;
-    std::stringstream ss[3];
+    std::stringstream ss[4];
     ShaderType type = ShaderType::NONE;
     while (getline(stream, line))
     {
@@ -345,9 +453,12 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
             // Set mode to fragment
             else if (line.find("fragment") != std::string::npos)
                 type = ShaderType::FRAGMENT;
-            // Set mode to fragment
+            // Set mode to geometry
             else if (line.find("geometry") != std::string::npos)
                 type = ShaderType::GEOMETRY;
+            // Set mode to compute
+            else if (line.find("compute") != std::string::npos)
+                type = ShaderType::COMPUTE;
         }
         else
         {
@@ -359,13 +470,16 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
                 std::string includedSource = ReadFile(includePath);
                 ss[(int)type] << includedSource;
             }
+            // Definitions of the shader variant
+            else if (line.find("#version") != std::string::npos)
+                ss[(int)type] << line << '\n' << GetDefinitions();
             else
                 ss[(int)type] << line << '\n';
         }
     }
     
     // Return the shader sources
-    return OpenGLShaderSource(ss[0].str(), ss[1].str(), ss[2].str());
+    return OpenGLShaderSource(ss[0].str(), ss[1].str(), ss[2].str(), ss[3].str());
 }
 
 } // namespace pixc
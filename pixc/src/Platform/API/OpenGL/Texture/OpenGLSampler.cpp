@@ -0,0 +1,115 @@
+#include "pixcpch.h"
+#include "Platform/OpenGL/Texture/OpenGLSampler.h"
+
+#include "Foundation/Renderer/RendererAPI.h"
+
+#include "Platform/OpenGL/OpenGLRendererUtils.h"
+#include "Platform/OpenGL/Texture/OpenGLTextureUtils.h"
+
+#include <GL/glew.h>
+
+namespace pixc {
+
+///< Samplers bound to each texture unit.
+static std::array<uint32_t, 32> g_BoundSamplers = {};
+
+/**
+ * @brief Bind a sampler to a texture unit (if it is not already bound).
+ *
+ * @param slot The texture unit slot.
+ * @param id The sampler ID (0 to use the sampling state of the texture).
+ */
+static void BindSampler(uint32_t slot, uint32_t id)
+{
+    if (slot < g_BoundSamplers.size())
+    {
+        if (g_BoundSamplers[slot] == id)
+            return;
+        g_BoundSamplers[slot] = id;
+    }
+    glBindSampler(slot, id);
+}
+
+/**
+ * @brief Create a sampler object with a specific sampling state.
+ *
+ * @param spec The sampler specifications.
+ */
+OpenGLSampler::OpenGLSampler(const SamplerSpecification& spec)
+    : Sampler(spec)
+{
+    glGenSamplers(1, &m_ID);
+    
+    // Set the wrapping parameters
+    GLenum wrap = utils::textures::gl::ToOpenGLWrap(m_Spec.Wrap);
+    if (wrap)
+    {
+        glSamplerParameteri(m_ID, GL_TEXTURE_WRAP_S, wrap);
+        glSamplerParameteri(m_ID, GL_TEXTURE_WRAP_T, wrap);
+        glSamplerParameteri(m_ID, GL_TEXTURE_WRAP_R, wrap);
+    }
+    glSamplerParameterfv(m_ID, GL_TEXTURE_BORDER_COLOR, &m_Spec.BorderColor[0]);
+    
+    // Set the filtering parameters
+    GLenum minFilter = utils::textures::gl::ToOpenGLMinFilter(m_Spec.Filter, m_Spec.MipMaps);
+    GLenum magFilter = utils::textures::gl::ToOpenGLMagFilter(m_Spec.Filter.Mag);
+    if (minFilter)
+        glSamplerParameteri(m_ID, GL_TEXTURE_MIN_FILTER, minFilter);
+    if (magFilter)
+        glSamplerParameteri(m_ID, GL_TEXTURE_MAG_FILTER, magFilter);
+    
+    // Set the depth comparison (shadow samplers, the closest depth is the largest one if reversed)
+    if (m_Spec.CompareDepth)
+    {
+        DepthFunction compare = RendererAPI::IsDepthReversed() ? DepthFunction::GEqual : DepthFunction::LEqual;
+        glSamplerParameteri(m_ID, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glSamplerParameteri(m_ID, GL_TEXTURE_COMPARE_FUNC, utils::graphics::gl::ToOpenGLDepthFunc(compare));
+    }
+}
+
+/**
+ * @brief Delete the sampler object.
+ */
+OpenGLSampler::~OpenGLSampler()
+{
+    Release();
+}
+
+/**
+ * @brief Delete the sampler object (the sampling state of the textures is used from then on).
+ */
+void OpenGLSampler::Release()
+{
+    if (!m_ID)
+        return;
+    
+    for (uint32_t slot = 0; slot < g_BoundSamplers.size(); slot++)
+    {
+        if (g_BoundSamplers[slot] == m_ID)
+            g_BoundSamplers[slot] = 0;
+    }
+    glDeleteSamplers(1, &m_ID);
+    m_ID = 0;
+}
+
+/**
+ * @brief Bind the sampler to a specific texture unit.
+ *
+ * @param slot The texture unit slot.
+ */
+void OpenGLSampler::BindToTextureUnit(uint32_t slot) const
+{
+    BindSampler(slot, m_ID);
+}
+
+/**
+ * @brief Remove the sampler bound to a texture unit (the sampling state of the texture is used).
+ *
+ * @param slot The texture unit slot.
+ */
+void OpenGLSampler::UnbindTextureUnit(uint32_t slot)
+{
+    BindSampler(slot, 0);
+}
+
+} // namespace pixc
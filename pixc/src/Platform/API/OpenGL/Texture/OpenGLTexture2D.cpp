@@ -3,6 +3,8 @@
 
 #include "Platform/OpenGL/Texture/OpenGLTextureUtils.h"
 
+#include "Foundation/Renderer/RendererAPI.h"
+
 #include <GL/glew.h>
 
 namespace pixc {
@@ -127,7 +129,9 @@ void OpenGLTexture2D::CreateTexture(const void *data)
         glTexStorage2D(GL_TEXTURE_2D, 1, utils::textures::gl::ToOpenGLBaseFormat(m_Spec.Format),
                        m_Spec.Width, m_Spec.Height);
         
-        float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        // The depth outside the texture is the far plane
+        float depth = RendererAPI::GetFarDepth();
+        float borderColor[] = { depth, depth, depth, depth };
         glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
     }
     else
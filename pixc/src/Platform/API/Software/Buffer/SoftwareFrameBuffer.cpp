@@ -0,0 +1,224 @@
+#include "pixcpch.h"
+#include "Platform/Software/Buffer/SoftwareFrameBuffer.h"
+
+#include "Foundation/Renderer/RendererAPI.h"
+
+namespace pixc {
+
+///< Framebuffer standing for the screen (the images are not presented).
+static std::shared_ptr<SoftwareFrameBuffer> g_Screen;
+
+/**
+ * @brief Get the software texture of an attachment.
+ *
+ * @param attachment The attachment.
+ *
+ * @return The software texture, or null if the attachment is not defined.
+ */
+static SoftwareTexture* AsSoftwareTexture(const std::shared_ptr<Texture>& attachment)
+{
+    return dynamic_cast<SoftwareTexture*>(attachment.get());
+}
+
+/**
+ * @brief Generate a framebuffer.
+ *
+ * @param spec Framebuffer specifications.
+ */
+SoftwareFrameBuffer::SoftwareFrameBuffer(const FrameBufferSpecification& spec)
+: FrameBuffer(spec)
+{
+    Invalidate();
+}
+
+/**
+ * @brief Delete the framebuffer.
+ */
+SoftwareFrameBuffer::~SoftwareFrameBuffer()
+{
+    ReleaseFrameBuffer();
+}
+
+/**
+ * @brief Retrieves pixel data from a color attachment of the framebuffer.
+ *
+ * @param index The index of the color attachment to retrieve data from.
+ *
+ * @return A vector containing the pixel data of the color attachment, with each channel.
+ */
+std::vector<char> SoftwareFrameBuffer::GetAttachmentData(const uint32_t index)
+{
+    PIXEL_CORE_ASSERT(index < m_ColorAttachments.size(), "Attachment index out of bounds!");
+    
+    // The face selected for drawing is read from the cube attachments
+    const uint32_t layer = m_DrawTargetOverride.IsCubeFaceDefined() ? m_DrawTargetOverride.CubeFace : 0;
+    return AsSoftwareTexture(m_ColorAttachments[index])->Read(layer);
+}
+
+/**
+ * @brief Get the textures written by the draw calls (the attachment or cube face selected for
+ * drawing, or all the color attachments).
+ *
+ * @return The render target.
+ */
+SoftwareRenderTarget SoftwareFrameBuffer::GetRenderTarget() const
+{
+    SoftwareRenderTarget target;
+    target.Width = m_Spec.Width;
+    target.Height = std::max(m_Spec.Height, 1u);
+    target.Depth = AsSoftwareTexture(m_DepthAttachment);
+    
+    const uint32_t layer = m_DrawTargetOverride.IsCubeFaceDefined() ? m_DrawTargetOverride.CubeFace : 0;
+    for (uint32_t i = 0; i < m_ColorAttachments.size(); i++)
+    {
+        if (m_DrawTargetOverride.IsAttachmentDefined() && m_DrawTargetOverride.AttachmentIndex != i)
+            continue;
+        if (auto *texture = AsSoftwareTexture(m_ColorAttachments[i]))
+            target.Colors.emplace_back(texture, layer);
+    }
+    return target;
+}
+
+/**
+ * @brief Get the framebuffer standing for the screen.
+ *
+ * @return The screen framebuffer.
+ */
+std::shared_ptr<SoftwareFrameBuffer> SoftwareFrameBuffer::GetScreen()
+{
+    if (!g_Screen)
+        ResizeScreen(1, 1);
+    return g_Screen;
+}
+
+/**
+ * @brief Define the framebuffer standing for the screen (re-defined when its size changes).
+ *
+ * @param width The width of the screen.
+ * @param height The height of the screen.
+ */
+void SoftwareFrameBuffer::ResizeScreen(const uint32_t width, const uint32_t height)
+{
+    if (g_Screen && g_Screen->m_Spec.Width == width && g_Screen->m_Spec.Height == height)
+        return;
+    
+    FrameBufferSpecification spec;
+    spec.SetFrameBufferSize(std::max(width, 1u), std::max(height, 1u));
+    spec.AttachmentsSpec = {
+        { TextureType::TEXTURE2D, TextureFormat::RGBA8 },
+        { TextureType::TEXTURE2D, RendererAPI::GetDepthFormat(TextureFormat::DEPTH24) }
+    };
+    g_Screen = std::make_shared<SoftwareFrameBuffer>(spec);
+}
+
+/**
+ * @brief Clear a specific attachment belonging to this framebuffer (set a default value on it).
+ *
+ * @param index Attachment index to be cleared.
+ * @param value Clear (reset) value.
+ */
+void SoftwareFrameBuffer::ClearAttachment(const uint32_t index, const int value)
+{
+    PIXEL_CORE_ASSERT(index < m_ColorAttachments.size(), "Attachment index out of bounds!");
+    
+    auto *attachment = AsSoftwareTexture(m_ColorAttachments[index]);
+    for (uint32_t layer = 0; layer < attachment->GetLayerCount(); layer++)
+        attachment->Fill(glm::vec4(static_cast<float>(value)), layer);
+}
+
+/**
+ * @brief Prepare the attachments of the framebuffer for a render pass.
+ *
+ * Each attachment to be cleared is cleared on its own (in the layer selected for drawing); the
+ * other attachments keep their content.
+ *
+ * @param actions The actions of the render pass.
+ */
+void SoftwareFrameBuffer::ApplyLoadActions(const RenderPassActions& actions)
+{
+    const SoftwareRenderTarget target = GetRenderTarget();
+    for (uint32_t i = 0; i < m_ColorAttachments.size(); i++)
+    {
+        if (actions.GetColorActions(i).Load != LoadAction::Clear)
+            continue;
+        
+        auto *attachment = AsSoftwareTexture(m_ColorAttachments[i]);
+        for (const auto& [texture, layer] : target.Colors)
+        {
+            if (texture == attachment)
+                attachment->Fill(actions.ClearColor, layer);
+        }
+    }
+    
+    if (target.Depth && actions.Depth.Load == LoadAction::Clear)
+        target.Depth->Fill(glm::vec4(actions.ClearDepth));
+}
+
+/**
+ * @brief Blit the contents of a source framebuffer to a destination framebuffer.
+ *
+ * The contents are scaled if the framebuffers have different sizes.
+ *
+ * @param src The source framebuffer from which to copy the contents.
+ * @param dst The destination framebuffer to which the contents are copied.
+ * @param spec The blit-specific parameters such as filter type, target buffers, and attachment indices.
+ */
+void SoftwareFrameBuffer::Blit(const std::shared_ptr<SoftwareFrameBuffer>& src,
+                               const std::shared_ptr<SoftwareFrameBuffer>& dst,
+                               const BlitSpecification& spec)
+{
+    // Ensure that source and destination framebuffers are defined
+    PIXEL_CORE_ASSERT(src && dst, "Trying to blit undefined framebuffer(s)");
+    
+    if (utils::graphics::IsBufferActive(spec.Targets, RenderTargetMask::Color))
+    {
+        PIXEL_CORE_ASSERT(spec.SrcAttachmentIndex < src->m_ColorAttachments.size(),
+                    "Invalid source color attachment index!");
+        PIXEL_CORE_ASSERT(spec.DstAttachmentIndex < dst->m_ColorAttachments.size(),
+                    "Invalid destination color attachment index!");
+        
+        AsSoftwareTexture(dst->m_ColorAttachments[spec.DstAttachmentIndex])->Copy(
+            *AsSoftwareTexture(src->m_ColorAttachments[spec.SrcAttachmentIndex]));
+    }
+    
+    if (utils::graphics::IsBufferActive(spec.Targets, RenderTargetMask::Depth) &&
+        src->m_DepthAttachment && dst->m_DepthAttachment)
+    {
+        AsSoftwareTexture(dst->m_DepthAttachment)->Copy(*AsSoftwareTexture(src->m_DepthAttachment));
+    }
+}
+
+/**
+ * @brief Blit the contents of a framebuffer to the screen framebuffer.
+ *
+ * @param src The source framebuffer from which to copy the contents.
+ * @param width The width of the screen area.
+ * @param height The height of the screen area.
+ * @param spec The blit-specific parameters such as filter type and source attachment index.
+ */
+void SoftwareFrameBuffer::BlitToScreen(const std::shared_ptr<SoftwareFrameBuffer>& src,
+                                       const uint32_t width, const uint32_t height,
+                                       const BlitSpecification& spec)
+{
+    BlitSpecification screenSpec = spec;
+    screenSpec.SetTargets(RenderTargetMask::Color);
+    screenSpec.SetAttachmentIndices(spec.SrcAttachmentIndex, 0);
+    
+    ResizeScreen(width, height);
+    Blit(src, GetScreen(), screenSpec);
+}
+
+/**
+ * @brief Define/re-define the framebuffer and its attachments.
+ */
+void SoftwareFrameBuffer::Invalidate()
+{
+    // Release the previous attachments, if any
+    if (!m_ColorAttachments.empty() || m_DepthAttachment)
+        ReleaseFrameBuffer();
+    
+    // Define the framebuffer texture(s)
+    DefineAttachments();
+}
+
+} // namespace pixc
@@ -0,0 +1,46 @@
+#include "pixcpch.h"
+#include "Platform/Software/Buffer/SoftwareVertexBuffer.h"
+
+namespace pixc {
+
+/**
+ * @brief Generate a vertex buffer and copy the input vertices into it.
+ *
+ * @param vertices Vertex data.
+ * @param size Size of the vertex data in bytes.
+ * @param count Number of vertices.
+ */
+SoftwareVertexBuffer::SoftwareVertexBuffer(const void *vertices, const uint32_t size,
+                                           const uint32_t count)
+    : VertexBuffer(size, count), m_Data(size)
+{
+    if (vertices)
+        std::memcpy(m_Data.data(), vertices, size);
+}
+
+/**
+ * @brief Generate a dynamic vertex buffer (without data).
+ *
+ * @param size Size of the vertex buffer in bytes.
+ */
+SoftwareVertexBuffer::SoftwareVertexBuffer(const uint32_t size)
+    : VertexBuffer(size, 0), m_Data(size)
+{}
+
+/**
+ * @brief Update the content of the vertex buffer.
+ *
+ * @param vertices The new vertex data.
+ * @param size Size of the vertex data in bytes.
+ * @param count Number of vertices.
+ */
+void SoftwareVertexBuffer::SetData(const void *vertices, const uint32_t size,
+                                   const uint32_t count)
+{
+    PIXEL_CORE_ASSERT(size <= m_Size, "Vertex data exceeds the size of the buffer!");
+    
+    std::memcpy(m_Data.data(), vertices, size);
+    m_Count = count;
+}
+
+} // namespace pixc
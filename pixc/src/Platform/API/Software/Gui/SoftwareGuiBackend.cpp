@@ -0,0 +1,33 @@
+#include "pixcpch.h"
+#include "Platform/Software/Gui/SoftwareGuiBackend.h"
+
+#include <GLFW/glfw3.h>
+
+#include <imgui.h>
+#include <backends/imgui_impl_glfw.h>
+
+#include "Foundation/Core/Application.h"
+
+namespace pixc {
+
+/**
+ * @brief Initializes the ImGui software backend.
+ */
+void SoftwareGuiBackend::Init()
+{
+    // Define the current window
+    Application &app = Application::Get();
+    GLFWwindow *window = static_cast<GLFWwindow *>(app.GetWindow().GetNativeWindow());
+    
+    // Initialize (the font atlas must be built before the first frame)
+    ImGui_ImplGlfw_InitForOther(window, true);
+    
+    ImGuiIO &io = ImGui::GetIO();
+    io.BackendRendererName = "pixc_software";
+    
+    unsigned char *pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+}
+
+} // namespace pixc
@@ -0,0 +1,570 @@
+#include "pixcpch.h"
+#include "Platform/Software/Shader/SoftwareShader.h"
+
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+#include <unordered_set>
+
+namespace pixc {
+
+/**
+ * @brief Represents a member of a GLSL structure (or a variable).
+ */
+struct GLSLDeclaration
+{
+    std::string Type;           ///< Type of the member (basic type or structure name).
+    std::string Name;           ///< Name of the member.
+    uint32_t ArraySize = 0;     ///< Number of elements (0 if the member is not an array).
+};
+
+///< Shading kernel of the shaders supported by the software rasterizer (by file name).
+static const std::unordered_map<std::string, SoftwareShadingModel> g_ShadingModels = {
+    { "Unlit",          SoftwareShadingModel::Unlit },
+    { "PhongColor",     SoftwareShadingModel::Phong },
+    { "PhongTexture",   SoftwareShadingModel::PhongTexture },
+    { "DepthOnly",      SoftwareShadingModel::Depth },
+    { "LinearDepth",    SoftwareShadingModel::LinearDepth },
+};
+
+/**
+ * @brief Convert a GLSL type into a data type.
+ *
+ * @param type The GLSL type name.
+ *
+ * @return The data type (the samplers and booleans are integers), or `DataType::None` if the
+ *         type is not supported.
+ */
+static DataType ToDataType(const std::string& type)
+{
+    if (type == "float") return DataType::Float;
+    if (type == "vec2")  return DataType::Vec2;
+    if (type == "vec3")  return DataType::Vec3;
+    if (type == "vec4")  return DataType::Vec4;
+    if (type == "mat2")  return DataType::Mat2;
+    if (type == "mat3")  return DataType::Mat3;
+    if (type == "mat4")  return DataType::Mat4;
+    if (type == "uint")  return DataType::Uint;
+    if (type == "int" || type == "bool" || type.find("sampler") != std::string::npos)
+        return DataType::Int;
+    return DataType::None;
+}
+
+/**
+ * @brief Remove the comments of a GLSL source and collect its integer definitions.
+ *
+ * @param source The GLSL source.
+ * @param defines The integer definitions (`#define NAME value`) found in the source.
+ *
+ * @return The source without comments and preprocessor directives.
+ */
+static std::string Preprocess(const std::string& source,
+                              std::unordered_map<std::string, uint32_t>& defines)
+{
+    // Remove the comments
+    std::string code;
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (source.compare(i, 2, "//") == 0)
+            i = std::min(source.find('\n', i), source.size()) - 1;
+        else if (source.compare(i, 2, "/*") == 0)
+            i = std::min(source.find("*/", i + 2), source.size() - 2) + 1;
+        else
+            code += source[i];
+    }
+    
+    // Remove the preprocessor directives (keeping the integer definitions)
+    std::stringstream stream(code);
+    std::string line, result;
+    while (std::getline(stream, line))
+    {
+        std::stringstream words(line);
+        std::string directive, name, value;
+        words >> directive;
+        if (directive.empty() || directive[0] != '#')
+        {
+            result += line + '\n';
+            continue;
+        }
+        
+        if (directive == "#define" && (words >> name >> value) &&
+            std::all_of(value.begin(), value.end(), ::isdigit))
+            defines[name] = static_cast<uint32_t>(std::stoul(value));
+    }
+    return result;
+}
+
+/**
+ * @brief Split a GLSL source into tokens (identifiers, numbers and punctuation).
+ *
+ * @param source The GLSL source (without comments).
+ *
+ * @return The tokens.
+ */
+static std::vector<std::string> Tokenize(const std::string& source)
+{
+    std::vector<std::string> tokens;
+    for (size_t i = 0; i < source.size();)
+    {
+        const char c = source[i];
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            i++;
+            continue;
+        }
+        
+        if (std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.')
+        {
+            size_t end = i;
+            while (end < source.size() &&
+                   (std::isalnum(static_cast<unsigned char>(source[end])) || source[end] == '_' || source[end] == '.'))
+                end++;
+            tokens.emplace_back(source.substr(i, end - i));
+            i = end;
+        }
+        else
+            tokens.emplace_back(1, source[i++]);
+    }
+    return tokens;
+}
+
+/**
+ * @brief Get the size of a GLSL array.
+ *
+ * @param token The size token (a number or an integer definition).
+ * @param defines The integer definitions of the source.
+ *
+ * @return The number of elements (0 if the size is unknown).
+ */
+static uint32_t ParseArraySize(const std::string& token,
+                               const std::unordered_map<std::string, uint32_t>& defines)
+{
+    auto it = defines.find(token);
+    if (it != defines.end())
+        return it->second;
+    
+    if (token.empty() || !std::all_of(token.begin(), token.end(), ::isdigit))
+        return 0;
+    return static_cast<uint32_t>(std::stoul(token));
+}
+
+/**
+ * @brief Parse a GLSL declaration statement (`type name[size], name[size], ...`).
+ *
+ * @param statement The tokens of the statement (without the semicolon).
+ * @param defines The integer definitions of the source.
+ *
+ * @return The declared variables.
+ */
+static std::vector<GLSLDeclaration> ParseDeclaration(const std::vector<std::string>& statement,
+                                                     const std::unordered_map<std::string, uint32_t>& defines)
+{
+    static const std::unordered_set<std::string> qualifiers = {
+        "const", "highp", "mediump", "lowp", "flat", "smooth", "noperspective"
+    };
+    
+    // Skip the qualifiers before the type
+    size_t i = 0;
+    while (i < statement.size() && qualifiers.count(statement[i]))
+        i++;
+    if (i + 1 >= statement.size())
+        return {};
+    
+    std::vector<GLSLDeclaration> declarations;
+    const std::string& type = statement[i++];
+    for (; i < statement.size(); i++)
+    {
+        if (statement[i] == ",")
+            continue;
+        
+        GLSLDeclaration declaration{ type, statement[i] };
+        if (i + 2 < statement.size() && statement[i + 1] == "[")
+        {
+            declaration.ArraySize = ParseArraySize(statement[i + 2], defines);
+            i += 3;
+        }
+        declarations.push_back(declaration);
+    }
+    return declarations;
+}
+
+/**
+ * @brief Parse the declarations of a GLSL block (`{ type name[size]; ... }`).
+ *
+ * @param tokens The tokens of the source.
+ * @param i The index of the opening brace, updated to the index after the closing brace.
+ * @param defines The integer definitions of the source.
+ *
+ * @return The declarations of the block.
+ */
+static std::vector<GLSLDeclaration> ParseBlock(const std::vector<std::string>& tokens, size_t& i,
+                                               const std::unordered_map<std::string, uint32_t>& defines)
+{
+    std::vector<GLSLDeclaration> declarations;
+    
+    i++;
+    while (i < tokens.size() && tokens[i] != "}")
+    {
+        std::vector<std::string> statement;
+        while (i < tokens.size() && tokens[i] != ";" && tokens[i] != "}")
+            statement.push_back(tokens[i++]);
+        if (i < tokens.size() && tokens[i] == ";")
+            i++;
+        
+        auto members = ParseDeclaration(statement, defines);
+        declarations.insert(declarations.end(), members.begin(), members.end());
+    }
+    i++;
+    return declarations;
+}
+
+/**
+ * @brief Generate a shader program.
+ *
+ * @param name The name for the shader.
+ * @param filePath Path to the source file.
+ */
+SoftwareShader::SoftwareShader(const std::string& name, const std::filesystem::path& filePath)
+    : Shader(name, filePath)
+{
+    // Parse the shader and divide it in the different program sources
+    ParseShader(filePath);
+    // Define the shader attributes and uniforms
+    ExtractShaderResources();
+    
+    // Select the shading kernel
+    auto it = g_ShadingModels.find(filePath.stem().string());
+    if (it != g_ShadingModels.end())
+        m_ShadingModel = it->second;
+    else
+        PIXEL_CORE_WARN("Shader '{0}' is not supported by the software rasterizer!", m_Name);
+}
+
+/**
+ * @brief Generate a shader program.
+ *
+ * @param filePath Path to the source file.
+ */
+SoftwareShader::SoftwareShader(const std::filesystem::path& filePath)
+    : SoftwareShader(filePath.stem().string(), filePath)
+{}
+
+/**
+ * @brief Get the texture read by a sampler uniform.
+ *
+ * @param name The name of the sampler uniform (e.g., "u_Material.TextureMap").
+ *
+ * @return The texture bound to the texture unit of the sampler, or null if not defined.
+ */
+const SoftwareTexture* SoftwareShader::GetTexture(const std::string& name)
+{
+    auto it = m_TextureUnits.find(GetUniform<int>(name, -1));
+    if (it == m_TextureUnits.end())
+        return nullptr;
+    return dynamic_cast<const SoftwareTexture*>(it->second.get());
+}
+
+/**
+ * @brief Set the uniform with a bool value.
+ *
+ * @param name Uniform name.
+ * @param value Uniform value.
+ */
+void SoftwareShader::SetBool(const std::string& name, bool value)
+{
+    SetUniformData(name, static_cast<int>(value));
+}
+
+/**
+ * @brief Set the uniform with an unsigned integer value.
+ *
+ * @param name Uniform name.
+ * @param value Uniform value.
+ */
+void SoftwareShader::SetUint(const std::string &name, unsigned int value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with an integer value.
+ *
+ * @param name Uniform name.
+ * @param value Uniform value.
+ */
+void SoftwareShader::SetInt(const std::string& name, int value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a float value.
+ *
+ * @param name Uniform name.
+ * @param value Uniform value.
+ */
+void SoftwareShader::SetFloat(const std::string& name, float value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a vector with 2 values (x, y).
+ *
+ * @param name Uniform name.
+ * @param value Vector input value.
+ */
+void SoftwareShader::SetVec2(const std::string& name, const glm::vec2& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a vector with 3 values (x, y, z).
+ *
+ * @param name Uniform name.
+ * @param value Vector input value.
+ */
+void SoftwareShader::SetVec3(const std::string& name, const glm::vec3& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a vector with 4 values (x, y, z, w).
+ *
+ * @param name Uniform name.
+ * @param value Vector input value.
+ */
+void SoftwareShader::SetVec4(const std::string& name, const glm::vec4& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a matrix with 2x2 values.
+ *
+ * @param name Uniform name.
+ * @param value Matrix input value.
+ */
+void SoftwareShader::SetMat2(const std::string& name, const glm::mat2& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a matrix with 3x3 values.
+ *
+ * @param name Uniform name.
+ * @param value Matrix input value.
+ */
+void SoftwareShader::SetMat3(const std::string& name, const glm::mat3& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set the uniform with a matrix with 4x4 values.
+ *
+ * @param name Uniform name.
+ * @param value Matrix input value.
+ */
+void SoftwareShader::SetMat4(const std::string& name, const glm::mat4& value)
+{
+    SetUniformData(name, value);
+}
+
+/**
+ * @brief Set a texture map in the shader program.
+ *
+ * @param texture The texture map.
+ * @param name Uniform name.
+ * @param slot The texture slot.
+ * @param sampler The sampler used to read the texture (the sampling state of the texture is
+ *                always used by the software rasterizer).
+ */
+void SoftwareShader::SetTexture(const std::string &name,
+                                const std::shared_ptr<Texture>& texture,
+                                int slot,
+                                const std::shared_ptr<Sampler>& sampler)
+{
+    if(!texture)
+        return;
+    
+    m_TextureUnits[slot] = texture;
+    SetInt(name, slot);
+}
+
+/**
+ * @brief Define the vertex attributes and the uniforms declared in the shader sources.
+ *
+ * @post  `m_Attributes` will contain the inputs of the vertex shader.
+ * @post  `m_Uniforms` will contain the uniforms of both stages (also the members of the uniform
+ *        blocks, which are set individually).
+ */
+void SoftwareShader::ExtractShaderResources()
+{
+    ExtractStageResources(m_VertexSource, true);
+    ExtractStageResources(m_FragmentSource, false);
+}
+
+/**
+ * @brief Define the vertex attributes and the uniforms declared in the source of a shader stage.
+ *
+ * @param source The GLSL source of the stage.
+ * @param vertexStage Define the inputs of the stage as vertex attributes.
+ */
+void SoftwareShader::ExtractStageResources(const std::string& source, bool vertexStage)
+{
+    std::unordered_map<std::string, uint32_t> defines;
+    const std::vector<std::string> tokens = Tokenize(Preprocess(source, defines));
+    std::unordered_map<std::string, std::vector<GLSLDeclaration>> structures;
+    
+    // Register a uniform, expanding its structure members and array elements into leaf uniforms
+    std::function<void(const std::string&, const GLSLDeclaration&)> addUniform =
+        [&](const std::string& prefix, const GLSLDeclaration& declaration)
+    {
+        for (uint32_t i = 0; i < std::max(declaration.ArraySize, 1u); i++)
+        {
+            std::string name = prefix + declaration.Name;
+            if (declaration.ArraySize > 0)
+                name += "[" + std::to_string(i) + "]";
+            
+            auto structure = structures.find(declaration.Type);
+            if (structure != structures.end())
+            {
+                for (const auto& member : structure->second)
+                    addUniform(name + ".", member);
+                continue;
+            }
+            
+            const DataType type = ToDataType(declaration.Type);
+            auto [group, member] = utils::SplitString(name);
+            if (type != DataType::None && !m_Uniforms.Exists(group, member))
+                m_Uniforms.Add(group, member, UniformElement(type));
+        }
+    };
+    
+    // Go through the global declarations (the function bodies are skipped)
+    for (size_t i = 0; i < tokens.size();)
+    {
+        const std::string& token = tokens[i];
+        
+        // Layout qualifiers
+        if (token == "layout" && i + 1 < tokens.size() && tokens[i + 1] == "(")
+        {
+            i = std::find(tokens.begin() + i, tokens.end(), ")") - tokens.begin() + 1;
+        }
+        // Structure definitions
+        else if (token == "struct" && i + 2 < tokens.size() && tokens[i + 2] == "{")
+        {
+            const std::string name = tokens[i + 1];
+            i += 2;
+            structures[name] = ParseBlock(tokens, i, defines);
+        }
+        // Uniform blocks and uniforms
+        else if (token == "uniform" && i + 2 < tokens.size())
+        {
+            if (tokens[i + 2] == "{")
+            {
+                i += 2;
+                auto members = ParseBlock(tokens, i, defines);
+                const std::string prefix = i < tokens.size() && tokens[i] != ";" ? tokens[i] + "." : "";
+                for (const auto& member : members)
+                    addUniform(prefix, member);
+            }
+            else
+            {
+                std::vector<std::string> statement(tokens.begin() + i + 1,
+                                                   std::find(tokens.begin() + i, tokens.end(), ";"));
+                for (const auto& declaration : ParseDeclaration(statement, defines))
+                    addUniform("", declaration);
+            }
+            i = std::find(tokens.begin() + i, tokens.end(), ";") - tokens.begin() + 1;
+        }
+        // Vertex attributes
+        else if (token == "in" && i + 2 < tokens.size())
+        {
+            if (vertexStage && ToDataType(tokens[i + 1]) != DataType::None)
+                m_Attributes.Add(tokens[i + 2], DataElement(ToDataType(tokens[i + 1])));
+            i = std::find(tokens.begin() + i, tokens.end(), ";") - tokens.begin() + 1;
+        }
+        // Parameter lists and initializers
+        else if (token == "(")
+        {
+            int depth = 0;
+            for (; i < tokens.size(); i++)
+            {
+                depth += tokens[i] == "(" ? 1 : tokens[i] == ")" ? -1 : 0;
+                if (depth == 0)
+                    break;
+            }
+            i++;
+        }
+        // Function bodies
+        else if (token == "{")
+        {
+            int depth = 0;
+            for (; i < tokens.size(); i++)
+            {
+                depth += tokens[i] == "{" ? 1 : tokens[i] == "}" ? -1 : 0;
+                if (depth == 0)
+                    break;
+            }
+            i++;
+        }
+        else
+            i++;
+    }
+}
+
+/**
+ * @brief Parse shader input file.
+ *
+ * @param filepath Path to the shader file.
+ */
+void SoftwareShader::ParseShader(const std::filesystem::path& filepath)
+{
+    // Open the file
+    std::ifstream stream(filepath);
+    
+    // Parse the file
+    std::string line;
+    std::stringstream ss[4];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line))
+    {
+        if (line.find("#shader") != std::string::npos)
+        {
+            // Set mode to vertex
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            // Set mode to fragment
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+            // Set mode to geometry
+            else if (line.find("geometry") != std::string::npos)
+                type = ShaderType::GEOMETRY;
+            // Set mode to compute
+            else if (line.find("compute") != std::string::npos)
+                type = ShaderType::COMPUTE;
+        }
+        else if (type != ShaderType::NONE)
+        {
+            // Include statement handling
+            if (line.find("#include") != std::string::npos)
+            {
+                std::string includePath = line.substr(line.find_first_of('"') + 1,
+                                                      line.find_last_of('"') - line.find_first_of('"') - 1);
+                ss[(int)type] << ReadFile(includePath);
+            }
+            else
+                ss[(int)type] << line << '\n';
+        }
+    }
+    
+    // Keep the sources of the stages emulated by the rasterizer
+    m_VertexSource = ss[(int)ShaderType::VERTEX].str();
+    m_FragmentSource = ss[(int)ShaderType::FRAGMENT].str();
+}
+
+} // namespace pixc
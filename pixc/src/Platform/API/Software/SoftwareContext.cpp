@@ -0,0 +1,54 @@
+#include "pixcpch.h"
+#include "Platform/Software/SoftwareContext.h"
+
+#include "Platform/Software/Buffer/SoftwareFrameBuffer.h"
+
+#include <GLFW/glfw3.h>
+
+namespace pixc {
+
+/**
+ *  Constructs a software context for rendering.
+ *
+ *  @param windowHandle The GLFW window handle to associate with this context.
+ */
+SoftwareContext::SoftwareContext(GLFWwindow* windowHandle)
+: GraphicsContext(), m_WindowHandle(windowHandle)
+{
+    PIXEL_CORE_ASSERT(windowHandle, "Window handle is null!");
+}
+
+/**
+ *  Initializes the software context.
+ */
+void SoftwareContext::Init()
+{
+    // Display the software rasterizer general information
+    PIXEL_CORE_INFO("Using the software rasterizer:");
+    PIXEL_CORE_INFO("  Threads: {0}", std::max(std::thread::hardware_concurrency(), 1u));
+}
+
+/**
+ *  Sets the window hints required for the software context.
+ *
+ *  This is a static function that should be called *before*
+ *  creating the GLFW window, so no graphics context is created.
+ */
+void SoftwareContext::SetWindowHints()
+{
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+}
+
+/**
+ * Set the size of the drawable screen buffer.
+ *
+ * @param width The width of the buffer.
+ * @param height The height of the buffer.
+ */
+void SoftwareContext::UpdateBufferSize(const uint32_t width,
+                                       const uint32_t height)
+{
+    SoftwareFrameBuffer::ResizeScreen(width, height);
+}
+
+} // namespace pixc
@@ -0,0 +1,674 @@
+#include "pixcpch.h"
+#include "Platform/Software/SoftwareRasterizer.h"
+
+#include "Foundation/Core/Timer.h"
+
+#include "Foundation/Renderer/RendererAPI.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace pixc {
+
+/**
+ * @brief Represents a triangle set up for rasterization (in pixels, counter-clockwise).
+ */
+struct SoftwareTriangle
+{
+    ///< Edge functions (E = A * x + B * y + C) opposite to each vertex.
+    float A[3], B[3], C[3];
+    ///< Indicates if a pixel center on an edge belongs to the triangle (top-left rule).
+    bool TopLeft[3];
+    ///< Inverse of the doubled area of the triangle.
+    float InvArea;
+    ///< Depth (NDC) and inverse clip w of the vertices.
+    float Z[3], InvW[3];
+    ///< Bounding box of the triangle (in pixels, inclusive).
+    int32_t MinX, MinY, MaxX, MaxY;
+    ///< Vertices of the triangle (in the clipped vertices).
+    uint32_t Vertices[3];
+};
+
+/**
+ * @brief Represents the state of the software rasterizer.
+ */
+struct SoftwareRasterizerData
+{
+    ///< Worker threads.
+    std::vector<std::thread> Workers;
+    bool Running = true;
+    
+    ///< Draw call shared with the workers (guarded by the mutex).
+    std::mutex Mutex;
+    std::condition_variable Start;
+    std::condition_variable Done;
+    uint64_t Generation = 0;
+    uint32_t ActiveCount = 0;
+    ///< Next tile to be rasterized.
+    std::atomic<uint32_t> NextTile = 0;
+    
+    ///< Draw call being rasterized.
+    const SoftwareRenderTarget* Target = nullptr;
+    const SoftwareRasterState* State = nullptr;
+    const SoftwareMaterial* Material = nullptr;
+    
+    ///< Vertices after clipping and triangles set up.
+    std::vector<SoftwareVertex> Vertices;
+    std::vector<SoftwareTriangle> Triangles;
+    ///< Triangles overlapping each tile (in submission order), and tiles with triangles.
+    std::vector<std::vector<uint32_t>> Bins;
+    std::vector<uint32_t> ActiveTiles;
+    uint32_t TileCountX = 0;
+    
+    ///< Rasterizer statistics.
+    SoftwareRasterizer::Statistics Stats;
+};
+
+static std::unique_ptr<SoftwareRasterizerData> g_Data;
+
+///< Thresholds of a 4x4 ordered dithering pattern (same as `DitherFade.glsl`).
+static const float g_Bayer4x4[16] = {
+     0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
+    12.0f / 16.0f,  4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
+     3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
+    15.0f / 16.0f,  7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f
+};
+
+/**
+ * @brief Interpolate linearly between two vertices (in clip space).
+ *
+ * @param a The first vertex.
+ * @param b The second vertex.
+ * @param t The interpolation factor.
+ *
+ * @return The interpolated vertex.
+ */
+static SoftwareVertex Interpolate(const SoftwareVertex& a, const SoftwareVertex& b, float t)
+{
+    SoftwareVertex vertex;
+    vertex.Position = glm::mix(a.Position, b.Position, t);
+    vertex.WorldPosition = glm::mix(a.WorldPosition, b.WorldPosition, t);
+    vertex.Normal = glm::mix(a.Normal, b.Normal, t);
+    vertex.TextureCoord = glm::mix(a.TextureCoord, b.TextureCoord, t);
+    return vertex;
+}
+
+/**
+ * @brief Clip a triangle against the near plane (z >= 0 in clip space, or z <= w if the depth is
+ * reversed).
+ *
+ * The far plane and the sides of the view volume are handled per pixel (depth range) and by the
+ * bounding box of the triangle (viewport).
+ *
+ * @param triangle The vertices of the triangle.
+ * @param reversed Reversed depth flag.
+ * @param polygon The vertices of the clipped polygon (empty if the triangle is not visible).
+ */
+static void ClipNearPlane(const SoftwareVertex (&triangle)[3], bool reversed,
+                          std::vector<SoftwareVertex>& polygon)
+{
+    // Signed distance to the near plane (positive inside the view volume)
+    auto distance = [reversed](const SoftwareVertex& vertex)
+    {
+        return reversed ? vertex.Position.w - vertex.Position.z : vertex.Position.z;
+    };
+    
+    polygon.clear();
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const SoftwareVertex& current = triangle[i];
+        const SoftwareVertex& next = triangle[(i + 1) % 3];
+        const float currentDistance = distance(current);
+        const float nextDistance = distance(next);
+        const bool currentInside = currentDistance >= 0.0f;
+        const bool nextInside = nextDistance >= 0.0f;
+        
+        if (currentInside)
+            polygon.push_back(current);
+        if (currentInside != nextInside)
+        {
+            float t = currentDistance / (currentDistance - nextDistance);
+            polygon.push_back(Interpolate(current, next, t));
+        }
+    }
+}
+
+/**
+ * @brief Set up a triangle for rasterization and bin it into the tiles it overlaps.
+ *
+ * @param target The render target.
+ * @param state The pipeline state.
+ * @param v0 The index of the first vertex (in the clipped vertices).
+ * @param v1 The index of the second vertex.
+ * @param v2 The index of the third vertex.
+ */
+static void SetupTriangle(const SoftwareRenderTarget& target, const SoftwareRasterState& state,
+                          uint32_t v0, uint32_t v1, uint32_t v2)
+{
+    SoftwareTriangle triangle;
+    triangle.Vertices[0] = v0;
+    triangle.Vertices[1] = v1;
+    triangle.Vertices[2] = v2;
+    
+    // Project the vertices on the viewport
+    glm::vec2 screen[3];
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const glm::vec4& position = g_Data->Vertices[triangle.Vertices[i]].Position;
+        if (position.w <= 0.0f)
+            return;
+        
+        triangle.InvW[i] = 1.0f / position.w;
+        const glm::vec3 ndc = glm::vec3(position) * triangle.InvW[i];
+        screen[i].x = state.Viewport.x + (ndc.x * 0.5f + 0.5f) * state.Viewport.z;
+        screen[i].y = state.Viewport.y + (ndc.y * 0.5f + 0.5f) * state.Viewport.w;
+        triangle.Z[i] = ndc.z;
+    }
+    
+    // Skip the degenerated triangles, and orient the others counter-clockwise (no face culling)
+    float area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) -
+                 (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+    if (area == 0.0f || !std::isfinite(area))
+        return;
+    if (area < 0.0f)
+    {
+        std::swap(screen[1], screen[2]);
+        std::swap(triangle.Vertices[1], triangle.Vertices[2]);
+        std::swap(triangle.Z[1], triangle.Z[2]);
+        std::swap(triangle.InvW[1], triangle.InvW[2]);
+        area = -area;
+    }
+    triangle.InvArea = 1.0f / area;
+    
+    // Define the edge functions (the edge i is opposite to the vertex i)
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const glm::vec2& a = screen[(i + 1) % 3];
+        const glm::vec2& b = screen[(i + 2) % 3];
+        triangle.A[i] = -(b.y - a.y);
+        triangle.B[i] = b.x - a.x;
+        triangle.C[i] = (b.y - a.y) * a.x - (b.x - a.x) * a.y;
+        triangle.TopLeft[i] = triangle.A[i] > 0.0f || (triangle.A[i] == 0.0f && triangle.B[i] > 0.0f);
+    }
+    
+    // Compute the bounding box, limited to the viewport and the target
+    const int32_t minX = std::max(state.Viewport.x, 0);
+    const int32_t minY = std::max(state.Viewport.y, 0);
+    const int32_t maxX = std::min(state.Viewport.x + state.Viewport.z, (int32_t)target.Width) - 1;
+    const int32_t maxY = std::min(state.Viewport.y + state.Viewport.w, (int32_t)target.Height) - 1;
+    
+    const glm::vec2 lower = glm::min(glm::min(screen[0], screen[1]), screen[2]);
+    const glm::vec2 upper = glm::max(glm::max(screen[0], screen[1]), screen[2]);
+    triangle.MinX = std::max(minX, (int32_t)std::floor(lower.x));
+    triangle.MinY = std::max(minY, (int32_t)std::floor(lower.y));
+    triangle.MaxX = std::min(maxX, (int32_t)std::ceil(upper.x));
+    triangle.MaxY = std::min(maxY, (int32_t)std::ceil(upper.y));
+    if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY)
+        return;
+    
+    // Bin the triangle into the tiles overlapped by its bounding box
+    const uint32_t index = static_cast<uint32_t>(g_Data->Triangles.size());
+    g_Data->Triangles.push_back(triangle);
+    
+    const uint32_t size = SoftwareRasterizer::TileSize;
+    for (uint32_t ty = triangle.MinY / size; ty <= triangle.MaxY / size; ty++)
+    {
+        for (uint32_t tx = triangle.MinX / size; tx <= triangle.MaxX / size; tx++)
+        {
+            const uint32_t tile = ty * g_Data->TileCountX + tx;
+            if (g_Data->Bins[tile].empty())
+                g_Data->ActiveTiles.push_back(tile);
+            g_Data->Bins[tile].push_back(index);
+        }
+    }
+}
+
+/**
+ * @brief Compare the depth of a fragment with the depth stored in the buffer.
+ *
+ * @param function The depth function.
+ * @param depth The depth of the fragment.
+ * @param stored The depth stored in the buffer.
+ *
+ * @return `true` if the fragment passes the depth test.
+ */
+static bool DepthTest(DepthFunction function, float depth, float stored)
+{
+    switch (function)
+    {
+        case DepthFunction::Always:     return true;
+        case DepthFunction::Never:      return false;
+        case DepthFunction::Less:       return depth < stored;
+        case DepthFunction::Equal:      return depth == stored;
+        case DepthFunction::LEqual:     return depth <= stored;
+        case DepthFunction::Greater:    return depth > stored;
+        case DepthFunction::NotEqual:   return depth != stored;
+        case DepthFunction::GEqual:     return depth >= stored;
+        case DepthFunction::None:
+        default:                        return depth < stored;
+    }
+}
+
+/**
+ * @brief Sample a texture of the material (white if the texture is not defined).
+ *
+ * @param texture The texture.
+ * @param coordinates The texture coordinates.
+ *
+ * @return The sampled value.
+ */
+static glm::vec4 SampleMap(const SoftwareTexture* texture, const glm::vec2& coordinates)
+{
+    return texture ? texture->Sample(coordinates) : glm::vec4(1.0f);
+}
+
+/**
+ * @brief Calculate the light reflected by a surface with the Blinn-Phong model (same as `Phong.glsl`).
+ *
+ * @param fragment The interpolated attributes of the fragment.
+ * @param material The material.
+ * @param kd The diffuse reflection coefficient.
+ * @param ks The specular reflection coefficient.
+ *
+ * @return The reflected light of all the lights of the environment.
+ */
+static glm::vec3 ShadePhong(const SoftwareVertex& fragment, const SoftwareMaterial& material,
+                            const glm::vec3& kd, const glm::vec3& ks)
+{
+    // Attenuation of the positional lights (linear, quadratic and maximum)
+    const float linear = 0.045f, quadratic = 0.0075f, maxAttenuation = 0.7f;
+    
+    const glm::vec3 normal = glm::normalize(fragment.Normal);
+    const glm::vec3 viewDirection = glm::normalize(material.ViewPosition - fragment.WorldPosition);
+    
+    glm::vec3 reflectance(0.0f);
+    for (uint32_t i = 0; i < std::min(material.LightCount, SoftwareMaterial::MaxLights); i++)
+    {
+        const SoftwareLight& light = material.Lights[i];
+        const bool positional = light.Vector.w == 1.0f;
+        
+        // Calculate the light direction and radiance
+        glm::vec3 lightDirection;
+        float attenuation = maxAttenuation;
+        if (positional)
+        {
+            glm::vec3 toLight = glm::vec3(light.Vector) - fragment.WorldPosition;
+            float distance = glm::length(toLight);
+            lightDirection = toLight / distance;
+            attenuation = std::min(maxAttenuation,
+                                   1.0f / (1.0f + linear * distance + quadratic * distance * distance));
+        }
+        else
+            lightDirection = glm::normalize(-glm::vec3(light.Vector));
+        
+        // Calculate the diffuse (Lambert) and specular (Blinn-Phong) components
+        const float cosTheta = glm::clamp(glm::dot(normal, lightDirection), 0.0f, 1.0f);
+        const glm::vec3 diffuse = cosTheta * kd * light.Ld;
+        
+        const glm::vec3 halfVector = glm::normalize(lightDirection + viewDirection);
+        const float cosPhi = glm::clamp(glm::dot(normal, halfVector), 0.0f, 1.0f);
+        const float specularMask = glm::smoothstep(1e-4f, 1.0f, cosTheta);
+        const glm::vec3 specular = specularMask * std::pow(cosPhi, material.Shininess) * ks * light.Ls;
+        
+        reflectance += light.Color * attenuation * (diffuse + specular);
+    }
+    return reflectance;
+}
+
+/**
+ * @brief Execute the shading kernel of the material for a fragment.
+ *
+ * @param fragment The interpolated attributes of the fragment.
+ * @param material The material.
+ *
+ * @return The color of the fragment.
+ */
+static glm::vec4 Shade(const SoftwareVertex& fragment, const SoftwareMaterial& material)
+{
+    switch (material.Model)
+    {
+        case SoftwareShadingModel::Unlit:
+            return SampleMap(material.TextureMap, fragment.TextureCoord) * material.Color;
+        
+        case SoftwareShadingModel::Phong:
+        {
+            glm::vec3 result = ShadePhong(fragment, material, material.Kd, material.Ks) +
+                               material.La * material.Ka;
+            return glm::vec4(result, material.Alpha);
+        }
+        
+        case SoftwareShadingModel::PhongTexture:
+        {
+            const glm::vec3 kd = glm::vec3(SampleMap(material.TextureMap, fragment.TextureCoord));
+            const glm::vec3 ks = glm::vec3(SampleMap(material.SpecularMap, fragment.TextureCoord));
+            // NOTE: using the diffuse map as the ambient reflectance (same as the shader)
+            glm::vec3 result = ShadePhong(fragment, material, kd, ks) + material.La * kd;
+            return glm::vec4(result, material.Alpha);
+        }
+        
+        case SoftwareShadingModel::LinearDepth:
+        {
+            float depth = SampleMap(material.TextureMap, fragment.TextureCoord).r;
+            if (material.Linearize)
+            {
+                if (RendererAPI::IsDepthReversed())
+                    depth = 1.0f - depth;
+                const float n = material.NearPlane, f = material.FarPlane;
+                depth = (2.0f * n * f) / (f + n - depth * (f - n)) / f;
+            }
+            return glm::vec4(glm::vec3(depth), 1.0f);
+        }
+        
+        case SoftwareShadingModel::Depth:
+        case SoftwareShadingModel::None:
+        default:
+            return glm::vec4(0.0f);
+    }
+}
+
+/**
+ * @brief Rasterize the triangles binned into a tile.
+ *
+ * The triangles are processed in submission order, so the depth test and the blending give the
+ * same result as a sequential rasterization.
+ *
+ * @param tile The tile index.
+ */
+static void RasterizeTile(uint32_t tile)
+{
+    const SoftwareRenderTarget& target = *g_Data->Target;
+    const SoftwareRasterState& state = *g_Data->State;
+    const SoftwareMaterial& material = *g_Data->Material;
+    
+    const bool depthTesting = state.DepthTesting && target.Depth;
+    const bool depthWriting = depthTesting && state.DepthWriting;
+    const bool colorWriting = state.ColorWriting && material.Model != SoftwareShadingModel::Depth;
+    glm::vec4 *depthTexels = target.Depth ? target.Depth->GetTexels() : nullptr;
+    
+    // Pixels of the tile
+    const int32_t size = SoftwareRasterizer::TileSize;
+    const int32_t tileX = (tile % g_Data->TileCountX) * size;
+    const int32_t tileY = (tile / g_Data->TileCountX) * size;
+    
+    for (uint32_t index : g_Data->Bins[tile])
+    {
+        const SoftwareTriangle& triangle = g_Data->Triangles[index];
+        const SoftwareVertex& v0 = g_Data->Vertices[triangle.Vertices[0]];
+        const SoftwareVertex& v1 = g_Data->Vertices[triangle.Vertices[1]];
+        const SoftwareVertex& v2 = g_Data->Vertices[triangle.Vertices[2]];
+        
+        const int32_t minX = std::max(triangle.MinX, tileX);
+        const int32_t minY = std::max(triangle.MinY, tileY);
+        const int32_t maxX = std::min(triangle.MaxX, tileX + size - 1);
+        const int32_t maxY = std::min(triangle.MaxY, tileY + size - 1);
+        
+        for (int32_t y = minY; y <= maxY; y++)
+        {
+            const float py = y + 0.5f;
+            for (int32_t x = minX; x <= maxX; x += 4)
+            {
+                // Evaluate the edge functions for four pixels at once
+                float e[3][4];
+                bool covered[4];
+                bool any = false;
+                for (int32_t lane = 0; lane < 4; lane++)
+                {
+                    const float px = x + lane + 0.5f;
+                    for (uint32_t i = 0; i < 3; i++)
+                        e[i][lane] = triangle.A[i] * px + triangle.B[i] * py + triangle.C[i];
+                    
+                    covered[lane] = x + lane <= maxX;
+                    for (uint32_t i = 0; i < 3; i++)
+                        covered[lane] &= e[i][lane] > 0.0f || (e[i][lane] == 0.0f && triangle.TopLeft[i]);
+                    any |= covered[lane];
+                }
+                if (!any)
+                    continue;
+                
+                for (int32_t lane = 0; lane < 4; lane++)
+                {
+                    if (!covered[lane])
+                        continue;
+                    
+                    const int32_t px = x + lane;
+                    const size_t pixel = (size_t)y * target.Width + px;
+                    
+                    // Interpolate the depth linearly in screen space
+                    const float b0 = e[0][lane] * triangle.InvArea;
+                    const float b1 = e[1][lane] * triangle.InvArea;
+                    const float b2 = e[2][lane] * triangle.InvArea;
+                    const float depth = b0 * triangle.Z[0] + b1 * triangle.Z[1] + b2 * triangle.Z[2];
+                    if (depth < 0.0f || depth > 1.0f)
+                        continue;
+                    
+                    if (depthTesting && !DepthTest(state.DepthFunc, depth, depthTexels[pixel].r))
+                        continue;
+                    
+                    // Discard the fragments of a model fading out
+                    if (material.Fade < 1.0f && material.Fade <= g_Bayer4x4[(y & 3) * 4 + (px & 3)])
+                        continue;
+                    
+                    if (depthWriting)
+                        depthTexels[pixel].r = depth;
+                    if (!colorWriting)
+                        continue;
+                    
+                    // Interpolate the attributes with perspective correction
+                    float w0 = b0 * triangle.InvW[0];
+                    float w1 = b1 * triangle.InvW[1];
+                    float w2 = b2 * triangle.InvW[2];
+                    const float invSum = 1.0f / (w0 + w1 + w2);
+                    w0 *= invSum; w1 *= invSum; w2 *= invSum;
+                    
+                    SoftwareVertex fragment;
+                    fragment.WorldPosition = w0 * v0.WorldPosition + w1 * v1.WorldPosition + w2 * v2.WorldPosition;
+                    fragment.Normal = w0 * v0.Normal + w1 * v1.Normal + w2 * v2.Normal;
+                    fragment.TextureCoord = w0 * v0.TextureCoord + w1 * v1.TextureCoord + w2 * v2.TextureCoord;
+                    
+                    const glm::vec4 color = Shade(fragment, material);
+                    for (const auto& [texture, layer] : target.Colors)
+                    {
+                        glm::vec4& texel = texture->GetTexels(layer)[pixel];
+                        texel = state.Blending ? color * color.a + texel * (1.0f - color.a) : color;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Rasterize tiles until all the active tiles of the draw call have been processed.
+ */
+static void RunTiles()
+{
+    const uint32_t count = static_cast<uint32_t>(g_Data->ActiveTiles.size());
+    while (true)
+    {
+        uint32_t index = g_Data->NextTile.fetch_add(1);
+        if (index >= count)
+            return;
+        
+        RasterizeTile(g_Data->ActiveTiles[index]);
+    }
+}
+
+/**
+ * @brief Rasterize tiles each time a draw call is started (worker threads).
+ */
+static void WorkerLoop()
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Start.wait(lock, [&generation] {
+                return !g_Data->Running || g_Data->Generation != generation;
+            });
+            if (!g_Data->Running)
+                return;
+            generation = g_Data->Generation;
+        }
+        
+        RunTiles();
+        
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->ActiveCount--;
+        }
+        g_Data->Done.notify_one();
+    }
+}
+
+/**
+ * @brief Initialize the software rasterizer.
+ *
+ * @param workerCount The number of worker threads (hardware concurrency minus one if zero).
+ */
+void SoftwareRasterizer::Init(uint32_t workerCount)
+{
+    if (g_Data)
+        return;
+    
+    g_Data = std::make_unique<SoftwareRasterizerData>();
+    
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    for (uint32_t i = 0; i < workerCount; i++)
+        g_Data->Workers.emplace_back(WorkerLoop);
+    g_Data->Stats.ThreadCount = workerCount + 1;
+}
+
+/**
+ * @brief Stop the worker threads of the software rasterizer.
+ */
+void SoftwareRasterizer::Shutdown()
+{
+    if (!g_Data)
+        return;
+    
+    {
+        std::lock_guard<std::mutex> lock(g_Data->Mutex);
+        g_Data->Running = false;
+    }
+    g_Data->Start.notify_all();
+    for (auto& worker : g_Data->Workers)
+        worker.join();
+    
+    g_Data.reset();
+}
+
+/**
+ * @brief Rasterize a list of triangles into a render target.
+ *
+ * @param target The render target.
+ * @param state The pipeline state.
+ * @param material The uniforms of the shading kernel.
+ * @param vertices The vertices (transformed into clip space).
+ * @param indices The indices of the triangles (three per triangle).
+ */
+void SoftwareRasterizer::DrawTriangles(const SoftwareRenderTarget& target,
+                                       const SoftwareRasterState& state,
+                                       const SoftwareMaterial& material,
+                                       const std::vector<SoftwareVertex>& vertices,
+                                       const std::vector<uint32_t>& indices)
+{
+    PIXEL_CORE_ASSERT(g_Data, "Software rasterizer has not been initialized!");
+    if (target.Width == 0 || target.Height == 0 || indices.size() < 3)
+        return;
+    
+    Timer timer;
+    
+    // Reset the bins of the target
+    const uint32_t tileCountX = (target.Width + TileSize - 1) / TileSize;
+    const uint32_t tileCountY = (target.Height + TileSize - 1) / TileSize;
+    g_Data->TileCountX = tileCountX;
+    g_Data->Bins.resize((size_t)tileCountX * tileCountY);
+    for (uint32_t tile : g_Data->ActiveTiles)
+        g_Data->Bins[tile].clear();
+    g_Data->ActiveTiles.clear();
+    g_Data->Triangles.clear();
+    
+    // Clip the triangles against the near plane, then set them up and bin them
+    g_Data->Vertices.clear();
+    std::vector<SoftwareVertex> polygon;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        if (indices[i] >= vertices.size() || indices[i + 1] >= vertices.size() ||
+            indices[i + 2] >= vertices.size())
+            continue;
+        
+        const SoftwareVertex triangle[3] = {
+            vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]
+        };
+        ClipNearPlane(triangle, state.ReversedDepth, polygon);
+        if (polygon.size() < 3)
+            continue;
+        
+        const uint32_t first = static_cast<uint32_t>(g_Data->Vertices.size());
+        g_Data->Vertices.insert(g_Data->Vertices.end(), polygon.begin(), polygon.end());
+        for (uint32_t v = 1; v + 1 < polygon.size(); v++)
+            SetupTriangle(target, state, first, first + v, first + v + 1);
+    }
+    
+    // Rasterize the tiles on all the threads (the workers are only woken up if there is enough work)
+    g_Data->Target = &target;
+    g_Data->State = &state;
+    g_Data->Material = &material;
+    g_Data->NextTile = 0;
+    
+    if (g_Data->ActiveTiles.size() > 1 && !g_Data->Workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_Data->Mutex);
+            g_Data->ActiveCount = static_cast<uint32_t>(g_Data->Workers.size());
+            g_Data->Generation++;
+        }
+        g_Data->Start.notify_all();
+        
+        RunTiles();
+        {
+            std::unique_lock<std::mutex> lock(g_Data->Mutex);
+            g_Data->Done.wait(lock, [] { return g_Data->ActiveCount == 0; });
+        }
+    }
+    else
+        RunTiles();
+    
+    g_Data->Target = nullptr;
+    g_Data->State = nullptr;
+    g_Data->Material = nullptr;
+    
+    // Update the statistics
+    g_Data->Stats.DrawCount++;
+    g_Data->Stats.TriangleCount += static_cast<uint32_t>(g_Data->Triangles.size());
+    g_Data->Stats.TileCount += static_cast<uint32_t>(g_Data->ActiveTiles.size());
+    g_Data->Stats.RasterTime += timer.ElapsedMilliseconds();
+}
+
+/**
+ * @brief Get the statistics of the software rasterizer.
+ *
+ * @return The statistics accumulated since the last reset.
+ */
+SoftwareRasterizer::Statistics SoftwareRasterizer::GetStats()
+{
+    return g_Data ? g_Data->Stats : Statistics();
+}
+
+/**
+ * @brief Reset the statistics of the software rasterizer (the thread count is kept).
+ */
+void SoftwareRasterizer::ResetStats()
+{
+    if (!g_Data)
+        return;
+    
+    const uint32_t threadCount = g_Data->Stats.ThreadCount;
+    g_Data->Stats = Statistics();
+    g_Data->Stats.ThreadCount = threadCount;
+}
+
+} // namespace pixc
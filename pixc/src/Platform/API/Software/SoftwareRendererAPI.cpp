@@ -0,0 +1,367 @@
+#include "pixcpch.h"
+#include "Platform/Software/SoftwareRendererAPI.h"
+
+#include "Platform/Software/Buffer/SoftwareVertexBuffer.h"
+#include "Platform/Software/Buffer/SoftwareIndexBuffer.h"
+
+namespace pixc {
+
+/**
+ * @brief Read a vertex attribute from the data of a vertex buffer.
+ *
+ * @param data The vertex data.
+ * @param element The attribute in the layout of the buffer.
+ * @param stride The size of a vertex (bytes).
+ * @param index The index of the vertex.
+ *
+ * @return The attribute value (missing components are set to zero, and w to one).
+ */
+static glm::vec4 ReadAttribute(const char *data, const DataElement& element,
+                               uint32_t stride, uint32_t index)
+{
+    glm::vec4 value(0.0f, 0.0f, 0.0f, 1.0f);
+    const float *components = reinterpret_cast<const float*>(data + (size_t)index * stride + element.Offset);
+    const uint32_t count = std::min<uint32_t>(element.Size / sizeof(float), 4);
+    for (uint32_t i = 0; i < count; i++)
+        value[i] = components[i];
+    return value;
+}
+
+/**
+ * @brief Read the uniforms used by the shading kernel of a shader.
+ *
+ * @param shader The shader of the drawable.
+ *
+ * @return The uniforms of the kernel.
+ */
+static SoftwareMaterial ReadMaterial(SoftwareShader& shader)
+{
+    SoftwareMaterial material;
+    material.Model = shader.GetShadingModel();
+    material.Fade = shader.GetUniform<float>("u_Fade.Factor", 1.0f);
+    
+    switch (material.Model)
+    {
+        case SoftwareShadingModel::Unlit:
+            material.Color = shader.GetUniform<glm::vec4>("u_Material.Color", glm::vec4(1.0f));
+            material.TextureMap = shader.GetTexture("u_Material.TextureMap");
+            break;
+        
+        case SoftwareShadingModel::Phong:
+        case SoftwareShadingModel::PhongTexture:
+        {
+            material.Ka = shader.GetUniform<glm::vec3>("u_Material.Ka", glm::vec3(0.0f));
+            material.Kd = shader.GetUniform<glm::vec3>("u_Material.Kd", glm::vec3(0.0f));
+            material.Ks = shader.GetUniform<glm::vec3>("u_Material.Ks", glm::vec3(0.0f));
+            material.Shininess = shader.GetUniform<float>("u_Material.Shininess", 1.0f);
+            material.Alpha = shader.GetUniform<float>("u_Material.Alpha", 1.0f);
+            material.TextureMap = shader.GetTexture("u_MaterialMaps.DiffuseMap");
+            material.SpecularMap = shader.GetTexture("u_MaterialMaps.SpecularMap");
+            
+            material.ViewPosition = shader.GetUniform<glm::vec3>("u_View.Position", glm::vec3(0.0f));
+            material.La = shader.GetUniform<float>("u_Environment.La", 0.0f);
+            int lightCount = shader.GetUniform<int>("u_Environment.LightCount", 0);
+            material.LightCount = std::min((uint32_t)std::max(lightCount, 0), SoftwareMaterial::MaxLights);
+            for (uint32_t i = 0; i < material.LightCount; i++)
+            {
+                const std::string light = "u_Environment.Lights[" + std::to_string(i) + "].";
+                material.Lights[i].Vector = shader.GetUniform<glm::vec4>(light + "Vector", glm::vec4(0.0f));
+                material.Lights[i].Color = shader.GetUniform<glm::vec3>(light + "Color", glm::vec3(0.0f));
+                material.Lights[i].Ld = shader.GetUniform<float>(light + "Ld", 0.0f);
+                material.Lights[i].Ls = shader.GetUniform<float>(light + "Ls", 0.0f);
+            }
+            break;
+        }
+        
+        case SoftwareShadingModel::LinearDepth:
+            material.TextureMap = shader.GetTexture("u_Material.DepthMap");
+            material.Linearize = shader.GetUniform<unsigned int>("u_Material.Linearize", 0u) != 0u;
+            material.NearPlane = shader.GetUniform<float>("u_Material.NearPlane", 0.1f);
+            material.FarPlane = shader.GetUniform<float>("u_Material.FarPlane", 100.0f);
+            break;
+        
+        case SoftwareShadingModel::Depth:
+        case SoftwareShadingModel::None:
+            break;
+    }
+    return material;
+}
+
+/**
+ * @brief Initializes the software rendering API (starts the rasterizer threads).
+ */
+void SoftwareRendererAPI::Init()
+{
+    SoftwareRasterizer::Init();
+}
+
+/**
+ * @brief Define the color to clear the color buffer.
+ *
+ * @param color The color to use.
+ */
+void SoftwareRendererAPI::SetClearColor(const glm::vec4& color)
+{
+    m_ClearColor = color;
+}
+
+/**
+ * @brief Set the viewport for rendering.
+ *
+ * @param x The x-coordinate of the lower-left corner of the viewport.
+ * @param y The y-coordinate of the lower-left corner of the viewport.
+ * @param width The width of the viewport.
+ * @param height The height of the viewport.
+ */
+void SoftwareRendererAPI::SetViewport(const uint32_t x, const uint32_t y,
+                                      const uint32_t width, const uint32_t height)
+{
+    m_State.Viewport = glm::ivec4(x, y, width, height);
+}
+
+/**
+ * @brief Enable or disable depth testing.
+ *
+ * @param enabled Pass true to enable depth testing, false to disable it.
+ */
+void SoftwareRendererAPI::EnableDepthTesting(const bool enabled)
+{
+    m_State.DepthTesting = enabled;
+}
+
+/**
+ * @brief Set the depth comparison function used during depth testing.
+ *
+ * @param function The depth function to use (e.g., Less, LessEqual, Greater, Always).
+ */
+void SoftwareRendererAPI::SetDepthFunction(const DepthFunction function)
+{
+    if (function == DepthFunction::None)
+        return;
+    
+    m_State.DepthFunc = function;
+}
+
+/**
+ * @brief Enable or disable (straight) alpha blending.
+ *
+ * @param enabled Set to `true` to enable alpha blending, or `false` to disable it.
+ */
+void SoftwareRendererAPI::EnableBlending(const bool enabled)
+{
+    m_State.Blending = enabled;
+}
+
+/**
+ * @brief Enable or disable the writing into the color attachments.
+ *
+ * @param enabled Set to `true` to write the color of the fragments, or `false` to discard it.
+ */
+void SoftwareRendererAPI::EnableColorWriting(const bool enabled)
+{
+    m_State.ColorWriting = enabled;
+}
+
+/**
+ * @brief Enable or disable the writing into the depth buffer.
+ *
+ * @param enabled Set to `true` to write the depth of the fragments, or `false` to keep the buffer.
+ */
+void SoftwareRendererAPI::EnableDepthWriting(const bool enabled)
+{
+    m_State.DepthWriting = enabled;
+}
+
+/**
+ * @brief Get the textures written by the draw calls (the active framebuffer, or the screen).
+ *
+ * @return The render target.
+ */
+SoftwareRenderTarget SoftwareRendererAPI::GetRenderTarget() const
+{
+    if (auto framebuffer = std::dynamic_pointer_cast<SoftwareFrameBuffer>(m_ActiveFrameBuffer))
+        return framebuffer->GetRenderTarget();
+    return SoftwareFrameBuffer::GetScreen()->GetRenderTarget();
+}
+
+/**
+ * @brief Clear the buffers to preset values.
+ *
+ * @param targets Bitmask of render targets to be cleared.
+ */
+void SoftwareRendererAPI::Clear(const RenderTargetMask targets)
+{
+    // Set depth testing state so it's in the correct state
+    EnableDepthTesting(utils::graphics::IsBufferActive(targets, RenderTargetMask::Depth));
+    
+    SoftwareRenderTarget target = GetRenderTarget();
+    if (utils::graphics::IsBufferActive(targets, RenderTargetMask::Color))
+    {
+        for (const auto& [texture, layer] : target.Colors)
+            texture->Fill(m_ClearColor, layer);
+    }
+    if (utils::graphics::IsBufferActive(targets, RenderTargetMask::Depth) && target.Depth)
+        target.Depth->Fill(glm::vec4(RendererAPI::GetFarDepth()));
+}
+
+/**
+ * @brief Render primitives from array data using the specified vertex array.
+ *
+ * @param drawable The Vertex Array containing the vertex and index buffers for rendering.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void SoftwareRendererAPI::Draw(const std::shared_ptr<Drawable>& drawable,
+                               const PrimitiveType &primitive)
+{
+    DrawIndexed(drawable, drawable->GetIndexBuffer()->GetCount(), primitive);
+}
+
+/**
+ * @brief Render only the first indices of a drawable object.
+ *
+ * @param drawable The Vertex Array containing the vertex and index buffers for rendering.
+ * @param indexCount The number of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void SoftwareRendererAPI::DrawIndexed(const std::shared_ptr<Drawable>& drawable,
+                                      const uint32_t indexCount,
+                                      const PrimitiveType &primitive)
+{
+    auto indexBuffer = std::dynamic_pointer_cast<SoftwareIndexBuffer>(drawable->GetIndexBuffer());
+    if (!indexBuffer)
+        return;
+    
+    const auto& indices = indexBuffer->GetIndices();
+    m_Indices.assign(indices.begin(), indices.begin() + std::min<size_t>(indexCount, indices.size()));
+    DrawIndices(drawable, m_Indices, primitive);
+}
+
+/**
+ * @brief Render several ranges of indices of a drawable object (rasterized as a single draw call).
+ *
+ * @param drawable The Vertex Array containing the vertex and index buffers for rendering.
+ * @param ranges The ranges of indices to be rendered.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void SoftwareRendererAPI::DrawRanges(const std::shared_ptr<Drawable>& drawable,
+                                     const std::vector<IndexRange>& ranges,
+                                     const PrimitiveType &primitive)
+{
+    auto indexBuffer = std::dynamic_pointer_cast<SoftwareIndexBuffer>(drawable->GetIndexBuffer());
+    if (!indexBuffer)
+        return;
+    
+    // Strips cannot be concatenated
+    const auto& indices = indexBuffer->GetIndices();
+    if (primitive == PrimitiveType::TriangleStrip)
+    {
+        for (const auto& range : ranges)
+        {
+            const size_t begin = std::min<size_t>(range.Offset, indices.size());
+            const size_t end = std::min<size_t>(begin + range.Count, indices.size());
+            m_Indices.assign(indices.begin() + begin, indices.begin() + end);
+            DrawIndices(drawable, m_Indices, primitive);
+        }
+        return;
+    }
+    
+    m_Indices.clear();
+    for (const auto& range : ranges)
+    {
+        const size_t begin = std::min<size_t>(range.Offset, indices.size());
+        const size_t end = std::min<size_t>(begin + range.Count, indices.size());
+        m_Indices.insert(m_Indices.end(), indices.begin() + begin, indices.begin() + end);
+    }
+    DrawIndices(drawable, m_Indices, primitive);
+}
+
+/**
+ * @brief Transform the vertices of a drawable and rasterize its triangles.
+ *
+ * @param drawable The drawable object.
+ * @param indices The indices to be rendered.
+ * @param primitive The type of primitive to be drawn (only the triangles are rasterized).
+ */
+void SoftwareRendererAPI::DrawIndices(const std::shared_ptr<Drawable>& drawable,
+                                      const std::vector<uint32_t>& indices,
+                                      const PrimitiveType &primitive)
+{
+    if (primitive != PrimitiveType::Triangle && primitive != PrimitiveType::TriangleStrip)
+    {
+        static bool warned = false;
+        if (!warned)
+            PIXEL_CORE_WARN("The software rasterizer only draws triangles!");
+        warned = true;
+        return;
+    }
+    
+    auto shader = std::dynamic_pointer_cast<SoftwareShader>(drawable->GetShader());
+    if (!shader)
+        return;
+    
+    // Read the uniforms of the kernel (the draw call is skipped if the shader has no kernel)
+    SoftwareMaterial material = ReadMaterial(*shader);
+    if (material.Model == SoftwareShadingModel::None)
+        return;
+    
+    const glm::mat4 model = shader->GetUniform<glm::mat4>("u_Transform.Model", glm::mat4(1.0f));
+    const glm::mat4 view = shader->GetUniform<glm::mat4>("u_Transform.View", glm::mat4(1.0f));
+    const glm::mat4 projection = shader->GetUniform<glm::mat4>("u_Transform.Projection", glm::mat4(1.0f));
+    const glm::mat4 normal = shader->GetUniform<glm::mat4>("u_Transform.Normal", model);
+    const glm::mat4 transform = projection * view;
+    
+    // Fetch the vertex attributes and transform the vertices
+    m_Vertices.clear();
+    for (const auto& vbo : drawable->GetVertexBuffers())
+    {
+        auto buffer = std::dynamic_pointer_cast<SoftwareVertexBuffer>(vbo);
+        if (!buffer)
+            continue;
+        
+        const BufferLayout& layout = buffer->GetLayout();
+        const uint32_t stride = layout.GetStride();
+        if (stride == 0)
+            continue;
+        
+        m_Vertices.resize(std::max<size_t>(m_Vertices.size(), buffer->GetCount()));
+        for (uint32_t i = 0; i < buffer->GetCount(); i++)
+        {
+            SoftwareVertex& vertex = m_Vertices[i];
+            if (layout.Exists("a_Position"))
+            {
+                glm::vec4 position = ReadAttribute(buffer->GetData(), layout.Get("a_Position"), stride, i);
+                glm::vec4 world = model * position;
+                vertex.WorldPosition = glm::vec3(world);
+                vertex.Position = transform * world;
+            }
+            if (layout.Exists("a_Normal"))
+            {
+                glm::vec4 direction = ReadAttribute(buffer->GetData(), layout.Get("a_Normal"), stride, i);
+                vertex.Normal = glm::vec3(normal * glm::vec4(glm::vec3(direction), 0.0f));
+            }
+            if (layout.Exists("a_TextureCoord"))
+                vertex.TextureCoord = glm::vec2(ReadAttribute(buffer->GetData(), layout.Get("a_TextureCoord"),
+                                                              stride, i));
+        }
+    }
+    
+    // Assemble the triangles
+    const std::vector<uint32_t>* triangles = &indices;
+    if (primitive == PrimitiveType::TriangleStrip)
+    {
+        m_Triangles.clear();
+        for (size_t i = 0; i + 2 < indices.size(); i++)
+        {
+            // Keep the same orientation for all the triangles of the strip
+            const bool odd = i % 2 == 1;
+            m_Triangles.push_back(indices[i]);
+            m_Triangles.push_back(indices[odd ? i + 2 : i + 1]);
+            m_Triangles.push_back(indices[odd ? i + 1 : i + 2]);
+        }
+        triangles = &m_Triangles;
+    }
+    
+    SoftwareRasterizer::DrawTriangles(GetRenderTarget(), m_State, material, m_Vertices, *triangles);
+}
+
+} // namespace pixc
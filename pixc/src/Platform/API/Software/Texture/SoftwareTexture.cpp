@@ -0,0 +1,344 @@
+#include "pixcpch.h"
+#include "Platform/Software/Texture/SoftwareTexture.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace pixc {
+
+/**
+ * @brief Check if a color format stores unsigned integers (not normalized when converted).
+ *
+ * @param format The texture format.
+ *
+ * @return `true` if the format is an unsigned integer format.
+ */
+static bool IsUnsignedIntegerFormat(TextureFormat format)
+{
+    return format == TextureFormat::R8UI || format == TextureFormat::RG8UI ||
+           format == TextureFormat::RGB8UI || format == TextureFormat::RGBA8UI;
+}
+
+/**
+ * @brief Get the number of channels stored for a format (the depth is stored in one channel).
+ *
+ * @param format The texture format.
+ *
+ * @return The number of channels.
+ */
+static uint32_t GetStoredChannels(TextureFormat format)
+{
+    return utils::textures::IsDepthFormat(format) ? 1 : utils::textures::GetChannelCount(format);
+}
+
+/**
+ * @brief Get the number of bytes of a channel of a format (the depth is read as a float).
+ *
+ * @param format The texture format.
+ *
+ * @return The size of a channel (bytes).
+ */
+static uint32_t GetStoredBytes(TextureFormat format)
+{
+    return utils::textures::IsDepthFormat(format) ? 4 : utils::textures::GetBytesPerChannel(format);
+}
+
+/**
+ * @brief Convert a channel of a texel into a floating point value.
+ *
+ * @param format The texture format.
+ * @param data The channel data.
+ *
+ * @return The value of the channel.
+ */
+static float DecodeChannel(TextureFormat format, const char *data)
+{
+    switch (GetStoredBytes(format))
+    {
+        case 1:
+        {
+            float value = static_cast<float>(*reinterpret_cast<const uint8_t*>(data));
+            return IsUnsignedIntegerFormat(format) ? value : value / 255.0f;
+        }
+        case 2:
+            return glm::unpackHalf1x16(*reinterpret_cast<const uint16_t*>(data));
+        case 4:
+            return *reinterpret_cast<const float*>(data);
+    }
+    return 0.0f;
+}
+
+/**
+ * @brief Convert a floating point value into a channel of a texel.
+ *
+ * @param format The texture format.
+ * @param value The value of the channel.
+ * @param data The channel data to be written.
+ */
+static void EncodeChannel(TextureFormat format, float value, char *data)
+{
+    switch (GetStoredBytes(format))
+    {
+        case 1:
+        {
+            float scaled = IsUnsignedIntegerFormat(format) ? value :
+                           glm::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f;
+            *reinterpret_cast<uint8_t*>(data) = static_cast<uint8_t>(glm::clamp(scaled, 0.0f, 255.0f));
+            return;
+        }
+        case 2:
+            *reinterpret_cast<uint16_t*>(data) = glm::packHalf1x16(value);
+            return;
+        case 4:
+            *reinterpret_cast<float*>(data) = value;
+            return;
+    }
+}
+
+/**
+ * @brief Apply the wrap mode to a texel coordinate.
+ *
+ * @param coordinate The texel coordinate.
+ * @param size The size of the texture in this dimension.
+ * @param wrap The wrap mode.
+ *
+ * @return The wrapped coordinate, or -1 if the border color must be used.
+ */
+static int32_t WrapCoordinate(int32_t coordinate, int32_t size, TextureWrap wrap)
+{
+    switch (wrap)
+    {
+        case TextureWrap::Repeat:
+        {
+            int32_t wrapped = coordinate % size;
+            return wrapped < 0 ? wrapped + size : wrapped;
+        }
+        case TextureWrap::MirroredRepeat:
+        {
+            int32_t period = 2 * size;
+            int32_t wrapped = coordinate % period;
+            wrapped = wrapped < 0 ? wrapped + period : wrapped;
+            return wrapped < size ? wrapped : period - 1 - wrapped;
+        }
+        case TextureWrap::ClampToBorder:
+            return coordinate < 0 || coordinate >= size ? -1 : coordinate;
+        case TextureWrap::ClampToEdge:
+        case TextureWrap::None:
+        default:
+            return glm::clamp(coordinate, 0, size - 1);
+    }
+}
+
+/**
+ * @brief Allocate the texels of the texture.
+ *
+ * @param spec The texture specification.
+ * @param layerCount The number of layers (faces or slices).
+ */
+void SoftwareTexture::SWCreate(const TextureSpecification& spec, uint32_t layerCount)
+{
+    m_Width = std::max(spec.Width, 1u);
+    m_Height = std::max(spec.Height, 1u);
+    m_LayerCount = std::max(layerCount, 1u);
+    
+    m_Format = spec.Format;
+    m_Filter = spec.Filter.Mag != TextureFilter::None ? spec.Filter.Mag : TextureFilter::Linear;
+    m_Wrap = spec.Wrap;
+    
+    // The depth is initialized to the far plane, the colors to zero
+    const glm::vec4 value = utils::textures::IsDepthFormat(m_Format) ? glm::vec4(1.0f) : glm::vec4(0.0f);
+    m_Texels.assign((size_t)m_Width * m_Height * m_LayerCount, value);
+}
+
+/**
+ * @brief Convert data in the texture format into the texels of a layer.
+ *
+ * @param data The texture data (ignored if null).
+ * @param layer The layer index.
+ */
+void SoftwareTexture::SWUpload(const void *data, uint32_t layer)
+{
+    if (!data || layer >= m_LayerCount)
+        return;
+    
+    const uint32_t channels = GetStoredChannels(m_Format);
+    const uint32_t bytes = GetStoredBytes(m_Format);
+    const char *source = static_cast<const char*>(data);
+    
+    glm::vec4 *texels = GetTexels(layer);
+    for (size_t i = 0; i < (size_t)m_Width * m_Height; i++)
+    {
+        glm::vec4 texel(0.0f, 0.0f, 0.0f, 1.0f);
+        for (uint32_t c = 0; c < channels; c++)
+            texel[c] = DecodeChannel(m_Format, source + (i * channels + c) * bytes);
+        texels[i] = texel;
+    }
+}
+
+/**
+ * @brief Release the texels of the texture.
+ */
+void SoftwareTexture::SWRelease()
+{
+    m_Texels.clear();
+    m_Texels.shrink_to_fit();
+    m_Width = m_Height = m_LayerCount = 0;
+}
+
+/**
+ * @brief Read a texel of the texture (with the wrap mode applied).
+ *
+ * @param x The column of the texel.
+ * @param y The row of the texel.
+ * @param layer The layer index.
+ *
+ * @return The texel value.
+ */
+glm::vec4 SoftwareTexture::Fetch(int32_t x, int32_t y, uint32_t layer) const
+{
+    if (m_Texels.empty())
+        return glm::vec4(1.0f);
+    
+    x = WrapCoordinate(x, (int32_t)m_Width, m_Wrap);
+    y = WrapCoordinate(y, (int32_t)m_Height, m_Wrap);
+    if (x < 0 || y < 0)
+        return glm::vec4(1.0f);
+    
+    return GetTexels(std::min(layer, m_LayerCount - 1))[(size_t)y * m_Width + x];
+}
+
+/**
+ * @brief Sample the texture with its filter and wrap modes.
+ *
+ * @param coordinates The normalized texture coordinates.
+ * @param layer The layer index.
+ *
+ * @return The filtered value.
+ */
+glm::vec4 SoftwareTexture::Sample(const glm::vec2& coordinates, uint32_t layer) const
+{
+    const float x = coordinates.x * m_Width;
+    const float y = coordinates.y * m_Height;
+    
+    if (m_Filter == TextureFilter::Nearest)
+        return Fetch((int32_t)std::floor(x), (int32_t)std::floor(y), layer);
+    
+    // Bilinear filtering between the four nearest texels
+    const float fx = x - 0.5f, fy = y - 0.5f;
+    const int32_t x0 = (int32_t)std::floor(fx), y0 = (int32_t)std::floor(fy);
+    const float tx = fx - x0, ty = fy - y0;
+    
+    glm::vec4 bottom = glm::mix(Fetch(x0, y0, layer), Fetch(x0 + 1, y0, layer), tx);
+    glm::vec4 top = glm::mix(Fetch(x0, y0 + 1, layer), Fetch(x0 + 1, y0 + 1, layer), tx);
+    return glm::mix(bottom, top, ty);
+}
+
+/**
+ * @brief Sample a cube texture in a direction (same face selection as the graphics APIs).
+ *
+ * @param direction The sampling direction.
+ *
+ * @return The filtered value.
+ */
+glm::vec4 SoftwareTexture::SampleCube(const glm::vec3& direction) const
+{
+    const glm::vec3 a = glm::abs(direction);
+    uint32_t face;
+    float sc, tc, ma;
+    
+    if (a.x >= a.y && a.x >= a.z)
+    {
+        face = direction.x > 0.0f ? 0 : 1;
+        sc = direction.x > 0.0f ? -direction.z : direction.z;
+        tc = -direction.y;
+        ma = a.x;
+    }
+    else if (a.y >= a.z)
+    {
+        face = direction.y > 0.0f ? 2 : 3;
+        sc = direction.x;
+        tc = direction.y > 0.0f ? direction.z : -direction.z;
+        ma = a.y;
+    }
+    else
+    {
+        face = direction.z > 0.0f ? 4 : 5;
+        sc = direction.z > 0.0f ? direction.x : -direction.x;
+        tc = -direction.y;
+        ma = a.z;
+    }
+    
+    if (ma <= 0.0f)
+        return glm::vec4(0.0f);
+    
+    return Sample(glm::vec2(sc / ma + 1.0f, tc / ma + 1.0f) * 0.5f, face);
+}
+
+/**
+ * @brief Set all the texels of a layer to a value.
+ *
+ * @param value The value.
+ * @param layer The layer index.
+ */
+void SoftwareTexture::Fill(const glm::vec4& value, uint32_t layer)
+{
+    if (layer >= m_LayerCount)
+        return;
+    
+    std::fill_n(GetTexels(layer), (size_t)m_Width * m_Height, value);
+}
+
+/**
+ * @brief Copy a layer of another texture into a layer of this one (scaled if the sizes differ).
+ *
+ * @param src The source texture.
+ * @param srcLayer The source layer index.
+ * @param dstLayer The destination layer index.
+ */
+void SoftwareTexture::Copy(const SoftwareTexture& src, uint32_t srcLayer, uint32_t dstLayer)
+{
+    if (srcLayer >= src.m_LayerCount || dstLayer >= m_LayerCount)
+        return;
+    
+    if (src.m_Width == m_Width && src.m_Height == m_Height)
+    {
+        std::copy_n(src.GetTexels(srcLayer), (size_t)m_Width * m_Height, GetTexels(dstLayer));
+        return;
+    }
+    
+    glm::vec4 *texels = GetTexels(dstLayer);
+    for (uint32_t y = 0; y < m_Height; y++)
+    {
+        for (uint32_t x = 0; x < m_Width; x++)
+        {
+            glm::vec2 coordinates((x + 0.5f) / m_Width, (y + 0.5f) / m_Height);
+            texels[(size_t)y * m_Width + x] = src.Sample(coordinates, srcLayer);
+        }
+    }
+}
+
+/**
+ * @brief Convert the texels of a layer back into the texture format (tightly packed rows).
+ *
+ * @param layer The layer index.
+ *
+ * @return The texture data.
+ */
+std::vector<char> SoftwareTexture::Read(uint32_t layer) const
+{
+    const uint32_t channels = GetStoredChannels(m_Format);
+    const uint32_t bytes = GetStoredBytes(m_Format);
+    
+    std::vector<char> buffer((size_t)m_Width * m_Height * channels * bytes);
+    if (layer >= m_LayerCount)
+        return buffer;
+    
+    const glm::vec4 *texels = GetTexels(layer);
+    for (size_t i = 0; i < (size_t)m_Width * m_Height; i++)
+    {
+        for (uint32_t c = 0; c < channels; c++)
+            EncodeChannel(m_Format, texels[i][c], buffer.data() + (i * channels + c) * bytes);
+    }
+    return buffer;
+}
+
+} // namespace pixc
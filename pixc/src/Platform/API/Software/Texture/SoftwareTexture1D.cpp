@@ -0,0 +1,69 @@
+#include "pixcpch.h"
+#include "Platform/Software/Texture/SoftwareTexture1D.h"
+
+namespace pixc {
+
+/**
+ * @brief Create a base 1D texture.
+ */
+SoftwareTexture1D::SoftwareTexture1D()
+: Texture1D(), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE1D;
+}
+
+/**
+ * @brief Create a 1D base texture with specific properties.
+ *
+ * @param spec The texture specifications.
+ */
+SoftwareTexture1D::SoftwareTexture1D(const TextureSpecification& spec)
+: Texture1D(spec), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE1D;
+}
+
+/**
+ * @brief Create a 1D texture from input data.
+ *
+ * @param data The data for the 1D texture.
+ */
+SoftwareTexture1D::SoftwareTexture1D(const void *data)
+: SoftwareTexture1D()
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a 1D texture from input data and with specific properties.
+ *
+ * @param data The data for the 1D texture.
+ * @param spec The texture specifications.
+ */
+SoftwareTexture1D::SoftwareTexture1D(const void *data, const TextureSpecification& spec)
+: SoftwareTexture1D(spec)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create the texels of the texture from the provided data.
+ *
+ * @param data The texture data. This can be nullptr if the texture is to be written.
+ */
+void SoftwareTexture1D::CreateTexture(const void *data)
+{
+    // Verify size of the 1D texture
+    PIXEL_CORE_ASSERT(m_Spec.Width > 0, "1D texture size not properly defined!");
+    
+    // A 1D texture is stored as a single row
+    TextureSpecification spec = m_Spec;
+    spec.Height = 1;
+    SWCreate(spec, 1);
+    SWUpload(data, 0);
+    
+    // Define the texture as loaded
+    m_IsLoaded = true;
+}
+
+} // namespace pixc
@@ -0,0 +1,105 @@
+#include "pixcpch.h"
+#include "Platform/Software/Texture/SoftwareTexture2D.h"
+
+namespace pixc {
+
+// --------------------------------------------
+// Texture (2D)
+// --------------------------------------------
+
+/**
+ * @brief Create a base 2D texture.
+ */
+SoftwareTexture2D::SoftwareTexture2D(uint8_t samples)
+: Texture2D(samples), SoftwareTexture()
+{
+    m_Spec.Type = samples > 1 ? TextureType::TEXTURE2D_MULTISAMPLE : TextureType::TEXTURE2D;
+}
+
+/**
+ * @brief Create a 2D base texture with specific properties.
+ *
+ * @param spec The texture specifications.
+ */
+SoftwareTexture2D::SoftwareTexture2D(const TextureSpecification& spec,
+                                     uint8_t samples)
+: Texture2D(spec, samples), SoftwareTexture()
+{
+    m_Spec.Type = samples > 1 ? TextureType::TEXTURE2D_MULTISAMPLE : TextureType::TEXTURE2D;
+}
+
+/**
+ * @brief Create a 2D texture from input data.
+ *
+ * @param data The data for the 2D texture.
+ */
+SoftwareTexture2D::SoftwareTexture2D(const void *data, uint8_t samples)
+: SoftwareTexture2D(samples)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a 2D texture from input data and with specific properties.
+ *
+ * @param data The data for the 2D texture.
+ * @param spec The texture specifications.
+ */
+SoftwareTexture2D::SoftwareTexture2D(const void *data,
+                                     const TextureSpecification& spec,
+                                     uint8_t samples)
+: SoftwareTexture2D(spec, samples)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a 2D texture from the input source file.
+ *
+ * @param filePath Texture file path.
+ * @param flip Fip the texture vertically.
+ */
+SoftwareTexture2D::SoftwareTexture2D(const std::filesystem::path& filePath,
+                                     bool flip)
+: Texture2D(filePath, flip), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE2D;
+    
+    LoadFromFile(filePath);
+}
+
+/**
+ * @brief Create a 2D texture from the input source file.
+ *
+ * @param filePath Texture file path.
+ * @param spec The texture specifications.
+ * @param flip Fip the texture vertically.
+ */
+SoftwareTexture2D::SoftwareTexture2D(const std::filesystem::path& filePath,
+                                     const TextureSpecification& spec, bool flip)
+: Texture2D(filePath, spec, flip), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE2D;
+    
+    LoadFromFile(filePath);
+}
+
+/**
+ * @brief Create the texels of the texture from the provided data.
+ *
+ * @param data The texture data. This can be nullptr if the texture is to be written.
+ */
+void SoftwareTexture2D::CreateTexture(const void *data)
+{
+    // Verify size of the 2D texture
+    PIXEL_CORE_ASSERT(m_Spec.Width > 0 && m_Spec.Height > 0, "2D texture size not properly defined!");
+    
+    // The multisampled textures are stored with a single sample
+    SWCreate(m_Spec, 1);
+    SWUpload(data, 0);
+    
+    // Define the texture as loaded
+    m_IsLoaded = true;
+}
+
+} // namespace pixc
@@ -0,0 +1,76 @@
+#include "pixcpch.h"
+#include "Platform/Software/Texture/SoftwareTexture3D.h"
+
+namespace pixc {
+
+/**
+ * @brief Create a base 3D texture.
+ */
+SoftwareTexture3D::SoftwareTexture3D()
+: Texture3D(), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE3D;
+}
+
+/**
+ * @brief Create a 3D base texture with specific properties.
+ *
+ * @param spec The texture specifications.
+ */
+SoftwareTexture3D::SoftwareTexture3D(const TextureSpecification& spec)
+: Texture3D(spec), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURE3D;
+}
+
+/**
+ * @brief Create a 3D texture from input data.
+ *
+ * @param data The data for the 3D texture.
+ */
+SoftwareTexture3D::SoftwareTexture3D(const void *data)
+: SoftwareTexture3D()
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a 3D texture from input data and with specific properties.
+ *
+ * @param data The data for the 3D texture.
+ * @param spec The texture specifications.
+ */
+SoftwareTexture3D::SoftwareTexture3D(const void *data, const TextureSpecification& spec)
+: SoftwareTexture3D(spec)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create the texels of the texture from the provided data.
+ *
+ * @param data The texture data (slice after slice). This can be nullptr if the texture is to be written.
+ */
+void SoftwareTexture3D::CreateTexture(const void *data)
+{
+    // Verify size of the 3D texture
+    PIXEL_CORE_ASSERT(m_Spec.Width > 0 && m_Spec.Height > 0 && m_Spec.Depth > 0,
+                "3D texture size not properly defined!");
+    
+    SWCreate(m_Spec, m_Spec.Depth);
+    
+    // Each slice is stored as a layer
+    if (data)
+    {
+        const size_t sliceSize = (size_t)m_Spec.Width * m_Spec.Height *
+            utils::textures::GetChannelCount(m_Spec.Format) *
+            utils::textures::GetBytesPerChannel(m_Spec.Format);
+        for (uint32_t slice = 0; slice < m_Spec.Depth; slice++)
+            SWUpload(static_cast<const char*>(data) + slice * sliceSize, slice);
+    }
+    
+    // Define the texture as loaded
+    m_IsLoaded = true;
+}
+
+} // namespace pixc
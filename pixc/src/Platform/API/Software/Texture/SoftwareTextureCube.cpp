@@ -0,0 +1,142 @@
+#include "pixcpch.h"
+#include "Platform/Software/Texture/SoftwareTextureCube.h"
+
+/**
+ * @namespace pixc
+ * @brief Main namespace of the Pixel Core rendering engine.
+ */
+namespace pixc {
+
+/**
+ * @brief Create a cube texture with no data defined.
+ */
+SoftwareTextureCube::SoftwareTextureCube()
+: TextureCube(), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURECUBE;
+}
+
+/**
+ * @brief Create a cube texture with specific properties and no data defined.
+ *
+ * @param spec The texture specifications.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const TextureSpecification& spec)
+: TextureCube(spec), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURECUBE;
+}
+
+/**
+ * @brief Create a cube texture from input data.
+ *
+ * @param data The data to be placed on all the faces of the cube.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const void *data)
+: SoftwareTextureCube()
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a cube texture from input data.
+ *
+ * @param data The data for the cube texture (defined for each face).
+ */
+SoftwareTextureCube::SoftwareTextureCube(const std::vector<const void *>& data)
+: SoftwareTextureCube()
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a cube texture from input data and with specific properties.
+ *
+ * @param data The data to be placed on all the faces of the cube.
+ * @param spec The texture specifications.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const void *data,
+                                         const TextureSpecification& spec)
+: SoftwareTextureCube(spec)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a cube texture from input data and with specific properties.
+ *
+ * @param data The data for the cube texture (defined for each face).
+ * @param spec The texture specifications.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const std::vector<const void *>& data,
+                                         const TextureSpecification& spec)
+: SoftwareTextureCube(spec)
+{
+    CreateTexture(data);
+}
+
+/**
+ * @brief Create a cube texture from the input source files.
+ *
+ * @param directory Textures file path.
+ * @param files List of texture files.
+ * @param flip Fip the texture vertically.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const std::filesystem::path& directory,
+                                         const std::vector<std::string>& files, bool flip)
+: TextureCube(directory, files, flip), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURECUBE;
+    
+    LoadFromFile(directory, files);
+}
+
+/**
+ * @brief Create a cube texture from the input source files.
+ *
+ * @param directory Textures file path.
+ * @param files List of texture files.
+ * @param spec The texture specifications.
+ * @param flip Fip the texture vertically.
+ */
+SoftwareTextureCube::SoftwareTextureCube(const std::filesystem::path& directory,
+                                         const std::vector<std::string>& files,
+                                         const TextureSpecification& spec,
+                                         bool flip)
+: TextureCube(directory, files, spec, flip), SoftwareTexture()
+{
+    m_Spec.Type = TextureType::TEXTURECUBE;
+    
+    LoadFromFile(directory, files);
+}
+
+/**
+ * @brief Create the texels of the texture from the provided data.
+ *
+ * @param data The data to be placed on all the faces of the cube.
+ */
+void SoftwareTextureCube::CreateTexture(const void *data)
+{
+    std::vector<const void *> cube(6, data);
+    CreateTexture(cube);
+}
+
+/**
+ * @brief Create the texels of the texture from the provided data.
+ *
+ * @param data The data for the cube texture (defined for each face).
+ */
+void SoftwareTextureCube::CreateTexture(const std::vector<const void *> &data)
+{
+    PIXEL_CORE_ASSERT(data.size() == 6, "Invalid data for the texture cube map!");
+    PIXEL_CORE_ASSERT(m_Spec.Width > 0 && m_Spec.Height > 0, "2D texture size not properly defined!");
+    
+    // Each face is stored as a layer
+    SWCreate(m_Spec, 6);
+    for (uint32_t i = 0; i < data.size(); ++i)
+        SWUpload(data[i], i);
+    
+    m_IsLoaded = true;
+}
+
+} // namespace pixc